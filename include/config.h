@@ -12,18 +12,60 @@
 // --- Serial ---
 #define SERIAL_BAUD 115200
 
+// --- Scheduler ---
+// loop() runs jobs off a timer wheel and sleeps until the next one is due
+#define SCHED_POLL_MS           10      // Services with work in flight (a request, a scan, a prefetch, a stream)
+#define SCHED_IDLE_POLL_MS      50      // Idle services with no event to wake them (listening sockets)
+#define SCHED_BUSY_HOLD_MS      1000    // A socket stays on SCHED_POLL_MS this long after its last traffic
+#define SCHED_MAX_SLEEP_MS      1000    // loop() wakes at least this often
+
 // --- Display ---
 // Pin definitions come from platformio.ini build flags:
 // TFT_SCK, TFT_MOSI, TFT_DC, TFT_RST, TFT_BL, DISPLAY_WIDTH, DISPLAY_HEIGHT
-#define DISPLAY_UPDATE_MS       1000    // Clock refresh interval
+#define DISPLAY_TASK_CORE       0       // Render task core (Arduino loop() runs on core 1)
+#define DISPLAY_TASK_PRIORITY   2
+#define DISPLAY_TASK_STACK      6144
+#define DISPLAY_TASK_MAX_SLEEP_MS 1000  // Render task wakes at least this often
+#define DISPLAY_QUEUE_DEPTH     4       // Snapshots in flight between loop and render task (power of 2)
+#define DISPLAY_PUBLISH_MS      250     // How often loop() offers fresh state to the render task
+#define DISPLAY_TRANSITION      1       // Page change animation: 0 = cut, 1 = slide, 2 = fade
+#define DISPLAY_TRANSITION_MS   300     // Animation length
+#define DISPLAY_TRANSITION_FPS  60      // Target rate; pacing drops to 30/20/.. if the bus can't keep up
+#define DISPLAY_TILE_QUEUE      16      // Remote 16x16 tiles in flight to the render task (power of 2)
+#define DISPLAY_CAPTURE_WAIT_MS 1000    // Screenshot gives up if a render pass holds the frame this long
+#define DISPLAY_FONT_PATH       "/fonts/ui.vlw" // Smooth font on LittleFS for dates and labels (optional)
+#define DISPLAY_LAYOUT_DIR      "/layouts"  // clock.json / sysinfo.json here replace the built-in page layouts
+#define DISPLAY_ANALOG_STEP_MS  250     // Analog seconds hand step: 1000 = tick once a second, less = sweep
+#define DISPLAY_SPLASH_HOLD_MS  120000  // Boot splash stays up this long waiting for NTP, then "Waiting for NTP..."
+#define DISPLAY_GIF_MAX_FILES   16      // .gif files in PHOTO_DIR played by the animation page
+#define DISPLAY_GIF_LOOPS       3       // Loops of one file before the next (a single file loops forever)
+#define DISPLAY_GIF_MIN_DELAY_MS 20     // Shorter frame delays play at 100 ms, as in browsers
+#define DISPLAY_GIF_CATCHUP     8       // Late frames decoded without being shown, at most, per pass
 #define BRIGHTNESS_DEFAULT      25      // 0-100, low default (cheap panel blows out at high)
 #define BRIGHTNESS_DIM          5       // Dim mode brightness
 #define SCREEN_DIM_MS           60000   // Dim after 1 minute of no touch
 
+// --- Backlight ---
+// TFT_BL comes from platformio.ini. Levels are perceptual (CIE 1931), not linear duty.
+#define BACKLIGHT_PWM_FREQ      44100   // Well above audible and visible flicker
+#define BACKLIGHT_PWM_BITS      10      // 1024 duty steps, fine enough for the dark end of the curve
+#define BACKLIGHT_LEDC_CHANNEL  0
+#define BACKLIGHT_LEDC_TIMER    0
+#define BACKLIGHT_INVERT        1       // SmallTV Pro backlight is on when the pin is LOW
+#define BACKLIGHT_FADE_MS       400     // Level changes, wake
+#define BACKLIGHT_DIM_FADE_MS   1500    // Auto-dim and night window changes
+#define NIGHT_BRIGHTNESS_DEFAULT 5      // Night window level (0-100)
+#define NIGHT_START_DEFAULT     0       // Minute of day; start == end disables the night window
+#define NIGHT_END_DEFAULT       0
+#define BACKLIGHT_POLL_MS       20      // Start queued fades, follow the night window
+
 // --- Touch ---
 // TOUCH_PIN comes from platformio.ini (T9 = GPIO32)
 #define TOUCH_SAMPLES           8       // Readings averaged per poll
-#define TOUCH_BASELINE_SAMPLES  16      // Readings for initial calibration
+#define TOUCH_POLL_MS           10      // Sampling period during a gesture (gesture timings assume about this)
+#define TOUCH_IDLE_POLL_MS      100     // Untouched: baseline drift only, the touch interrupt wakes the job
+#define TOUCH_BASELINE_SAMPLES  16      // Readings for calibration (one per poll after a WiFi scan)
+#define TOUCH_SETTLE_MS         50      // ADC settle time after a WiFi scan before recalibrating
 #define TOUCH_DEBOUNCE_MS       50
 #define TOUCH_LONG_PRESS_MS     2000
 #define TOUCH_DOUBLE_TAP_MS     300
@@ -33,21 +75,59 @@
 #define WIFI_AP_SSID_PREFIX     "SmallTV-"
 #define WIFI_AP_PASSWORD        "smalltv123"
 #define WIFI_CONNECT_TIMEOUT_MS 30000
+#define WIFI_FAST_TIMEOUT_MS    5000    // Attempt at the cached BSSID/channel before the full path
+#define WIFI_FAST_LEASE_S       3600    // Reuse a cached DHCP lease for at most this long
 #define WIFI_RETRY_ATTEMPTS     3
-#define WIFI_RETRY_DELAY_MS     2000
-#define WIFI_MONITOR_INTERVAL   60000   // Check WiFi health every 60s
+#define WIFI_RETRY_DELAY_MS     2000    // First backoff, doubling per failed attempt
+#define WIFI_REFUSED_RETRY_MS   1000    // Re-issue a refused attempt within its window
+#define WIFI_QUICK_TIMEOUT_MS   10000   // Reconnect attempt after losing a working link
+#define WIFI_QUICK_ATTEMPTS     3       // Then fall back to AP
+#define WIFI_MONITOR_INTERVAL   60000   // Check WiFi health every 60s; also the gap between quick attempts
 #define WIFI_RECONNECT_INTERVAL 300000  // Retry saved creds every 5 min in AP mode
 #define WIFI_CAPTIVE_TIMEOUT_S  180     // Captive portal timeout
+#define WIFI_SCAN_CHANNELS      13      // Scanned one at a time, 1..N
+#define WIFI_SCAN_DWELL_MS      120     // Active scan time per channel
+#define WIFI_SCAN_GAP_MS        30      // Back on the home channel between channels
+#define WIFI_SCAN_CHANNEL_TIMEOUT_MS 1000   // Give up on a channel that never reports
 
 // --- Web Server ---
 #define WEB_SERVER_PORT         80
 #define DNS_PORT                53
 
+// --- Remote Display ---
+#define REMOTE_DISPLAY_PORT     7070    // UDP tile-delta framebuffer push
+#define REMOTE_DISPLAY_TIMEOUT_MS 10000 // Back to the pages after this long without packets
+#define REMOTE_PACKETS_PER_LOOP 8       // Bound the work done per loop() iteration
+
+// --- Screen Mirroring ---
+#define SCREEN_STREAM_FPS       10      // Max delta frames per second on /api/screen/stream
+#define SCREEN_STREAM_TILES_PER_LOOP 4  // Tiles encoded and sent per loop() iteration
+#define SCREEN_STREAM_WRITE_TIMEOUT_MS 200  // Drop a client whose socket stays full this long
+
+// --- Boot Splash ---
+#define SPLASH_PATH             "/splash.rle"   // Last clock frame, shown at boot
+#define SPLASH_FIRST_SAVE_MS    60000   // Clock page live this long before the first save
+#define SPLASH_SAVE_INTERVAL_MS 900000  // Then refresh every 15 minutes (flash wear)
+#define SPLASH_MAX_BYTES        32768   // Frames that encode larger are not saved
+#define SPLASH_POLL_MS          1000    // How often a save is considered
+
+// --- Photo Frame ---
+#define PHOTO_DIR               "/photos"   // JPEG/PNG files shown on the photo page
+#define PHOTO_MAX_FILES         32      // Indexed per scan; the rest are ignored
+#define PHOTO_NAME_MAX          31      // File name length, without the directory
+#define PHOTO_INTERVAL_MS       15000   // Each photo stays up this long
+#define PHOTO_READ_CHUNK        4096    // Prefetch bytes read per loop() iteration
+#define PHOTO_PREFETCH_MAX      32768   // Larger files are decoded straight from flash
+#define PHOTO_HEAP_RESERVE      24576   // Largest free block kept after a prefetch buffer
+#define PHOTO_UPLOAD_MAX        262144  // Largest accepted upload
+#define PHOTO_FS_RESERVE        65536   // Free LittleFS space an upload must leave
+
 // --- mDNS ---
 #define MDNS_HOSTNAME_PREFIX    "smalltv"   // becomes smalltv-XXXX.local
 
 // --- Weather ---
 #define WEATHER_FETCH_INTERVAL  900000  // 15 minutes (matches API update cadence)
+#define WEATHER_FIRST_FETCH_MS  10000   // After setup, so boot isn't held up by the HTTPS request
 #define WEATHER_API_BASE        "https://api.open-meteo.com/v1/forecast"
 #define WEATHER_TIMEOUT_MS      10000
 #define WEATHER_DEFAULT_LAT     0.0
@@ -60,7 +140,7 @@
 
 // --- Settings (NVS) ---
 #define NVS_NAMESPACE           "smalltv"
-#define SETTINGS_VERSION        2       // Increment when settings struct changes
+#define SETTINGS_VERSION        2       // Bump only when a stored key changes meaning (resets all settings)
 
 // --- Logger ---
 #define LOG_BUFFER_SIZE         30      // Number of log lines
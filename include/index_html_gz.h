@@ -1,691 +1,700 @@
 const unsigned char INDEX_HTML_GZ[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0xa1, 0xfe, 0x8b, 0x69, 0x02, 0x03, 0xbd, 0x3d,
-  0x6d, 0x7b, 0xdb, 0x36, 0x92, 0xdf, 0xfd, 0x2b, 0x50, 0xe5, 0xc9, 0x4a,
-  0x6a, 0x44, 0x99, 0x92, 0x25, 0x59, 0x96, 0x6c, 0xf7, 0x92, 0x34, 0xd9,
-  0xe4, 0xae, 0x49, 0xf3, 0xd4, 0x6e, 0xf7, 0xba, 0xdb, 0x5e, 0x1f, 0x5a,
-  0x84, 0x2c, 0xae, 0x25, 0x52, 0x47, 0x52, 0x76, 0x5c, 0xaf, 0xff, 0xfb,
-  0xcd, 0x0c, 0x5e, 0x08, 0x90, 0xa0, 0x24, 0xb7, 0xd9, 0x6b, 0x13, 0x5b,
-  0xc4, 0xcb, 0x60, 0x30, 0x6f, 0x98, 0x19, 0x0c, 0x95, 0xd3, 0xaf, 0xbe,
-  0xfd, 0xfe, 0xf5, 0xe5, 0xcf, 0x9f, 0xde, 0xb0, 0x45, 0xbe, 0x5a, 0x9e,
-  0x1f, 0x9c, 0xd2, 0xaf, 0xd3, 0x05, 0x0f, 0x42, 0x78, 0x58, 0xf1, 0x3c,
-  0x60, 0xb3, 0x45, 0x90, 0x66, 0x3c, 0x3f, 0x6b, 0x6c, 0xf2, 0xb9, 0x37,
-  0x6e, 0xa8, 0xe6, 0x38, 0x58, 0xf1, 0xb3, 0xc6, 0x6d, 0xc4, 0xef, 0xd6,
-  0x49, 0x9a, 0x37, 0xd8, 0x2c, 0x89, 0x73, 0x1e, 0xc3, 0xb0, 0xbb, 0x28,
-  0xcc, 0x17, 0x67, 0x21, 0xbf, 0x8d, 0x66, 0xdc, 0xa3, 0x87, 0x4e, 0x14,
-  0x47, 0x79, 0x14, 0x2c, 0xbd, 0x6c, 0x16, 0x2c, 0xf9, 0x59, 0x0f, 0x61,
-  0xe4, 0x51, 0xbe, 0xe4, 0xe7, 0x17, 0xab, 0x60, 0xb9, 0xbc, 0xfc, 0xe9,
-  0xf4, 0x50, 0x3c, 0x1e, 0x9c, 0x66, 0xf9, 0x3d, 0xfe, 0xfe, 0xfa, 0xe1,
-  0x2a, 0xf9, 0xec, 0x65, 0xd1, 0xef, 0x51, 0x7c, 0x3d, 0xb9, 0x4a, 0xd2,
-  0x90, 0xa7, 0x1e, 0xb4, 0x4c, 0x57, 0x41, 0x7a, 0x1d, 0xc5, 0x13, 0x7f,
-  0xba, 0x0e, 0xc2, 0x10, 0xfb, 0xfc, 0xc7, 0x83, 0x83, 0x49, 0x9a, 0x24,
-  0xf9, 0xc3, 0x01, 0x63, 0x9e, 0x77, 0x75, 0x3d, 0x79, 0x36, 0xef, 0xcf,
-  0x7b, 0x3c, 0x9c, 0xd2, 0x73, 0xb6, 0x49, 0xe7, 0xc1, 0x8c, 0x43, 0x63,
-  0x30, 0x3f, 0x99, 0x1f, 0x5b, 0x8d, 0xfd, 0xc9, 0x33, 0x3e, 0xe7, 0x21,
-  0x1f, 0x8b, 0x56, 0xb1, 0xca, 0x24, 0xbd, 0xbe, 0x0a, 0x5a, 0x27, 0x7e,
-  0x67, 0xec, 0x77, 0x46, 0xc3, 0x4e, 0xb7, 0xd7, 0x16, 0xbd, 0x39, 0xff,
-  0x9c, 0x4f, 0x9e, 0x1d, 0x05, 0x47, 0x83, 0xfe, 0xb8, 0x68, 0x01, 0x10,
-  0xc7, 0xe3, 0x63, 0x7f, 0x38, 0x2f, 0x9a, 0x8e, 0x26, 0xcf, 0x82, 0xe1,
-  0x49, 0x38, 0xe6, 0xa2, 0x29, 0x98, 0xcd, 0x80, 0x28, 0x30, 0x8c, 0x9f,
-  0x0c, 0x46, 0x7d, 0xb3, 0xcd, 0x5b, 0x24, 0xb7, 0xb0, 0xde, 0xb3, 0x11,
-  0x1f, 0x1f, 0x0d, 0x07, 0x56, 0x4f, 0x18, 0xad, 0x04, 0x1e, 0xbd, 0xfe,
-  0xa8, 0xd3, 0x1b, 0x8c, 0x3b, 0x27, 0xe3, 0x02, 0x93, 0x62, 0x4c, 0xdf,
-  0x31, 0x68, 0x2c, 0x47, 0x85, 0x41, 0x7c, 0x8d, 0xd0, 0xaf, 0xe6, 0xc3,
-  0xf9, 0x70, 0x68, 0xb6, 0x19, 0xd0, 0x4f, 0x7a, 0x9d, 0x93, 0x61, 0x67,
-  0x0c, 0xdb, 0xf4, 0xd5, 0xbc, 0x34, 0x08, 0xa3, 0x4d, 0x36, 0xe9, 0x8d,
-  0xd6, 0x9f, 0xcd, 0x06, 0x2f, 0x5b, 0x4d, 0x7a, 0x3d, 0xd5, 0x96, 0x2d,
-  0x82, 0x30, 0xb9, 0x9b, 0xf8, 0x0c, 0x5a, 0xd8, 0x11, 0xfc, 0x15, 0xe0,
-  0x7c, 0xbf, 0x03, 0x84, 0x3b, 0xf6, 0x01, 0xdc, 0xa8, 0xdd, 0x61, 0x3e,
-  0x1b, 0x40, 0x57, 0xaf, 0xef, 0xea, 0x1f, 0xb4, 0x4d, 0x48, 0x92, 0x14,
-  0x3e, 0xc3, 0xb1, 0x63, 0xc7, 0xf8, 0x1e, 0x81, 0x03, 0x9c, 0x58, 0xdf,
-  0x77, 0x2f, 0x37, 0x3d, 0x00, 0x41, 0xb8, 0x4a, 0xc2, 0x7b, 0x94, 0x83,
-  0x39, 0x88, 0xa2, 0x37, 0x0f, 0x56, 0xd1, 0xf2, 0x7e, 0xe2, 0x05, 0xeb,
-  0xf5, 0x92, 0x7b, 0xd9, 0x7d, 0x96, 0xf3, 0x55, 0xe7, 0xd5, 0x32, 0x8a,
-  0x6f, 0x3e, 0x04, 0xb3, 0x0b, 0x7a, 0x7c, 0x0b, 0xe3, 0x3a, 0xcd, 0x0b,
-  0x7e, 0x9d, 0x70, 0xf6, 0xe3, 0xfb, 0x66, 0x47, 0x0c, 0xf2, 0x36, 0x51,
-  0x27, 0x0b, 0x62, 0xd8, 0x33, 0x4f, 0x23, 0xe2, 0xec, 0x55, 0x30, 0xbb,
-  0xb9, 0x4e, 0x93, 0x4d, 0x1c, 0x4e, 0x6e, 0x83, 0xb4, 0x85, 0x62, 0x46,
-  0xf8, 0xcf, 0x92, 0x65, 0x92, 0xca, 0x26, 0xe4, 0x3d, 0x35, 0xae, 0x82,
-  0xcf, 0x42, 0xea, 0x27, 0x83, 0x91, 0x2f, 0x28, 0xa6, 0xa4, 0x96, 0x05,
-  0x9b, 0x3c, 0xc1, 0x06, 0x2d, 0xbd, 0xb0, 0xab, 0xa3, 0xbe, 0x18, 0x44,
-  0x48, 0x83, 0xc4, 0x73, 0x4d, 0x7c, 0xc0, 0x95, 0x7b, 0x0b, 0x1e, 0x5d,
-  0x2f, 0xf2, 0x49, 0xaf, 0x4b, 0x4c, 0x5c, 0x45, 0xb1, 0x6e, 0xf1, 0xfd,
-  0xdb, 0x05, 0x51, 0xf1, 0x8e, 0x5f, 0xdd, 0x44, 0xb0, 0x61, 0x02, 0xb0,
-  0x02, 0x5d, 0x58, 0x20, 0xec, 0x20, 0x46, 0x95, 0x8b, 0x82, 0x0c, 0x75,
-  0x01, 0x88, 0x73, 0xf8, 0x35, 0xd0, 0xdb, 0xf3, 0xd8, 0x65, 0xb2, 0x86,
-  0x0d, 0xa5, 0xac, 0x85, 0x3a, 0xce, 0x53, 0xf6, 0x82, 0xe5, 0xc1, 0x55,
-  0xd6, 0x16, 0x9d, 0x5f, 0x1f, 0x1e, 0x74, 0xf3, 0x64, 0xed, 0xc1, 0x00,
-  0x24, 0x64, 0x18, 0x65, 0xeb, 0x65, 0x70, 0x3f, 0x99, 0x2f, 0x39, 0x61,
-  0x04, 0xf0, 0xae, 0x63, 0x2f, 0x02, 0x22, 0x65, 0x13, 0x94, 0x42, 0x9e,
-  0x9a, 0xbb, 0x21, 0xde, 0xd0, 0x0f, 0x9f, 0x9a, 0x93, 0x0c, 0xb4, 0x3e,
-  0x89, 0x27, 0x59, 0x1e, 0xcd, 0x6e, 0xee, 0xb1, 0x09, 0x40, 0x4f, 0xfc,
-  0x6d, 0x14, 0xfd, 0xdd, 0x8b, 0xe2, 0x90, 0x7f, 0x9e, 0x0c, 0xc5, 0x28,
-  0xa5, 0xf8, 0x79, 0x9e, 0x80, 0xfc, 0x01, 0xe0, 0x2c, 0x59, 0x46, 0x21,
-  0x93, 0x53, 0xa8, 0x97, 0x38, 0x4f, 0x38, 0x2f, 0xf9, 0x3c, 0xdf, 0x1f,
-  0xe9, 0xeb, 0x60, 0x3d, 0x19, 0x9b, 0xec, 0xf1, 0x52, 0x22, 0xab, 0x60,
-  0x91, 0x01, 0x92, 0x2d, 0x7a, 0x0f, 0x36, 0x7b, 0xba, 0x7d, 0xbe, 0xd2,
-  0x1c, 0xbb, 0x13, 0xdc, 0x18, 0xfb, 0x7e, 0xad, 0x44, 0x2c, 0x79, 0x0e,
-  0x8b, 0x7a, 0xd9, 0x3a, 0x98, 0x21, 0x99, 0xbc, 0x2e, 0x71, 0xdc, 0x5c,
-  0xa2, 0x1b, 0x0a, 0x03, 0x26, 0xe4, 0x06, 0xd1, 0x92, 0x4c, 0x96, 0x18,
-  0x4a, 0x42, 0x48, 0xe5, 0x1c, 0xfa, 0xcf, 0x9d, 0x34, 0x24, 0xf3, 0x43,
-  0x2b, 0xe2, 0xd6, 0x41, 0xb7, 0x52, 0x10, 0x76, 0x41, 0xef, 0x3c, 0x05,
-  0x81, 0x16, 0xdc, 0x28, 0xa6, 0xb1, 0xee, 0x51, 0x56, 0xc5, 0xa3, 0x9b,
-  0xc4, 0x28, 0x78, 0x0f, 0xae, 0x15, 0x84, 0xed, 0x69, 0x0b, 0x94, 0x3e,
-  0x17, 0x76, 0x80, 0xe4, 0x18, 0xd8, 0x63, 0x8e, 0x42, 0x3b, 0x43, 0x23,
-  0x83, 0x38, 0x5a, 0x05, 0xb4, 0xf4, 0x7a, 0xb3, 0xcc, 0x38, 0xeb, 0x77,
-  0x87, 0x19, 0xe3, 0x20, 0x97, 0xc0, 0x6b, 0x2f, 0xd9, 0xe4, 0x2c, 0x8a,
-  0xe7, 0x78, 0x40, 0x70, 0xc4, 0xe5, 0x3f, 0x6e, 0xf8, 0xfd, 0x3c, 0x85,
-  0xa3, 0x25, 0x63, 0x34, 0x1a, 0xd1, 0xf0, 0x9f, 0x77, 0x40, 0xd8, 0x9f,
-  0x3f, 0xec, 0xb7, 0xe4, 0x23, 0xcc, 0x18, 0xba, 0x46, 0x8f, 0xdc, 0xa3,
-  0x71, 0xff, 0xc1, 0x55, 0x9d, 0xc4, 0xa3, 0x98, 0x68, 0x76, 0xe1, 0xb0,
-  0x3c, 0x7e, 0x30, 0x44, 0x9e, 0xac, 0x5b, 0x6f, 0x20, 0x7f, 0x94, 0xb8,
-  0x12, 0x27, 0x31, 0x2f, 0xb8, 0xa7, 0x1f, 0xcb, 0x32, 0x22, 0x59, 0xa6,
-  0xe5, 0xab, 0x3b, 0x1e, 0x56, 0xe5, 0xeb, 0x58, 0xc8, 0x57, 0x49, 0x94,
-  0xba, 0x47, 0x62, 0xd1, 0xd9, 0x26, 0xcd, 0x00, 0xe6, 0x3a, 0x89, 0xb4,
-  0x4e, 0x2a, 0xe5, 0x4b, 0xf9, 0x12, 0x88, 0x7f, 0xcb, 0x4b, 0x52, 0x40,
-  0x48, 0xb0, 0x6e, 0x3f, 0xa3, 0x76, 0xc0, 0xc2, 0xa3, 0xce, 0x79, 0x92,
-  0xae, 0x26, 0x9b, 0xf5, 0x9a, 0xa7, 0x33, 0x60, 0x90, 0xb9, 0xeb, 0x09,
-  0xd9, 0xe8, 0x87, 0x32, 0xf2, 0xfd, 0x76, 0x31, 0xa4, 0x1b, 0xcc, 0x70,
-  0x25, 0x6b, 0x8c, 0x94, 0x98, 0xca, 0xa0, 0xc9, 0x24, 0x98, 0x03, 0xaa,
-  0x0f, 0x44, 0x0f, 0x72, 0x1c, 0x26, 0xcd, 0xa6, 0x85, 0x38, 0x18, 0xa5,
-  0x64, 0xb9, 0xc9, 0x25, 0x05, 0xc9, 0x02, 0xf8, 0x53, 0x94, 0x52, 0xb0,
-  0x7c, 0xcf, 0xa7, 0xa9, 0xb4, 0x81, 0xa4, 0x09, 0x52, 0x59, 0xfa, 0x15,
-  0x0e, 0x38, 0xa4, 0xd6, 0x54, 0x24, 0x64, 0x1e, 0xfe, 0xf5, 0xd1, 0x60,
-  0x19, 0x26, 0xf2, 0xb5, 0xc0, 0xc8, 0x30, 0x89, 0x80, 0xbb, 0x44, 0xd3,
-  0x14, 0x12, 0xc5, 0x51, 0x6d, 0x00, 0x07, 0x96, 0x01, 0x44, 0x19, 0x9a,
-  0xf4, 0x6c, 0x15, 0x98, 0x83, 0xcd, 0x7d, 0x1f, 0x03, 0xe1, 0xa5, 0x0e,
-  0x68, 0x12, 0x4b, 0xf0, 0x8a, 0x86, 0x6a, 0x89, 0xab, 0x65, 0x32, 0xbb,
-  0xb1, 0xd4, 0x42, 0x40, 0x78, 0x98, 0xa7, 0xc9, 0xea, 0x21, 0x41, 0x39,
-  0xc8, 0xef, 0x81, 0x30, 0x05, 0xf7, 0xe8, 0x13, 0xf0, 0x9c, 0xff, 0xdc,
-  0x02, 0x89, 0x6f, 0x3f, 0xe6, 0x89, 0x1e, 0xd6, 0x73, 0x0f, 0xf3, 0xdb,
-  0x8f, 0xc6, 0xe6, 0x2f, 0xf8, 0x0c, 0x31, 0x65, 0xad, 0x59, 0x90, 0x86,
-  0xe6, 0xb9, 0x90, 0x89, 0x0e, 0xa7, 0x61, 0x90, 0x2e, 0x95, 0x83, 0xc6,
-  0xa2, 0x5f, 0x3c, 0xb4, 0xcb, 0xa7, 0x85, 0x61, 0x7d, 0x95, 0x91, 0x57,
-  0x6a, 0x54, 0x68, 0xaf, 0x5c, 0x81, 0x1e, 0x8c, 0x05, 0xb6, 0x9e, 0x07,
-  0x12, 0xd7, 0xc9, 0x32, 0xc8, 0x72, 0x6f, 0xb6, 0x88, 0x96, 0xe1, 0x83,
-  0xbd, 0x8e, 0x5f, 0x0c, 0xf2, 0xc8, 0xf7, 0xb4, 0x6d, 0x7c, 0xf7, 0x58,
-  0xea, 0xa0, 0x5b, 0x59, 0xeb, 0x15, 0xa6, 0xa2, 0xa2, 0xbd, 0xee, 0xc8,
-  0x38, 0xdf, 0x6d, 0x6d, 0x2e, 0x6d, 0x7d, 0x24, 0xec, 0x4c, 0xc1, 0x89,
-  0x3c, 0xc8, 0x37, 0x19, 0x4b, 0x93, 0xbb, 0xcc, 0xe0, 0x02, 0x35, 0x7a,
-  0xd0, 0xe8, 0x32, 0x57, 0xff, 0xdc, 0xc0, 0x61, 0x3b, 0xbf, 0x57, 0xd2,
-  0x34, 0x41, 0x2c, 0xb8, 0x77, 0xc5, 0xf3, 0x3b, 0xce, 0xe3, 0xdd, 0x27,
-  0x78, 0x4f, 0xcb, 0xee, 0xfe, 0x47, 0x6f, 0x81, 0x90, 0x49, 0x6d, 0x7b,
-  0x3e, 0x2a, 0x4a, 0x31, 0x74, 0x19, 0x5c, 0xf1, 0xa5, 0xc3, 0x92, 0x4c,
-  0x0d, 0xfa, 0x9f, 0x00, 0xfd, 0x8b, 0x19, 0xb7, 0xc1, 0x72, 0xc3, 0x1f,
-  0xaa, 0x87, 0x6b, 0x69, 0xc2, 0xd4, 0xa4, 0xf1, 0xc8, 0x47, 0x1e, 0x5f,
-  0x05, 0xe1, 0x35, 0x37, 0x29, 0x15, 0xd1, 0xe9, 0xe6, 0x91, 0x5e, 0x6d,
-  0xb1, 0x16, 0xfa, 0xf4, 0x72, 0x18, 0x33, 0x93, 0x62, 0x78, 0x04, 0xf5,
-  0x7c, 0xd7, 0x29, 0xad, 0xe4, 0xdb, 0x14, 0xaa, 0x71, 0xd5, 0xb0, 0x8f,
-  0x7c, 0xdb, 0xf6, 0xbc, 0x8f, 0xd7, 0x9b, 0xbc, 0xe0, 0xb7, 0xa0, 0x95,
-  0x81, 0xbf, 0x46, 0xdc, 0x3c, 0x30, 0xc6, 0x6e, 0x61, 0xed, 0xb7, 0xab,
-  0x52, 0xe6, 0x90, 0xc6, 0x91, 0xfb, 0x6c, 0x91, 0xc7, 0x5e, 0x84, 0x08,
-  0xfd, 0x23, 0xbf, 0x5f, 0xf3, 0x33, 0x84, 0xf9, 0x6b, 0xc7, 0x68, 0x58,
-  0x07, 0x59, 0x76, 0x07, 0xbb, 0xb6, 0x1a, 0xe3, 0xcd, 0xea, 0x8a, 0xa7,
-  0xbf, 0x76, 0x32, 0xbe, 0x04, 0x05, 0x2b, 0xdc, 0x1a, 0x3c, 0xc3, 0x2d,
-  0x61, 0xeb, 0xb9, 0x8f, 0xcd, 0x67, 0x10, 0xb2, 0x0c, 0xe6, 0xbd, 0x7d,
-  0x34, 0x7d, 0x9b, 0xb1, 0x01, 0x57, 0xb8, 0xde, 0x49, 0x37, 0x05, 0xc7,
-  0xe0, 0x89, 0x8c, 0x19, 0xa2, 0x78, 0x01, 0xae, 0x7f, 0xee, 0x50, 0x51,
-  0x79, 0xc4, 0x98, 0xee, 0x94, 0x40, 0x40, 0x9f, 0xa7, 0x9d, 0xc2, 0x72,
-  0xa9, 0xe3, 0x15, 0x7c, 0x1c, 0x94, 0x39, 0x7d, 0x5c, 0x40, 0x44, 0xc2,
-  0x03, 0x80, 0x30, 0x2b, 0x9a, 0x94, 0x0f, 0x5f, 0xe9, 0x7a, 0x3c, 0x28,
-  0xc8, 0x58, 0xd0, 0xc8, 0x83, 0xe3, 0xe4, 0x9a, 0x4f, 0x36, 0xe9, 0xb2,
-  0xd5, 0x08, 0x83, 0x3c, 0x98, 0xd0, 0xf3, 0x61, 0x76, 0x7b, 0xfd, 0xe2,
-  0xf3, 0x6a, 0xd9, 0x79, 0x7e, 0xf4, 0x1a, 0x3e, 0x32, 0xf8, 0x18, 0x67,
-  0x67, 0xcd, 0x45, 0x9e, 0xaf, 0x27, 0x87, 0x87, 0x77, 0x77, 0x77, 0xdd,
-  0xbb, 0xa3, 0x6e, 0x92, 0x5e, 0x1f, 0xf6, 0x7d, 0xdf, 0xc7, 0xc1, 0x4d,
-  0xc1, 0x99, 0xb3, 0x66, 0xaf, 0xdf, 0x94, 0x87, 0xe8, 0x59, 0xf3, 0xb8,
-  0xf9, 0xfc, 0xe8, 0x0d, 0x40, 0x58, 0x07, 0xf9, 0x82, 0x85, 0x67, 0xcd,
-  0x0f, 0x3d, 0xd6, 0x5b, 0x0e, 0x19, 0xfc, 0xef, 0x0d, 0x9b, 0x2c, 0xcb,
-  0xd3, 0xe4, 0x86, 0x9f, 0x35, 0x9f, 0xf7, 0x8f, 0xc6, 0x83, 0xe3, 0x60,
-  0x14, 0xaa, 0x26, 0x4f, 0x81, 0xea, 0xc2, 0xa8, 0x79, 0xb4, 0x5c, 0x9e,
-  0x35, 0x71, 0x07, 0xba, 0x1b, 0x29, 0x30, 0x0b, 0xd6, 0x67, 0x4d, 0xda,
-  0x80, 0xd5, 0xfc, 0x4f, 0x70, 0x5b, 0x54, 0xfb, 0xa1, 0x58, 0x1c, 0xb1,
-  0x83, 0x4f, 0x8d, 0xb6, 0x2d, 0x1b, 0x5e, 0xca, 0x81, 0x3e, 0x39, 0xd0,
-  0x46, 0x7e, 0x2a, 0x75, 0x17, 0x5e, 0x0f, 0xee, 0x45, 0x38, 0x66, 0x85,
-  0x95, 0x33, 0x06, 0x9a, 0x42, 0xa1, 0xd2, 0x01, 0xa6, 0x5e, 0xcb, 0x60,
-  0xe0, 0x68, 0xe4, 0xf6, 0xaf, 0xa4, 0x56, 0x4c, 0xe6, 0xc9, 0x6c, 0x93,
-  0x49, 0x41, 0x17, 0x0f, 0x0f, 0x85, 0x4c, 0xd6, 0x58, 0x8e, 0x7d, 0x1d,
-  0x67, 0xb5, 0xc6, 0x04, 0xd4, 0x7e, 0xc6, 0x17, 0xc9, 0x32, 0x74, 0xb8,
-  0x5f, 0x47, 0x6d, 0xc3, 0x74, 0xfc, 0x80, 0xf1, 0x3d, 0xcb, 0x40, 0x4f,
-  0x20, 0xac, 0x53, 0x06, 0xc4, 0x50, 0xcc, 0x14, 0xfb, 0x7f, 0x7d, 0xd8,
-  0x26, 0x6e, 0x65, 0x5d, 0x95, 0x91, 0xeb, 0x88, 0x9c, 0xa4, 0xaa, 0xaa,
-  0x92, 0x1e, 0xac, 0x83, 0x14, 0xb0, 0xae, 0x0a, 0xfa, 0x63, 0x75, 0xed,
-  0xc9, 0x44, 0xad, 0x2c, 0xb0, 0xf4, 0xd2, 0x4d, 0x1c, 0x07, 0x57, 0x10,
-  0x9f, 0x03, 0xa4, 0xd9, 0xcd, 0x43, 0xe1, 0xcb, 0x8d, 0x6a, 0x7c, 0x39,
-  0x8b, 0x59, 0xb6, 0xf2, 0x1f, 0x99, 0x56, 0x78, 0xdb, 0x91, 0xb5, 0x1b,
-  0xad, 0x7c, 0x01, 0x36, 0x6c, 0x2f, 0x42, 0xf5, 0xfb, 0x45, 0xb0, 0xd6,
-  0xef, 0x3f, 0x25, 0x5a, 0x33, 0x44, 0x42, 0x1a, 0x19, 0x8c, 0x8e, 0xbd,
-  0x93, 0x3a, 0x8f, 0xde, 0x92, 0x1b, 0xdc, 0xdd, 0x40, 0x65, 0x42, 0xfc,
-  0x0e, 0xfe, 0xdf, 0xed, 0x0d, 0xdb, 0x25, 0xdb, 0xa4, 0x3d, 0x14, 0x06,
-  0x9d, 0xb6, 0x65, 0x82, 0x67, 0x83, 0x58, 0x7d, 0x4d, 0xac, 0x67, 0xf3,
-  0xf9, 0xfc, 0x09, 0x34, 0x92, 0x51, 0x81, 0x5a, 0x96, 0xbc, 0x21, 0x4a,
-  0xf2, 0xb5, 0x7a, 0xdd, 0x5e, 0xbf, 0x2a, 0xef, 0x76, 0x82, 0xc7, 0x48,
-  0x5c, 0x1d, 0xd5, 0x70, 0x46, 0x45, 0x0b, 0x4e, 0x06, 0x55, 0xd7, 0xf4,
-  0x87, 0x18, 0x6a, 0xd0, 0xdc, 0x3a, 0x17, 0xa9, 0x3e, 0x1d, 0x20, 0xce,
-  0x22, 0x73, 0x3e, 0xab, 0x6a, 0x8f, 0x70, 0xea, 0xf5, 0x20, 0xf0, 0x4c,
-  0x1e, 0xf6, 0x8e, 0xde, 0xdc, 0xf9, 0x22, 0xe0, 0xbc, 0x90, 0xa5, 0x23,
-  0x19, 0xed, 0x93, 0x77, 0x49, 0x68, 0x0a, 0x3b, 0xa6, 0xa1, 0xc1, 0xcc,
-  0x28, 0x80, 0xdf, 0x70, 0xc2, 0xc2, 0xf9, 0x34, 0x9b, 0x40, 0xdc, 0xb0,
-  0x59, 0x06, 0x29, 0x3e, 0x67, 0x96, 0x13, 0xf1, 0x6a, 0x03, 0xc7, 0x55,
-  0x5c, 0x78, 0x11, 0x57, 0xf4, 0xfc, 0x50, 0x3e, 0x7c, 0xfb, 0x96, 0xe3,
-  0x52, 0x8a, 0x57, 0xb7, 0x9e, 0xa9, 0x15, 0xe9, 0x74, 0x78, 0x23, 0x35,
-  0x27, 0xaa, 0xc3, 0xf3, 0x30, 0x44, 0x36, 0x58, 0x2e, 0x49, 0x38, 0x65,
-  0x70, 0x64, 0x65, 0xbc, 0x06, 0x92, 0x3f, 0x62, 0x37, 0x52, 0x34, 0x2a,
-  0x42, 0xd0, 0x3d, 0x39, 0x46, 0x19, 0x90, 0x81, 0xfa, 0x36, 0xb5, 0x13,
-  0xec, 0x10, 0x12, 0xef, 0x90, 0xd3, 0x91, 0x4b, 0x4e, 0xfb, 0xc2, 0xe9,
-  0x2d, 0x02, 0xe2, 0x2d, 0x2e, 0x24, 0x0d, 0xa8, 0xea, 0x80, 0x72, 0x19,
-  0x1d, 0xc0, 0xc7, 0x1a, 0xba, 0x07, 0xc1, 0xc9, 0xc3, 0x4e, 0x03, 0xe8,
-  0x76, 0xf8, 0xf6, 0x88, 0x8f, 0xe4, 0x0a, 0x72, 0x0f, 0xa6, 0xf3, 0x15,
-  0xce, 0xc3, 0x59, 0x38, 0x9a, 0x56, 0x44, 0x55, 0x4e, 0xba, 0x0b, 0x52,
-  0x37, 0x5d, 0x8b, 0xe4, 0x72, 0x05, 0x33, 0xd1, 0xe5, 0x46, 0xad, 0x9c,
-  0x88, 0x26, 0x23, 0x66, 0xac, 0x55, 0xc5, 0xb0, 0x32, 0x63, 0xa0, 0x70,
-  0x23, 0xd7, 0xf8, 0xc1, 0x38, 0xc0, 0x0c, 0xbb, 0x0a, 0xa2, 0x63, 0xe5,
-  0x40, 0xaf, 0xaf, 0x97, 0x9c, 0xb5, 0xde, 0x1e, 0xbe, 0xb6, 0x12, 0x9f,
-  0xd8, 0xfa, 0x60, 0x19, 0x0c, 0xb4, 0x0b, 0xfe, 0xb4, 0xea, 0x05, 0x3e,
-  0xaa, 0xe1, 0xac, 0xd0, 0xad, 0x22, 0xde, 0x57, 0x5a, 0x76, 0xb2, 0xdf,
-  0x91, 0xf4, 0x54, 0x36, 0x1f, 0xb5, 0xcb, 0x9a, 0xe1, 0x57, 0xfc, 0x52,
-  0x52, 0x24, 0xe1, 0x7f, 0x9a, 0x1a, 0x37, 0xf4, 0xfd, 0x92, 0x40, 0xaa,
-  0xc3, 0xda, 0xde, 0xcf, 0x64, 0x1e, 0xa5, 0xe5, 0x60, 0xae, 0xc6, 0x20,
-  0x90, 0x13, 0x53, 0x6e, 0xac, 0xc0, 0xab, 0xc6, 0x86, 0x12, 0x5c, 0x75,
-  0x6e, 0xb5, 0xc1, 0x9f, 0xca, 0x39, 0x94, 0xff, 0x91, 0xd1, 0xa4, 0x0d,
-  0xbf, 0x2e, 0x3d, 0x65, 0xa4, 0x3c, 0x9c, 0xf3, 0x2a, 0x56, 0xc4, 0x35,
-  0x4a, 0x65, 0x65, 0x9e, 0x68, 0x50, 0xb6, 0xb9, 0x81, 0x8e, 0xe3, 0xc1,
-  0x60, 0x4a, 0x14, 0x67, 0x3c, 0x67, 0xe2, 0x9c, 0xef, 0x97, 0xcf, 0xf9,
-  0xb6, 0x9d, 0x25, 0xb8, 0x8b, 0xf2, 0xd9, 0x82, 0x49, 0x7c, 0x8b, 0x3c,
-  0x01, 0x35, 0x3f, 0xed, 0x10, 0xdc, 0x99, 0x3d, 0x50, 0x72, 0x3d, 0x16,
-  0x69, 0x82, 0x47, 0x73, 0x19, 0xa6, 0x3e, 0xeb, 0x90, 0xd5, 0x0c, 0xb2,
-  0xfa, 0xee, 0x08, 0xb5, 0xed, 0x94, 0x4f, 0x0d, 0xf7, 0xa1, 0x2e, 0x93,
-  0xa9, 0x2e, 0x58, 0x84, 0xd8, 0x2b, 0xff, 0x4b, 0x9e, 0x9f, 0xa5, 0xec,
-  0xb7, 0x86, 0x26, 0x4e, 0x73, 0x23, 0x69, 0x26, 0xa0, 0xf8, 0xca, 0x7f,
-  0xf3, 0x8b, 0xfd, 0x68, 0x77, 0xd4, 0x99, 0x8e, 0x24, 0xee, 0xd4, 0x5c,
-  0x64, 0x38, 0x1c, 0xd4, 0xfd, 0xe3, 0x57, 0x15, 0x0d, 0x57, 0xcf, 0xd7,
-  0x9a, 0x04, 0x3e, 0xc5, 0x9b, 0x76, 0x00, 0x6a, 0xb2, 0x85, 0xb6, 0xf1,
-  0xb4, 0x54, 0x2b, 0x1a, 0x4b, 0xf4, 0xa4, 0x49, 0xd3, 0xa4, 0x4b, 0x2d,
-  0x5d, 0x5d, 0xdf, 0x70, 0x75, 0x7d, 0x47, 0xd8, 0x6e, 0x89, 0xbd, 0xed,
-  0xfd, 0xba, 0x9d, 0x52, 0x67, 0xb4, 0x5c, 0xf1, 0x73, 0x8f, 0xca, 0xf2,
-  0x2f, 0xcf, 0x60, 0x93, 0xa9, 0x93, 0xd9, 0x82, 0xcf, 0x6e, 0x78, 0xf8,
-  0xa2, 0xc2, 0xc0, 0x3d, 0xb2, 0xc1, 0x4e, 0x0d, 0xdd, 0x6b, 0x01, 0x83,
-  0xb4, 0x8e, 0xcc, 0xea, 0x7f, 0xb7, 0x7a, 0x20, 0x91, 0xed, 0x5a, 0x3a,
-  0xed, 0xda, 0xe7, 0xd0, 0x56, 0xf4, 0xbf, 0x45, 0x6f, 0x23, 0x16, 0x83,
-  0x32, 0x26, 0xe9, 0x8d, 0x91, 0x10, 0x84, 0x16, 0x88, 0xa2, 0xb3, 0x5c,
-  0x26, 0x38, 0x65, 0x0e, 0xef, 0x91, 0x3a, 0x9c, 0x57, 0x15, 0xd6, 0x8d,
-  0x24, 0x5d, 0x8b, 0xec, 0xe7, 0xf4, 0xed, 0x38, 0xa3, 0x2a, 0x22, 0xfb,
-  0x85, 0x72, 0x93, 0xdb, 0x9c, 0xc3, 0x4a, 0xf8, 0x62, 0x05, 0xa4, 0x82,
-  0x06, 0x4e, 0x3f, 0xed, 0x19, 0xef, 0x83, 0xa3, 0x13, 0x4c, 0xdd, 0x8c,
-  0xfb, 0xb9, 0xe5, 0xf5, 0x14, 0xe3, 0xea, 0xbd, 0x42, 0xe3, 0xfe, 0x59,
-  0xfa, 0x6d, 0xb0, 0x5a, 0x57, 0x24, 0x03, 0x78, 0xb8, 0x47, 0x22, 0x60,
-  0x6b, 0xe6, 0x51, 0x80, 0xf3, 0xb0, 0xca, 0xe2, 0x61, 0x5b, 0x9a, 0x73,
-  0xe8, 0xfb, 0xc6, 0x50, 0xd6, 0x25, 0x1f, 0x48, 0xfa, 0x2b, 0xa4, 0xc3,
-  0x43, 0xe0, 0xaf, 0x32, 0x79, 0xdd, 0xc1, 0x14, 0x68, 0x91, 0x47, 0xe0,
-  0x28, 0xcb, 0x00, 0x03, 0x37, 0x3a, 0x75, 0xe5, 0x46, 0x31, 0xc2, 0xc9,
-  0xb2, 0xc8, 0x91, 0x71, 0x98, 0x96, 0x83, 0x1d, 0xd3, 0xd1, 0x5f, 0x25,
-  0x71, 0x42, 0x8c, 0x9d, 0xde, 0x2d, 0x80, 0x93, 0x94, 0x4d, 0xc4, 0x98,
-  0xf9, 0x2e, 0x0d, 0xd6, 0x94, 0x8e, 0x4d, 0xb3, 0x87, 0x72, 0x86, 0x7c,
-  0xad, 0xea, 0x3a, 0x64, 0xd6, 0x05, 0x65, 0xd4, 0x4e, 0xd0, 0x81, 0x16,
-  0x68, 0xc2, 0x7a, 0x65, 0xb9, 0x1e, 0x6c, 0xbd, 0xf6, 0xa1, 0x42, 0x89,
-  0x6d, 0xc6, 0xd8, 0x3d, 0x6c, 0x9b, 0x22, 0xb8, 0x73, 0x82, 0x4f, 0xbc,
-  0x76, 0x7e, 0xb4, 0x77, 0x24, 0x4f, 0x4d, 0x33, 0x59, 0x8c, 0x47, 0xa6,
-  0x4b, 0x74, 0xca, 0x9e, 0x43, 0xed, 0x65, 0x44, 0x39, 0xa1, 0x3b, 0x26,
-  0xb7, 0xd5, 0x5a, 0x75, 0xa7, 0x78, 0x61, 0x84, 0xe6, 0x8a, 0x05, 0x56,
-  0x41, 0xbc, 0x01, 0x21, 0xc2, 0x72, 0x8a, 0x72, 0xfc, 0x5b, 0x3d, 0xe9,
-  0x4d, 0x17, 0xa9, 0x7a, 0xb2, 0x21, 0xfa, 0x21, 0x9f, 0x25, 0xa9, 0xb8,
-  0x21, 0x53, 0x51, 0x68, 0x5d, 0xc2, 0xbe, 0x44, 0x7d, 0xbf, 0x9a, 0xcf,
-  0x96, 0x3e, 0xae, 0x16, 0xfa, 0x71, 0xc9, 0x8c, 0xc8, 0x0e, 0x99, 0x04,
-  0xb1, 0x37, 0x23, 0xad, 0x85, 0xbe, 0x31, 0x33, 0xec, 0xef, 0x47, 0xca,
-  0x29, 0xae, 0x92, 0x90, 0xb3, 0x3c, 0x02, 0x55, 0x5b, 0x47, 0x70, 0x20,
-  0xa4, 0x86, 0x25, 0xc6, 0xd6, 0x3a, 0x87, 0x8b, 0xf2, 0x0b, 0x7d, 0xe7,
-  0x8d, 0x97, 0xbe, 0x5e, 0x96, 0xd3, 0x99, 0xf8, 0x04, 0x04, 0x2c, 0x92,
-  0x0d, 0xba, 0x4f, 0x88, 0x89, 0x0d, 0xa1, 0x1c, 0xdb, 0x80, 0xa7, 0xad,
-  0x91, 0x7a, 0xb6, 0xca, 0xae, 0x2d, 0x3f, 0x66, 0x1e, 0x7d, 0x16, 0xc5,
-  0x51, 0x72, 0xb2, 0x3a, 0xc9, 0x85, 0xad, 0x30, 0x4e, 0xeb, 0xf2, 0x59,
-  0xe6, 0x41, 0x67, 0xbb, 0xf0, 0x06, 0xc0, 0x84, 0xcc, 0xd0, 0x06, 0x3e,
-  0x67, 0x1e, 0xc3, 0xf0, 0xa3, 0x5c, 0xfb, 0xa2, 0xe0, 0xda, 0xc7, 0xcf,
-  0xde, 0x87, 0x4d, 0xf9, 0x8a, 0xb5, 0x2e, 0xbf, 0x60, 0xb3, 0x5c, 0x95,
-  0x8f, 0xf4, 0x2b, 0x0e, 0xb5, 0x2c, 0x46, 0x1a, 0x95, 0xce, 0x58, 0x59,
-  0xf7, 0x54, 0xdc, 0xcf, 0x52, 0x7e, 0xe9, 0xc7, 0xb5, 0x7d, 0x41, 0x6b,
-  0xdc, 0xbe, 0xca, 0xfe, 0x3d, 0xae, 0x5f, 0x25, 0xc5, 0x98, 0x71, 0xaa,
-  0xa0, 0xb0, 0xee, 0xbe, 0x90, 0x75, 0x4c, 0xa4, 0x1b, 0xda, 0x6e, 0x72,
-  0x63, 0x45, 0xea, 0xf3, 0xfe, 0x7c, 0xcc, 0xb9, 0xd4, 0xce, 0x67, 0x83,
-  0xe0, 0x38, 0x38, 0x0a, 0xa6, 0x35, 0x01, 0xb6, 0x95, 0xc1, 0x00, 0x50,
-  0x3c, 0xb5, 0xa3, 0xfe, 0x79, 0x88, 0x55, 0x73, 0x53, 0x57, 0xd4, 0xbe,
-  0x4f, 0xc8, 0x6e, 0x88, 0xdf, 0xf7, 0x97, 0x2f, 0x99, 0xb8, 0xb5, 0x2b,
-  0x14, 0x23, 0xc9, 0x03, 0x4f, 0x5f, 0xc4, 0x19, 0x9c, 0x1c, 0x8e, 0x6b,
-  0x53, 0x65, 0xfa, 0x96, 0x58, 0x24, 0x0c, 0xeb, 0xaf, 0xd7, 0x9e, 0x70,
-  0x15, 0xdb, 0x1d, 0x4a, 0x4d, 0xd3, 0xf8, 0x74, 0xc1, 0x17, 0x81, 0x40,
-  0x77, 0x05, 0xc7, 0xf5, 0xd6, 0xd3, 0xd8, 0x5d, 0xd1, 0x50, 0x80, 0x59,
-  0xf3, 0x18, 0xb1, 0xad, 0xa4, 0x29, 0x40, 0x0e, 0x3b, 0xbd, 0x91, 0xdf,
-  0x19, 0x48, 0xb7, 0x55, 0xf2, 0x2a, 0xf0, 0xc7, 0xa3, 0xbe, 0x2f, 0x21,
-  0x04, 0x74, 0x09, 0x9d, 0xd5, 0x19, 0x0d, 0xbb, 0x46, 0x09, 0xbd, 0x73,
-  0x61, 0xf2, 0x54, 0x12, 0x67, 0xe5, 0xce, 0x3c, 0x1c, 0x9b, 0x77, 0x6b,
-  0xdb, 0xd2, 0x7b, 0xe3, 0xba, 0x88, 0xa3, 0xee, 0xde, 0xf2, 0x4b, 0x66,
-  0xf4, 0x8e, 0x06, 0xd6, 0x56, 0x76, 0xa7, 0xf4, 0x3c, 0xc9, 0xb0, 0x3f,
-  0x91, 0xda, 0xb3, 0x52, 0xe7, 0xee, 0xd4, 0x9e, 0x5a, 0xa5, 0x9a, 0x7c,
-  0x72, 0xe4, 0xf7, 0xec, 0x29, 0x5d, 0xf0, 0x3d, 0xbd, 0xfb, 0x64, 0x83,
-  0xce, 0x71, 0x39, 0x5f, 0xf0, 0x6c, 0x36, 0x38, 0x09, 0xfa, 0xfe, 0x0e,
-  0x8c, 0x4e, 0x00, 0xa3, 0xe1, 0xa0, 0x73, 0xd4, 0x07, 0x8c, 0x86, 0x15,
-  0x94, 0x2c, 0xf8, 0x8e, 0xf4, 0xdd, 0x95, 0x3f, 0x0e, 0x7a, 0x63, 0x39,
-  0x27, 0x4d, 0x96, 0xcb, 0xab, 0xba, 0x38, 0xe8, 0xdf, 0x90, 0xb0, 0x53,
-  0xeb, 0x3d, 0x25, 0x69, 0xa7, 0xe6, 0x6c, 0x23, 0x5c, 0x05, 0xab, 0x9d,
-  0x89, 0x16, 0x3d, 0x76, 0xdb, 0x2a, 0x0e, 0xf2, 0x05, 0xe3, 0xa1, 0x3f,
-  0x08, 0x4a, 0xe6, 0x0c, 0x0f, 0xdf, 0xd4, 0xb6, 0x66, 0xd4, 0xa4, 0x23,
-  0xae, 0x81, 0xa8, 0x21, 0x7a, 0x34, 0xfa, 0xa8, 0x9e, 0x4c, 0x65, 0xe7,
-  0x40, 0xc8, 0xad, 0xd8, 0x43, 0x54, 0x1d, 0x57, 0x6a, 0x91, 0xa6, 0x88,
-  0xce, 0x7c, 0x09, 0x32, 0xb1, 0x88, 0xc2, 0x90, 0xc7, 0x16, 0x3c, 0xbc,
-  0x52, 0x7d, 0x28, 0x4a, 0x3f, 0x9f, 0x9b, 0x10, 0xd1, 0x41, 0x0a, 0x52,
-  0xef, 0x1a, 0x41, 0x81, 0x60, 0xb6, 0x4e, 0xfc, 0x90, 0x5f, 0x77, 0x2c,
-  0xa5, 0xe8, 0x48, 0xe1, 0xeb, 0x58, 0xf4, 0x69, 0x3b, 0x90, 0x30, 0x54,
-  0x97, 0x8e, 0x72, 0xd6, 0xcb, 0x98, 0x58, 0xc0, 0xc2, 0x07, 0xed, 0xee,
-  0x43, 0xb9, 0x60, 0xc6, 0x11, 0x2c, 0x18, 0x86, 0x8b, 0xa0, 0x17, 0x77,
-  0x1b, 0xc2, 0x29, 0x96, 0x40, 0xb3, 0x75, 0x14, 0xc7, 0x40, 0x52, 0xa7,
-  0xd7, 0x27, 0x53, 0xba, 0xc6, 0x55, 0x1b, 0x7d, 0xae, 0x44, 0x7f, 0xe5,
-  0xb0, 0x54, 0x6e, 0x0e, 0xcb, 0x1b, 0x5d, 0xee, 0x68, 0x35, 0x53, 0x51,
-  0xf8, 0x01, 0x80, 0xd3, 0x05, 0xa0, 0xc4, 0x7a, 0x58, 0xac, 0x28, 0xb6,
-  0x5f, 0xd4, 0x29, 0xba, 0x62, 0xa8, 0x52, 0xc8, 0x65, 0x39, 0x0d, 0x12,
-  0xd8, 0x03, 0x9c, 0xfc, 0x85, 0x69, 0x4b, 0xa1, 0x35, 0xe7, 0xad, 0xa3,
-  0x11, 0x32, 0xcb, 0xaa, 0xc0, 0xfa, 0x36, 0xba, 0xb5, 0xae, 0x70, 0xbb,
-  0xa1, 0x68, 0xd0, 0xec, 0xb7, 0xe5, 0xc9, 0xce, 0x29, 0x49, 0x99, 0x1c,
-  0x88, 0x24, 0x40, 0x01, 0x93, 0xca, 0xf1, 0x71, 0x0b, 0x09, 0x6b, 0x89,
-  0x3a, 0x67, 0x23, 0xf3, 0x8d, 0xcd, 0x20, 0x3e, 0x51, 0x68, 0x9e, 0x42,
-  0xf8, 0x4c, 0xa7, 0x10, 0xfc, 0x06, 0x6e, 0xae, 0xd6, 0xe8, 0x8b, 0x20,
-  0x21, 0x37, 0xab, 0x38, 0x9b, 0xf4, 0xe6, 0x29, 0x83, 0xbf, 0xda, 0xb7,
-  0x55, 0x87, 0x12, 0x81, 0x9a, 0xf1, 0xe5, 0x72, 0xaf, 0x18, 0x6d, 0xcb,
-  0x75, 0x6e, 0xd5, 0x2b, 0x34, 0xa1, 0x33, 0xf1, 0xd1, 0x95, 0x6b, 0x1c,
-  0xc9, 0xd3, 0xea, 0x29, 0x45, 0x5a, 0xf2, 0x10, 0x74, 0xe7, 0xd9, 0xcb,
-  0xce, 0xb6, 0xd3, 0x65, 0x71, 0x20, 0x27, 0xaa, 0x96, 0xdc, 0x89, 0xd0,
-  0x7d, 0x6f, 0x07, 0xf7, 0xba, 0xf7, 0x3b, 0x3d, 0x94, 0xaf, 0x4d, 0x9c,
-  0x1e, 0xd2, 0x8b, 0x1b, 0xa7, 0x58, 0x08, 0x7f, 0x7e, 0x70, 0x70, 0x0a,
-  0x82, 0xc3, 0x66, 0xcb, 0x20, 0xcb, 0xce, 0x1a, 0xb2, 0xaa, 0xbb, 0x71,
-  0x0e, 0x40, 0xcb, 0xed, 0x28, 0xb4, 0xd4, 0x01, 0x5d, 0x8b, 0x5e, 0xf1,
-  0x52, 0x06, 0x7c, 0x16, 0x8d, 0xc6, 0xf8, 0x30, 0xc9, 0x1b, 0x2c, 0x0a,
-  0xcf, 0x1a, 0xb2, 0x34, 0x0b, 0x9f, 0xcf, 0x4f, 0x0f, 0x61, 0x04, 0x41,
-  0xd6, 0x1f, 0xcc, 0x25, 0x44, 0x79, 0xad, 0x5a, 0x41, 0xa4, 0xd4, 0xad,
-  0xce, 0x3c, 0x66, 0xe2, 0xe8, 0x6f, 0x30, 0x2c, 0x67, 0xf1, 0xa0, 0xf1,
-  0xac, 0xb1, 0x48, 0x56, 0xf0, 0x9c, 0xc4, 0xb3, 0x25, 0x04, 0x5a, 0xb0,
-  0x1e, 0xe5, 0xdd, 0x2e, 0x83, 0xab, 0x56, 0x13, 0x7b, 0x9a, 0xed, 0xc6,
-  0xf9, 0x3b, 0xf8, 0x7d, 0x7a, 0x28, 0xe0, 0x6d, 0x03, 0x6e, 0x42, 0xcd,
-  0x80, 0xf3, 0xc0, 0xf2, 0xcc, 0x0d, 0x59, 0xf5, 0x22, 0xf4, 0x0b, 0xf9,
-  0xf9, 0xc9, 0x2b, 0x90, 0x76, 0xd5, 0xc0, 0xa7, 0x3e, 0x82, 0x4e, 0x9f,
-  0x4c, 0xd8, 0x92, 0x76, 0xf2, 0x97, 0x60, 0x1e, 0x12, 0x1a, 0x22, 0x38,
-  0x4d, 0xe1, 0x83, 0xd3, 0xaf, 0x40, 0x65, 0xcf, 0x1c, 0xff, 0xb1, 0x77,
-  0xdf, 0x7f, 0x78, 0xc3, 0x2e, 0x5f, 0xbe, 0x72, 0xf7, 0x7a, 0xde, 0xf9,
-  0x41, 0x99, 0x27, 0x32, 0x11, 0xa7, 0x49, 0x8f, 0x8b, 0x61, 0x3b, 0x11,
-  0x1e, 0xd6, 0xb2, 0xb9, 0x28, 0xab, 0x25, 0x1b, 0x55, 0x91, 0xb0, 0xea,
-  0x28, 0x61, 0x67, 0x24, 0x18, 0x5a, 0x12, 0x4a, 0x63, 0x75, 0xb5, 0x20,
-  0xec, 0x09, 0xd4, 0x2f, 0x2e, 0x75, 0x90, 0x42, 0x37, 0xce, 0x31, 0xd7,
-  0x09, 0x52, 0x0d, 0xfd, 0xce, 0x51, 0xa4, 0x59, 0x52, 0x0c, 0x21, 0xe0,
-  0x9c, 0x47, 0x8d, 0x73, 0xcf, 0x53, 0xe3, 0xff, 0xd4, 0xc2, 0xef, 0x3f,
-  0xb1, 0x97, 0x61, 0x98, 0xf2, 0x2c, 0xdb, 0x77, 0xf9, 0x68, 0xfd, 0xc5,
-  0x16, 0xbf, 0x80, 0xd3, 0x24, 0x58, 0xee, 0xbb, 0x30, 0xa6, 0xe7, 0x5c,
-  0x4b, 0x2b, 0x51, 0xf9, 0x83, 0xec, 0xa3, 0x34, 0xf3, 0x47, 0x91, 0x66,
-  0x36, 0xb7, 0x63, 0xcb, 0xbd, 0xbc, 0x40, 0x66, 0xfa, 0xde, 0xd5, 0x90,
-  0xf7, 0x30, 0xb9, 0x98, 0x05, 0x71, 0xab, 0x2d, 0x11, 0x85, 0xcf, 0xa4,
-  0x22, 0xe7, 0xd8, 0xaa, 0x20, 0x97, 0xb5, 0xca, 0xc0, 0x47, 0x25, 0xb4,
-  0xc5, 0x74, 0x78, 0xca, 0x0a, 0xf1, 0xd7, 0x63, 0x09, 0xb2, 0x99, 0xc9,
-  0x02, 0x8f, 0xba, 0xc1, 0xc8, 0x0c, 0x02, 0x02, 0x46, 0xf2, 0x40, 0x6e,
-  0xb8, 0xbc, 0xe5, 0x62, 0xa6, 0x1e, 0x20, 0x86, 0x14, 0x4f, 0xf5, 0x53,
-  0x34, 0xbf, 0x64, 0x9b, 0xca, 0xca, 0x1b, 0xe4, 0xda, 0x01, 0x00, 0xf3,
-  0x6e, 0x8d, 0xea, 0x26, 0xa8, 0xf9, 0xbc, 0x04, 0xc6, 0x7a, 0x34, 0x39,
-  0xe2, 0xa2, 0x89, 0x4c, 0x65, 0x81, 0x5a, 0xa7, 0xf7, 0x42, 0xde, 0xd4,
-  0xc4, 0x40, 0x21, 0x62, 0x64, 0xbb, 0x1a, 0xe6, 0x1c, 0x71, 0x83, 0x68,
-  0xf0, 0x51, 0x34, 0x7c, 0xa0, 0xde, 0x8b, 0x8b, 0xf7, 0xdf, 0x02, 0x47,
-  0xcf, 0xdf, 0xa0, 0xcf, 0xc6, 0xf0, 0x89, 0x89, 0x69, 0xcb, 0xfb, 0xd3,
-  0xc3, 0xc0, 0xa2, 0xb1, 0x01, 0x12, 0x24, 0x34, 0xf4, 0x30, 0xf5, 0xbb,
-  0x9d, 0x35, 0x30, 0x91, 0x2e, 0x59, 0x18, 0x15, 0xda, 0x34, 0xf0, 0xf0,
-  0x13, 0x98, 0xdd, 0x11, 0x84, 0x06, 0x33, 0x4a, 0xe0, 0xce, 0x1a, 0x52,
-  0x82, 0x98, 0x20, 0xd6, 0x0e, 0xba, 0x10, 0xa7, 0xce, 0x3f, 0xc9, 0x3a,
-  0xd5, 0xd3, 0x43, 0xf1, 0x7c, 0x50, 0x59, 0x53, 0x55, 0xb2, 0xaa, 0x75,
-  0xf1, 0xb9, 0xb4, 0xae, 0xd8, 0xba, 0x1e, 0x58, 0xa7, 0x16, 0x35, 0x2a,
-  0xf1, 0x3a, 0x01, 0xff, 0x76, 0x96, 0x23, 0x0d, 0xe5, 0xc7, 0x6d, 0xb6,
-  0xbf, 0xd6, 0xca, 0x5f, 0xbc, 0xb9, 0xbc, 0x7c, 0xff, 0xf1, 0xaf, 0x17,
-  0x7f, 0xc8, 0xd2, 0x17, 0x26, 0x5e, 0x9f, 0x82, 0x7f, 0xdc, 0x4e, 0x7c,
-  0x2b, 0x38, 0x69, 0x12, 0x5e, 0x10, 0xf7, 0x15, 0x65, 0xf1, 0x63, 0x32,
-  0xa1, 0x26, 0xb9, 0x0d, 0x50, 0xba, 0xc0, 0xaa, 0xe0, 0x9f, 0xc9, 0x0c,
-  0xea, 0x16, 0xc8, 0x5e, 0xe1, 0xab, 0xa5, 0xab, 0x28, 0x3e, 0x6b, 0xf8,
-  0x0d, 0x4c, 0x2f, 0x9e, 0x35, 0x20, 0xf8, 0x41, 0xc2, 0xd2, 0x78, 0x24,
-  0xec, 0x0c, 0x9c, 0xa2, 0x38, 0xef, 0x5e, 0xf3, 0xfc, 0xcd, 0x92, 0xe3,
-  0xc7, 0x57, 0xf7, 0xef, 0xc3, 0x56, 0x13, 0x26, 0xa2, 0xb9, 0x6c, 0xb6,
-  0xbb, 0x28, 0x4e, 0xf2, 0x8d, 0x8e, 0xb3, 0x7c, 0x11, 0x65, 0x5d, 0xb2,
-  0xa2, 0x2f, 0x9a, 0xcf, 0x9b, 0xc4, 0xa0, 0x05, 0x2e, 0x46, 0x7e, 0xc1,
-  0xa7, 0x00, 0xdc, 0x75, 0x9a, 0xd9, 0xec, 0x14, 0x03, 0xdb, 0x05, 0x8e,
-  0xa6, 0x45, 0xd6, 0xe5, 0x5f, 0x1a, 0x4f, 0x7a, 0x28, 0xec, 0xf1, 0x81,
-  0x25, 0x96, 0x7f, 0xd2, 0x28, 0x5f, 0x82, 0xfb, 0xcd, 0x53, 0x38, 0x03,
-  0x52, 0x5e, 0x73, 0xc4, 0x48, 0xed, 0xd5, 0xb8, 0x4a, 0xb9, 0x24, 0xdc,
-  0x40, 0x20, 0xe7, 0xa6, 0x3f, 0xc2, 0xf3, 0x1f, 0x21, 0x8e, 0x69, 0xe5,
-  0x29, 0xed, 0xee, 0x2f, 0xcf, 0x7a, 0xc7, 0xa3, 0xe9, 0x5b, 0xdb, 0x20,
-  0x57, 0x21, 0xcc, 0x1c, 0x10, 0xe6, 0xc1, 0x32, 0x2b, 0x40, 0xbc, 0x2e,
-  0xd9, 0xf4, 0x2f, 0xb5, 0x77, 0x88, 0x37, 0x7f, 0x07, 0x73, 0x61, 0x6e,
-  0x5c, 0x58, 0x4d, 0xc2, 0xed, 0x7a, 0x95, 0xbb, 0xf9, 0x08, 0x1d, 0x35,
-  0x7c, 0x4c, 0xd6, 0xf4, 0x86, 0x0b, 0x35, 0x9f, 0x35, 0xbc, 0xde, 0xd8,
-  0x07, 0x99, 0x3a, 0xff, 0xf1, 0x82, 0xbd, 0x09, 0xc0, 0x29, 0x4b, 0x63,
-  0xd6, 0xfa, 0xf1, 0xf2, 0xb5, 0x37, 0x6c, 0x9f, 0x1e, 0x8a, 0x91, 0x75,
-  0x13, 0xfb, 0xbd, 0x91, 0x9c, 0xf8, 0x1a, 0x0d, 0x6e, 0xb0, 0x14, 0x13,
-  0x47, 0xbb, 0x27, 0x0e, 0xfb, 0x72, 0xe2, 0x07, 0x08, 0x86, 0xf2, 0x20,
-  0x92, 0x4b, 0x1e, 0xef, 0x9e, 0x39, 0x1e, 0xcb, 0x99, 0x9f, 0x20, 0x74,
-  0x99, 0x47, 0x33, 0x31, 0x71, 0xbc, 0x6b, 0x22, 0xce, 0xb9, 0x7c, 0x6d,
-  0x0f, 0x02, 0x41, 0x25, 0x32, 0x7e, 0x01, 0x1e, 0x7d, 0x97, 0xcc, 0x28,
-  0x6e, 0xae, 0x5a, 0x83, 0xef, 0xa0, 0x3d, 0xdf, 0x84, 0xbc, 0xde, 0xf4,
-  0x8a, 0xf7, 0x05, 0x84, 0x1a, 0x41, 0x88, 0x89, 0x47, 0x05, 0x5f, 0x03,
-  0xc6, 0x5d, 0xe0, 0x4a, 0xaf, 0x64, 0x83, 0x79, 0xf7, 0xba, 0xcb, 0x06,
-  0x7e, 0xf7, 0xb8, 0xd7, 0x1f, 0x37, 0xec, 0x75, 0x92, 0xf8, 0xfa, 0x29,
-  0x0b, 0xc1, 0xae, 0x76, 0x2e, 0xe4, 0x1d, 0x0f, 0xa0, 0x6f, 0xe4, 0x3f,
-  0xcd, 0xd6, 0x83, 0x04, 0x02, 0x39, 0xd0, 0xd0, 0x5f, 0x04, 0xb7, 0x9c,
-  0x15, 0xa4, 0xa9, 0x98, 0xfb, 0x3f, 0x4a, 0x6d, 0x71, 0x13, 0xf5, 0x21,
-  0x09, 0xeb, 0x8c, 0x41, 0x51, 0x95, 0xe3, 0x36, 0x5e, 0x66, 0xa5, 0x0e,
-  0x9e, 0xe9, 0x58, 0x82, 0xcd, 0x62, 0x7d, 0xbf, 0x65, 0x5a, 0x30, 0x45,
-  0x60, 0x7b, 0x6a, 0xdd, 0xd1, 0x4d, 0x55, 0x12, 0xe4, 0x8a, 0x91, 0xef,
-  0x86, 0x10, 0x3d, 0xa4, 0xb4, 0x4b, 0x3f, 0xa9, 0xf7, 0xfb, 0x58, 0xea,
-  0xa8, 0xac, 0xaf, 0xf8, 0xa6, 0x37, 0xf1, 0xdb, 0x26, 0x74, 0x07, 0xda,
-  0x54, 0x7a, 0x81, 0x6e, 0x92, 0x85, 0xa5, 0xc5, 0xf6, 0x12, 0x59, 0x0c,
-  0x64, 0x48, 0xfe, 0x33, 0xa7, 0x57, 0xa8, 0x2e, 0xd9, 0x4a, 0x1e, 0xa1,
-  0xd5, 0x0d, 0x41, 0x7a, 0xc3, 0xf2, 0xf0, 0xc4, 0xaa, 0x10, 0xf3, 0xa4,
-  0x39, 0x5b, 0x24, 0x9b, 0xd4, 0xc2, 0x43, 0xed, 0xa1, 0xb0, 0x56, 0x02,
-  0x8b, 0x0c, 0x87, 0x6f, 0xa1, 0x0a, 0x81, 0x2b, 0x19, 0x2f, 0x53, 0x5b,
-  0x1d, 0x8e, 0xe1, 0xfe, 0xb8, 0xbe, 0x89, 0xc3, 0xfd, 0x31, 0xe5, 0x71,
-  0xb8, 0x05, 0x4f, 0x00, 0xf5, 0x34, 0x2c, 0xed, 0x07, 0xb1, 0xbe, 0x90,
-  0xe6, 0x2b, 0xb7, 0xd7, 0xb0, 0xcb, 0x6f, 0xa8, 0xf7, 0x1c, 0x04, 0xfe,
-  0x35, 0xfe, 0x83, 0xb6, 0x8a, 0x7b, 0x78, 0x12, 0x1a, 0xd0, 0x1f, 0xf4,
-  0x27, 0x68, 0xfe, 0xab, 0x3a, 0xa7, 0x62, 0xbb, 0x5b, 0x61, 0xad, 0xdd,
-  0x38, 0xf7, 0x9f, 0x97, 0x85, 0xbe, 0xec, 0xf5, 0x3e, 0xc5, 0x95, 0xfc,
-  0xf9, 0xe2, 0xf2, 0xcd, 0x87, 0x3f, 0xeb, 0x48, 0x8a, 0x64, 0xc7, 0x9f,
-  0x70, 0x23, 0x45, 0x62, 0xf2, 0x7d, 0x3c, 0x4f, 0x6a, 0x8c, 0x99, 0x4e,
-  0x4e, 0x3a, 0x95, 0x56, 0x27, 0xdd, 0x6a, 0xb4, 0xb6, 0x48, 0x13, 0x36,
-  0xce, 0xdf, 0x46, 0xe9, 0xea, 0x2e, 0xb0, 0x5c, 0x28, 0x3d, 0xbc, 0x14,
-  0x9f, 0xd0, 0x15, 0x9c, 0xa3, 0x84, 0x43, 0x5e, 0xc9, 0x35, 0xea, 0xa2,
-  0xbc, 0x22, 0xf1, 0xa7, 0xc2, 0xf4, 0x5b, 0x38, 0x72, 0xc8, 0x2b, 0x2c,
-  0xc7, 0x86, 0x26, 0xdb, 0xf5, 0x55, 0xa2, 0x98, 0x55, 0x3c, 0x96, 0xac,
-  0xdc, 0x56, 0x75, 0xfa, 0x83, 0x54, 0xf9, 0xf0, 0xf2, 0x75, 0x91, 0xf3,
-  0xa8, 0xb5, 0x28, 0xd5, 0x8d, 0xad, 0x82, 0x59, 0x65, 0x63, 0x5f, 0x04,
-  0xa1, 0xb7, 0x29, 0xe7, 0xec, 0x1d, 0x0f, 0xd6, 0x4f, 0x42, 0x67, 0x01,
-  0x13, 0xfe, 0x3d, 0xf8, 0xfc, 0xb8, 0x46, 0x73, 0xfa, 0x24, 0x64, 0x36,
-  0x5b, 0x51, 0xf9, 0x52, 0x9e, 0xb1, 0x43, 0x9e, 0x9f, 0x90, 0xa6, 0x59,
-  0x4a, 0xc7, 0xa4, 0xbb, 0x48, 0xf9, 0xfc, 0xec, 0xe5, 0xa7, 0xf7, 0x2f,
-  0x9a, 0x87, 0x9b, 0x75, 0x18, 0xe4, 0xbc, 0x89, 0x7b, 0x5e, 0x26, 0x41,
-  0xc8, 0x8a, 0x15, 0x2a, 0xd9, 0x1a, 0x25, 0xa7, 0xf2, 0xee, 0x7b, 0x8f,
-  0x30, 0xdf, 0xdc, 0x89, 0x71, 0xf3, 0x6d, 0x72, 0xc0, 0x81, 0xfd, 0x8a,
-  0x19, 0xd7, 0x9f, 0x85, 0x7a, 0xc8, 0x06, 0x91, 0x7c, 0xd5, 0x7b, 0x82,
-  0x9e, 0xd7, 0xa2, 0x43, 0x06, 0xda, 0xf8, 0x91, 0xfd, 0x35, 0x49, 0xc2,
-  0x72, 0x78, 0xb3, 0x6d, 0x31, 0x75, 0x5b, 0x58, 0xac, 0xa6, 0x5a, 0xaa,
-  0xcb, 0xfd, 0x20, 0x7b, 0x70, 0x3d, 0xfc, 0xcc, 0x5e, 0xc1, 0x43, 0x25,
-  0x96, 0xaa, 0x13, 0x43, 0x7d, 0x9f, 0x56, 0x23, 0x86, 0xd6, 0x7d, 0x22,
-  0x18, 0x03, 0x67, 0x17, 0x5e, 0x0d, 0x16, 0xa8, 0x1a, 0x6d, 0x32, 0x93,
-  0xb4, 0x45, 0x72, 0xed, 0xfb, 0xbc, 0x32, 0x10, 0x6a, 0x3b, 0xff, 0x77,
-  0x4b, 0xf1, 0x0f, 0x1c, 0xce, 0xca, 0xed, 0x22, 0x8c, 0x6f, 0x82, 0x98,
-  0x32, 0x8c, 0x68, 0xe2, 0xeb, 0x09, 0x36, 0x37, 0xa4, 0x48, 0x10, 0x3c,
-  0x64, 0xc7, 0x5b, 0x10, 0xb0, 0x24, 0xbd, 0x67, 0x72, 0x81, 0xfa, 0x6c,
-  0x4b, 0x36, 0x4b, 0xa3, 0x35, 0xb8, 0x2c, 0x87, 0x87, 0xec, 0xeb, 0xaf,
-  0xbf, 0x66, 0xdf, 0xbe, 0xf9, 0xe9, 0xcd, 0x77, 0xdf, 0x7f, 0xfa, 0xf0,
-  0xe6, 0xe3, 0xe5, 0x84, 0x5d, 0x70, 0xf0, 0x2d, 0xe0, 0xdc, 0x66, 0x79,
-  0xc2, 0xee, 0xc1, 0x6b, 0x62, 0xa1, 0x3c, 0xb0, 0x3e, 0x75, 0x45, 0x5f,
-  0xc2, 0x9a, 0x4d, 0x36, 0x4f, 0x52, 0xb6, 0x4e, 0x93, 0x70, 0x23, 0xbf,
-  0x3b, 0x81, 0x43, 0xa4, 0x11, 0x86, 0x3c, 0x6c, 0x77, 0x11, 0xe2, 0xc1,
-  0x6d, 0x90, 0x32, 0x50, 0x30, 0x76, 0xc6, 0xb0, 0xf2, 0x9a, 0x1e, 0x55,
-  0xde, 0x8f, 0x52, 0x69, 0xa2, 0x1d, 0x9b, 0x49, 0x80, 0x21, 0x24, 0x0c,
-  0x93, 0xbb, 0x18, 0x9a, 0xe3, 0xcd, 0x72, 0xa9, 0x3b, 0x7e, 0xe0, 0x2b,
-  0x88, 0x14, 0x41, 0xd7, 0xa0, 0xc3, 0x07, 0x30, 0x80, 0xae, 0xa8, 0xf8,
-  0x0a, 0xae, 0x44, 0xb1, 0xcd, 0xc1, 0x7c, 0x13, 0x0b, 0x04, 0x8a, 0x2b,
-  0x07, 0xcc, 0x92, 0xb5, 0x19, 0xde, 0x42, 0x21, 0x14, 0xfc, 0xaa, 0x1f,
-  0x98, 0xad, 0x7d, 0x9d, 0xff, 0xdd, 0xf0, 0xf4, 0x5e, 0xa4, 0x31, 0x93,
-  0xf4, 0xe5, 0x72, 0xd9, 0x6a, 0xaa, 0xef, 0xe9, 0x68, 0xd2, 0xf5, 0x13,
-  0xce, 0x81, 0xe3, 0x87, 0x2f, 0xf7, 0x99, 0x25, 0x9d, 0x83, 0xa6, 0xbc,
-  0xb8, 0x4a, 0x59, 0x0b, 0xa7, 0x47, 0x84, 0x2d, 0xfc, 0x3a, 0xa5, 0xd5,
-  0xbb, 0x4b, 0x1e, 0x5f, 0xe7, 0x0b, 0x68, 0x78, 0xf1, 0x42, 0xe0, 0xc5,
-  0xa8, 0xfd, 0x1f, 0xd1, 0xaf, 0x5d, 0xe2, 0xf8, 0x47, 0x2c, 0x63, 0x3d,
-  0xd3, 0x6d, 0xe0, 0x8d, 0xbd, 0xcc, 0xf3, 0x34, 0x02, 0xee, 0xf1, 0x56,
-  0x53, 0xdd, 0xb2, 0x34, 0xdb, 0xe8, 0xb3, 0x50, 0x0a, 0x90, 0x7d, 0xc3,
-  0x9a, 0xf6, 0x25, 0x52, 0x93, 0x4d, 0x74, 0x13, 0x15, 0xba, 0x3f, 0xd6,
-  0xe0, 0x23, 0x76, 0xe6, 0xc2, 0x48, 0xf4, 0x94, 0x71, 0x2a, 0x5a, 0xa3,
-  0x90, 0xd6, 0xa7, 0x55, 0x9a, 0xec, 0x85, 0x85, 0x88, 0x7d, 0xad, 0xa2,
-  0x91, 0x51, 0xd4, 0x11, 0x08, 0x3d, 0x1a, 0xec, 0xd3, 0x05, 0x7b, 0x05,
-  0xff, 0x56, 0xd9, 0x75, 0x2b, 0xef, 0xb0, 0xe4, 0xa6, 0x60, 0xdd, 0xca,
-  0xe4, 0x40, 0xd9, 0x47, 0x85, 0xf1, 0x82, 0xec, 0x2b, 0xd3, 0x3d, 0x45,
-  0x32, 0x8a, 0x46, 0x73, 0x17, 0xc9, 0x0d, 0x62, 0x9a, 0xdc, 0x10, 0x66,
-  0x3c, 0x4d, 0x9b, 0x62, 0x08, 0x59, 0xee, 0xae, 0x34, 0xdc, 0x28, 0x91,
-  0xa4, 0x6b, 0xd4, 0x09, 0xea, 0x83, 0x49, 0x98, 0x64, 0x93, 0xb7, 0x14,
-  0x86, 0x2d, 0x40, 0xcc, 0x35, 0x89, 0xde, 0xf9, 0x9e, 0xb2, 0xc7, 0x0e,
-  0x3b, 0x1a, 0xfa, 0xbe, 0x2c, 0x60, 0x97, 0x1b, 0x7d, 0xc7, 0x97, 0x6b,
-  0x55, 0x30, 0x59, 0x6c, 0x95, 0x67, 0xb3, 0x56, 0x86, 0xd0, 0x70, 0x93,
-  0xa1, 0xb9, 0xc9, 0x59, 0xca, 0xe1, 0x30, 0x92, 0xfb, 0x04, 0xde, 0x47,
-  0xb7, 0xb0, 0x47, 0x16, 0x96, 0x76, 0x98, 0x4d, 0x59, 0xca, 0xf3, 0x0d,
-  0x18, 0x88, 0xb0, 0x4b, 0x35, 0x04, 0xef, 0x2e, 0x3f, 0x7c, 0x07, 0x18,
-  0x14, 0x2b, 0x04, 0xeb, 0xa8, 0xb5, 0x01, 0x62, 0xe2, 0x22, 0x72, 0xe8,
-  0x9c, 0x83, 0x7a, 0xb4, 0x50, 0x25, 0x5f, 0x30, 0xea, 0xea, 0xe6, 0x0b,
-  0x1e, 0x17, 0xbb, 0x4b, 0x8d, 0xb1, 0x69, 0xf7, 0x9f, 0x19, 0x6e, 0x18,
-  0x60, 0xb6, 0xbb, 0x70, 0x64, 0xc2, 0x44, 0x3d, 0x8e, 0x13, 0x19, 0x80,
-  0x59, 0xcd, 0x1f, 0x38, 0x68, 0x05, 0xf0, 0x71, 0x1e, 0x44, 0x4b, 0x0e,
-  0x51, 0x11, 0x68, 0x34, 0xcd, 0xb0, 0x30, 0xc1, 0x2b, 0x9b, 0xcb, 0xe4,
-  0x55, 0x90, 0x66, 0xb4, 0x02, 0xbe, 0x4a, 0x32, 0x67, 0xad, 0x94, 0x9d,
-  0x83, 0xb7, 0x3d, 0xf4, 0xdb, 0x6a, 0xc5, 0xe6, 0x2f, 0x9b, 0xfe, 0x70,
-  0xdc, 0xa7, 0x9f, 0x03, 0xfa, 0x39, 0xa2, 0x9f, 0x63, 0xe2, 0x46, 0x31,
-  0x65, 0x34, 0xdc, 0x36, 0xa5, 0x34, 0x78, 0x5c, 0x03, 0x9f, 0x86, 0xd9,
-  0x1d, 0x4d, 0x62, 0x9b, 0xc6, 0x1a, 0xaf, 0xcf, 0x83, 0xfc, 0x1d, 0x18,
-  0xbf, 0xd6, 0xa2, 0xc0, 0x7a, 0x41, 0x1a, 0x60, 0x00, 0xed, 0xf5, 0xd9,
-  0xcb, 0x0f, 0x7a, 0xd1, 0x05, 0xe8, 0x57, 0xaf, 0xaf, 0x7b, 0x17, 0x40,
-  0xe8, 0xa6, 0xdd, 0x8f, 0xd3, 0x8d, 0x11, 0x38, 0xff, 0xd3, 0x07, 0x13,
-  0x1b, 0x18, 0xe3, 0xd1, 0x08, 0x9c, 0x4a, 0x5d, 0x86, 0x30, 0x7d, 0x4a,
-  0xd6, 0x1b, 0x2c, 0x48, 0x30, 0xd2, 0x16, 0x14, 0xd5, 0xb2, 0x30, 0x4d,
-  0xd6, 0x68, 0x3d, 0xa5, 0x9c, 0x59, 0x12, 0x2b, 0x55, 0x89, 0xc2, 0x6f,
-  0xb0, 0x5f, 0xdb, 0x34, 0xca, 0x08, 0xd4, 0x0b, 0x53, 0x08, 0xae, 0xce,
-  0x5e, 0xd3, 0x60, 0x5c, 0xbd, 0x15, 0xec, 0x0f, 0x2c, 0x53, 0x83, 0xbd,
-  0x22, 0xc3, 0x72, 0x66, 0x52, 0x3a, 0xa2, 0xf9, 0x4c, 0xe3, 0x5a, 0xc8,
-  0x36, 0x7b, 0x01, 0x7a, 0x56, 0x4a, 0xef, 0xa1, 0x0d, 0x8a, 0x90, 0x4e,
-  0x8d, 0x73, 0xfc, 0x28, 0xe0, 0xc1, 0xa3, 0x4e, 0xf8, 0x35, 0x05, 0x34,
-  0xb1, 0x81, 0x2f, 0x01, 0x0b, 0x6d, 0xaa, 0xc6, 0x8d, 0x66, 0xa2, 0xfa,
-  0xf7, 0xfb, 0xd4, 0x29, 0x97, 0xd1, 0xcd, 0xc7, 0xc8, 0xbb, 0x36, 0xa8,
-  0x50, 0xc1, 0xbf, 0xef, 0xd0, 0xbd, 0x34, 0x0a, 0x45, 0x0b, 0x71, 0x43,
-  0xc7, 0x53, 0x32, 0x0b, 0x35, 0xb7, 0x79, 0x08, 0x3f, 0x0f, 0xc5, 0xc8,
-  0x66, 0x59, 0x4f, 0x43, 0x45, 0x45, 0x14, 0xa9, 0xaf, 0x42, 0x25, 0x4c,
-  0x53, 0x71, 0xfb, 0x03, 0x6b, 0xc9, 0xef, 0xd0, 0x09, 0x93, 0x5c, 0x13,
-  0x1b, 0x3e, 0x6f, 0xe3, 0x60, 0x51, 0xd7, 0xd0, 0x94, 0x2c, 0x40, 0xd8,
-  0x61, 0x17, 0x6f, 0xa2, 0xd8, 0x5f, 0xfe, 0x82, 0x56, 0x66, 0xdd, 0x46,
-  0x20, 0x96, 0x51, 0x6d, 0x22, 0x54, 0xf1, 0xcd, 0x69, 0xcd, 0x62, 0x75,
-  0x2c, 0x50, 0xc0, 0x93, 0x8c, 0x9e, 0xeb, 0x57, 0xa4, 0x2b, 0x6c, 0x3b,
-  0xb3, 0x80, 0x18, 0x8a, 0x25, 0xff, 0xf5, 0x2f, 0xd6, 0xfc, 0x08, 0xc0,
-  0x67, 0xe2, 0xd6, 0x08, 0x6c, 0xcb, 0x74, 0x17, 0xb8, 0x68, 0xed, 0x00,
-  0x16, 0xad, 0x09, 0x94, 0xe7, 0x35, 0xcd, 0x5d, 0xa1, 0x45, 0x62, 0x5f,
-  0x09, 0x47, 0x43, 0xd1, 0x72, 0x2b, 0x6c, 0x9c, 0x00, 0xd0, 0x0b, 0x09,
-  0x42, 0x01, 0x32, 0x43, 0x59, 0x7c, 0xc5, 0x43, 0x48, 0x8e, 0x61, 0xed,
-  0xc4, 0x42, 0x6d, 0x21, 0x46, 0x14, 0xd0, 0x32, 0x1c, 0x21, 0xd7, 0x47,
-  0xfd, 0x0e, 0x5f, 0xad, 0x24, 0x62, 0x8f, 0x05, 0xf3, 0x28, 0xb9, 0xa0,
-  0x09, 0x28, 0x30, 0x86, 0x78, 0x3a, 0x03, 0xd6, 0xb7, 0xb7, 0x21, 0x09,
-  0x63, 0x1c, 0x14, 0x90, 0x33, 0xa7, 0x0a, 0x7c, 0x51, 0xaa, 0xac, 0x65,
-  0x83, 0x82, 0xee, 0x6d, 0xd2, 0xa1, 0x23, 0x73, 0x25, 0x1c, 0xe4, 0x21,
-  0x89, 0x10, 0xe8, 0x6f, 0x10, 0x01, 0xed, 0x9a, 0x6b, 0x46, 0x4b, 0xb6,
-  0x7c, 0x41, 0xef, 0x6f, 0xba, 0x1c, 0xb9, 0xca, 0x12, 0xc7, 0xa0, 0xa2,
-  0x93, 0x09, 0xc4, 0x4b, 0x3b, 0x6e, 0xbe, 0x56, 0x23, 0x25, 0x65, 0x8b,
-  0x81, 0x96, 0xe8, 0xea, 0x3d, 0xb1, 0x99, 0x63, 0x82, 0xb1, 0xb9, 0xba,
-  0xe3, 0x5e, 0x8f, 0xcd, 0xf2, 0x64, 0xfd, 0x7d, 0x1e, 0xa0, 0xb3, 0x90,
-  0xb6, 0xda, 0xaa, 0xfd, 0x91, 0x71, 0xfc, 0xde, 0xbf, 0x1d, 0xc8, 0xfe,
-  0x18, 0xcf, 0x9e, 0x8a, 0xae, 0x44, 0x6d, 0x5f, 0x64, 0x0b, 0x87, 0x46,
-  0x61, 0x0b, 0xe6, 0x4b, 0xa3, 0x7b, 0xe4, 0xfb, 0x70, 0xdc, 0x00, 0x8d,
-  0x37, 0x14, 0xee, 0xa3, 0xb2, 0xf8, 0xed, 0x62, 0x0f, 0x07, 0xc5, 0x4f,
-  0xc1, 0x8a, 0x55, 0x30, 0xdb, 0x2a, 0x83, 0xd0, 0xef, 0x90, 0x41, 0x68,
-  0xdd, 0xa9, 0xbe, 0x98, 0xc9, 0x70, 0x4c, 0xc5, 0x66, 0xf0, 0xdc, 0x3e,
-  0x04, 0xf9, 0xa2, 0x4b, 0x35, 0x74, 0x2d, 0xd9, 0x76, 0xc8, 0x7a, 0x7e,
-  0x7f, 0x20, 0x8e, 0xc9, 0xff, 0x7a, 0x45, 0x6e, 0x9d, 0xd6, 0x72, 0x14,
-  0xcf, 0x0d, 0x4d, 0x37, 0xb6, 0x55, 0x74, 0xc1, 0x29, 0x2c, 0x00, 0xce,
-  0x97, 0x49, 0x92, 0xb6, 0x36, 0x00, 0xeb, 0x68, 0x44, 0x7e, 0x9b, 0x1a,
-  0xb1, 0xb2, 0x47, 0xc0, 0x90, 0xe7, 0x62, 0x08, 0x0c, 0x1d, 0xa9, 0x81,
-  0x5b, 0x36, 0xb3, 0xa9, 0x6e, 0x85, 0x7c, 0x81, 0x05, 0x19, 0x80, 0x15,
-  0x7e, 0x5c, 0x19, 0x16, 0x53, 0x15, 0x5d, 0x4d, 0x8c, 0x84, 0xb0, 0x41,
-  0xf4, 0xa2, 0xf1, 0x09, 0x46, 0x0b, 0x2f, 0x74, 0xdb, 0xfa, 0x30, 0x32,
-  0x81, 0x4c, 0xf7, 0x98, 0x5a, 0xcd, 0xfa, 0x96, 0x80, 0xe0, 0x16, 0x9e,
-  0x57, 0x6d, 0x97, 0xde, 0x48, 0x2e, 0xef, 0x2f, 0x8d, 0x6d, 0x5c, 0xaf,
-  0xf2, 0xdf, 0x92, 0xf9, 0x1c, 0xdf, 0xf1, 0xae, 0x6c, 0x03, 0x89, 0x0e,
-  0xfd, 0x3b, 0xfc, 0x0c, 0xbc, 0xdc, 0xd4, 0xc2, 0x89, 0x53, 0x00, 0x4b,
-  0x18, 0x7f, 0x01, 0x91, 0x52, 0x7c, 0x6d, 0xad, 0xa0, 0x47, 0xb9, 0x7c,
-  0x11, 0xb1, 0x50, 0x57, 0xde, 0x8a, 0xb8, 0x22, 0x21, 0x85, 0xb4, 0x3d,
-  0x12, 0x63, 0x20, 0x49, 0x50, 0xf0, 0xe2, 0xe0, 0x13, 0xfa, 0xc1, 0x72,
-  0x88, 0x22, 0x34, 0xfc, 0x9e, 0x02, 0x17, 0x79, 0x70, 0x33, 0x95, 0x8a,
-  0x53, 0xa8, 0x91, 0x83, 0x4a, 0x7c, 0xb5, 0x66, 0x9b, 0x38, 0xca, 0x0d,
-  0x32, 0x61, 0xdb, 0x6f, 0xf3, 0xa7, 0x70, 0x1a, 0x6f, 0xba, 0x81, 0x59,
-  0xa6, 0xbd, 0xd0, 0x60, 0x20, 0xe8, 0x31, 0x42, 0xb2, 0xe6, 0x74, 0x1f,
-  0x60, 0xb3, 0x2d, 0xc0, 0x08, 0x8c, 0x84, 0x58, 0xcf, 0x7d, 0x95, 0x65,
-  0x33, 0xb6, 0x05, 0x6e, 0x6b, 0xb1, 0xa7, 0xda, 0xe5, 0x61, 0x94, 0x25,
-  0xb5, 0x4b, 0xf1, 0x6d, 0x57, 0x1a, 0x08, 0x78, 0x4a, 0x7b, 0x00, 0x49,
-  0x62, 0x1b, 0x48, 0x12, 0xbb, 0x74, 0xad, 0xf0, 0xa1, 0x8d, 0x15, 0xa8,
-  0xf1, 0x37, 0x73, 0x99, 0x9d, 0xf4, 0x57, 0x17, 0x7e, 0x48, 0x35, 0x71,
-  0x9f, 0x07, 0xab, 0x7e, 0xf5, 0x55, 0x01, 0x6b, 0x5a, 0x31, 0xa3, 0xa2,
-  0x87, 0x4c, 0xf1, 0x93, 0x17, 0x92, 0xde, 0xb9, 0xb1, 0x3f, 0x03, 0x5a,
-  0xdd, 0x52, 0x70, 0x42, 0x3c, 0x79, 0x21, 0xf2, 0xe7, 0x2b, 0xcb, 0x40,
-  0x6b, 0xdd, 0x22, 0x57, 0x7f, 0x60, 0x37, 0x57, 0xce, 0xbd, 0x5c, 0xa9,
-  0x9d, 0xec, 0x33, 0xbf, 0xc6, 0x56, 0x15, 0x38, 0x59, 0xa6, 0x8a, 0x61,
-  0x78, 0x6a, 0xc6, 0x54, 0x54, 0xfa, 0x87, 0xf5, 0x7a, 0x94, 0x64, 0x2a,
-  0x65, 0x94, 0x16, 0xc9, 0xdd, 0x47, 0x9e, 0x67, 0xca, 0xe5, 0x16, 0x0e,
-  0x37, 0x1e, 0x27, 0xc8, 0x5e, 0xf5, 0x56, 0xba, 0xfd, 0x28, 0xed, 0x89,
-  0xa2, 0x40, 0x3d, 0xfe, 0x00, 0xb7, 0xe2, 0x53, 0x1a, 0x97, 0x32, 0x66,
-  0x19, 0x39, 0xf3, 0xa7, 0xdb, 0x5f, 0x49, 0x3e, 0xc1, 0xeb, 0xa8, 0x8f,
-  0x49, 0xf1, 0xa6, 0xfc, 0x1c, 0xcf, 0x4a, 0x91, 0xeb, 0x93, 0x5b, 0x57,
-  0x41, 0x82, 0x20, 0x82, 0x3a, 0x07, 0x85, 0x49, 0x30, 0xb0, 0x07, 0x83,
-  0xf9, 0x26, 0x30, 0xa3, 0xfd, 0xd8, 0x8c, 0xd9, 0x30, 0x23, 0x86, 0xb9,
-  0x8b, 0x98, 0xdc, 0x74, 0xe3, 0xc4, 0x44, 0x07, 0x18, 0xfa, 0x0c, 0xef,
-  0x37, 0x16, 0xde, 0x6f, 0x31, 0x24, 0x0b, 0xe6, 0x5c, 0x5a, 0x94, 0xac,
-  0x9b, 0x72, 0xaa, 0x3c, 0x68, 0x1d, 0x36, 0x0f, 0xaf, 0x3b, 0xac, 0xf9,
-  0x97, 0x67, 0x47, 0x27, 0x53, 0xa0, 0x86, 0x6e, 0xfe, 0xe5, 0x17, 0x6a,
-  0xff, 0x05, 0xfe, 0x53, 0x26, 0x7f, 0x21, 0xe2, 0x36, 0xbb, 0x68, 0xd2,
-  0x2a, 0x41, 0xc0, 0xdc, 0x9c, 0x2c, 0x94, 0x6b, 0xfd, 0xd2, 0xc4, 0xa3,
-  0x56, 0xaf, 0x09, 0x32, 0x00, 0x80, 0x74, 0x75, 0xa5, 0x67, 0x76, 0x16,
-  0xab, 0xfe, 0xe3, 0x7f, 0x02, 0xef, 0xf7, 0x97, 0xde, 0xdf, 0x7d, 0xef,
-  0xe4, 0x57, 0x5a, 0xff, 0xb7, 0x66, 0x5b, 0x06, 0x85, 0x16, 0x0e, 0xa6,
-  0xeb, 0x5f, 0x94, 0x30, 0x12, 0x4c, 0xf8, 0x0b, 0x5b, 0xe7, 0xf1, 0x0c,
-  0xad, 0xa5, 0x35, 0x90, 0xb2, 0xb8, 0xe7, 0xa7, 0xc5, 0x97, 0x14, 0x36,
-  0xea, 0xbf, 0xa4, 0xb0, 0x21, 0xbf, 0xa4, 0xb0, 0xd1, 0x3b, 0x6a, 0xa8,
-  0x2f, 0x29, 0xa4, 0xcf, 0xf4, 0x25, 0x83, 0x8d, 0xd9, 0x26, 0xc5, 0xb7,
-  0xfd, 0x5f, 0xa3, 0x4c, 0x34, 0x18, 0xfe, 0x73, 0x04, 0xaf, 0x92, 0xcf,
-  0x67, 0x0d, 0xfc, 0x66, 0x83, 0xfe, 0x70, 0x84, 0x7f, 0x61, 0x21, 0xf9,
-  0x5d, 0x86, 0x8d, 0x0f, 0x7d, 0x7f, 0xdc, 0x19, 0xfb, 0xef, 0x7a, 0xc7,
-  0xa3, 0x9f, 0x86, 0xa3, 0x60, 0x30, 0xee, 0xc0, 0x1f, 0x7a, 0x15, 0xd4,
-  0x3b, 0x19, 0x75, 0xfc, 0x9f, 0xa0, 0x6b, 0x30, 0x7e, 0xd9, 0x1b, 0x75,
-  0xe0, 0x8f, 0x78, 0x43, 0xf4, 0xa8, 0xdf, 0x39, 0x19, 0xfd, 0xd4, 0xc7,
-  0xb7, 0xaa, 0x8c, 0x56, 0xfa, 0xfc, 0xae, 0xda, 0xea, 0xf5, 0x46, 0x3f,
-  0x9d, 0x8c, 0x2c, 0x00, 0x62, 0xc5, 0xbf, 0x7f, 0x00, 0xf8, 0xb0, 0x22,
-  0x80, 0x83, 0x3f, 0x34, 0xb8, 0x33, 0x1a, 0x88, 0x15, 0x4f, 0x46, 0x7f,
-  0xc7, 0x24, 0x3b, 0xe2, 0x88, 0xb7, 0x7d, 0xb7, 0xd7, 0xea, 0xce, 0x4f,
-  0x9c, 0x53, 0x66, 0xd0, 0x54, 0x4f, 0x7a, 0x51, 0x0c, 0x5c, 0x13, 0x88,
-  0x91, 0x44, 0x96, 0x42, 0xaf, 0xd8, 0x0a, 0xbd, 0x9c, 0xf0, 0x0b, 0x95,
-  0x79, 0x14, 0xef, 0xe4, 0x3e, 0x41, 0x7f, 0x17, 0x76, 0x0a, 0xc9, 0x16,
-  0x48, 0x52, 0x18, 0x52, 0xa5, 0x52, 0x16, 0x1c, 0x3b, 0xe8, 0x7c, 0x02,
-  0x8b, 0xf4, 0x23, 0x5d, 0x45, 0x31, 0xf1, 0x2a, 0x14, 0xf5, 0x00, 0xc7,
-  0xf9, 0x32, 0xdc, 0x86, 0x88, 0xa8, 0x17, 0x35, 0xac, 0xa8, 0x03, 0xe0,
-  0x6d, 0x94, 0x6d, 0xc0, 0x57, 0x12, 0x2b, 0x8b, 0x83, 0x19, 0x55, 0x12,
-  0xf7, 0xb0, 0x23, 0xc7, 0x0d, 0x43, 0xea, 0xb3, 0x3a, 0x38, 0xdf, 0xf6,
-  0x9f, 0xb0, 0x45, 0x67, 0x90, 0xbf, 0x8b, 0xb2, 0x1c, 0x94, 0x6b, 0x95,
-  0xdc, 0x72, 0x7c, 0xcb, 0x40, 0xec, 0xba, 0x48, 0x2c, 0xa1, 0xfe, 0xbd,
-  0x0f, 0x29, 0xa2, 0x52, 0x1a, 0x09, 0x98, 0xef, 0x34, 0x0d, 0x2e, 0x25,
-  0xd5, 0xb9, 0xaa, 0x6d, 0xfe, 0xa3, 0x58, 0xaf, 0xad, 0x92, 0x71, 0x1c,
-  0x4e, 0x29, 0xf0, 0xdc, 0x0a, 0x4c, 0xc1, 0xe0, 0xda, 0x68, 0x0a, 0x12,
-  0x5e, 0xc0, 0x21, 0xa0, 0x79, 0xa6, 0x2c, 0x2c, 0x25, 0xbf, 0xb7, 0x71,
-  0xa5, 0x52, 0xe2, 0x5c, 0x39, 0xa2, 0x04, 0x9b, 0xf6, 0x05, 0x71, 0x95,
-  0x7c, 0x06, 0x08, 0xb5, 0xe1, 0x9d, 0x40, 0xf5, 0x5d, 0x14, 0x72, 0x59,
-  0xa2, 0xcc, 0xa8, 0x1a, 0x1a, 0x37, 0x8a, 0x87, 0x18, 0x1c, 0x24, 0xdb,
-  0x56, 0x2a, 0x57, 0x2e, 0xbb, 0x56, 0xd2, 0x51, 0xef, 0x2e, 0x28, 0xa2,
-  0x28, 0xb3, 0xb2, 0xdd, 0xa6, 0xa3, 0x8a, 0x5a, 0x23, 0xfe, 0x16, 0xbf,
-  0x46, 0x54, 0x97, 0x19, 0xef, 0x23, 0xf3, 0x38, 0x16, 0xd6, 0xa0, 0xef,
-  0x1f, 0x6d, 0xb5, 0x6d, 0xc5, 0xab, 0xd6, 0x70, 0xeb, 0x2c, 0xe8, 0xdd,
-  0x8e, 0x74, 0x45, 0x95, 0x12, 0x4a, 0xb4, 0xb0, 0x74, 0x7c, 0x8f, 0x99,
-  0x6a, 0xf7, 0x4a, 0xca, 0xee, 0x1c, 0x51, 0xf9, 0x99, 0x22, 0xa7, 0x3a,
-  0x5a, 0xef, 0x76, 0x86, 0xee, 0xb8, 0x7a, 0x99, 0xa0, 0x15, 0x6e, 0xef,
-  0x4a, 0x92, 0x69, 0x4b, 0xa1, 0xa9, 0x26, 0x9d, 0xe2, 0xd7, 0x4b, 0x2e,
-  0xac, 0x01, 0x89, 0xb6, 0x69, 0x25, 0x98, 0xeb, 0xce, 0x6e, 0x7b, 0xf4,
-  0xbb, 0x87, 0xd4, 0x1a, 0x19, 0x94, 0xa7, 0x9a, 0xa1, 0x2f, 0x6d, 0x88,
-  0xac, 0x3c, 0xcd, 0xdd, 0xae, 0x7c, 0x8f, 0x8b, 0x0d, 0x6e, 0xb9, 0x96,
-  0xf7, 0x5d, 0x5a, 0x26, 0xd5, 0xfb, 0x21, 0x5a, 0x12, 0xf1, 0xea, 0x6e,
-  0x5b, 0x46, 0x56, 0xbe, 0x41, 0x22, 0xb0, 0xc4, 0x7f, 0x43, 0xa0, 0xb4,
-  0xec, 0x85, 0x74, 0x59, 0x7f, 0xd9, 0xf4, 0xfd, 0xbe, 0xb8, 0xf7, 0xc0,
-  0x51, 0x80, 0x37, 0x16, 0x36, 0xa2, 0x59, 0xc5, 0x52, 0xe7, 0xa7, 0x1e,
-  0x61, 0x82, 0xbd, 0x46, 0x0a, 0x1a, 0x56, 0xf9, 0x86, 0x42, 0x8b, 0xb3,
-  0x5e, 0x25, 0x11, 0x6d, 0x7a, 0x86, 0x10, 0x83, 0xf3, 0x4c, 0xdc, 0xd1,
-  0xea, 0x0c, 0x21, 0x56, 0x06, 0x9c, 0xe1, 0x45, 0xda, 0x7b, 0x24, 0x11,
-  0x1c, 0x4f, 0xd5, 0xa9, 0xe5, 0xb5, 0xea, 0x93, 0xdd, 0x3a, 0xda, 0xc0,
-  0x7c, 0x34, 0xf8, 0xdb, 0xca, 0x65, 0xc7, 0x20, 0x7c, 0x86, 0xf2, 0xab,
-  0x17, 0xc1, 0x75, 0xdb, 0xd3, 0x3a, 0x9a, 0xe9, 0x97, 0x71, 0x9a, 0xd3,
-  0x32, 0xc1, 0xa8, 0xb2, 0x7b, 0x6a, 0x7a, 0xfd, 0x45, 0x10, 0xcf, 0x84,
-  0x9c, 0x20, 0x06, 0x2f, 0x5e, 0x88, 0xcd, 0x9e, 0xb3, 0xbe, 0xff, 0xff,
-  0xb4, 0xfa, 0xa3, 0x94, 0xfd, 0xc7, 0x0e, 0x1b, 0xca, 0x4c, 0xd5, 0x63,
-  0xc9, 0xe8, 0x19, 0x6f, 0x5b, 0x14, 0x77, 0x3e, 0x44, 0x7e, 0x43, 0x7f,
-  0x21, 0x54, 0xd9, 0xd3, 0x8f, 0xd0, 0x17, 0xe1, 0xdb, 0x84, 0x54, 0x9b,
-  0x61, 0x3d, 0x85, 0x22, 0xa4, 0x4c, 0x5f, 0x10, 0x0a, 0x25, 0x66, 0x81,
-  0xb6, 0x2d, 0x09, 0xde, 0x27, 0x29, 0x7d, 0x51, 0x17, 0x86, 0x32, 0x34,
-  0xa1, 0xdd, 0xd2, 0x34, 0xb9, 0x93, 0x42, 0xba, 0x3b, 0x24, 0xcc, 0xc2,
-  0x0f, 0x31, 0x6e, 0x31, 0x85, 0xdc, 0xc8, 0x4b, 0x02, 0x18, 0x24, 0x24,
-  0x65, 0xc5, 0xf3, 0x45, 0x12, 0x82, 0x1b, 0xf9, 0xe9, 0xfb, 0x8b, 0xcb,
-  0x66, 0x47, 0x78, 0x77, 0xf4, 0xef, 0xfe, 0x40, 0xd4, 0xff, 0x40, 0x19,
-  0x62, 0x64, 0x89, 0x77, 0x79, 0xbf, 0xe6, 0x4d, 0x4c, 0x67, 0xac, 0xd7,
-  0x10, 0x41, 0x50, 0xc2, 0xe2, 0x10, 0x6f, 0x3d, 0x9b, 0x40, 0x66, 0x9a,
-  0x84, 0x6f, 0x94, 0x4e, 0xd8, 0x7f, 0x5e, 0x7c, 0xff, 0x11, 0x8c, 0x02,
-  0xe6, 0x98, 0xa2, 0xf9, 0x7d, 0xeb, 0x81, 0x0e, 0xee, 0x09, 0xcb, 0x3a,
-  0xfa, 0xbc, 0x9a, 0x00, 0x95, 0x1e, 0xdb, 0xc4, 0x93, 0x3d, 0xaf, 0x54,
-  0x09, 0x7c, 0xbd, 0xa4, 0x23, 0x11, 0xc2, 0xee, 0x8a, 0x67, 0x59, 0x70,
-  0x4d, 0xd9, 0x4b, 0x20, 0x64, 0x8c, 0x1b, 0x04, 0xb1, 0xdf, 0xcc, 0x66,
-  0xd0, 0xae, 0x13, 0x5c, 0xf2, 0x9e, 0x46, 0xb6, 0xd6, 0xde, 0x5a, 0xeb,
-  0xba, 0xa7, 0x94, 0x8b, 0xab, 0xa6, 0xa9, 0x94, 0x25, 0x95, 0xcd, 0xac,
-  0x5e, 0xf3, 0x6a, 0x26, 0xbe, 0x2d, 0xdf, 0xee, 0x9a, 0xe1, 0xb3, 0xca,
-  0xa7, 0x94, 0x23, 0x67, 0x55, 0x09, 0x7a, 0xd3, 0x61, 0xb7, 0x95, 0x7b,
-  0x2d, 0x9e, 0x7f, 0x83, 0xee, 0xde, 0x0d, 0xb2, 0xf0, 0x0c, 0x3f, 0xdd,
-  0x6e, 0xbd, 0xe3, 0x92, 0x57, 0x50, 0x7a, 0x93, 0x42, 0xb4, 0x82, 0x5b,
-  0x42, 0x4a, 0x0b, 0x86, 0xd4, 0xd0, 0x2a, 0xca, 0x0e, 0x65, 0xd1, 0xef,
-  0x72, 0x88, 0x65, 0xaa, 0x32, 0x85, 0x28, 0x62, 0xd6, 0xeb, 0x2d, 0xa1,
-  0xd7, 0xa2, 0xdc, 0x57, 0x8f, 0x62, 0x13, 0xbf, 0xd9, 0x76, 0xb2, 0x4f,
-  0x50, 0x59, 0x92, 0x56, 0x8e, 0x78, 0x12, 0x45, 0x4d, 0xe4, 0xa8, 0x96,
-  0x5e, 0xab, 0xf1, 0x32, 0xd8, 0xa6, 0x84, 0x46, 0xce, 0x4c, 0xfb, 0x2a,
-  0xc9, 0xd6, 0x09, 0x45, 0x7e, 0xcc, 0xad, 0x50, 0x4a, 0x58, 0xfe, 0xdf,
-  0x34, 0x0a, 0xb6, 0x00, 0x3a, 0x84, 0xff, 0xe2, 0xde, 0x5b, 0x20, 0x61,
-  0xde, 0x5a, 0x06, 0xed, 0x0e, 0x6c, 0x22, 0xb6, 0x1b, 0x93, 0xf6, 0x17,
-  0xd2, 0x32, 0x97, 0x7e, 0x49, 0x69, 0x32, 0x14, 0xec, 0x8f, 0x71, 0x51,
-  0xeb, 0x85, 0xb8, 0xc6, 0xb3, 0xb5, 0xc2, 0x2e, 0xd6, 0xd2, 0x29, 0x25,
-  0xd9, 0x8c, 0x10, 0x45, 0xf1, 0x56, 0x8a, 0x03, 0xbe, 0x61, 0xe0, 0xfa,
-  0x30, 0xf5, 0xd2, 0x1a, 0x0b, 0xe2, 0x50, 0xe4, 0xaa, 0x66, 0x29, 0x87,
-  0xe0, 0x10, 0xff, 0x9d, 0xb3, 0x8c, 0xdd, 0x45, 0x30, 0xe4, 0x8a, 0x33,
-  0x9e, 0xe2, 0x3f, 0x79, 0xd6, 0x05, 0xd1, 0x94, 0x1c, 0xb3, 0x99, 0x4a,
-  0xf0, 0x90, 0x9b, 0x25, 0x4e, 0xaa, 0x2d, 0x3a, 0x85, 0x59, 0x56, 0x78,
-  0x48, 0x04, 0x4a, 0x86, 0xd8, 0x98, 0xb9, 0x3f, 0x79, 0x4a, 0x35, 0x40,
-  0x78, 0x15, 0x39, 0xd3, 0x75, 0x5f, 0xc5, 0x17, 0x8e, 0x14, 0xf4, 0x4a,
-  0xf0, 0x9e, 0x0a, 0xcb, 0x0c, 0x69, 0x57, 0x66, 0x35, 0x98, 0xe7, 0xa9,
-  0xd3, 0xc6, 0xaa, 0x11, 0x3b, 0xc5, 0xda, 0x8c, 0x6a, 0xd5, 0x98, 0xbc,
-  0xd5, 0x89, 0x62, 0xfb, 0x5e, 0xc7, 0x1a, 0xa8, 0x6f, 0x76, 0x44, 0xa1,
-  0xda, 0x0c, 0x8b, 0x86, 0xcc, 0xfe, 0xe7, 0xd0, 0xbf, 0xd5, 0x9b, 0xb2,
-  0x4b, 0x08, 0xab, 0xf1, 0xcf, 0xcb, 0x4d, 0x9e, 0xe8, 0x9a, 0x4a, 0x06,
-  0xb8, 0xd0, 0x5d, 0x10, 0xfc, 0x06, 0x0e, 0x4d, 0xc8, 0xca, 0xe0, 0xaa,
-  0xa7, 0xac, 0xe7, 0xa3, 0xb1, 0xf1, 0x8b, 0x44, 0x08, 0x34, 0xef, 0xb9,
-  0x30, 0x66, 0x87, 0xb4, 0xbf, 0x2d, 0xbe, 0xc8, 0xe4, 0x8c, 0xb5, 0xe4,
-  0x2d, 0x9f, 0xb9, 0x1b, 0xbc, 0xc8, 0xc2, 0xd6, 0xaf, 0x61, 0x35, 0xbf,
-  0x5d, 0x64, 0x48, 0xab, 0x04, 0xa5, 0x6a, 0x97, 0x87, 0x83, 0xba, 0x8b,
-  0x4e, 0x72, 0xfd, 0xf2, 0x5d, 0x17, 0xc0, 0x26, 0x59, 0xc4, 0xbc, 0x3c,
-  0x77, 0xdd, 0xa6, 0xeb, 0xca, 0x53, 0x7e, 0x95, 0x24, 0xb9, 0x2c, 0xc5,
-  0xfc, 0x81, 0x1e, 0xb4, 0x08, 0x02, 0xc6, 0xea, 0x35, 0xf5, 0x6a, 0x39,
-  0xb9, 0xfc, 0x46, 0x15, 0x5d, 0x41, 0x6e, 0x04, 0x19, 0x02, 0xe6, 0x05,
-  0x31, 0xb6, 0x67, 0x78, 0xa9, 0x69, 0xb4, 0xdb, 0x47, 0xd5, 0x73, 0x85,
-  0xd8, 0xe9, 0xa9, 0x3b, 0x37, 0x6e, 0x6c, 0xa4, 0x69, 0x1d, 0xd9, 0x05,
-  0x36, 0x92, 0xc2, 0x25, 0x2f, 0x32, 0x8d, 0xd0, 0x2f, 0xca, 0xcb, 0x32,
-  0xf4, 0x03, 0x0f, 0xa3, 0xd4, 0xf2, 0x8c, 0xa6, 0x60, 0x03, 0x62, 0x50,
-  0xa0, 0xae, 0xeb, 0x84, 0x3f, 0x30, 0x3c, 0xd7, 0x07, 0x27, 0x38, 0x9b,
-  0xb4, 0x54, 0xc0, 0xa0, 0x31, 0x03, 0xa9, 0x40, 0x37, 0xf5, 0x51, 0x79,
-  0x9e, 0x3d, 0xe5, 0x2d, 0xd8, 0x91, 0x8d, 0x7d, 0xa3, 0x9c, 0x16, 0x22,
-  0xf6, 0x50, 0x08, 0x94, 0x2e, 0xef, 0x6c, 0x1b, 0x79, 0xe8, 0x92, 0x9e,
-  0x92, 0x62, 0xae, 0x82, 0xcf, 0x2d, 0xbf, 0x63, 0x2a, 0x69, 0x01, 0xb0,
-  0x2d, 0x27, 0x09, 0x93, 0x20, 0x1f, 0xcc, 0xc2, 0x51, 0x93, 0x8b, 0x72,
-  0x9c, 0xc6, 0xda, 0xc6, 0xd8, 0x14, 0xe4, 0x1a, 0x3c, 0xcb, 0x1c, 0xb1,
-  0x7a, 0xa7, 0xce, 0x9a, 0x55, 0x97, 0x79, 0x23, 0xcb, 0x7e, 0xa8, 0xd5,
-  0x9e, 0xec, 0x1b, 0xca, 0x8e, 0xec, 0xb9, 0xc8, 0xf9, 0x5a, 0xd8, 0x28,
-  0x12, 0x28, 0x39, 0xac, 0x68, 0xb5, 0x6c, 0xa1, 0xae, 0xf2, 0xde, 0x37,
-  0x88, 0x2c, 0xd5, 0x8c, 0x17, 0x59, 0x09, 0x6b, 0xf5, 0x33, 0x43, 0xc7,
-  0x6d, 0xb4, 0x7a, 0x42, 0x64, 0x1d, 0xb1, 0xcc, 0xcb, 0x94, 0x63, 0x65,
-  0x30, 0xc3, 0xaf, 0x94, 0xfa, 0xa6, 0x59, 0x0c, 0xb3, 0x8a, 0x16, 0xaa,
-  0xa5, 0xec, 0xcc, 0xfc, 0x2a, 0x2a, 0x39, 0xad, 0xce, 0x65, 0x75, 0xe1,
-  0xd9, 0x23, 0xbe, 0x94, 0x48, 0xe7, 0xc2, 0xcf, 0xac, 0x82, 0x97, 0xa1,
-  0xd6, 0x0e, 0xd4, 0x50, 0xd2, 0x51, 0xca, 0x07, 0x85, 0x4f, 0x6c, 0x5f,
-  0x99, 0x54, 0x38, 0xc6, 0xb6, 0x2c, 0xbc, 0x57, 0x60, 0x6e, 0x1f, 0xd2,
-  0x8a, 0x51, 0xd7, 0x88, 0xf2, 0x17, 0x0c, 0x24, 0x9a, 0xea, 0x7d, 0x86,
-  0xa2, 0xd2, 0xe5, 0x2b, 0xdb, 0x6f, 0x66, 0xca, 0x71, 0xdd, 0x2f, 0x12,
-  0xc0, 0xf2, 0x6f, 0x45, 0x34, 0x79, 0xba, 0x7f, 0x29, 0x0e, 0xb8, 0x43,
-  0xe2, 0xb2, 0x83, 0x6c, 0xbd, 0x81, 0xf0, 0x14, 0x5d, 0x30, 0xdf, 0x68,
-  0x28, 0x94, 0xc1, 0xd6, 0x3a, 0x53, 0x1b, 0x4a, 0xfa, 0xf8, 0xe5, 0xd4,
-  0x41, 0xdb, 0x83, 0x27, 0xea, 0x43, 0x05, 0x55, 0x52, 0x88, 0x8a, 0xd9,
-  0x70, 0xa1, 0xa8, 0xdf, 0xd3, 0xd8, 0xc1, 0x0c, 0x05, 0x6c, 0xa7, 0x3e,
-  0x54, 0x8d, 0x15, 0xab, 0x5b, 0x17, 0x0d, 0x3c, 0x0e, 0x7d, 0xaa, 0x4a,
-  0x68, 0x5c, 0xea, 0x5d, 0xd7, 0x5a, 0xc7, 0xd5, 0x58, 0x96, 0x7c, 0xe7,
-  0xd4, 0x3e, 0xeb, 0x2a, 0x9e, 0x6c, 0xad, 0xd0, 0xab, 0x6f, 0x11, 0xcb,
-  0xb6, 0x81, 0xb0, 0x7c, 0xff, 0xf7, 0x10, 0x5a, 0x0a, 0x4b, 0xaf, 0xf4,
-  0x0a, 0xdc, 0x11, 0xf9, 0xba, 0xc5, 0xe9, 0x21, 0x7d, 0x4f, 0xd5, 0xe9,
-  0xa1, 0xf8, 0xa7, 0xc7, 0xff, 0x0f, 0xf3, 0x35, 0x7f, 0x20, 0x8b, 0x7c,
-  0x00, 0x00
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb4, 0x3c,
+  0x6b, 0x73, 0xdb, 0x38, 0x92, 0xdf, 0xfd, 0x2b, 0x30, 0x72, 0x65, 0x29,
+  0x25, 0xa2, 0x4c, 0x3d, 0x2d, 0x4b, 0x96, 0xf7, 0x12, 0x8f, 0xb3, 0x49,
+  0xd5, 0x38, 0x49, 0x8d, 0x9d, 0xdd, 0x9b, 0xda, 0x9b, 0xba, 0x82, 0x48,
+  0x48, 0xe2, 0x98, 0x22, 0x75, 0x24, 0x65, 0xc7, 0xa3, 0xf5, 0x7f, 0xbf,
+  0x6e, 0x00, 0x24, 0x01, 0x12, 0x94, 0xe5, 0x99, 0x4c, 0x52, 0xb6, 0x48,
+  0x3c, 0x1a, 0x8d, 0x7e, 0x77, 0x03, 0xf2, 0xf9, 0x0f, 0x3f, 0x7e, 0xbe,
+  0xbc, 0xfd, 0xe5, 0xcb, 0x15, 0x59, 0xa5, 0xeb, 0xe0, 0xe2, 0xe8, 0x9c,
+  0x7f, 0x9c, 0xaf, 0x18, 0xf5, 0xe0, 0x65, 0xcd, 0x52, 0x4a, 0xdc, 0x15,
+  0x8d, 0x13, 0x96, 0xce, 0x1a, 0xdb, 0x74, 0x61, 0x8f, 0x1b, 0x59, 0x73,
+  0x48, 0xd7, 0x6c, 0xd6, 0xb8, 0xf7, 0xd9, 0xc3, 0x26, 0x8a, 0xd3, 0x06,
+  0x71, 0xa3, 0x30, 0x65, 0x21, 0x0c, 0x7b, 0xf0, 0xbd, 0x74, 0x35, 0xf3,
+  0xd8, 0xbd, 0xef, 0x32, 0x9b, 0xbf, 0xb4, 0xfd, 0xd0, 0x4f, 0x7d, 0x1a,
+  0xd8, 0x89, 0x4b, 0x03, 0x36, 0xeb, 0x22, 0x8c, 0xd4, 0x4f, 0x03, 0x76,
+  0x71, 0xb3, 0xa6, 0x41, 0x70, 0xfb, 0xcf, 0xf3, 0x13, 0xf1, 0x7a, 0x74,
+  0x9e, 0xa4, 0x8f, 0xf8, 0xf9, 0x7a, 0x37, 0x8f, 0xbe, 0xd9, 0x89, 0xff,
+  0xbb, 0x1f, 0x2e, 0x27, 0xf3, 0x28, 0xf6, 0x58, 0x6c, 0x43, 0xcb, 0x74,
+  0x4d, 0xe3, 0xa5, 0x1f, 0x4e, 0x9c, 0xe9, 0x86, 0x7a, 0x1e, 0xf6, 0x39,
+  0x4f, 0x47, 0x47, 0x93, 0x38, 0x8a, 0xd2, 0xdd, 0x11, 0x21, 0xb6, 0x3d,
+  0x5f, 0x4e, 0x8e, 0x17, 0xbd, 0x45, 0x97, 0x79, 0x53, 0xfe, 0x9e, 0x6c,
+  0xe3, 0x05, 0x75, 0x19, 0x34, 0xd2, 0xc5, 0xd9, 0xe2, 0x54, 0x6b, 0xec,
+  0x4d, 0x8e, 0xd9, 0x82, 0x79, 0x6c, 0x2c, 0x5a, 0xc5, 0x2a, 0x93, 0x78,
+  0x39, 0xa7, 0xcd, 0x33, 0xa7, 0x3d, 0x76, 0xda, 0xa3, 0x61, 0xbb, 0xd3,
+  0x6d, 0x89, 0xde, 0x94, 0x7d, 0x4b, 0x27, 0xc7, 0x7d, 0xda, 0x1f, 0xf4,
+  0xc6, 0x45, 0x0b, 0x80, 0x38, 0x1d, 0x9f, 0x3a, 0xc3, 0x45, 0xd1, 0xd4,
+  0x9f, 0x1c, 0xd3, 0xe1, 0x99, 0x37, 0x66, 0xa2, 0x89, 0xba, 0x2e, 0x10,
+  0x05, 0x86, 0xb1, 0xb3, 0xc1, 0xa8, 0xa7, 0xb6, 0xd9, 0xab, 0xe8, 0x1e,
+  0xd6, 0x3b, 0x1e, 0xb1, 0x71, 0x7f, 0x38, 0xd0, 0x7a, 0x3c, 0x7f, 0x2d,
+  0xf0, 0xe8, 0xf6, 0x46, 0xed, 0xee, 0x60, 0xdc, 0x3e, 0x1b, 0x17, 0x98,
+  0x14, 0x63, 0x7a, 0x86, 0x41, 0x63, 0x39, 0xca, 0xa3, 0xe1, 0x12, 0xa1,
+  0xcf, 0x17, 0xc3, 0xc5, 0x70, 0xa8, 0xb6, 0x29, 0xd0, 0xcf, 0xba, 0xed,
+  0xb3, 0x61, 0x7b, 0x0c, 0xdb, 0x74, 0xb2, 0x79, 0x31, 0xf5, 0xfc, 0x6d,
+  0x32, 0xe9, 0x8e, 0x36, 0xdf, 0xd4, 0x06, 0x3b, 0x59, 0x4f, 0xba, 0xdd,
+  0xac, 0x2d, 0x59, 0x51, 0x2f, 0x7a, 0x98, 0x38, 0x04, 0x5a, 0x48, 0x1f,
+  0x7e, 0x04, 0x38, 0xc7, 0x69, 0x03, 0xe1, 0x4e, 0x1d, 0x00, 0x37, 0x6a,
+  0xb5, 0x89, 0x43, 0x06, 0xd0, 0xd5, 0xed, 0x99, 0xfa, 0x07, 0x2d, 0x15,
+  0x92, 0x24, 0x85, 0x43, 0x70, 0xec, 0xd8, 0x30, 0xbe, 0xcb, 0xc1, 0x01,
+  0x4e, 0xa4, 0xe7, 0x98, 0x97, 0x9b, 0x1e, 0x81, 0x20, 0xcc, 0x23, 0xef,
+  0x11, 0xe5, 0x60, 0x01, 0xa2, 0x68, 0x2f, 0xe8, 0xda, 0x0f, 0x1e, 0x27,
+  0x36, 0xdd, 0x6c, 0x02, 0x66, 0x27, 0x8f, 0x49, 0xca, 0xd6, 0xed, 0x77,
+  0x81, 0x1f, 0xde, 0x5d, 0x53, 0xf7, 0x86, 0xbf, 0xbe, 0x87, 0x71, 0x6d,
+  0xeb, 0x86, 0x2d, 0x23, 0x46, 0xbe, 0x7e, 0xb4, 0xda, 0x62, 0x90, 0xbd,
+  0xf5, 0xdb, 0x09, 0x0d, 0x61, 0xcf, 0x2c, 0xf6, 0x39, 0x67, 0xe7, 0xd4,
+  0xbd, 0x5b, 0xc6, 0xd1, 0x36, 0xf4, 0x26, 0xf7, 0x34, 0x6e, 0xa2, 0x98,
+  0x71, 0xfc, 0xdd, 0x28, 0x88, 0x62, 0xd9, 0x84, 0xbc, 0xe7, 0x8d, 0x6b,
+  0xfa, 0x4d, 0x48, 0xfd, 0x64, 0x30, 0x72, 0x04, 0xc5, 0x32, 0xa9, 0x25,
+  0x74, 0x9b, 0x46, 0xd8, 0x90, 0x4b, 0x2f, 0xec, 0xaa, 0xdf, 0x13, 0x83,
+  0x38, 0xd2, 0x20, 0xf1, 0x2c, 0x27, 0x3e, 0xe0, 0xca, 0xec, 0x15, 0xf3,
+  0x97, 0xab, 0x74, 0xd2, 0xed, 0x70, 0x26, 0xae, 0xfd, 0x30, 0x6f, 0x71,
+  0x9c, 0xfb, 0x15, 0xa7, 0xe2, 0x03, 0x9b, 0xdf, 0xf9, 0xb0, 0x61, 0x0e,
+  0x60, 0x0d, 0xba, 0xb0, 0x42, 0xd8, 0x34, 0x44, 0x95, 0xf3, 0x69, 0x82,
+  0xba, 0x00, 0xc4, 0x39, 0x79, 0x0d, 0xf4, 0xb6, 0x6d, 0x72, 0x1b, 0x6d,
+  0x60, 0x43, 0x31, 0x69, 0xa2, 0x8e, 0xb3, 0x98, 0xbc, 0x21, 0x29, 0x9d,
+  0x27, 0x2d, 0xd1, 0xf9, 0xfa, 0xe4, 0xa8, 0x93, 0x46, 0x1b, 0x1b, 0x06,
+  0x20, 0x21, 0x3d, 0x3f, 0xd9, 0x04, 0xf4, 0x71, 0xb2, 0x08, 0x18, 0xc7,
+  0x08, 0xe0, 0x2d, 0x43, 0xdb, 0x07, 0x22, 0x25, 0x13, 0x94, 0x42, 0x16,
+  0xab, 0xbb, 0xe1, 0xbc, 0xe1, 0xbf, 0x1c, 0xde, 0x1c, 0x25, 0xa0, 0xf5,
+  0x51, 0x38, 0x49, 0x52, 0xdf, 0xbd, 0x7b, 0xc4, 0x26, 0x00, 0x3d, 0x71,
+  0xf6, 0x51, 0xf4, 0x77, 0xdb, 0x0f, 0x3d, 0xf6, 0x6d, 0x32, 0x14, 0xa3,
+  0x32, 0xc5, 0x4f, 0xd3, 0x08, 0xe4, 0x0f, 0x00, 0x27, 0x51, 0xe0, 0x7b,
+  0x44, 0x4e, 0xe1, 0xbd, 0x9c, 0xf3, 0x1c, 0xe7, 0x80, 0x2d, 0xd2, 0xc3,
+  0x91, 0x5e, 0xd2, 0xcd, 0x64, 0xac, 0xb2, 0xc7, 0x8e, 0x39, 0x59, 0x05,
+  0x8b, 0x14, 0x90, 0x64, 0xd5, 0xdd, 0xe9, 0xec, 0xe9, 0xf4, 0xd8, 0x3a,
+  0xe7, 0xd8, 0x83, 0xe0, 0xc6, 0xd8, 0x71, 0x6a, 0x25, 0x22, 0x60, 0x29,
+  0x2c, 0x6a, 0x27, 0x1b, 0xea, 0x22, 0x99, 0xec, 0x0e, 0xe7, 0xb8, 0xba,
+  0x44, 0xc7, 0x13, 0x06, 0x4c, 0xc8, 0x0d, 0xa2, 0x25, 0x99, 0x2c, 0x31,
+  0x94, 0x84, 0x90, 0xca, 0x39, 0x74, 0x5e, 0x19, 0x69, 0xc8, 0xcd, 0x0f,
+  0x5f, 0x11, 0xb7, 0x0e, 0xba, 0x15, 0x83, 0xb0, 0x0b, 0x7a, 0xa7, 0x31,
+  0x08, 0xb4, 0xe0, 0x46, 0x31, 0x8d, 0x74, 0xfa, 0x49, 0x15, 0x8f, 0x4e,
+  0x14, 0xa2, 0xe0, 0xed, 0x4c, 0x2b, 0x08, 0xdb, 0xd3, 0x12, 0x28, 0x7d,
+  0x2b, 0xec, 0x00, 0x97, 0x63, 0x60, 0x8f, 0x3a, 0x0a, 0xed, 0x0c, 0x1f,
+  0x49, 0x43, 0x7f, 0x4d, 0xf9, 0xd2, 0x9b, 0x6d, 0x90, 0x30, 0xd2, 0xeb,
+  0x0c, 0x13, 0xc2, 0x40, 0x2e, 0x81, 0xd7, 0x76, 0xb4, 0x4d, 0x89, 0x1f,
+  0x2e, 0xd0, 0x41, 0x30, 0xc4, 0xe5, 0xbf, 0xee, 0xd8, 0xe3, 0x22, 0x06,
+  0xd7, 0x92, 0x10, 0x3e, 0x1a, 0xd1, 0x70, 0x5e, 0xb5, 0x41, 0xd8, 0x5f,
+  0xed, 0x0e, 0x5b, 0xf2, 0x09, 0x66, 0x0c, 0x4d, 0xa3, 0x47, 0xe6, 0xd1,
+  0xb8, 0x7f, 0x3a, 0xaf, 0x93, 0x78, 0x14, 0x93, 0x9c, 0x5d, 0x38, 0x2c,
+  0x0d, 0x77, 0x8a, 0xc8, 0x73, 0xeb, 0xd6, 0x1d, 0xc8, 0x5f, 0x25, 0xae,
+  0x84, 0x51, 0xc8, 0x0a, 0xee, 0xe5, 0xaf, 0x65, 0x19, 0x91, 0x2c, 0xcb,
+  0xe5, 0xab, 0x33, 0x1e, 0x56, 0xe5, 0xeb, 0x54, 0xc8, 0x57, 0x49, 0x94,
+  0x3a, 0x7d, 0xb1, 0xa8, 0xbb, 0x8d, 0x13, 0x80, 0xb9, 0x89, 0xfc, 0x5c,
+  0x27, 0x33, 0xe5, 0x8b, 0x59, 0x00, 0xc4, 0xbf, 0x67, 0x25, 0x29, 0xe0,
+  0x48, 0x90, 0x4e, 0x2f, 0xe1, 0xed, 0x80, 0x85, 0xcd, 0x3b, 0x17, 0x51,
+  0xbc, 0x9e, 0x6c, 0x37, 0x1b, 0x16, 0xbb, 0xc0, 0x20, 0x75, 0xd7, 0x13,
+  0x6e, 0xa3, 0x77, 0x65, 0xe4, 0x7b, 0xad, 0x62, 0x48, 0x87, 0xba, 0xb8,
+  0x92, 0x36, 0x46, 0x4a, 0x4c, 0x65, 0xd0, 0x64, 0x42, 0x17, 0x80, 0xea,
+  0x8e, 0xd3, 0x83, 0x07, 0x0e, 0x13, 0xcb, 0xd2, 0x10, 0x07, 0xa3, 0x14,
+  0x05, 0xdb, 0x54, 0x52, 0x90, 0x5b, 0x00, 0x67, 0x8a, 0x52, 0x0a, 0x96,
+  0xef, 0xd5, 0x34, 0x96, 0x36, 0x90, 0x6b, 0x82, 0x54, 0x96, 0x5e, 0x85,
+  0x03, 0x06, 0xa9, 0x55, 0x15, 0x09, 0x99, 0x87, 0x3f, 0x0e, 0x1a, 0x2c,
+  0xc5, 0x44, 0x5e, 0x0a, 0x8c, 0x14, 0x93, 0x08, 0xb8, 0x4b, 0x34, 0x55,
+  0x21, 0xc9, 0x38, 0x9a, 0x1b, 0xc0, 0x81, 0x66, 0x00, 0x51, 0x86, 0x26,
+  0x5d, 0x5d, 0x05, 0x16, 0x60, 0x73, 0x3f, 0x86, 0x40, 0x78, 0xa9, 0x03,
+  0x39, 0x89, 0x25, 0xf8, 0x8c, 0x86, 0xd9, 0x12, 0xf3, 0x20, 0x72, 0xef,
+  0x34, 0xb5, 0x10, 0x10, 0x76, 0x8b, 0x38, 0x5a, 0xef, 0x22, 0x94, 0x83,
+  0xf4, 0x11, 0x08, 0x53, 0x70, 0x8f, 0x3f, 0x01, 0xcf, 0xd9, 0x2f, 0x4d,
+  0x90, 0xf8, 0xd6, 0x53, 0x1a, 0xe5, 0xc3, 0xba, 0xe6, 0x61, 0x4e, 0xeb,
+  0x49, 0xd9, 0xfc, 0x0d, 0x73, 0x11, 0x53, 0xd2, 0x74, 0x69, 0xec, 0xa9,
+  0x7e, 0x21, 0x11, 0x1d, 0x46, 0xc3, 0x20, 0x43, 0x2a, 0x03, 0x8d, 0x45,
+  0xbf, 0x78, 0x69, 0x95, 0xbd, 0x85, 0x62, 0x7d, 0x33, 0x23, 0x9f, 0xa9,
+  0x51, 0xa1, 0xbd, 0x72, 0x05, 0xfe, 0xa2, 0x2c, 0xb0, 0xd7, 0x1f, 0x48,
+  0x5c, 0x27, 0x01, 0x4d, 0x52, 0xdb, 0x5d, 0xf9, 0x81, 0xb7, 0xd3, 0xd7,
+  0x71, 0x8a, 0x41, 0x36, 0x8f, 0x3d, 0x75, 0x1b, 0xdf, 0x39, 0x95, 0x3a,
+  0x68, 0x56, 0xd6, 0x7a, 0x85, 0xa9, 0xa8, 0x68, 0xb7, 0x33, 0x52, 0xfc,
+  0xbb, 0xae, 0xcd, 0xa5, 0xad, 0x8f, 0x84, 0x9d, 0x29, 0x38, 0x91, 0xd2,
+  0x74, 0x9b, 0x90, 0x38, 0x7a, 0x48, 0x14, 0x2e, 0xf0, 0x46, 0x1b, 0x1a,
+  0x4d, 0xe6, 0xea, 0xb7, 0x2d, 0x38, 0xdb, 0xc5, 0x63, 0x26, 0x4d, 0x13,
+  0xc4, 0x82, 0xd9, 0x73, 0x96, 0x3e, 0x30, 0x16, 0x3e, 0xef, 0xc1, 0xbb,
+  0xb9, 0xec, 0x1e, 0xee, 0x7a, 0x0b, 0x84, 0x54, 0x6a, 0xeb, 0xf3, 0x51,
+  0x51, 0x8a, 0xa1, 0x01, 0x9d, 0xb3, 0xc0, 0x60, 0x49, 0xa6, 0x0a, 0xfd,
+  0xcf, 0x80, 0xfe, 0xc5, 0x8c, 0x7b, 0x1a, 0x6c, 0xd9, 0xae, 0xea, 0x5c,
+  0x4b, 0x13, 0xa6, 0x2a, 0x8d, 0x47, 0x0e, 0xf2, 0x78, 0x4e, 0xbd, 0x25,
+  0x53, 0x29, 0xe5, 0x73, 0xef, 0x66, 0x73, 0xbd, 0xda, 0x63, 0x2d, 0x72,
+  0xef, 0x65, 0x30, 0x66, 0x2a, 0xc5, 0xd0, 0x05, 0x75, 0x1d, 0x93, 0x97,
+  0xce, 0xe4, 0x5b, 0x15, 0xaa, 0x71, 0xd5, 0xb0, 0x8f, 0x1c, 0xdd, 0xf6,
+  0x7c, 0x0c, 0x37, 0xdb, 0xb4, 0xe0, 0xb7, 0xa0, 0x95, 0x82, 0x7f, 0x8e,
+  0xb8, 0xea, 0x30, 0xc6, 0x66, 0x61, 0xed, 0xb5, 0xaa, 0x52, 0x66, 0x90,
+  0xc6, 0x91, 0xd9, 0xb7, 0x48, 0xb7, 0xe7, 0x23, 0x42, 0xff, 0x4e, 0x1f,
+  0x37, 0x6c, 0x86, 0x30, 0x7f, 0x6d, 0x2b, 0x0d, 0x1b, 0x9a, 0x24, 0x0f,
+  0xb0, 0x6b, 0xad, 0x31, 0xdc, 0xae, 0xe7, 0x2c, 0xfe, 0xb5, 0x9d, 0xb0,
+  0x00, 0x14, 0xac, 0x08, 0x6b, 0xd0, 0x87, 0x6b, 0xc2, 0xd6, 0x35, 0xbb,
+  0xcd, 0x63, 0x48, 0x59, 0x06, 0x8b, 0xee, 0x21, 0x9a, 0xbe, 0xcf, 0xd8,
+  0x40, 0x28, 0x5c, 0x1f, 0xa4, 0xab, 0x82, 0xa3, 0xf0, 0x44, 0xe6, 0x0c,
+  0x7e, 0xb8, 0x82, 0xd0, 0x3f, 0x35, 0xa8, 0xa8, 0x74, 0x31, 0x6a, 0x38,
+  0x25, 0x10, 0xc8, 0xfd, 0x69, 0xbb, 0xb0, 0x5c, 0x99, 0x7b, 0x85, 0x18,
+  0x07, 0x65, 0x2e, 0x77, 0x17, 0x90, 0x91, 0x30, 0x0a, 0x10, 0xdc, 0xa2,
+  0x29, 0x8b, 0xe1, 0x2b, 0x5d, 0x4f, 0x47, 0x05, 0x19, 0x0b, 0x1a, 0xd9,
+  0xe0, 0x4e, 0x96, 0x6c, 0xb2, 0x8d, 0x83, 0x66, 0xc3, 0xa3, 0x29, 0x9d,
+  0xf0, 0xf7, 0x93, 0xe4, 0x7e, 0xf9, 0xe6, 0xdb, 0x3a, 0x68, 0xbf, 0xea,
+  0x5f, 0xc2, 0x23, 0x81, 0xc7, 0x30, 0x99, 0x59, 0xab, 0x34, 0xdd, 0x4c,
+  0x4e, 0x4e, 0x1e, 0x1e, 0x1e, 0x3a, 0x0f, 0xfd, 0x4e, 0x14, 0x2f, 0x4f,
+  0x7a, 0x8e, 0xe3, 0xe0, 0x60, 0x4b, 0x70, 0x66, 0x66, 0x75, 0x7b, 0x96,
+  0x74, 0xa2, 0x33, 0xeb, 0xd4, 0x7a, 0xd5, 0xbf, 0x02, 0x08, 0x1b, 0x9a,
+  0xae, 0x88, 0x37, 0xb3, 0xae, 0xbb, 0xa4, 0x1b, 0x0c, 0x09, 0xfc, 0xb7,
+  0x87, 0x16, 0x49, 0xd2, 0x38, 0xba, 0x63, 0x33, 0xeb, 0x55, 0xaf, 0x3f,
+  0x1e, 0x9c, 0xd2, 0x91, 0x97, 0x35, 0xd9, 0x19, 0xa8, 0x0e, 0x8c, 0x5a,
+  0xf8, 0x41, 0x30, 0xb3, 0x70, 0x07, 0x79, 0x37, 0x52, 0xc0, 0xa5, 0x9b,
+  0x99, 0xc5, 0x37, 0xa0, 0x35, 0xff, 0x06, 0x61, 0x4b, 0xd6, 0x7e, 0x22,
+  0x16, 0x47, 0xec, 0xe0, 0xa9, 0xd1, 0xd2, 0x65, 0xc3, 0x8e, 0x19, 0xd0,
+  0x27, 0x05, 0xda, 0xc8, 0xa7, 0x52, 0x77, 0x11, 0xf5, 0xe0, 0x5e, 0x44,
+  0x60, 0x56, 0x58, 0x39, 0x65, 0xa0, 0x2a, 0x14, 0x59, 0x39, 0x40, 0xd5,
+  0x6b, 0x99, 0x0c, 0xf4, 0x47, 0xe6, 0xf8, 0x4a, 0x6a, 0xc5, 0x64, 0x11,
+  0xb9, 0xdb, 0x44, 0x0a, 0xba, 0x78, 0xd9, 0x15, 0x32, 0x59, 0x63, 0x39,
+  0x0e, 0x0d, 0x9c, 0xb3, 0x35, 0x26, 0xa0, 0xf6, 0x2e, 0x5b, 0x45, 0x81,
+  0x67, 0x08, 0xbf, 0xfa, 0x2d, 0xc5, 0x74, 0xfc, 0x8c, 0xf9, 0x3d, 0x49,
+  0x40, 0x4f, 0x20, 0xad, 0xcb, 0x0c, 0x88, 0xa2, 0x98, 0x31, 0xf6, 0xff,
+  0xba, 0xdb, 0x27, 0x6e, 0x65, 0x5d, 0x95, 0x99, 0xeb, 0x88, 0x07, 0x49,
+  0x55, 0x55, 0xe5, 0x7a, 0xb0, 0xa1, 0x31, 0x60, 0x5d, 0x15, 0xf4, 0xa7,
+  0xea, 0xda, 0x93, 0x49, 0xb6, 0xb2, 0xc0, 0xd2, 0x8e, 0xb7, 0x61, 0x48,
+  0xe7, 0x90, 0x9f, 0x03, 0x24, 0xf7, 0x6e, 0x57, 0xc4, 0x72, 0xa3, 0x9a,
+  0x58, 0x4e, 0x63, 0x96, 0xae, 0xfc, 0x7d, 0xd5, 0x0a, 0xef, 0x73, 0x59,
+  0xcf, 0xa3, 0x95, 0xae, 0xc0, 0x86, 0x1d, 0x44, 0xa8, 0x5e, 0xaf, 0x48,
+  0xd6, 0x7a, 0xbd, 0x97, 0x64, 0x6b, 0x8a, 0x48, 0x48, 0x23, 0x83, 0xd9,
+  0xb1, 0x7d, 0x56, 0x17, 0xd1, 0x6b, 0x72, 0x83, 0xbb, 0x1b, 0x64, 0x95,
+  0x10, 0xa7, 0x8d, 0xff, 0x3b, 0xdd, 0x61, 0xab, 0x64, 0x9b, 0xf2, 0x08,
+  0x85, 0x40, 0xa7, 0x6e, 0x99, 0xe0, 0x5d, 0x21, 0x56, 0x2f, 0x27, 0xd6,
+  0xf1, 0x62, 0xb1, 0x78, 0x01, 0x8d, 0x64, 0x56, 0x90, 0x2d, 0xcb, 0xa3,
+  0x21, 0x5e, 0xe4, 0x6b, 0x76, 0x3b, 0xdd, 0x5e, 0x55, 0xde, 0xf5, 0x02,
+  0x8f, 0x52, 0xb8, 0xea, 0xd7, 0x70, 0x26, 0xcb, 0x16, 0x8c, 0x0c, 0xaa,
+  0xae, 0xe9, 0x0c, 0x31, 0xd5, 0xe0, 0x73, 0xeb, 0x42, 0xa4, 0xfa, 0x72,
+  0x80, 0xf0, 0x45, 0xea, 0x7c, 0x52, 0xd5, 0x1e, 0x11, 0xd4, 0xe7, 0x83,
+  0x20, 0x32, 0xd9, 0x1d, 0x9c, 0xbd, 0x99, 0xeb, 0x45, 0xc0, 0x79, 0x21,
+  0x4b, 0x7d, 0x99, 0xed, 0xf3, 0xe8, 0x92, 0xa3, 0x29, 0xec, 0x58, 0x0e,
+  0x0d, 0x66, 0xfa, 0x14, 0x3e, 0xc1, 0xc3, 0x82, 0x7f, 0x72, 0x27, 0x90,
+  0x37, 0x6c, 0x03, 0x1a, 0xe3, 0x7b, 0xa2, 0x05, 0x11, 0xef, 0xb6, 0xe0,
+  0xae, 0xc2, 0x22, 0x8a, 0x98, 0xf3, 0xf7, 0x5d, 0xd9, 0xf9, 0xf6, 0xb4,
+  0xc0, 0xa5, 0x94, 0xaf, 0xee, 0xf5, 0xa9, 0x15, 0xe9, 0x34, 0x44, 0x23,
+  0x35, 0x1e, 0xd5, 0x10, 0x79, 0x28, 0x22, 0x4b, 0x83, 0x80, 0x0b, 0xa7,
+  0x4c, 0x8e, 0xb4, 0x8a, 0xd7, 0x40, 0xf2, 0x47, 0xec, 0x46, 0x8a, 0x46,
+  0x45, 0x08, 0x3a, 0x67, 0xa7, 0x28, 0x03, 0x32, 0x51, 0xdf, 0xa7, 0x76,
+  0x82, 0x1d, 0x42, 0xe2, 0x0d, 0x72, 0x3a, 0x32, 0xc9, 0x69, 0x4f, 0x04,
+  0xbd, 0x45, 0x42, 0xbc, 0x27, 0x84, 0xe4, 0x03, 0xaa, 0x3a, 0x90, 0x85,
+  0x8c, 0x06, 0xe0, 0xe3, 0x1c, 0xba, 0x0d, 0xc9, 0xc9, 0xee, 0x59, 0x03,
+  0x68, 0x0e, 0xf8, 0x0e, 0xc8, 0x8f, 0xe4, 0x0a, 0x72, 0x0f, 0x6a, 0xf0,
+  0xe5, 0x2d, 0x3c, 0xd7, 0x1b, 0x4d, 0x2b, 0xa2, 0x2a, 0x27, 0x3d, 0xd0,
+  0xd8, 0x4c, 0xd7, 0xa2, 0xb8, 0x5c, 0xc1, 0x4c, 0x74, 0x99, 0x51, 0x2b,
+  0x17, 0xa2, 0xb9, 0x11, 0x53, 0xd6, 0xaa, 0x62, 0x58, 0x99, 0x31, 0xc8,
+  0x70, 0xe3, 0xa1, 0xf1, 0x4e, 0x71, 0x60, 0x8a, 0x5d, 0x05, 0xd1, 0xd1,
+  0x6a, 0xa0, 0xcb, 0x65, 0xc0, 0x48, 0xf3, 0xfd, 0xc9, 0xa5, 0x56, 0xf8,
+  0xc4, 0xd6, 0x9d, 0x66, 0x30, 0xd0, 0x2e, 0x38, 0xd3, 0x6a, 0x14, 0xf8,
+  0x94, 0x0d, 0x27, 0x85, 0x6e, 0x15, 0xf9, 0x7e, 0xa6, 0x65, 0x67, 0x87,
+  0xb9, 0xa4, 0x97, 0xb2, 0xb9, 0xdf, 0x2a, 0x6b, 0x86, 0x53, 0x89, 0x4b,
+  0xb9, 0x22, 0x89, 0xf8, 0x53, 0xd5, 0xb8, 0xa1, 0xe3, 0x94, 0x04, 0x32,
+  0x73, 0xd6, 0xfa, 0x7e, 0x26, 0x0b, 0x3f, 0x2e, 0x27, 0x73, 0x35, 0x06,
+  0x81, 0x07, 0x31, 0xe5, 0xc6, 0x0a, 0xbc, 0x6a, 0x6e, 0x28, 0xc1, 0x55,
+  0xe7, 0x56, 0x1b, 0x9c, 0xa9, 0x9c, 0xc3, 0xeb, 0x3f, 0x32, 0x9b, 0xd4,
+  0xe1, 0xd7, 0x95, 0xa7, 0x94, 0x92, 0x87, 0x71, 0x5e, 0xc5, 0x8a, 0x98,
+  0x46, 0x65, 0x55, 0x99, 0x17, 0x1a, 0x94, 0x7d, 0x61, 0xa0, 0xc1, 0x3d,
+  0x28, 0x4c, 0xf1, 0xc3, 0x84, 0xa5, 0x44, 0xf8, 0xf9, 0x5e, 0xd9, 0xcf,
+  0xb7, 0xf4, 0x2a, 0xc1, 0x83, 0x9f, 0xba, 0x2b, 0x22, 0xf1, 0x2d, 0xea,
+  0x04, 0xbc, 0xf9, 0x65, 0x4e, 0xf0, 0xd9, 0xea, 0x41, 0x26, 0xd7, 0x63,
+  0x51, 0x26, 0x78, 0x52, 0x97, 0x21, 0xd9, 0x73, 0x9e, 0xb2, 0xaa, 0x49,
+  0x56, 0xcf, 0x9c, 0xa1, 0xb6, 0x8c, 0xf2, 0x99, 0xc3, 0xdd, 0xd5, 0x55,
+  0x32, 0xb3, 0x03, 0x16, 0x21, 0xf6, 0x59, 0xfc, 0x25, 0xfd, 0x67, 0xa9,
+  0xfa, 0x9d, 0x43, 0x13, 0xde, 0x5c, 0x29, 0x9a, 0x09, 0x28, 0x4e, 0x16,
+  0xbf, 0x39, 0xc5, 0x7e, 0xf2, 0x70, 0xd4, 0x58, 0x8e, 0xe4, 0xdc, 0xa9,
+  0x39, 0xc8, 0x30, 0x04, 0xa8, 0x87, 0xe7, 0xaf, 0x59, 0x36, 0x5c, 0xf5,
+  0xaf, 0x35, 0x05, 0x7c, 0x9e, 0x6f, 0xea, 0x09, 0xa8, 0xca, 0x16, 0xbe,
+  0x8d, 0x97, 0x95, 0x5a, 0xd1, 0x58, 0x62, 0x24, 0xcd, 0x35, 0x4d, 0x86,
+  0xd4, 0x32, 0xd4, 0x75, 0x94, 0x50, 0xd7, 0x31, 0xa4, 0xed, 0x9a, 0xd8,
+  0xeb, 0xd1, 0xaf, 0x39, 0x28, 0x35, 0x66, 0xcb, 0x95, 0x38, 0xb7, 0x5f,
+  0x96, 0x7f, 0xe9, 0x83, 0x55, 0xa6, 0x4e, 0xdc, 0x15, 0x73, 0xef, 0x98,
+  0xf7, 0xa6, 0xc2, 0xc0, 0x03, 0xaa, 0xc1, 0x46, 0x0d, 0x3d, 0x68, 0x01,
+  0x85, 0xb4, 0x86, 0xca, 0xea, 0x7f, 0x37, 0xbb, 0x20, 0x91, 0xad, 0x5a,
+  0x3a, 0x3d, 0xb7, 0xcf, 0xa1, 0xae, 0xe8, 0xff, 0xf2, 0xdf, 0xfb, 0x24,
+  0x04, 0x65, 0x8c, 0xe2, 0x3b, 0xa5, 0x20, 0x08, 0x2d, 0x90, 0x45, 0x27,
+  0xa9, 0x2c, 0x70, 0xca, 0x1a, 0xde, 0x13, 0xef, 0x30, 0x1e, 0x55, 0x68,
+  0x27, 0x92, 0xfc, 0x58, 0xe4, 0xb0, 0xa0, 0xef, 0x19, 0x1f, 0x55, 0x11,
+  0xd9, 0xef, 0x54, 0x9b, 0xdc, 0x17, 0x1c, 0x56, 0xd2, 0x17, 0x2d, 0x21,
+  0x15, 0x34, 0x30, 0xc6, 0x69, 0xc7, 0xac, 0x07, 0x81, 0x0e, 0x9d, 0x9a,
+  0x19, 0xf7, 0x4b, 0xd3, 0xee, 0x66, 0x8c, 0xab, 0x8f, 0x0a, 0x95, 0xf3,
+  0x67, 0x19, 0xb7, 0xc1, 0x6a, 0x1d, 0x51, 0x0c, 0x60, 0xde, 0x01, 0x85,
+  0x80, 0xbd, 0x95, 0x47, 0x01, 0xce, 0xc6, 0x5b, 0x16, 0xbb, 0x7d, 0x65,
+  0xce, 0xa1, 0xe3, 0x28, 0x43, 0x49, 0x87, 0xc7, 0x40, 0x32, 0x5e, 0xe1,
+  0x3a, 0x3c, 0x04, 0xfe, 0x66, 0x26, 0xaf, 0x33, 0x98, 0x02, 0x2d, 0x52,
+  0x1f, 0x02, 0x65, 0x99, 0x60, 0xe0, 0x46, 0xa7, 0xa6, 0xda, 0x28, 0x66,
+  0x38, 0x49, 0xe2, 0x1b, 0x2a, 0x0e, 0xd3, 0x72, 0xb2, 0xa3, 0x06, 0xfa,
+  0xeb, 0x28, 0x8c, 0x38, 0x63, 0xa7, 0x0f, 0x2b, 0xe0, 0x24, 0xaf, 0x26,
+  0x62, 0xce, 0xfc, 0x10, 0xd3, 0x0d, 0x2f, 0xc7, 0xc6, 0xc9, 0xae, 0x5c,
+  0x21, 0xdf, 0x64, 0xf7, 0x3a, 0x64, 0xd5, 0x05, 0x65, 0x54, 0x2f, 0xd0,
+  0x81, 0x16, 0xe4, 0x84, 0xb5, 0xcb, 0x72, 0x3d, 0xd8, 0x7b, 0xec, 0xc3,
+  0x2f, 0x4a, 0xec, 0x33, 0xc6, 0xe6, 0x61, 0xfb, 0x14, 0xc1, 0x5c, 0x13,
+  0x7c, 0xe1, 0xb1, 0xf3, 0x93, 0xbe, 0x23, 0xe9, 0x35, 0xd5, 0x62, 0x31,
+  0xba, 0x4c, 0x93, 0xe8, 0x94, 0x23, 0x87, 0xda, 0xc3, 0x88, 0x72, 0x41,
+  0x77, 0xcc, 0xc3, 0x56, 0x6d, 0xd5, 0x67, 0xc5, 0x0b, 0x33, 0x34, 0x53,
+  0x2e, 0xb0, 0xa6, 0xe1, 0x16, 0x84, 0x08, 0xaf, 0x53, 0x94, 0xf3, 0xdf,
+  0x7d, 0xb5, 0x68, 0x83, 0x63, 0x43, 0xec, 0x3d, 0xe6, 0x46, 0xb1, 0x38,
+  0x20, 0xcb, 0x92, 0xd0, 0xba, 0x7a, 0x7d, 0x89, 0xf8, 0x4e, 0xb5, 0x9c,
+  0x2d, 0x43, 0xdc, 0x5c, 0xe6, 0xc7, 0x25, 0x2b, 0x22, 0x3b, 0x64, 0x0d,
+  0x44, 0xdf, 0x8b, 0x34, 0x16, 0xf9, 0x81, 0x99, 0x62, 0x7e, 0x3f, 0xf1,
+  0x92, 0xe2, 0x3a, 0xf2, 0x18, 0x49, 0x7d, 0xd0, 0xb4, 0x8d, 0x0f, 0xfe,
+  0x20, 0x56, 0x0c, 0x31, 0xb6, 0xd6, 0xc5, 0x5b, 0xbc, 0xbc, 0xd0, 0x33,
+  0x1e, 0x78, 0xe5, 0xa7, 0xcb, 0x72, 0x3a, 0x11, 0x4f, 0x40, 0xbf, 0xa2,
+  0xd6, 0x90, 0xf7, 0x09, 0x29, 0xd1, 0x21, 0x94, 0x53, 0x1b, 0x08, 0xb4,
+  0x73, 0xa4, 0x8e, 0xd7, 0xc9, 0x52, 0x0b, 0x63, 0x16, 0xfe, 0x37, 0x71,
+  0x37, 0x4a, 0x4e, 0xce, 0x1c, 0xb9, 0x30, 0x15, 0x8a, 0xb3, 0x2e, 0xbb,
+  0x32, 0x1b, 0x3a, 0x5b, 0x45, 0x30, 0x00, 0x16, 0xc4, 0x45, 0x13, 0xf8,
+  0x8a, 0xd8, 0x04, 0xb3, 0x8f, 0xf2, 0xd5, 0x97, 0x0c, 0xae, 0xee, 0x7d,
+  0x0e, 0xf6, 0x35, 0xe5, 0x13, 0xd6, 0xba, 0xf2, 0x82, 0xce, 0xf2, 0xec,
+  0xf6, 0x48, 0xaf, 0x12, 0x4f, 0xcb, 0xbb, 0x48, 0xa3, 0x92, 0x8b, 0x95,
+  0xd7, 0x9e, 0x8a, 0xe3, 0x59, 0x5e, 0x5e, 0xfa, 0xba, 0xd1, 0xcf, 0x67,
+  0x95, 0xc3, 0x57, 0xd9, 0x7f, 0xc0, 0xe9, 0xab, 0xa4, 0x18, 0x51, 0x9c,
+  0x0a, 0x0a, 0xeb, 0xf3, 0xe7, 0xb1, 0x86, 0x89, 0xfc, 0x80, 0xb6, 0x13,
+  0xdd, 0x69, 0x89, 0xfa, 0xa2, 0xb7, 0x18, 0x33, 0x26, 0x95, 0xf3, 0x78,
+  0x40, 0x4f, 0x69, 0x9f, 0x4e, 0x6b, 0xf2, 0x6b, 0xad, 0x80, 0x01, 0xa0,
+  0x58, 0xac, 0x27, 0xfd, 0x0b, 0x0f, 0x2f, 0xcd, 0x4d, 0x4d, 0x49, 0xfb,
+  0x21, 0x19, 0xbb, 0x22, 0x7e, 0x9f, 0x6f, 0xdf, 0x12, 0x71, 0x68, 0x57,
+  0x28, 0x46, 0x94, 0x52, 0x3b, 0x3f, 0x87, 0x53, 0x38, 0x39, 0x1c, 0xd7,
+  0x56, 0xca, 0xf2, 0x43, 0x62, 0x51, 0x2f, 0xac, 0x3f, 0x5d, 0x7b, 0xc1,
+  0x49, 0x6c, 0x67, 0x28, 0x35, 0x2d, 0xc7, 0xa7, 0x03, 0xa1, 0x08, 0xe4,
+  0xb9, 0x6b, 0xf0, 0xd6, 0x7b, 0x9d, 0xb1, 0xf9, 0x42, 0x43, 0x01, 0x66,
+  0xc3, 0x42, 0xc4, 0xb6, 0x52, 0xa5, 0x00, 0x39, 0x6c, 0x77, 0x47, 0x4e,
+  0x7b, 0x20, 0xa3, 0x56, 0xc9, 0x2b, 0xea, 0x8c, 0x47, 0x3d, 0x47, 0x42,
+  0xa0, 0xfc, 0x0c, 0x3a, 0xa9, 0x33, 0x1a, 0xfa, 0x15, 0x25, 0x0c, 0xce,
+  0x85, 0xc9, 0xcb, 0x6a, 0x38, 0x6b, 0x73, 0xe1, 0xe1, 0x54, 0x3d, 0x5a,
+  0xdb, 0x57, 0xdd, 0x1b, 0xd7, 0x25, 0x1c, 0x75, 0xc7, 0x96, 0xdf, 0xb3,
+  0xa0, 0xd7, 0x1f, 0x68, 0x5b, 0x79, 0xbe, 0xa2, 0x67, 0x4b, 0x86, 0xfd,
+  0x89, 0xca, 0x9e, 0x56, 0x39, 0x37, 0x57, 0xf6, 0xb2, 0x55, 0xaa, 0xb5,
+  0x27, 0x43, 0x79, 0x4f, 0x9f, 0xd2, 0x81, 0xd0, 0xd3, 0x7e, 0x8c, 0xb6,
+  0x18, 0x1b, 0x97, 0xcb, 0x05, 0xc7, 0xee, 0xe0, 0x8c, 0xf6, 0x9c, 0x67,
+  0x30, 0x3a, 0x03, 0x8c, 0x86, 0x83, 0x76, 0xbf, 0x07, 0x18, 0x0d, 0x2b,
+  0x28, 0x69, 0xf0, 0x0d, 0xd5, 0xbb, 0xb9, 0x33, 0xa6, 0xdd, 0xb1, 0x9c,
+  0x13, 0x47, 0x41, 0x30, 0xaf, 0x4b, 0x83, 0xfe, 0x82, 0x7a, 0x5d, 0xb6,
+  0xde, 0x4b, 0x6a, 0x76, 0xd9, 0x9c, 0x7d, 0x84, 0xab, 0x60, 0xf5, 0x6c,
+  0x9d, 0x25, 0x1f, 0xbb, 0x6f, 0x15, 0x03, 0xf9, 0xe8, 0x78, 0xe8, 0x0c,
+  0x68, 0xc9, 0x9c, 0xa1, 0xf3, 0x8d, 0x75, 0x6b, 0xc6, 0x9b, 0xf2, 0x84,
+  0x6b, 0x20, 0xae, 0x10, 0x3d, 0x29, 0x7d, 0xfc, 0x3a, 0x59, 0x56, 0x9c,
+  0x03, 0x21, 0xd7, 0x52, 0x0f, 0x71, 0xe9, 0xb8, 0x72, 0x15, 0x69, 0x8a,
+  0xe8, 0x2c, 0x02, 0x90, 0x89, 0x95, 0xef, 0x79, 0x2c, 0xd4, 0xe0, 0xe1,
+  0x89, 0xea, 0xae, 0xb8, 0xf9, 0xf9, 0x4a, 0x85, 0x88, 0x01, 0x12, 0x8d,
+  0xed, 0x25, 0x82, 0x02, 0xc1, 0x6c, 0x9e, 0x39, 0x1e, 0x5b, 0xb6, 0x35,
+  0xa5, 0x68, 0x4b, 0xe1, 0x6b, 0x6b, 0xf4, 0x69, 0x19, 0x90, 0x50, 0x54,
+  0x97, 0xbb, 0x72, 0xd2, 0x4d, 0x88, 0x58, 0x40, 0xc3, 0x07, 0xed, 0xee,
+  0xae, 0x7c, 0x5f, 0xc6, 0x90, 0x2b, 0x28, 0x86, 0x8b, 0x43, 0x2f, 0x8e,
+  0x36, 0x44, 0x4c, 0x2c, 0x81, 0x26, 0x1b, 0x3f, 0x0c, 0x81, 0xa4, 0xc6,
+  0xa8, 0x4f, 0x56, 0x74, 0x95, 0x93, 0x36, 0xfe, 0x5c, 0x49, 0xfe, 0xca,
+  0x59, 0xa9, 0xdc, 0x1c, 0xde, 0x6e, 0x34, 0xc5, 0xd1, 0xd5, 0x42, 0x45,
+  0x11, 0x07, 0x00, 0x4e, 0x37, 0x80, 0x12, 0xe9, 0xe2, 0x5d, 0x45, 0xb1,
+  0xfd, 0xe2, 0x9a, 0xa2, 0x29, 0x85, 0x2a, 0x65, 0x5c, 0x5a, 0xd0, 0x20,
+  0x81, 0xed, 0xc0, 0xf3, 0x17, 0xa6, 0x2d, 0x86, 0xd6, 0x94, 0x35, 0xfb,
+  0x23, 0x64, 0x96, 0x76, 0x01, 0xeb, 0x47, 0xff, 0x5e, 0x3b, 0xc1, 0xed,
+  0x78, 0xa2, 0x21, 0x67, 0xbf, 0x2e, 0x4f, 0x7a, 0x49, 0x49, 0xca, 0xe4,
+  0x40, 0xd4, 0x00, 0x0a, 0x98, 0xfc, 0x36, 0x3e, 0x6e, 0x21, 0x22, 0x4d,
+  0x71, 0xcd, 0x59, 0x29, 0x7c, 0x63, 0x33, 0x88, 0x8f, 0xef, 0xa9, 0x5e,
+  0x08, 0xdf, 0xb9, 0x17, 0x82, 0x4f, 0xe0, 0xe6, 0x7a, 0x83, 0xb1, 0x08,
+  0x12, 0x72, 0xbb, 0x0e, 0x93, 0x49, 0x77, 0x11, 0x13, 0xf8, 0xc9, 0x63,
+  0xdb, 0xcc, 0x29, 0x71, 0x50, 0x2e, 0x0b, 0x82, 0x83, 0x52, 0xb4, 0x3d,
+  0xa7, 0xb9, 0xd5, 0xa8, 0x50, 0x85, 0x4e, 0xc4, 0xa3, 0xa9, 0xd4, 0x38,
+  0x92, 0xde, 0xea, 0x25, 0x77, 0xb4, 0xa4, 0x13, 0x34, 0x97, 0xd9, 0xcb,
+  0xc1, 0xb6, 0x31, 0x64, 0x31, 0x20, 0x27, 0x2e, 0x2d, 0x99, 0xeb, 0xa0,
+  0x87, 0x1e, 0x0e, 0x1e, 0x74, 0xec, 0x77, 0x7e, 0x22, 0xbf, 0x35, 0x71,
+  0x7e, 0xc2, 0xbf, 0xb7, 0x71, 0x8e, 0xf7, 0xe0, 0x2f, 0x8e, 0x8e, 0xce,
+  0x41, 0x70, 0x88, 0x1b, 0xd0, 0x24, 0x99, 0x35, 0xe4, 0xa5, 0xee, 0xc6,
+  0x05, 0x00, 0x2d, 0xb7, 0xa3, 0xd0, 0xf2, 0x0e, 0xe8, 0x5a, 0x75, 0x8b,
+  0xef, 0x64, 0xc0, 0xb3, 0x68, 0x54, 0xc6, 0x7b, 0x51, 0xda, 0x20, 0xbe,
+  0x37, 0x6b, 0xc8, 0x9b, 0x59, 0xf8, 0x7e, 0x71, 0x7e, 0x02, 0x23, 0x38,
+  0xe4, 0xfc, 0x41, 0x5d, 0x42, 0xdc, 0xae, 0xcd, 0x56, 0x10, 0x15, 0x75,
+  0xad, 0x33, 0x0d, 0x89, 0x70, 0xfd, 0x0d, 0x82, 0xb7, 0x59, 0x6c, 0x68,
+  0x9c, 0x35, 0x56, 0xd1, 0x1a, 0xde, 0xa3, 0xd0, 0x0d, 0x20, 0xd1, 0x82,
+  0xf5, 0x78, 0xd9, 0xed, 0x96, 0xce, 0x9b, 0x16, 0xf6, 0x58, 0xad, 0xc6,
+  0xc5, 0x07, 0xf8, 0x3c, 0x3f, 0x11, 0xf0, 0xf6, 0x01, 0x57, 0xa1, 0x26,
+  0xc0, 0x79, 0x60, 0x79, 0x62, 0x86, 0x9c, 0xf5, 0x22, 0xf4, 0x1b, 0xf9,
+  0xfc, 0xe2, 0x15, 0xb8, 0x76, 0xd5, 0xc0, 0xe7, 0x7d, 0x1c, 0x3a, 0x7f,
+  0x52, 0x61, 0x4b, 0xda, 0xc9, 0x0f, 0xc1, 0x3c, 0x24, 0x34, 0x64, 0x70,
+  0x39, 0x85, 0x8f, 0xce, 0x7f, 0x00, 0x95, 0x9d, 0x19, 0xfe, 0x91, 0x0f,
+  0x9f, 0xaf, 0xaf, 0xc8, 0xed, 0xdb, 0x77, 0xe6, 0x5e, 0xdb, 0xbe, 0x38,
+  0x2a, 0xf3, 0x44, 0xd6, 0xe1, 0x72, 0xd2, 0xe3, 0x62, 0xd8, 0xce, 0x09,
+  0x0f, 0x6b, 0xe9, 0x5c, 0x94, 0x97, 0x25, 0x1b, 0x55, 0x91, 0xd0, 0xae,
+  0x51, 0xc2, 0xce, 0xb8, 0x60, 0xe4, 0x92, 0x50, 0x1a, 0x9b, 0x5f, 0x16,
+  0x84, 0x3d, 0x81, 0xfa, 0x85, 0xa5, 0x0e, 0xae, 0xd0, 0x8d, 0x0b, 0x2c,
+  0x75, 0x82, 0x54, 0x43, 0xbf, 0x71, 0x14, 0xd7, 0x2c, 0x29, 0x86, 0x90,
+  0x70, 0x2e, 0xfc, 0xc6, 0x85, 0x6d, 0x67, 0xe3, 0xff, 0xd4, 0xc2, 0x1f,
+  0xbf, 0x90, 0xb7, 0x9e, 0x17, 0xb3, 0x24, 0x39, 0x74, 0x79, 0x7f, 0xf3,
+  0xdd, 0x16, 0xbf, 0x01, 0x6f, 0x42, 0x83, 0x43, 0x17, 0xc6, 0xea, 0x9c,
+  0x69, 0xe9, 0x4c, 0x54, 0xfe, 0x20, 0xfb, 0x78, 0x95, 0xf9, 0x93, 0xa8,
+  0x32, 0xab, 0xdb, 0xd1, 0xe5, 0x5e, 0x9e, 0x1f, 0x93, 0xfc, 0xd8, 0x55,
+  0x91, 0x77, 0x2f, 0xba, 0x71, 0x69, 0xd8, 0x6c, 0x49, 0x44, 0xe1, 0x99,
+  0xab, 0xc8, 0x05, 0xb6, 0x66, 0x90, 0xcb, 0x5a, 0xa5, 0xe0, 0x93, 0xd5,
+  0xb3, 0xc5, 0x74, 0x78, 0x4b, 0x0a, 0xf1, 0xcf, 0xc7, 0x72, 0xc8, 0x6a,
+  0x21, 0x0b, 0x22, 0xea, 0x06, 0xe1, 0x66, 0x10, 0x10, 0x50, 0x8a, 0x07,
+  0x72, 0xc3, 0xe5, 0x2d, 0x17, 0x33, 0xf3, 0x01, 0x62, 0x48, 0xf1, 0x56,
+  0x3f, 0x25, 0xe7, 0x97, 0x6c, 0xcb, 0x8a, 0xf2, 0x0a, 0xb9, 0x9e, 0x01,
+  0x80, 0x65, 0xb7, 0x46, 0x75, 0x13, 0xbc, 0xf9, 0xa2, 0x04, 0x46, 0x7b,
+  0x55, 0x39, 0x62, 0xa2, 0x89, 0x2c, 0x65, 0x81, 0x5a, 0xc7, 0x8f, 0x42,
+  0xde, 0xb2, 0x89, 0x34, 0x43, 0x44, 0xa9, 0x76, 0x35, 0xd4, 0x39, 0xe2,
+  0x00, 0x51, 0xe1, 0xa3, 0x68, 0xb8, 0xe6, 0xbd, 0x37, 0x37, 0x1f, 0x7f,
+  0x04, 0x8e, 0x5e, 0x5c, 0x61, 0xcc, 0x46, 0xf0, 0x8d, 0x88, 0x69, 0xc1,
+  0xe3, 0xf9, 0x09, 0xd5, 0x68, 0xac, 0x80, 0x04, 0x09, 0xf5, 0x6c, 0xac,
+  0xfc, 0xee, 0x67, 0x0d, 0x4c, 0xe4, 0x67, 0x2c, 0x84, 0xdf, 0xb3, 0x69,
+  0xa0, 0xf3, 0x13, 0x98, 0x3d, 0x70, 0x08, 0x0d, 0xa2, 0xdc, 0x80, 0x9b,
+  0x35, 0xa4, 0x04, 0x11, 0x41, 0xac, 0x67, 0xe8, 0xc2, 0x39, 0x75, 0xf1,
+  0x45, 0x5e, 0x53, 0x3d, 0x3f, 0x11, 0xef, 0x47, 0x95, 0x35, 0xb3, 0x8b,
+  0xac, 0xd9, 0xba, 0xf8, 0x5e, 0x5a, 0x57, 0x6c, 0x3d, 0x1f, 0x58, 0xa7,
+  0x16, 0x35, 0x2a, 0x71, 0x19, 0x41, 0x7c, 0xeb, 0xa6, 0x48, 0x43, 0xf9,
+  0xb8, 0xcf, 0xf6, 0xd7, 0x5a, 0xf9, 0x9b, 0xab, 0xdb, 0xdb, 0x8f, 0x9f,
+  0xfe, 0x71, 0xf3, 0x87, 0x2c, 0x7d, 0x61, 0xe2, 0x73, 0x2f, 0xf8, 0xc7,
+  0xed, 0xc4, 0x8f, 0x82, 0x93, 0x2a, 0xe1, 0x05, 0x71, 0xdf, 0xf1, 0x22,
+  0x7e, 0xc8, 0x4d, 0xa8, 0x4a, 0x6e, 0x05, 0x54, 0x7e, 0xbf, 0xaa, 0xe0,
+  0x9f, 0xca, 0x0c, 0xde, 0x2d, 0x90, 0x9d, 0xe3, 0x37, 0x4b, 0xd7, 0x7e,
+  0x38, 0x6b, 0x38, 0x0d, 0x2c, 0x2f, 0xce, 0x1a, 0x90, 0xfc, 0x20, 0x61,
+  0xf9, 0x78, 0x24, 0xac, 0x0b, 0x41, 0x51, 0x98, 0x76, 0x96, 0x2c, 0xbd,
+  0x0a, 0x18, 0x3e, 0xbe, 0x7b, 0xfc, 0xe8, 0x35, 0x2d, 0x98, 0x88, 0xe6,
+  0xd2, 0x6a, 0x75, 0x50, 0x9c, 0xe4, 0x17, 0x3a, 0x66, 0xe9, 0xca, 0x4f,
+  0x3a, 0xdc, 0x8a, 0xbe, 0xb1, 0x5e, 0x59, 0x9c, 0x41, 0x2b, 0x5c, 0x8c,
+  0xc7, 0x05, 0x5f, 0x28, 0x84, 0xeb, 0x7c, 0xa6, 0xd5, 0x2e, 0x06, 0xb6,
+  0x0a, 0x1c, 0x55, 0x8b, 0x9c, 0xdf, 0xfe, 0xca, 0xf1, 0xe4, 0x2f, 0x85,
+  0x3d, 0x3e, 0xd2, 0xc4, 0xf2, 0x4f, 0x1a, 0xe5, 0x5b, 0x08, 0xbf, 0x59,
+  0x0c, 0x3e, 0x20, 0x66, 0x35, 0x2e, 0x46, 0x6a, 0x6f, 0x8e, 0xab, 0x94,
+  0x4b, 0x8e, 0x1b, 0x08, 0xe4, 0x42, 0x8d, 0x47, 0x58, 0xfa, 0x15, 0xf2,
+  0x98, 0x66, 0x1a, 0xf3, 0xdd, 0xfd, 0xed, 0xb8, 0x7b, 0x3a, 0x9a, 0xbe,
+  0xd7, 0x0d, 0x72, 0x15, 0x82, 0x6b, 0x80, 0xb0, 0xa0, 0x41, 0x52, 0x80,
+  0xb8, 0x2c, 0xd9, 0xf4, 0xef, 0xb5, 0x77, 0xc8, 0x37, 0x7f, 0x07, 0x73,
+  0xa1, 0x6e, 0x5c, 0x58, 0x4d, 0x8e, 0xdb, 0x72, 0x9d, 0x9a, 0xf9, 0x08,
+  0x1d, 0x35, 0x7c, 0x8c, 0x36, 0xfc, 0x0b, 0x2e, 0xbc, 0x79, 0xd6, 0xb0,
+  0xbb, 0x63, 0x07, 0x64, 0xea, 0xe2, 0xeb, 0x0d, 0xb9, 0xa2, 0x10, 0x94,
+  0xc5, 0x21, 0x69, 0x7e, 0xbd, 0xbd, 0xb4, 0x87, 0xad, 0xf3, 0x13, 0x31,
+  0xb2, 0x6e, 0x62, 0xaf, 0x3b, 0x92, 0x13, 0x2f, 0xd1, 0xe0, 0xd2, 0x40,
+  0x4c, 0x1c, 0x3d, 0x3f, 0x71, 0xd8, 0x93, 0x13, 0xaf, 0x21, 0x19, 0x4a,
+  0xa9, 0x2f, 0x97, 0x3c, 0x7d, 0x7e, 0xe6, 0x78, 0x2c, 0x67, 0x7e, 0x81,
+  0xd4, 0x65, 0xe1, 0xbb, 0x62, 0xe2, 0xf8, 0xb9, 0x89, 0x38, 0xe7, 0xf6,
+  0x52, 0x1f, 0x04, 0x82, 0xca, 0xc9, 0xf8, 0x1d, 0x78, 0xf4, 0x53, 0xe4,
+  0xf2, 0xbc, 0xb9, 0x6a, 0x0d, 0x7e, 0x82, 0xf6, 0x74, 0xeb, 0xb1, 0x7a,
+  0xd3, 0x2b, 0xbe, 0x2e, 0x20, 0xd4, 0x08, 0x52, 0x4c, 0x74, 0x15, 0x6c,
+  0x03, 0x18, 0x77, 0x80, 0x2b, 0xdd, 0x92, 0x0d, 0x66, 0x9d, 0x65, 0x87,
+  0x0c, 0x9c, 0xce, 0x69, 0xb7, 0x37, 0x6e, 0xe8, 0xeb, 0x44, 0xe1, 0xf2,
+  0x25, 0x0b, 0xc1, 0xae, 0x9e, 0x5d, 0xc8, 0x3e, 0x1d, 0x40, 0xdf, 0xc8,
+  0x79, 0x99, 0xad, 0x07, 0x09, 0x04, 0x72, 0xa0, 0xa1, 0xbf, 0xa1, 0xf7,
+  0x8c, 0x14, 0xa4, 0xa9, 0x98, 0xfb, 0x3f, 0x4a, 0x6d, 0x71, 0x12, 0x75,
+  0x1d, 0x79, 0x75, 0xc6, 0xa0, 0xb8, 0x94, 0x63, 0x36, 0x5e, 0xea, 0x45,
+  0x1d, 0xf4, 0xe9, 0x78, 0x03, 0x9b, 0x84, 0xf9, 0xf9, 0x96, 0x6a, 0xc1,
+  0x32, 0x02, 0xeb, 0x53, 0xeb, 0x5c, 0x37, 0xbf, 0x24, 0xc1, 0x43, 0x31,
+  0x1e, 0xbb, 0x21, 0x44, 0x1b, 0x29, 0x6d, 0xd2, 0x4f, 0xde, 0xfb, 0x39,
+  0x94, 0x3a, 0x2a, 0xaf, 0x57, 0xfc, 0xbd, 0x3b, 0x71, 0x5a, 0x2a, 0x74,
+  0x03, 0xda, 0xfc, 0xe6, 0x05, 0x86, 0x49, 0x1a, 0x96, 0x1a, 0xdb, 0x4b,
+  0x64, 0x51, 0x90, 0xe1, 0xf2, 0x9f, 0x18, 0xa3, 0xc2, 0xec, 0x90, 0xad,
+  0x14, 0x11, 0x6a, 0xdd, 0x90, 0xa4, 0x37, 0xb4, 0x08, 0x4f, 0xac, 0x0a,
+  0x39, 0x4f, 0x9c, 0x92, 0x55, 0xb4, 0x8d, 0x35, 0x3c, 0xb2, 0x3d, 0x14,
+  0xd6, 0x4a, 0x60, 0x91, 0xe0, 0xf0, 0x3d, 0x54, 0xe1, 0xe0, 0x4a, 0xc6,
+  0x4b, 0xd5, 0x56, 0x43, 0x60, 0x78, 0x38, 0xae, 0x57, 0xa1, 0x77, 0x38,
+  0xa6, 0x2c, 0xf4, 0xf6, 0xe0, 0x09, 0xa0, 0x5e, 0x86, 0xa5, 0xfe, 0x22,
+  0xd6, 0x17, 0xd2, 0x3c, 0x37, 0x47, 0x0d, 0xcf, 0xc5, 0x0d, 0xf5, 0x91,
+  0x83, 0xc0, 0xbf, 0x26, 0x7e, 0xc8, 0xad, 0xe2, 0x01, 0x91, 0x44, 0x0e,
+  0xe8, 0x0f, 0xc6, 0x13, 0x7c, 0xfe, 0xbb, 0xba, 0xa0, 0x62, 0x7f, 0x58,
+  0xa1, 0xad, 0xdd, 0xb8, 0x70, 0x5e, 0x95, 0x85, 0xbe, 0x1c, 0xf5, 0xbe,
+  0x24, 0x94, 0xfc, 0xe5, 0xe6, 0xf6, 0xea, 0xfa, 0xcf, 0x06, 0x92, 0xa2,
+  0xd8, 0xf1, 0x27, 0xc2, 0x48, 0x51, 0x98, 0xfc, 0x18, 0x2e, 0xa2, 0x1a,
+  0x63, 0x96, 0x17, 0x27, 0x8d, 0x4a, 0x9b, 0x17, 0xdd, 0x6a, 0xb4, 0xb6,
+  0x28, 0x13, 0x36, 0x2e, 0xde, 0xfb, 0xf1, 0xfa, 0x81, 0x6a, 0x21, 0x54,
+  0x3e, 0xbc, 0x94, 0x9f, 0xf0, 0x23, 0x38, 0xc3, 0x0d, 0x0e, 0x79, 0x24,
+  0xd7, 0xa8, 0xcb, 0xf2, 0x8a, 0xc2, 0x5f, 0x96, 0xa6, 0xdf, 0x83, 0xcb,
+  0xe1, 0x51, 0x61, 0x39, 0x37, 0x54, 0xd9, 0x9e, 0x1f, 0x25, 0x8a, 0x59,
+  0xc5, 0x6b, 0xc9, 0xca, 0xed, 0x55, 0xa7, 0x3f, 0x48, 0x95, 0xeb, 0xb7,
+  0x97, 0x45, 0xcd, 0xa3, 0xd6, 0xa2, 0x54, 0x37, 0xb6, 0xa6, 0x6e, 0x65,
+  0x63, 0xdf, 0x05, 0xa1, 0xf7, 0x31, 0x63, 0xe4, 0x03, 0xa3, 0x9b, 0x17,
+  0xa1, 0xb3, 0x82, 0x09, 0x7f, 0x0d, 0x3e, 0x5f, 0x37, 0x68, 0x4e, 0x5f,
+  0x84, 0xcc, 0x76, 0x2f, 0x2a, 0xdf, 0x2b, 0x32, 0x36, 0xc8, 0xf3, 0x0b,
+  0xca, 0x34, 0x81, 0x0c, 0x4c, 0x3a, 0xab, 0x98, 0x2d, 0x66, 0x6f, 0xbf,
+  0x7c, 0x7c, 0x63, 0x9d, 0x6c, 0x37, 0x1e, 0x4d, 0x99, 0x85, 0x7b, 0x0e,
+  0x22, 0xea, 0x91, 0x62, 0x85, 0x4a, 0xb5, 0x26, 0x93, 0x53, 0x79, 0xf6,
+  0x7d, 0x40, 0x9a, 0xaf, 0xee, 0x44, 0x39, 0xf9, 0x56, 0x39, 0x60, 0xc0,
+  0x7e, 0x4d, 0x94, 0xe3, 0xcf, 0x42, 0x3d, 0x64, 0x83, 0x28, 0xbe, 0xe6,
+  0x7b, 0x82, 0x9e, 0x4b, 0xd1, 0x21, 0x13, 0x6d, 0x7c, 0x24, 0xff, 0x88,
+  0x22, 0xaf, 0x9c, 0xde, 0xec, 0x5b, 0x2c, 0x3b, 0x2d, 0x2c, 0x56, 0xcb,
+  0x5a, 0xaa, 0xcb, 0xfd, 0x2c, 0x7b, 0x70, 0x3d, 0x7c, 0x26, 0xef, 0xe0,
+  0xa5, 0x92, 0x4b, 0xd5, 0x89, 0x61, 0x7e, 0x9e, 0x56, 0x23, 0x86, 0xda,
+  0x79, 0x22, 0x18, 0x03, 0x63, 0x17, 0x1e, 0x0d, 0x16, 0xa8, 0x2a, 0x6d,
+  0xb2, 0x92, 0xb4, 0x47, 0x72, 0xf5, 0xf3, 0xbc, 0x32, 0x10, 0xde, 0x76,
+  0xf1, 0x57, 0x4b, 0xf1, 0xcf, 0x0c, 0x7c, 0xe5, 0x7e, 0x11, 0xc6, 0x2f,
+  0x82, 0xa8, 0x32, 0x8c, 0x68, 0xe2, 0xb7, 0x13, 0x74, 0x6e, 0x48, 0x91,
+  0xe0, 0xf0, 0x90, 0x1d, 0xef, 0x41, 0xc0, 0xa2, 0xf8, 0x91, 0xc8, 0x05,
+  0xea, 0xab, 0x2d, 0x89, 0x1b, 0xfb, 0x1b, 0x08, 0x59, 0x4e, 0x4e, 0xc8,
+  0xeb, 0xd7, 0xaf, 0xc9, 0x8f, 0x57, 0xff, 0xbc, 0xfa, 0xe9, 0xf3, 0x97,
+  0xeb, 0xab, 0x4f, 0xb7, 0x13, 0x72, 0xc3, 0x20, 0xb6, 0x00, 0xbf, 0x4d,
+  0xd2, 0x88, 0x3c, 0x42, 0xd4, 0x44, 0x3c, 0xe9, 0xb0, 0xbe, 0x74, 0x44,
+  0x5f, 0x44, 0x2c, 0x8b, 0x2c, 0xa2, 0x98, 0x6c, 0xe2, 0xc8, 0xdb, 0xca,
+  0x3f, 0x9d, 0xc0, 0x20, 0xd3, 0xf0, 0x3c, 0xe6, 0xb5, 0x3a, 0x08, 0xf1,
+  0xe8, 0x9e, 0xc6, 0x04, 0x14, 0x8c, 0xcc, 0x08, 0x5e, 0xbc, 0xe6, 0xaf,
+  0x59, 0xdd, 0x8f, 0x97, 0xd2, 0x44, 0x3b, 0x36, 0x73, 0x01, 0x86, 0x94,
+  0xd0, 0x8b, 0x1e, 0x42, 0x68, 0x0e, 0xb7, 0x41, 0x90, 0x77, 0xfc, 0xcc,
+  0xd6, 0x90, 0x29, 0x82, 0xae, 0x41, 0x87, 0x03, 0x60, 0x00, 0x5d, 0x71,
+  0xe3, 0x8b, 0xce, 0xc5, 0x65, 0x9b, 0xa3, 0xc5, 0x36, 0x14, 0x08, 0x14,
+  0x47, 0x0e, 0x58, 0x25, 0x6b, 0x11, 0x3c, 0x85, 0x42, 0x28, 0xf8, 0x97,
+  0x7e, 0x60, 0x76, 0x1e, 0xeb, 0xfc, 0xdf, 0x96, 0xc5, 0x8f, 0xa2, 0x8c,
+  0x19, 0xc5, 0x6f, 0x83, 0xa0, 0x69, 0x65, 0x7f, 0xa6, 0xc3, 0xe2, 0xc7,
+  0x4f, 0x38, 0x07, 0xdc, 0x0f, 0x0b, 0x0e, 0x99, 0x25, 0x83, 0x03, 0x4b,
+  0x1e, 0x5c, 0xc5, 0xa4, 0x89, 0xd3, 0x7d, 0x8e, 0x2d, 0x7c, 0x9c, 0xf3,
+  0xd5, 0x3b, 0x01, 0x0b, 0x97, 0xe9, 0x0a, 0x1a, 0xde, 0xbc, 0x11, 0x78,
+  0x11, 0xde, 0xfe, 0x6f, 0xff, 0xd7, 0x0e, 0xe7, 0xf8, 0x27, 0xbc, 0xc5,
+  0x3a, 0xcb, 0xdb, 0x20, 0x1a, 0x7b, 0x9b, 0xa6, 0xb1, 0x0f, 0xdc, 0x63,
+  0x4d, 0x2b, 0x3b, 0x65, 0xb1, 0x5a, 0x18, 0xb3, 0xf0, 0x12, 0x20, 0xf9,
+  0x3b, 0xb1, 0xf4, 0x43, 0x24, 0x8b, 0x4c, 0xf2, 0x26, 0x7e, 0xcf, 0xfd,
+  0xa9, 0x06, 0x1f, 0xb1, 0x33, 0x13, 0x46, 0xa2, 0xa7, 0x8c, 0x53, 0xd1,
+  0xea, 0x7b, 0x7c, 0x7d, 0xbe, 0x8a, 0x45, 0xde, 0x68, 0x88, 0xe8, 0xc7,
+  0x2a, 0x39, 0x32, 0x19, 0x75, 0x04, 0x42, 0x4f, 0x0a, 0xfb, 0xf2, 0x0b,
+  0x7b, 0x05, 0xff, 0xd6, 0xc9, 0xb2, 0x99, 0xb6, 0x49, 0x74, 0x57, 0xb0,
+  0x6e, 0xad, 0x72, 0xa0, 0x1c, 0xa3, 0xc2, 0x78, 0x41, 0xf6, 0xb5, 0x1a,
+  0x9e, 0x22, 0x19, 0x45, 0xa3, 0xba, 0x8b, 0xe8, 0x0e, 0x31, 0x8d, 0xee,
+  0x38, 0x66, 0x2c, 0x8e, 0x2d, 0x31, 0x84, 0x5b, 0xee, 0x8e, 0x34, 0xdc,
+  0x28, 0x91, 0x5c, 0xd7, 0x78, 0x27, 0xa8, 0x0f, 0x16, 0x61, 0xa2, 0x6d,
+  0xda, 0xcc, 0x30, 0x6c, 0x02, 0x62, 0xa6, 0x49, 0xfc, 0x2b, 0xdf, 0x53,
+  0xf2, 0xd4, 0x26, 0xfd, 0xa1, 0xe3, 0xc8, 0xfb, 0xeb, 0x72, 0xa3, 0x1f,
+  0x58, 0xb0, 0xc9, 0x2e, 0x4c, 0x16, 0x5b, 0x65, 0x89, 0xdb, 0x4c, 0x10,
+  0x1a, 0x6e, 0xd2, 0x53, 0x37, 0xe9, 0xc6, 0x0c, 0x9c, 0x91, 0xdc, 0x27,
+  0xf0, 0xde, 0xbf, 0x87, 0x3d, 0x12, 0xaf, 0xb4, 0xc3, 0x64, 0x4a, 0x62,
+  0x96, 0x6e, 0xc1, 0x40, 0x78, 0x1d, 0x7e, 0x87, 0xe0, 0xc3, 0xed, 0xf5,
+  0x4f, 0x80, 0x41, 0xb1, 0x02, 0xdd, 0xf8, 0xcd, 0x2d, 0x10, 0x13, 0x17,
+  0x91, 0x43, 0x17, 0x0c, 0xd4, 0xa3, 0x89, 0x2a, 0xf9, 0x86, 0xf0, 0xae,
+  0x4e, 0xba, 0x62, 0x61, 0xb1, 0xbb, 0x58, 0x19, 0x1b, 0x77, 0x7e, 0x4b,
+  0x70, 0xc3, 0x00, 0xb3, 0xd5, 0x01, 0x97, 0x09, 0x13, 0xf3, 0x71, 0x8c,
+  0x93, 0x01, 0x98, 0x65, 0xfd, 0xcc, 0x40, 0x2b, 0x80, 0x8f, 0x0b, 0xea,
+  0x07, 0x0c, 0xb2, 0x22, 0xd0, 0x68, 0x3e, 0x43, 0xc3, 0x04, 0x8f, 0x6c,
+  0x6e, 0xa3, 0x77, 0x34, 0x4e, 0xf8, 0x0a, 0xf8, 0x4d, 0x92, 0x05, 0x69,
+  0xc6, 0xe4, 0x02, 0xa2, 0xed, 0xa1, 0xd3, 0xca, 0x56, 0xb4, 0xfe, 0x67,
+  0xdb, 0x1b, 0x8e, 0x7b, 0xfc, 0xf7, 0x80, 0xff, 0x1e, 0xf1, 0xdf, 0x63,
+  0xce, 0x8d, 0x62, 0xca, 0x68, 0xb8, 0x6f, 0x4a, 0x69, 0xf0, 0xb8, 0x06,
+  0x3e, 0x1f, 0xa6, 0x77, 0x58, 0x9c, 0x6d, 0x39, 0xd6, 0x78, 0x7c, 0x4e,
+  0xd3, 0x0f, 0x60, 0xfc, 0x9a, 0xab, 0x02, 0xeb, 0x15, 0xd7, 0x00, 0x05,
+  0x68, 0xb7, 0x47, 0xde, 0x5e, 0xe7, 0x8b, 0xae, 0x40, 0xbf, 0xba, 0xbd,
+  0xbc, 0x77, 0x05, 0x84, 0xb6, 0xf4, 0x7e, 0x9c, 0xae, 0x8c, 0xc0, 0xf9,
+  0x5f, 0xae, 0x55, 0x6c, 0x60, 0x8c, 0xcd, 0x47, 0xe0, 0x54, 0xde, 0xa5,
+  0x08, 0xd3, 0x97, 0x68, 0xb3, 0xc5, 0x0b, 0x09, 0x4a, 0xd9, 0x82, 0x67,
+  0xb5, 0xc4, 0x8b, 0xa3, 0x0d, 0x5a, 0x4f, 0x29, 0x67, 0x9a, 0xc4, 0x4a,
+  0x55, 0xe2, 0xe9, 0x37, 0xd8, 0xaf, 0x7d, 0x1a, 0xa5, 0x24, 0xea, 0x85,
+  0x29, 0x84, 0x50, 0xe7, 0xa0, 0x69, 0x30, 0xae, 0xde, 0x0a, 0xf6, 0x06,
+  0x9a, 0xa9, 0xc1, 0x5e, 0x51, 0x61, 0x99, 0xa9, 0x94, 0xf6, 0xf9, 0x7c,
+  0x92, 0xe3, 0x5a, 0xc8, 0x36, 0x79, 0x03, 0x7a, 0x56, 0x2a, 0xef, 0xa1,
+  0x0d, 0xf2, 0x91, 0x4e, 0x8d, 0x0b, 0x7c, 0x14, 0xf0, 0xe0, 0x35, 0x2f,
+  0xf8, 0x59, 0x02, 0x9a, 0xd8, 0xc0, 0xf7, 0x80, 0x85, 0x36, 0x35, 0xc7,
+  0x8d, 0xcf, 0x44, 0xf5, 0xef, 0xf5, 0x78, 0xa7, 0x5c, 0x26, 0x6f, 0x3e,
+  0x45, 0xde, 0xb5, 0x40, 0x85, 0x0a, 0xfe, 0xfd, 0x84, 0xe1, 0xa5, 0x72,
+  0x51, 0xb4, 0x10, 0x37, 0x0c, 0x3c, 0x25, 0xb3, 0x50, 0x73, 0xad, 0x13,
+  0xf8, 0x7d, 0x22, 0x46, 0x5a, 0x65, 0x3d, 0xf5, 0x32, 0x2a, 0xa2, 0x48,
+  0xfd, 0xe0, 0x65, 0xc2, 0x34, 0x15, 0xa7, 0x3f, 0xb0, 0x96, 0xfc, 0x13,
+  0x3a, 0x5e, 0x94, 0xe6, 0xc4, 0x86, 0xe7, 0x7d, 0x1c, 0x2c, 0xee, 0x35,
+  0x58, 0x92, 0x05, 0x08, 0xdb, 0xeb, 0xe0, 0x49, 0x14, 0xf9, 0xdb, 0xdf,
+  0xd0, 0xca, 0x6c, 0x5a, 0x08, 0x44, 0x33, 0xaa, 0x16, 0x42, 0x15, 0x7f,
+  0x38, 0xcd, 0x2a, 0x56, 0xc7, 0x0b, 0x0a, 0xe8, 0xc9, 0xf8, 0x7b, 0xfd,
+  0x8a, 0xfc, 0x08, 0x5b, 0xaf, 0x2c, 0x20, 0x86, 0x62, 0xc9, 0xff, 0xfc,
+  0x87, 0x58, 0x9f, 0x00, 0xb8, 0x2b, 0x4e, 0x8d, 0xc0, 0xb6, 0x4c, 0x9f,
+  0x03, 0xe7, 0x6f, 0x0c, 0xc0, 0xfc, 0x0d, 0x07, 0x65, 0xdb, 0x96, 0xba,
+  0x2b, 0xb4, 0x48, 0xe4, 0x07, 0x11, 0x68, 0x64, 0xb4, 0xdc, 0x0b, 0x1b,
+  0x27, 0x00, 0xf4, 0x42, 0x82, 0x50, 0x80, 0xd4, 0x54, 0x16, 0xbf, 0xe1,
+  0x21, 0x24, 0x47, 0xb1, 0x76, 0x62, 0xa1, 0x96, 0x10, 0x23, 0x9e, 0xd0,
+  0x12, 0x1c, 0x21, 0xd7, 0x47, 0xfd, 0xf6, 0xde, 0xad, 0x25, 0x62, 0x4f,
+  0x05, 0xf3, 0x78, 0x71, 0x21, 0x27, 0xa0, 0xc0, 0x18, 0xf2, 0xe9, 0x04,
+  0x58, 0xdf, 0xda, 0x87, 0x24, 0x8c, 0x31, 0x50, 0x40, 0xce, 0x9c, 0x66,
+  0xe0, 0x8b, 0xab, 0xca, 0xb9, 0x6c, 0xf0, 0xa4, 0x7b, 0x9f, 0x74, 0xe4,
+  0x99, 0x79, 0x26, 0x1c, 0x3c, 0x42, 0x12, 0x29, 0xd0, 0xbf, 0x20, 0x03,
+  0x7a, 0x6e, 0xae, 0x9a, 0x2d, 0xe9, 0xf2, 0x05, 0xbd, 0xff, 0x9b, 0x5f,
+  0x47, 0xae, 0xb2, 0xc4, 0x30, 0xa8, 0xe8, 0x24, 0x02, 0xf1, 0xd2, 0x8e,
+  0xad, 0xcb, 0x6c, 0xa4, 0xa4, 0x6c, 0x31, 0x50, 0x13, 0xdd, 0x7c, 0x4f,
+  0xc4, 0x35, 0x4c, 0x50, 0x36, 0x57, 0xe7, 0xee, 0xf3, 0xb1, 0x49, 0x1a,
+  0x6d, 0x3e, 0xa7, 0x14, 0x83, 0x85, 0xb8, 0xd9, 0xca, 0xda, 0x9f, 0x08,
+  0xc3, 0x3f, 0xfb, 0xf7, 0x0c, 0xb2, 0x5f, 0x43, 0xf7, 0xa5, 0xe8, 0x4a,
+  0xd4, 0x0e, 0x45, 0xb6, 0x08, 0x68, 0x32, 0x6c, 0xc1, 0x7c, 0xe5, 0xe8,
+  0xf6, 0x1d, 0x07, 0xdc, 0x0d, 0xd0, 0x78, 0xcb, 0xd3, 0x7d, 0x54, 0x16,
+  0xe7, 0xff, 0x7b, 0x3b, 0xd6, 0xa6, 0x36, 0x6e, 0xe0, 0xf7, 0xfc, 0x0a,
+  0xc5, 0x9d, 0xd4, 0x76, 0x63, 0xe3, 0x07, 0xc4, 0x05, 0x0c, 0x61, 0x48,
+  0x26, 0x4c, 0xd2, 0x36, 0xa4, 0x13, 0x52, 0x3e, 0xa4, 0xb4, 0x8c, 0x31,
+  0x07, 0x78, 0x82, 0x7d, 0x8c, 0xef, 0x0c, 0x49, 0x19, 0xfe, 0x7b, 0x77,
+  0x57, 0xd2, 0x6a, 0x75, 0xa7, 0xbb, 0xb3, 0x33, 0x4c, 0x32, 0x24, 0x31,
+  0x3a, 0x9d, 0x76, 0xb5, 0xda, 0x5d, 0xed, 0x4b, 0x72, 0xd3, 0xcd, 0xe1,
+  0x89, 0xfb, 0x57, 0x2f, 0xc5, 0x74, 0x34, 0x2e, 0xe5, 0x41, 0x78, 0x1e,
+  0xe0, 0x41, 0x68, 0xad, 0x14, 0x5f, 0x8c, 0x64, 0x04, 0x5e, 0xc5, 0x66,
+  0xb0, 0xdc, 0xde, 0x8f, 0xd2, 0xab, 0x35, 0xaa, 0xa1, 0x6b, 0x98, 0xb6,
+  0x8e, 0xea, 0x75, 0xfb, 0x1b, 0x7a, 0x9b, 0xfc, 0xfd, 0x15, 0x99, 0x75,
+  0x2c, 0xe5, 0xc8, 0x9e, 0x0b, 0x7a, 0x5d, 0x4c, 0xcb, 0x3d, 0x82, 0x5d,
+  0x58, 0x0f, 0x78, 0x71, 0x1d, 0xc7, 0xf3, 0xc6, 0x02, 0xc6, 0x5a, 0x1f,
+  0x90, 0xdd, 0x66, 0x7b, 0x4c, 0xfd, 0x1e, 0xd0, 0xe5, 0x99, 0xee, 0x02,
+  0x5d, 0x07, 0xb6, 0x63, 0xc9, 0x64, 0x16, 0xf9, 0xa9, 0x90, 0x2d, 0x70,
+  0x45, 0x0a, 0x60, 0x8a, 0x1f, 0xa7, 0x42, 0x63, 0xda, 0xa2, 0xab, 0x6d,
+  0x11, 0x10, 0x16, 0x44, 0x77, 0x8d, 0x2b, 0x28, 0x2d, 0x4c, 0xe8, 0x36,
+  0x79, 0x33, 0x92, 0x83, 0x0c, 0x97, 0x78, 0x35, 0x1f, 0xf5, 0xcd, 0x0c,
+  0x82, 0x53, 0x78, 0x96, 0xd7, 0x5d, 0x3c, 0x91, 0xd4, 0xe4, 0x2f, 0xc5,
+  0x34, 0x2e, 0xa7, 0xe9, 0x69, 0x7c, 0x71, 0x81, 0x47, 0xbc, 0x73, 0xd3,
+  0x40, 0xa2, 0xc3, 0xf3, 0x0a, 0x3b, 0x03, 0x93, 0x9b, 0xcc, 0x9c, 0xf8,
+  0x0a, 0x60, 0x09, 0xfd, 0x8f, 0xc0, 0x53, 0x9a, 0x5d, 0x7a, 0x10, 0xb8,
+  0x57, 0xc8, 0x16, 0xd1, 0x80, 0xd6, 0x4c, 0x56, 0x24, 0xe4, 0x09, 0x59,
+  0xa4, 0xfd, 0x9e, 0xe8, 0x03, 0x19, 0x82, 0x82, 0x15, 0x07, 0x9f, 0xd0,
+  0x0e, 0x36, 0x5d, 0x2c, 0xa1, 0xe1, 0xff, 0x21, 0xac, 0x62, 0x34, 0xfa,
+  0x32, 0x34, 0x82, 0xe3, 0xc4, 0x28, 0x40, 0xa5, 0x68, 0x7a, 0xa3, 0x16,
+  0xb3, 0x49, 0x2a, 0xc8, 0x84, 0x6d, 0xa7, 0x17, 0xab, 0xac, 0x34, 0x66,
+  0xba, 0x61, 0xb1, 0xa4, 0xbe, 0xe0, 0x61, 0xc0, 0xe9, 0x11, 0x2e, 0x59,
+  0x7d, 0xb8, 0xcc, 0x60, 0xe3, 0x92, 0xc1, 0x68, 0x18, 0x33, 0x62, 0xf1,
+  0xea, 0xdb, 0x28, 0x9b, 0x98, 0x16, 0x98, 0xad, 0x6e, 0x4e, 0x85, 0xe0,
+  0xa1, 0x97, 0xc7, 0xb5, 0xd7, 0xfa, 0xb2, 0x2b, 0x1e, 0x04, 0x2c, 0xa5,
+  0x25, 0x06, 0x89, 0x67, 0xfe, 0x20, 0xf1, 0x2c, 0x24, 0x6b, 0xce, 0x86,
+  0x16, 0x10, 0xa8, 0xf1, 0x54, 0x82, 0xa9, 0xa4, 0xbf, 0x4d, 0xf8, 0x21,
+  0xd5, 0x74, 0x3e, 0x0f, 0xa0, 0x3e, 0x7d, 0xea, 0xc6, 0x1a, 0xe6, 0xd4,
+  0xa8, 0x7e, 0x42, 0xaa, 0x78, 0x65, 0x40, 0xc6, 0x3a, 0x17, 0xf3, 0x13,
+  0xa3, 0x15, 0x81, 0x82, 0x1d, 0x62, 0x65, 0x40, 0x64, 0xcf, 0xe7, 0xc0,
+  0x40, 0x6b, 0x11, 0x90, 0xb3, 0xef, 0x98, 0xcd, 0x59, 0x70, 0x2e, 0x67,
+  0x76, 0x26, 0xcb, 0xbc, 0x5f, 0xa0, 0xab, 0x1c, 0x4e, 0x9e, 0xaa, 0x52,
+  0xe8, 0x9e, 0x4a, 0x9f, 0x8a, 0x4a, 0xff, 0xb0, 0x5e, 0x8f, 0x82, 0x4c,
+  0x99, 0x88, 0xd2, 0x55, 0x7c, 0x77, 0x18, 0xa5, 0x89, 0x35, 0xb9, 0xb5,
+  0xc1, 0x8d, 0xdb, 0x09, 0x2e, 0xaf, 0x3d, 0x94, 0xee, 0xff, 0x6a, 0xf4,
+  0x89, 0xa5, 0x40, 0x31, 0xfe, 0x30, 0x6e, 0xce, 0xa6, 0x14, 0x49, 0x19,
+  0x59, 0x46, 0xae, 0xba, 0xc3, 0xf2, 0x13, 0xc9, 0x5b, 0x98, 0x8e, 0x3a,
+  0x8c, 0xdd, 0x41, 0xf9, 0x0b, 0xdc, 0x2b, 0x75, 0xac, 0xcf, 0x4c, 0xdd,
+  0x3a, 0x09, 0x9a, 0x08, 0x76, 0x1f, 0xd4, 0x2a, 0x41, 0x60, 0x0f, 0x0a,
+  0xf3, 0xcd, 0x48, 0x7a, 0xfb, 0x33, 0xe9, 0xb3, 0x61, 0x44, 0x0c, 0x63,
+  0x17, 0x33, 0x32, 0xd3, 0xc5, 0x8e, 0x89, 0x06, 0x30, 0x3c, 0x13, 0xd6,
+  0xef, 0x4c, 0x5b, 0xbf, 0xae, 0x4b, 0x32, 0xba, 0x88, 0x8c, 0x46, 0x49,
+  0xd6, 0xe6, 0x11, 0x55, 0x1e, 0x34, 0x3a, 0xf5, 0xce, 0x65, 0x4b, 0xd5,
+  0x7f, 0xfe, 0x69, 0x7d, 0x6b, 0x08, 0xd4, 0xe0, 0xe6, 0x93, 0x13, 0x6a,
+  0x3f, 0x81, 0x3f, 0x56, 0xe5, 0x5f, 0x69, 0xbf, 0xcd, 0x2f, 0x9a, 0xc4,
+  0xfd, 0xd4, 0x60, 0x43, 0x5a, 0xd9, 0x8b, 0x30, 0x82, 0xbe, 0xe2, 0x06,
+  0xad, 0xff, 0xc8, 0x5e, 0xf0, 0xca, 0x16, 0xf0, 0xa9, 0x29, 0xae, 0x6b,
+  0x9c, 0xd4, 0x71, 0x38, 0xc6, 0x13, 0xba, 0x02, 0x70, 0xae, 0xc8, 0x6c,
+  0xcb, 0x87, 0x0e, 0xd3, 0xbf, 0xff, 0x1d, 0xb5, 0xff, 0xdb, 0x6f, 0x7f,
+  0xee, 0xb6, 0xb7, 0xfe, 0x21, 0x9c, 0x4f, 0x0d, 0x14, 0x4b, 0x78, 0x83,
+  0xb7, 0x74, 0x17, 0x5c, 0xd9, 0x23, 0x8d, 0xa9, 0xe7, 0x10, 0xcd, 0xc6,
+  0x88, 0xb1, 0xd7, 0x91, 0x22, 0xbf, 0x2f, 0x77, 0xdc, 0xbd, 0x86, 0xb5,
+  0xe2, 0x7b, 0x0d, 0x6b, 0xe6, 0x5e, 0xc3, 0x5a, 0x6f, 0xbd, 0x66, 0xef,
+  0x35, 0xa4, 0xcf, 0x74, 0x2f, 0x61, 0x6d, 0xbc, 0x98, 0xe3, 0x05, 0x01,
+  0xaf, 0x91, 0x8f, 0x6a, 0x0a, 0xbf, 0xc1, 0xe0, 0x55, 0xfc, 0x75, 0xb7,
+  0x86, 0x97, 0x21, 0xf4, 0x5f, 0x0c, 0xf0, 0x2f, 0x00, 0x32, 0xd7, 0x1f,
+  0xd6, 0xde, 0xf7, 0xbb, 0x9b, 0xad, 0xcd, 0xee, 0xdb, 0xde, 0xaf, 0x83,
+  0xe3, 0x17, 0x83, 0xd1, 0xc6, 0x66, 0x0b, 0x7e, 0xe8, 0xf8, 0x68, 0x7b,
+  0x6b, 0xd0, 0xea, 0x1e, 0xc3, 0xa3, 0x8d, 0xcd, 0xfd, 0xde, 0xa0, 0x05,
+  0x3f, 0xfa, 0x54, 0xe9, 0x7a, 0xbf, 0xb5, 0x35, 0x38, 0xee, 0xe3, 0x49,
+  0x2c, 0xd1, 0x4a, 0x9f, 0xdf, 0xe6, 0x5b, 0xdb, 0xbd, 0xc1, 0xf1, 0xd6,
+  0xc0, 0x1b, 0x40, 0x43, 0xfc, 0xfc, 0x1e, 0xc6, 0x07, 0x88, 0x30, 0x1c,
+  0xfc, 0x50, 0xe7, 0xd6, 0x60, 0x43, 0x43, 0xdc, 0x1a, 0x7c, 0xc6, 0xc0,
+  0x3c, 0xe2, 0x88, 0x19, 0xc2, 0xdb, 0x4b, 0x9b, 0x27, 0x14, 0x6b, 0x6b,
+  0x5b, 0x0a, 0x49, 0xaf, 0x0b, 0x88, 0x0b, 0x9c, 0x37, 0xe2, 0xe2, 0x8c,
+  0xbb, 0x36, 0xf3, 0xdc, 0xb5, 0xe0, 0xf8, 0x4e, 0xcc, 0x1e, 0xf4, 0x39,
+  0xde, 0x15, 0x64, 0xfe, 0xca, 0x0f, 0x3b, 0xf9, 0x0c, 0x49, 0x42, 0x46,
+  0xe2, 0x97, 0x89, 0x9c, 0xe3, 0x03, 0xda, 0xd3, 0x40, 0x8b, 0xfd, 0x45,
+  0xe9, 0x2b, 0xa5, 0x8f, 0x4f, 0xd1, 0x13, 0x58, 0xf1, 0xe8, 0xfa, 0xbc,
+  0x0c, 0x11, 0x5d, 0x63, 0x2a, 0x34, 0x6f, 0x60, 0xc0, 0xdb, 0x49, 0xb2,
+  0x00, 0xfb, 0x4a, 0x43, 0xd6, 0x9b, 0x39, 0x8a, 0x31, 0xce, 0xa1, 0x22,
+  0x2e, 0x8e, 0x72, 0x59, 0x18, 0x09, 0xc2, 0xf7, 0x7d, 0x9b, 0x0b, 0x5b,
+  0x38, 0xea, 0xfc, 0xc7, 0x24, 0x49, 0x41, 0xb8, 0xa6, 0xf1, 0x6d, 0x84,
+  0x27, 0x13, 0x8c, 0xf0, 0x72, 0x30, 0x0a, 0xe5, 0xef, 0xdd, 0x39, 0x79,
+  0x61, 0x56, 0x22, 0x01, 0xf3, 0x4a, 0x75, 0x12, 0x12, 0x52, 0x8e, 0x6f,
+  0x95, 0xd9, 0x9c, 0x1a, 0x5e, 0xd3, 0x06, 0xf0, 0x22, 0xd8, 0xd9, 0xc0,
+  0xda, 0x73, 0x98, 0x82, 0x92, 0xf6, 0xd1, 0xd4, 0x24, 0x3c, 0x82, 0x8d,
+  0x83, 0xd7, 0xcc, 0x6a, 0x65, 0x0a, 0x98, 0x97, 0xad, 0x4a, 0xae, 0x2c,
+  0x3a, 0xb7, 0xad, 0xe9, 0x65, 0x5a, 0x76, 0x88, 0xb3, 0xf8, 0x2b, 0x8c,
+  0x50, 0xe8, 0x12, 0x6a, 0x54, 0xdf, 0x4e, 0xce, 0x23, 0x53, 0xd6, 0xac,
+  0xa8, 0x82, 0x1a, 0x27, 0x8a, 0x1b, 0x1f, 0x6c, 0x3e, 0x65, 0x90, 0xb2,
+  0xd5, 0xce, 0x21, 0x48, 0xec, 0x29, 0x57, 0x8d, 0xa2, 0x0b, 0x39, 0x73,
+  0xd3, 0xad, 0x07, 0x2a, 0xaf, 0x19, 0xf1, 0x03, 0xbc, 0x79, 0x94, 0x4b,
+  0x93, 0x97, 0xe1, 0x79, 0xec, 0x0b, 0x30, 0xe8, 0xca, 0xd2, 0x46, 0xd3,
+  0x17, 0xbc, 0x7c, 0xdd, 0x37, 0x47, 0x4e, 0xef, 0x2a, 0x42, 0x1c, 0x79,
+  0x4a, 0x58, 0xd6, 0xc2, 0x72, 0xf3, 0x25, 0xde, 0xb4, 0xb3, 0xb7, 0x5c,
+  0x76, 0x17, 0xf0, 0xe4, 0x77, 0x2d, 0x39, 0xed, 0x76, 0x7c, 0x57, 0xe9,
+  0xee, 0x23, 0xf4, 0x2c, 0x41, 0x73, 0xab, 0x5d, 0x15, 0x58, 0x63, 0x4d,
+  0xc1, 0x54, 0x33, 0x86, 0xf4, 0xeb, 0xeb, 0x48, 0x6b, 0x03, 0x62, 0x6d,
+  0xa9, 0x25, 0x54, 0x28, 0xcf, 0x57, 0xee, 0x31, 0x2f, 0xc1, 0xb5, 0x22,
+  0xea, 0xb2, 0xaa, 0x1a, 0x7a, 0x6c, 0x45, 0xe4, 0xc5, 0x76, 0xee, 0xaa,
+  0x62, 0x44, 0xa1, 0x65, 0x08, 0xf3, 0xb5, 0xc9, 0x91, 0x31, 0x4f, 0xda,
+  0x33, 0x25, 0xcc, 0x89, 0x98, 0xee, 0x2b, 0x8b, 0xe2, 0x9a, 0x53, 0x27,
+  0x1a, 0x4b, 0xfc, 0xda, 0x81, 0x0c, 0xd8, 0x23, 0x63, 0xe6, 0x9e, 0x2c,
+  0xfa, 0xdd, 0xbe, 0xce, 0x95, 0x60, 0x2f, 0xc0, 0x1b, 0x8b, 0x21, 0x51,
+  0xad, 0x62, 0x79, 0xf4, 0xaa, 0x5b, 0x98, 0x5e, 0x5e, 0x11, 0xb6, 0x06,
+  0x28, 0x7b, 0xe4, 0x8e, 0xec, 0xf6, 0x72, 0xc1, 0x6b, 0x69, 0x4d, 0x82,
+  0xdf, 0x1e, 0x25, 0x3a, 0xaf, 0xcb, 0x51, 0x45, 0xac, 0x26, 0x40, 0x33,
+  0x2e, 0x7d, 0x87, 0x24, 0x82, 0xed, 0x29, 0xff, 0x6a, 0x16, 0x56, 0x71,
+  0x80, 0x9c, 0x3d, 0x14, 0x8c, 0x61, 0x83, 0x8d, 0x6e, 0xcd, 0x7c, 0x74,
+  0xdc, 0xc7, 0xc8, 0xbf, 0x0c, 0x04, 0xe1, 0x36, 0x87, 0x45, 0x34, 0xe3,
+  0x03, 0x3c, 0xf5, 0x61, 0x96, 0x60, 0x54, 0x0d, 0x3e, 0x94, 0x9e, 0x82,
+  0x73, 0xfc, 0x95, 0xe6, 0x13, 0xc4, 0xe0, 0xf9, 0x73, 0x3d, 0xd9, 0x97,
+  0xaa, 0xdf, 0xfd, 0xf1, 0xd0, 0x4d, 0x0c, 0x9f, 0xbd, 0x03, 0xef, 0xb7,
+  0x8c, 0xc3, 0xa2, 0xff, 0x80, 0x80, 0x1f, 0x7a, 0xbe, 0x84, 0x4a, 0x62,
+  0x80, 0x36, 0x1f, 0x2a, 0x20, 0xb5, 0x2d, 0x07, 0x40, 0x72, 0x26, 0x8a,
+  0xbe, 0x2b, 0x0b, 0xd8, 0xe1, 0x5a, 0x81, 0x8b, 0x3f, 0xa2, 0xc8, 0x8f,
+  0x18, 0x48, 0x3b, 0x88, 0xa6, 0x47, 0xb3, 0x9a, 0x29, 0x4d, 0x88, 0xdc,
+  0x0e, 0x09, 0x66, 0x57, 0xc7, 0x6b, 0x49, 0x86, 0x62, 0x70, 0x39, 0x6f,
+  0x6e, 0xe6, 0xb0, 0x8b, 0x69, 0x7b, 0x68, 0xa9, 0x17, 0x26, 0xba, 0xf7,
+  0x90, 0x51, 0xfa, 0xe2, 0x84, 0x8a, 0xcb, 0x93, 0xa9, 0x8c, 0x17, 0x01,
+  0xee, 0xdd, 0x92, 0x76, 0x14, 0x17, 0x0f, 0x94, 0x09, 0x29, 0x6f, 0x43,
+  0xfc, 0x0a, 0x79, 0x95, 0x09, 0x27, 0x55, 0xb5, 0x12, 0x03, 0x4a, 0x5a,
+  0xdd, 0x1a, 0x63, 0x0e, 0xce, 0xea, 0x0b, 0x9b, 0x64, 0x35, 0xee, 0x1c,
+  0xcd, 0x96, 0x5e, 0x33, 0x33, 0x71, 0xd2, 0xdd, 0x22, 0x61, 0xd6, 0x76,
+  0x98, 0xc8, 0xfc, 0x6a, 0xb9, 0x31, 0x89, 0x15, 0xe8, 0xa4, 0x57, 0x7d,
+  0x1a, 0xa5, 0x57, 0xf1, 0x39, 0x98, 0xd1, 0x7f, 0x7e, 0x38, 0xfa, 0x54,
+  0x6f, 0x69, 0xeb, 0x96, 0xbe, 0x2a, 0x29, 0xd9, 0x06, 0xc4, 0xea, 0x66,
+  0xbd, 0xda, 0x9f, 0xbe, 0xdd, 0x44, 0x75, 0x0c, 0x01, 0xdd, 0xdc, 0x80,
+  0x07, 0x45, 0x41, 0x9e, 0x0e, 0x66, 0x8a, 0xeb, 0x40, 0x66, 0x7a, 0x09,
+  0x4f, 0xe1, 0x6e, 0xab, 0xdf, 0x8e, 0x3e, 0x1c, 0x82, 0x52, 0xc4, 0xb8,
+  0xdc, 0xe4, 0xe2, 0x5b, 0xe3, 0x9e, 0x0c, 0x97, 0x6d, 0x95, 0xb4, 0x78,
+  0xbf, 0xde, 0x06, 0x2a, 0x3d, 0x34, 0x69, 0x4d, 0x96, 0x4c, 0x43, 0xd3,
+  0xf0, 0xc5, 0x92, 0x8e, 0x44, 0x38, 0x5f, 0x9b, 0x46, 0x49, 0x32, 0xba,
+  0xa4, 0x88, 0x2f, 0x10, 0x72, 0x86, 0x13, 0x04, 0xb1, 0x5f, 0x8c, 0xc7,
+  0xd0, 0xce, 0x3c, 0x62, 0x72, 0x5b, 0xa6, 0xb5, 0x30, 0xd3, 0xcf, 0xb5,
+  0x62, 0xf3, 0x48, 0xa7, 0xe7, 0x86, 0x86, 0x97, 0x6c, 0x04, 0x38, 0x9f,
+  0x1a, 0xe7, 0x45, 0x3c, 0xc8, 0x66, 0xc4, 0x65, 0xc8, 0xc1, 0xc6, 0xa0,
+  0xb2, 0xd1, 0x06, 0x5b, 0x3d, 0xfb, 0xa5, 0xa5, 0x6e, 0x73, 0xb9, 0xc0,
+  0x28, 0xdd, 0x43, 0x41, 0xf8, 0x82, 0x4b, 0xb8, 0x8b, 0x9f, 0x6e, 0x4b,
+  0xf3, 0x82, 0x46, 0xe4, 0x79, 0x92, 0x9a, 0xb5, 0x46, 0xb7, 0x84, 0x14,
+  0x33, 0x86, 0xd1, 0x11, 0x79, 0x94, 0x03, 0xc2, 0xc2, 0xe7, 0x5f, 0x34,
+  0x98, 0x3c, 0x4f, 0x21, 0x8a, 0x18, 0x29, 0x3c, 0x20, 0xf4, 0x1a, 0x14,
+  0x2f, 0xec, 0x91, 0x6f, 0xd6, 0xad, 0x37, 0x83, 0xcb, 0xa7, 0xa9, 0x6c,
+  0x48, 0x6b, 0x7a, 0xac, 0x44, 0x51, 0x89, 0x1c, 0x9d, 0x3f, 0x60, 0x31,
+  0xbe, 0x1e, 0x95, 0x09, 0xa1, 0x88, 0x33, 0xb2, 0xad, 0x16, 0x97, 0xbe,
+  0xe0, 0x62, 0x8a, 0x61, 0x81, 0xb2, 0xcc, 0xf2, 0xc3, 0x24, 0x0a, 0xa6,
+  0x00, 0x32, 0x84, 0x5f, 0x52, 0x78, 0x00, 0x24, 0x4c, 0x1b, 0xd7, 0xa3,
+  0x66, 0x0b, 0x26, 0x31, 0xf3, 0x1b, 0xe3, 0xe6, 0x23, 0x49, 0x59, 0x48,
+  0xbe, 0x0c, 0x37, 0x09, 0x01, 0xfb, 0xbe, 0x55, 0x64, 0xb9, 0xd0, 0xa9,
+  0x4f, 0x5f, 0x2a, 0xfc, 0x02, 0x37, 0x0e, 0xc3, 0x99, 0x66, 0x1c, 0x51,
+  0x17, 0xbc, 0xcd, 0xb1, 0xc3, 0x9e, 0x02, 0xd3, 0x4f, 0xd9, 0x83, 0x7e,
+  0x6a, 0x04, 0xfb, 0x16, 0xc5, 0xf7, 0xc6, 0xf3, 0x08, 0x9c, 0x63, 0xfc,
+  0x6a, 0xb8, 0x44, 0xdd, 0x4d, 0xa0, 0xcb, 0x59, 0xa4, 0xa2, 0x39, 0x7e,
+  0x4b, 0xdc, 0x1a, 0xb0, 0xa6, 0x59, 0x31, 0x7f, 0x51, 0x69, 0x3c, 0x5c,
+  0xcd, 0xcc, 0x4a, 0xda, 0x29, 0x06, 0x99, 0xd9, 0x54, 0xc5, 0x18, 0x04,
+  0x32, 0x8a, 0x58, 0xbc, 0xb9, 0x3c, 0x79, 0x32, 0x75, 0x53, 0x98, 0xbe,
+  0x1d, 0x73, 0xad, 0x9c, 0xbb, 0xa4, 0xc5, 0xd1, 0x2b, 0xc6, 0xdc, 0x1e,
+  0x96, 0x66, 0xd2, 0xac, 0x64, 0x05, 0x5d, 0xbb, 0x6d, 0x77, 0x1b, 0xaf,
+  0xae, 0x6e, 0x07, 0xeb, 0x59, 0xf2, 0x95, 0x76, 0x26, 0x13, 0x36, 0x99,
+  0xf9, 0xb9, 0x30, 0xaf, 0x23, 0x67, 0xc3, 0x74, 0x71, 0xdf, 0x18, 0x0b,
+  0xad, 0xe4, 0xf3, 0x67, 0xf0, 0xbc, 0xd4, 0x9a, 0xf4, 0xcb, 0x2e, 0xf3,
+  0xfe, 0xdf, 0xfe, 0x22, 0x8d, 0xb9, 0x0e, 0x55, 0x01, 0x2e, 0x94, 0x3f,
+  0x83, 0xff, 0x61, 0x85, 0xb6, 0x49, 0xcb, 0x20, 0xd4, 0x1d, 0xd5, 0xeb,
+  0xa2, 0xb2, 0xe9, 0xba, 0x40, 0x10, 0x34, 0x2f, 0x09, 0x18, 0xa3, 0x63,
+  0xec, 0x6f, 0xe8, 0xcb, 0x5f, 0x76, 0x55, 0xc3, 0x64, 0x46, 0xe5, 0x6c,
+  0x30, 0xf9, 0x87, 0xad, 0xbf, 0x00, 0xb4, 0x6e, 0xd3, 0x45, 0x95, 0xf3,
+  0x04, 0xa5, 0x0a, 0xa1, 0xfb, 0x27, 0x45, 0xc9, 0x61, 0x32, 0x7d, 0xd3,
+  0xaa, 0xa4, 0xb9, 0x24, 0x8b, 0x7e, 0x2f, 0x4d, 0x43, 0x15, 0x08, 0x5c,
+  0xad, 0x1b, 0x9d, 0xc5, 0x71, 0x6a, 0xca, 0x57, 0x3f, 0xd2, 0x2f, 0xce,
+  0xa8, 0xea, 0x75, 0xed, 0xd1, 0xfe, 0x7c, 0x09, 0xbe, 0xb9, 0x85, 0x86,
+  0xab, 0xee, 0x85, 0x93, 0xa5, 0xc7, 0x3c, 0xa2, 0x85, 0xed, 0x09, 0x2b,
+  0x7d, 0x3e, 0xa9, 0xb6, 0xd1, 0xf9, 0x5d, 0xcd, 0x76, 0xfc, 0x6a, 0xe5,
+  0xc4, 0xc5, 0x44, 0xea, 0xde, 0x96, 0xed, 0xb0, 0x31, 0x14, 0xce, 0x58,
+  0xd1, 0xf3, 0x09, 0xda, 0x45, 0x69, 0x96, 0x87, 0x3e, 0x46, 0xe7, 0x93,
+  0xb9, 0x67, 0x19, 0x0d, 0x41, 0x07, 0xcc, 0x40, 0x80, 0xd6, 0x42, 0x3b,
+  0xfc, 0x13, 0x61, 0x3b, 0xdf, 0x07, 0x87, 0xf3, 0x49, 0x4b, 0x45, 0x1f,
+  0x8c, 0x19, 0x70, 0x05, 0x9a, 0xe9, 0x0f, 0xd6, 0xf2, 0xec, 0x59, 0x6b,
+  0xc1, 0xf7, 0xec, 0xfc, 0x2c, 0xfc, 0xdc, 0xb1, 0xd8, 0xbd, 0x63, 0x28,
+  0x2e, 0x89, 0x6d, 0x8a, 0xd8, 0x7d, 0x46, 0x4e, 0x49, 0x30, 0xa7, 0xa3,
+  0xaf, 0x8d, 0x6e, 0x4b, 0x0a, 0xa9, 0x1b, 0xb0, 0x69, 0x5e, 0xd2, 0x2a,
+  0xc1, 0xfc, 0x22, 0x8b, 0x6d, 0xe5, 0x2a, 0x9a, 0x7e, 0x8c, 0xb5, 0x8f,
+  0xb1, 0x64, 0xe4, 0x02, 0x3c, 0xb3, 0x2b, 0xe2, 0x3d, 0x1d, 0x06, 0xeb,
+  0x7c, 0x43, 0xea, 0x8d, 0x34, 0x7b, 0x87, 0xc5, 0x9e, 0xf4, 0x1b, 0xf2,
+  0x8e, 0x79, 0x72, 0x94, 0x46, 0x37, 0x5a, 0x47, 0x11, 0x43, 0x99, 0x6e,
+  0xae, 0xd5, 0xd3, 0x85, 0x5c, 0x19, 0xbf, 0xac, 0x13, 0x9d, 0xa9, 0xb3,
+  0x77, 0x51, 0x19, 0x0f, 0xfa, 0xae, 0x90, 0x71, 0x1f, 0xad, 0x9e, 0x66,
+  0xd9, 0x80, 0xa3, 0xb3, 0x3f, 0x8f, 0xb0, 0x9a, 0x5a, 0xe1, 0x35, 0x5c,
+  0x7b, 0x75, 0xd7, 0xcd, 0x2b, 0xf4, 0xc8, 0x97, 0xff, 0x2b, 0x79, 0x7d,
+  0x97, 0x79, 0xad, 0xc8, 0x64, 0x0d, 0xe1, 0xd9, 0xa3, 0x75, 0xc9, 0x90,
+  0x2e, 0x84, 0x9f, 0x3c, 0x39, 0x60, 0x5c, 0xcd, 0x0a, 0xd4, 0x90, 0xd3,
+  0x91, 0xcb, 0x37, 0x9c, 0x4d, 0xec, 0xa7, 0x99, 0x72, 0x2b, 0xa6, 0x4a,
+  0x00, 0x2f, 0x15, 0x98, 0xf0, 0x37, 0x69, 0xbb, 0x50, 0x97, 0x88, 0xf2,
+  0x23, 0x3a, 0x12, 0x75, 0x7b, 0x06, 0xc4, 0x55, 0x07, 0x3d, 0xf5, 0xed,
+  0x66, 0x65, 0x0d, 0xd7, 0xe5, 0x3c, 0x01, 0x2c, 0x99, 0xb7, 0x44, 0x33,
+  0xbb, 0xfb, 0x63, 0xad, 0x40, 0x38, 0x24, 0x90, 0x35, 0x90, 0xbd, 0x53,
+  0x1b, 0xab, 0xc8, 0x82, 0x3c, 0x05, 0xe2, 0x84, 0xc1, 0x97, 0x3a, 0x29,
+  0x0d, 0x19, 0x79, 0x7c, 0x3c, 0x71, 0x60, 0x7d, 0xb0, 0xa2, 0x3c, 0xe4,
+  0x50, 0x25, 0x81, 0xc8, 0xa9, 0x8d, 0x10, 0x8a, 0x7c, 0xb6, 0xa5, 0x62,
+  0x31, 0xec, 0x60, 0x95, 0xf2, 0x90, 0x57, 0x56, 0xaa, 0x08, 0x2e, 0x2a,
+  0x78, 0xec, 0xba, 0xaa, 0x48, 0x30, 0x2e, 0xc5, 0xa6, 0x6b, 0xa1, 0xe1,
+  0x2a, 0xc0, 0x92, 0xed, 0x3c, 0xf7, 0xf7, 0xba, 0x9c, 0x25, 0x5b, 0xc8,
+  0xf4, 0xf6, 0xe6, 0xb5, 0xa4, 0x6c, 0x08, 0xcf, 0xf6, 0x7f, 0x07, 0xae,
+  0xa5, 0xd6, 0xf4, 0x56, 0xae, 0xc0, 0x1c, 0x31, 0x47, 0x54, 0x76, 0x3a,
+  0x74, 0xb7, 0xd7, 0x4e, 0x47, 0x7f, 0x5b, 0xfb, 0xff, 0x25, 0x0a, 0x0e,
+  0xd1, 0xbe, 0x7d, 0x00, 0x00
 };
-const unsigned int INDEX_HTML_GZ_LEN = 8246;
+const unsigned int INDEX_HTML_GZ_LEN = 8357;
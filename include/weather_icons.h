@@ -0,0 +1,608 @@
+// Generated by tools/pack_icons.py from assets/icons/*.png - do not edit
+// Run-length encoded RGB565, see src/rle565.h
+#pragma once
+
+#define WEATHER_ICON_W 48
+#define WEATHER_ICON_H 48
+
+const unsigned char ICON_CLEAR_DAY_RLE[] PROGMEM = {
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x81, 0x5a, 0x41, 0x96, 0x00, 0x00, 0x95, 0x00, 0x00,
+  0x00, 0x5a, 0x41, 0x81, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x95, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe, 0x45, 0x00, 0x7b, 0x02,
+  0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe, 0x45,
+  0x00, 0x7b, 0x02, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x7b, 0x02,
+  0x81, 0xfe, 0x45, 0x00, 0x7b, 0x02, 0x95, 0x00, 0x00, 0x89, 0x00, 0x00,
+  0x01, 0x08, 0x40, 0x29, 0x20, 0x89, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81,
+  0xfe, 0x45, 0x00, 0x7b, 0x02, 0x89, 0x00, 0x00, 0x01, 0x29, 0x20, 0x08,
+  0x40, 0x89, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0x08, 0x40, 0xed, 0xc4,
+  0xfe, 0x45, 0x9b, 0xe3, 0x88, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe,
+  0x45, 0x00, 0x7b, 0x02, 0x88, 0x00, 0x00, 0x03, 0x9b, 0xe3, 0xfe, 0x45,
+  0xed, 0xc4, 0x08, 0x40, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x29,
+  0x20, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x87, 0x00, 0x00, 0x00, 0x5a,
+  0x41, 0x81, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x87, 0x00, 0x00, 0x00, 0x9b,
+  0xe3, 0x82, 0xfe, 0x45, 0x00, 0x29, 0x20, 0x88, 0x00, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x87, 0x00,
+  0x00, 0x81, 0x5a, 0x41, 0x87, 0x00, 0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe,
+  0x45, 0x00, 0x9b, 0xe3, 0x89, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x9b,
+  0xe3, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x8f, 0x00, 0x00, 0x00, 0x9b,
+  0xe3, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x8a, 0x00, 0x00, 0x8b, 0x00,
+  0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x39, 0x81, 0x82, 0x00,
+  0x00, 0x02, 0x5a, 0x41, 0xac, 0x43, 0xdd, 0x64, 0x81, 0xfe, 0x45, 0x02,
+  0xdd, 0x64, 0xac, 0x43, 0x5a, 0x41, 0x82, 0x00, 0x00, 0x00, 0x39, 0x81,
+  0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x8b, 0x00, 0x00, 0x8c, 0x00, 0x00,
+  0x06, 0x9b, 0xe3, 0xfe, 0x45, 0xed, 0xc4, 0x18, 0xc0, 0x00, 0x00, 0x49,
+  0xe1, 0xdd, 0x64, 0x87, 0xfe, 0x45, 0x06, 0xdd, 0x64, 0x49, 0xe1, 0x00,
+  0x00, 0x18, 0xc0, 0xed, 0xc4, 0xfe, 0x45, 0x9b, 0xe3, 0x8c, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x03, 0x39, 0x81, 0x18, 0xc0, 0x00, 0x00, 0x9b, 0xe3,
+  0x8b, 0xfe, 0x45, 0x03, 0x9b, 0xe3, 0x00, 0x00, 0x18, 0xc0, 0x39, 0x81,
+  0x8d, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x9b, 0xe3, 0x8d, 0xfe, 0x45,
+  0x00, 0x9b, 0xe3, 0x8f, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x49, 0xe1,
+  0x8f, 0xfe, 0x45, 0x00, 0x49, 0xe1, 0x8e, 0x00, 0x00, 0x8e, 0x00, 0x00,
+  0x00, 0xdd, 0x64, 0x8f, 0xfe, 0x45, 0x00, 0xdd, 0x64, 0x8e, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x5a, 0x41, 0x91, 0xfe, 0x45, 0x00, 0x5a, 0x41,
+  0x8d, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xac, 0x43, 0x91, 0xfe, 0x45,
+  0x00, 0xac, 0x43, 0x8d, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x5a, 0x41,
+  0x84, 0x7b, 0x02, 0x00, 0x5a, 0x41, 0x81, 0x00, 0x00, 0x00, 0xdd, 0x64,
+  0x91, 0xfe, 0x45, 0x00, 0xdd, 0x64, 0x81, 0x00, 0x00, 0x00, 0x5a, 0x41,
+  0x84, 0x7b, 0x02, 0x00, 0x5a, 0x41, 0x84, 0x00, 0x00, 0x83, 0x00, 0x00,
+  0x00, 0x5a, 0x41, 0x86, 0xfe, 0x45, 0x01, 0x5a, 0x41, 0x00, 0x00, 0x93,
+  0xfe, 0x45, 0x01, 0x00, 0x00, 0x5a, 0x41, 0x86, 0xfe, 0x45, 0x00, 0x5a,
+  0x41, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x5a, 0x41, 0x86, 0xfe,
+  0x45, 0x01, 0x5a, 0x41, 0x00, 0x00, 0x93, 0xfe, 0x45, 0x01, 0x00, 0x00,
+  0x5a, 0x41, 0x86, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x83, 0x00, 0x00, 0x84,
+  0x00, 0x00, 0x00, 0x5a, 0x41, 0x84, 0x7b, 0x02, 0x00, 0x5a, 0x41, 0x81,
+  0x00, 0x00, 0x00, 0xdd, 0x64, 0x91, 0xfe, 0x45, 0x00, 0xdd, 0x64, 0x81,
+  0x00, 0x00, 0x00, 0x5a, 0x41, 0x84, 0x7b, 0x02, 0x00, 0x5a, 0x41, 0x84,
+  0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xac, 0x43, 0x91, 0xfe, 0x45, 0x00,
+  0xac, 0x43, 0x8d, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x5a, 0x41, 0x91,
+  0xfe, 0x45, 0x00, 0x5a, 0x41, 0x8d, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0xdd, 0x64, 0x8f, 0xfe, 0x45, 0x00, 0xdd, 0x64, 0x8e, 0x00, 0x00, 0x8e,
+  0x00, 0x00, 0x00, 0x49, 0xe1, 0x8f, 0xfe, 0x45, 0x00, 0x49, 0xe1, 0x8e,
+  0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x9b, 0xe3, 0x8d, 0xfe, 0x45, 0x00,
+  0x9b, 0xe3, 0x8f, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x03, 0x39, 0x81, 0x18,
+  0xc0, 0x00, 0x00, 0x9b, 0xe3, 0x8b, 0xfe, 0x45, 0x03, 0x9b, 0xe3, 0x00,
+  0x00, 0x18, 0xc0, 0x39, 0x81, 0x8d, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x06,
+  0x9b, 0xe3, 0xfe, 0x45, 0xed, 0xc4, 0x18, 0xc0, 0x00, 0x00, 0x49, 0xe1,
+  0xdd, 0x64, 0x87, 0xfe, 0x45, 0x06, 0xdd, 0x64, 0x49, 0xe1, 0x00, 0x00,
+  0x18, 0xc0, 0xed, 0xc4, 0xfe, 0x45, 0x9b, 0xe3, 0x8c, 0x00, 0x00, 0x8b,
+  0x00, 0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x39, 0x81, 0x82,
+  0x00, 0x00, 0x02, 0x5a, 0x41, 0xac, 0x43, 0xdd, 0x64, 0x81, 0xfe, 0x45,
+  0x02, 0xdd, 0x64, 0xac, 0x43, 0x5a, 0x41, 0x82, 0x00, 0x00, 0x00, 0x39,
+  0x81, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x8b, 0x00, 0x00, 0x8a, 0x00,
+  0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x8f, 0x00,
+  0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x8a, 0x00,
+  0x00, 0x89, 0x00, 0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x9b,
+  0xe3, 0x87, 0x00, 0x00, 0x81, 0x5a, 0x41, 0x87, 0x00, 0x00, 0x00, 0x9b,
+  0xe3, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x89, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x29, 0x20, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x87, 0x00,
+  0x00, 0x00, 0x5a, 0x41, 0x81, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x87, 0x00,
+  0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x29, 0x20, 0x88, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x03, 0x08, 0x40, 0xed, 0xc4, 0xfe, 0x45, 0x9b,
+  0xe3, 0x88, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe, 0x45, 0x00, 0x7b,
+  0x02, 0x88, 0x00, 0x00, 0x03, 0x9b, 0xe3, 0xfe, 0x45, 0xed, 0xc4, 0x08,
+  0x40, 0x88, 0x00, 0x00, 0x89, 0x00, 0x00, 0x01, 0x08, 0x40, 0x29, 0x20,
+  0x89, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe, 0x45, 0x00, 0x7b, 0x02,
+  0x89, 0x00, 0x00, 0x01, 0x29, 0x20, 0x08, 0x40, 0x89, 0x00, 0x00, 0x95,
+  0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe, 0x45, 0x00, 0x7b, 0x02, 0x95,
+  0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe, 0x45, 0x00,
+  0x7b, 0x02, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81,
+  0xfe, 0x45, 0x00, 0x7b, 0x02, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x5a, 0x41, 0x81, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x95, 0x00, 0x00, 0x96,
+  0x00, 0x00, 0x81, 0x5a, 0x41, 0x96, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+};
+
+const unsigned char ICON_CLEAR_NIGHT_RLE[] PROGMEM = {
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x92, 0x00, 0x00, 0x02, 0x39, 0xc5,
+  0x84, 0x0b, 0x5a, 0xa7, 0x99, 0x00, 0x00, 0x90, 0x00, 0x00, 0x04, 0x5a,
+  0xa7, 0xd6, 0x52, 0xf7, 0x35, 0xd6, 0x52, 0x08, 0x61, 0x99, 0x00, 0x00,
+  0x8e, 0x00, 0x00, 0x01, 0x29, 0x43, 0xc5, 0xd1, 0x82, 0xf7, 0x35, 0x00,
+  0x5a, 0xa7, 0x9a, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x4a, 0x26, 0xe6,
+  0xb3, 0x82, 0xf7, 0x35, 0x00, 0xd6, 0x52, 0x9b, 0x00, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x4a, 0x26, 0x84, 0xf7, 0x35, 0x00, 0x84, 0x0b, 0x9b, 0x00,
+  0x00, 0x8b, 0x00, 0x00, 0x01, 0x29, 0x43, 0xe6, 0xb3, 0x84, 0xf7, 0x35,
+  0x00, 0x39, 0xc5, 0x9b, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0xc5, 0xd1,
+  0x85, 0xf7, 0x35, 0x00, 0x08, 0x61, 0x9b, 0x00, 0x00, 0x8a, 0x00, 0x00,
+  0x00, 0x5a, 0xa7, 0x86, 0xf7, 0x35, 0x9c, 0x00, 0x00, 0x8a, 0x00, 0x00,
+  0x00, 0xd6, 0x52, 0x86, 0xf7, 0x35, 0x9c, 0x00, 0x00, 0x89, 0x00, 0x00,
+  0x00, 0x39, 0xc5, 0x87, 0xf7, 0x35, 0x00, 0x08, 0x61, 0x9b, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x84, 0x0b, 0x87, 0xf7, 0x35, 0x00, 0x39, 0xc5,
+  0x9b, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xb5, 0x6f, 0x87, 0xf7, 0x35,
+  0x00, 0x84, 0x0b, 0x9b, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xe6, 0xb3,
+  0x87, 0xf7, 0x35, 0x00, 0xd6, 0x52, 0x9b, 0x00, 0x00, 0x89, 0x00, 0x00,
+  0x89, 0xf7, 0x35, 0x00, 0x5a, 0xa7, 0x9a, 0x00, 0x00, 0x89, 0x00, 0x00,
+  0x89, 0xf7, 0x35, 0x01, 0xd6, 0x52, 0x08, 0x61, 0x99, 0x00, 0x00, 0x89,
+  0x00, 0x00, 0x00, 0xe6, 0xb3, 0x89, 0xf7, 0x35, 0x00, 0x94, 0x6d, 0x99,
+  0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xb5, 0x6f, 0x8a, 0xf7, 0x35, 0x00,
+  0x94, 0x6d, 0x98, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x84, 0x0b, 0x8b,
+  0xf7, 0x35, 0x01, 0x94, 0x6d, 0x08, 0x61, 0x96, 0x00, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0x39, 0xc5, 0x8c, 0xf7, 0x35, 0x01, 0xd6, 0x52, 0x5a, 0xa7,
+  0x89, 0x00, 0x00, 0x01, 0x5a, 0xa7, 0x18, 0xc2, 0x89, 0x00, 0x00, 0x8a,
+  0x00, 0x00, 0x00, 0xd6, 0x52, 0x8d, 0xf7, 0x35, 0x03, 0xd6, 0x52, 0x84,
+  0x0b, 0x39, 0xc5, 0x08, 0x61, 0x81, 0x00, 0x00, 0x02, 0x08, 0x61, 0x39,
+  0xc5, 0x84, 0x0b, 0x81, 0xd6, 0x52, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00,
+  0x00, 0x5a, 0xa7, 0x97, 0xf7, 0x35, 0x00, 0x5a, 0xa7, 0x8a, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0xc5, 0xd1, 0x95, 0xf7, 0x35, 0x00, 0xc5, 0xd1,
+  0x8b, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x01, 0x29, 0x43, 0xe6, 0xb3, 0x93,
+  0xf7, 0x35, 0x01, 0xe6, 0xb3, 0x29, 0x43, 0x8b, 0x00, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x4a, 0x26, 0x93, 0xf7, 0x35, 0x00, 0x4a, 0x26, 0x8c, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x01, 0x4a, 0x26, 0xe6, 0xb3, 0x8f, 0xf7, 0x35,
+  0x01, 0xe6, 0xb3, 0x4a, 0x26, 0x8d, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x01,
+  0x29, 0x43, 0xc5, 0xd1, 0x8d, 0xf7, 0x35, 0x01, 0xc5, 0xd1, 0x29, 0x43,
+  0x8e, 0x00, 0x00, 0x90, 0x00, 0x00, 0x01, 0x5a, 0xa7, 0xd6, 0x52, 0x89,
+  0xf7, 0x35, 0x01, 0xd6, 0x52, 0x5a, 0xa7, 0x90, 0x00, 0x00, 0x92, 0x00,
+  0x00, 0x03, 0x39, 0xc5, 0x84, 0x0b, 0xb5, 0x6f, 0xe6, 0xb3, 0x81, 0xf7,
+  0x35, 0x03, 0xe6, 0xb3, 0xb5, 0x6f, 0x84, 0x0b, 0x39, 0xc5, 0x92, 0x00,
+  0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00,
+  0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00,
+  0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+};
+
+const unsigned char ICON_PARTLY_CLOUDY_RLE[] PROGMEM = {
+  0x8e, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe, 0x45, 0x00, 0x7b, 0x02,
+  0x9c, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x81, 0xfe, 0x45,
+  0x00, 0x7b, 0x02, 0x9c, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x7b, 0x02,
+  0x81, 0xfe, 0x45, 0x00, 0x7b, 0x02, 0x9c, 0x00, 0x00, 0x83, 0x00, 0x00,
+  0x02, 0x29, 0x20, 0xbc, 0xa3, 0x8b, 0x82, 0x87, 0x00, 0x00, 0x00, 0x7b,
+  0x02, 0x81, 0xfe, 0x45, 0x00, 0x7b, 0x02, 0x87, 0x00, 0x00, 0x02, 0x8b,
+  0x82, 0xbc, 0xa3, 0x29, 0x20, 0x91, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0xbc, 0xa3, 0x81, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x86, 0x00, 0x00, 0x00,
+  0x7b, 0x02, 0x81, 0xfe, 0x45, 0x00, 0x7b, 0x02, 0x86, 0x00, 0x00, 0x00,
+  0x9b, 0xe3, 0x81, 0xfe, 0x45, 0x00, 0xbc, 0xa3, 0x91, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x8b, 0x82, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x85,
+  0x00, 0x00, 0x00, 0x5a, 0x41, 0x81, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x85,
+  0x00, 0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x8b, 0x82, 0x91,
+  0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00,
+  0x9b, 0xe3, 0x85, 0x00, 0x00, 0x81, 0x5a, 0x41, 0x85, 0x00, 0x00, 0x00,
+  0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x92, 0x00, 0x00, 0x85,
+  0x00, 0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x00, 0x7b, 0x02, 0x8b,
+  0x00, 0x00, 0x00, 0x7b, 0x02, 0x82, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x93,
+  0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x9b, 0xe3, 0x81, 0xfe, 0x45, 0x00,
+  0xac, 0x43, 0x81, 0x00, 0x00, 0x02, 0x29, 0x20, 0x9b, 0xe3, 0xdd, 0x64,
+  0x81, 0xfe, 0x45, 0x02, 0xdd, 0x64, 0x9b, 0xe3, 0x29, 0x20, 0x81, 0x00,
+  0x00, 0x00, 0xac, 0x43, 0x81, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x94, 0x00,
+  0x00, 0x87, 0x00, 0x00, 0x04, 0x7b, 0x02, 0xac, 0x43, 0x29, 0x20, 0x08,
+  0x40, 0x8b, 0x82, 0x87, 0xfe, 0x45, 0x04, 0x8b, 0x82, 0x08, 0x40, 0x29,
+  0x20, 0xac, 0x43, 0x7b, 0x02, 0x95, 0x00, 0x00, 0x89, 0x00, 0x00, 0x01,
+  0x08, 0x40, 0xcd, 0x04, 0x89, 0xfe, 0x45, 0x01, 0xcd, 0x04, 0x08, 0x40,
+  0x97, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x8b, 0x82, 0x8b, 0xfe, 0x45,
+  0x00, 0x8b, 0x82, 0x97, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x29, 0x20,
+  0x8d, 0xfe, 0x45, 0x00, 0x29, 0x20, 0x96, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x9b, 0xe3, 0x8d, 0xfe, 0x45, 0x00, 0x9b, 0xe3, 0x96, 0x00, 0x00,
+  0x00, 0x5a, 0x41, 0x84, 0x7b, 0x02, 0x00, 0x5a, 0x41, 0x81, 0x00, 0x00,
+  0x00, 0xdd, 0x64, 0x8d, 0xfe, 0x45, 0x00, 0xdd, 0x64, 0x81, 0x00, 0x00,
+  0x00, 0x5a, 0x41, 0x84, 0x7b, 0x02, 0x00, 0x5a, 0x41, 0x8d, 0x00, 0x00,
+  0x86, 0xfe, 0x45, 0x01, 0x5a, 0x41, 0x00, 0x00, 0x8d, 0xfe, 0x45, 0x02,
+  0xf6, 0xae, 0xf7, 0x15, 0xce, 0x79, 0x81, 0xef, 0x5d, 0x02, 0xef, 0x3a,
+  0xf7, 0x15, 0xf6, 0xae, 0x82, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x8c, 0x00,
+  0x00, 0x86, 0xfe, 0x45, 0x01, 0x5a, 0x41, 0x00, 0x00, 0x8b, 0xfe, 0x45,
+  0x01, 0xfe, 0x8c, 0xef, 0x3a, 0x87, 0xef, 0x5d, 0x03, 0xef, 0x3a, 0xfe,
+  0x8c, 0xfe, 0x45, 0x5a, 0x41, 0x8c, 0x00, 0x00, 0x00, 0x5a, 0x41, 0x84,
+  0x7b, 0x02, 0x00, 0x5a, 0x41, 0x81, 0x00, 0x00, 0x00, 0xdd, 0x64, 0x89,
+  0xfe, 0x45, 0x00, 0xf6, 0xf4, 0x8b, 0xef, 0x5d, 0x00, 0xc5, 0xb3, 0x8d,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x9b, 0xe3, 0x88, 0xfe, 0x45, 0x00,
+  0xf6, 0xf4, 0x8d, 0xef, 0x5d, 0x00, 0x94, 0x92, 0x8c, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x29, 0x20, 0x87, 0xfe, 0x45, 0x00, 0xfe, 0x8c, 0x8f,
+  0xef, 0x5d, 0x00, 0x4a, 0x49, 0x8b, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x8b, 0x82, 0x86, 0xfe, 0x45, 0x00, 0xef, 0x3a, 0x8f, 0xef, 0x5d, 0x00,
+  0xce, 0x79, 0x8b, 0x00, 0x00, 0x89, 0x00, 0x00, 0x01, 0x08, 0x40, 0xcd,
+  0x04, 0x84, 0xfe, 0x45, 0x00, 0xf6, 0xae, 0x91, 0xef, 0x5d, 0x00, 0x52,
+  0xaa, 0x8a, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0x7b, 0x02, 0xac, 0x43,
+  0x29, 0x20, 0x08, 0x40, 0x8b, 0x82, 0xfe, 0x69, 0xf6, 0xf4, 0xef, 0x3a,
+  0x93, 0xef, 0x5d, 0x00, 0xa5, 0x14, 0x8a, 0x00, 0x00, 0x86, 0x00, 0x00,
+  0x00, 0x9b, 0xe3, 0x81, 0xfe, 0x45, 0x02, 0xac, 0x43, 0x08, 0x61, 0x84,
+  0x10, 0x96, 0xef, 0x5d, 0x00, 0xce, 0x79, 0x8a, 0x00, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x9b, 0xe3, 0x82, 0xfe, 0x45, 0x01, 0x8b, 0x84, 0xbd, 0xf7,
+  0x98, 0xef, 0x5d, 0x8a, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x9b, 0xe3,
+  0x82, 0xfe, 0x45, 0x01, 0x9b, 0xe3, 0x84, 0x10, 0x99, 0xef, 0x5d, 0x01,
+  0x84, 0x10, 0x18, 0xe3, 0x88, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x8b,
+  0x82, 0x82, 0xfe, 0x45, 0x01, 0x9b, 0xe3, 0x29, 0x45, 0x9b, 0xef, 0x5d,
+  0x01, 0xde, 0xfb, 0x52, 0xaa, 0x87, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0xbc, 0xa3, 0x81, 0xfe, 0x45, 0x02, 0x9b, 0xe3, 0x00, 0x00, 0x94, 0x92,
+  0x9d, 0xef, 0x5d, 0x00, 0x52, 0xaa, 0x86, 0x00, 0x00, 0x83, 0x00, 0x00,
+  0x02, 0x29, 0x20, 0xbc, 0xa3, 0x8b, 0x82, 0x81, 0x00, 0x00, 0x00, 0xce,
+  0x79, 0x9d, 0xef, 0x5d, 0x01, 0xde, 0xfb, 0x18, 0xe3, 0x85, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x4a, 0x49, 0x9f, 0xef, 0x5d, 0x00, 0x84, 0x10,
+  0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x94, 0x92, 0xa0, 0xef, 0x5d,
+  0x00, 0xbd, 0xf7, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4a, 0x49,
+  0xa2, 0xef, 0x5d, 0x00, 0x4a, 0x49, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0x00, 0xb5, 0x96, 0xa2, 0xef, 0x5d, 0x00, 0xb5, 0x96, 0x84, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0xa4, 0xef, 0x5d, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0xa4, 0xef, 0x5d, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xb5, 0x96,
+  0xa2, 0xef, 0x5d, 0x00, 0xb5, 0x96, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0x00, 0x4a, 0x49, 0xa2, 0xef, 0x5d, 0x00, 0x4a, 0x49, 0x84, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x94, 0x92, 0xa0, 0xef, 0x5d, 0x00, 0x94, 0x92,
+  0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x01, 0x4a, 0x49, 0xb5, 0x96, 0x9c,
+  0xef, 0x5d, 0x01, 0xb5, 0x96, 0x4a, 0x49, 0x86, 0x00, 0x00, 0xaf, 0x00,
+  0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00,
+  0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00,
+  0x00,
+};
+
+const unsigned char ICON_CLOUDY_RLE[] PROGMEM = {
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x02, 0x31, 0xa6, 0x63, 0x2c, 0x84, 0x10, 0x81, 0x94,
+  0xb2, 0x02, 0x84, 0x10, 0x63, 0x2c, 0x31, 0xa6, 0x90, 0x00, 0x00, 0x94,
+  0x00, 0x00, 0x01, 0x29, 0x65, 0x84, 0x10, 0x87, 0x94, 0xb2, 0x01, 0x84,
+  0x10, 0x29, 0x65, 0x8e, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x5a, 0xeb,
+  0x8b, 0x94, 0xb2, 0x00, 0x5a, 0xeb, 0x8d, 0x00, 0x00, 0x92, 0x00, 0x00,
+  0x00, 0x5a, 0xeb, 0x8d, 0x94, 0xb2, 0x00, 0x5a, 0xeb, 0x8c, 0x00, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x29, 0x65, 0x8f, 0x94, 0xb2, 0x00, 0x29, 0x65,
+  0x8b, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x84, 0x10, 0x8f, 0x94, 0xb2,
+  0x00, 0x84, 0x10, 0x8b, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x31, 0xa6,
+  0x91, 0x94, 0xb2, 0x00, 0x31, 0xa6, 0x8a, 0x00, 0x00, 0x8c, 0x00, 0x00,
+  0x02, 0x18, 0xc3, 0x5a, 0xeb, 0x84, 0x10, 0x93, 0x94, 0xb2, 0x00, 0x63,
+  0x2c, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x08, 0x41, 0x52, 0xaa,
+  0x89, 0x94, 0xb2, 0x02, 0xb5, 0xb6, 0xd6, 0x9a, 0xe7, 0x1c, 0x81, 0xef,
+  0x5d, 0x02, 0xe7, 0x1c, 0xd6, 0x9a, 0xb5, 0xb6, 0x84, 0x94, 0xb2, 0x00,
+  0x84, 0x10, 0x8a, 0x00, 0x00, 0x89, 0x00, 0x00, 0x01, 0x08, 0x41, 0x7b,
+  0xcf, 0x88, 0x94, 0xb2, 0x01, 0xb5, 0x96, 0xe7, 0x1c, 0x87, 0xef, 0x5d,
+  0x01, 0xe7, 0x1c, 0xb5, 0x96, 0x83, 0x94, 0xb2, 0x8a, 0x00, 0x00, 0x89,
+  0x00, 0x00, 0x00, 0x52, 0xaa, 0x88, 0x94, 0xb2, 0x00, 0xce, 0x59, 0x8b,
+  0xef, 0x5d, 0x00, 0xce, 0x59, 0x82, 0x94, 0xb2, 0x01, 0x52, 0xaa, 0x10,
+  0x82, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x88, 0x94,
+  0xb2, 0x00, 0xce, 0x59, 0x8d, 0xef, 0x5d, 0x00, 0xce, 0x59, 0x82, 0x94,
+  0xb2, 0x01, 0x8c, 0x71, 0x31, 0xa6, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x5a, 0xeb, 0x87, 0x94, 0xb2, 0x00, 0xb5, 0x96, 0x8f, 0xef, 0x5d,
+  0x00, 0xb5, 0x96, 0x83, 0x94, 0xb2, 0x00, 0x31, 0xa6, 0x86, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x84, 0x10, 0x87, 0x94, 0xb2, 0x00, 0xe7, 0x1c,
+  0x8f, 0xef, 0x5d, 0x00, 0xe7, 0x1c, 0x83, 0x94, 0xb2, 0x01, 0x8c, 0x71,
+  0x10, 0x82, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x29, 0x65, 0x87,
+  0x94, 0xb2, 0x00, 0xb5, 0xb6, 0x91, 0xef, 0x5d, 0x00, 0xb5, 0xb6, 0x83,
+  0x94, 0xb2, 0x00, 0x52, 0xaa, 0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x5a, 0xeb, 0x84, 0x94, 0xb2, 0x02, 0xa5, 0x34, 0xce, 0x59, 0xe7, 0x1c,
+  0x93, 0xef, 0x5d, 0x00, 0xd6, 0x9a, 0x83, 0x94, 0xb2, 0x00, 0x7b, 0xcf,
+  0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x29, 0x65, 0x83, 0x94, 0xb2,
+  0x01, 0x9c, 0xd3, 0xc6, 0x38, 0x96, 0xef, 0x5d, 0x00, 0xe7, 0x1c, 0x84,
+  0x94, 0xb2, 0x00, 0x29, 0x65, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x73, 0x8e, 0x82, 0x94, 0xb2, 0x01, 0x9c, 0xd3, 0xde, 0xdb, 0x98, 0xef,
+  0x5d, 0x84, 0x94, 0xb2, 0x00, 0x73, 0x8e, 0x84, 0x00, 0x00, 0x85, 0x00,
+  0x00, 0x83, 0x94, 0xb2, 0x00, 0xc6, 0x38, 0x99, 0xef, 0x5d, 0x01, 0xc6,
+  0x38, 0xa5, 0x14, 0x83, 0x94, 0xb2, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0x82, 0x94, 0xb2, 0x00, 0xa5, 0x34, 0x9b, 0xef, 0x5d, 0x01, 0xe7, 0x3c,
+  0xb5, 0xb6, 0x82, 0x94, 0xb2, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x73, 0x8e, 0x81, 0x94, 0xb2, 0x00, 0xce, 0x59, 0x9d, 0xef, 0x5d, 0x02,
+  0xb5, 0xb6, 0x94, 0xb2, 0x73, 0x8e, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0x00, 0x29, 0x65, 0x81, 0x94, 0xb2, 0x00, 0xe7, 0x1c, 0x9d, 0xef, 0x5d,
+  0x02, 0xe7, 0x3c, 0xa5, 0x14, 0x29, 0x65, 0x84, 0x00, 0x00, 0x86, 0x00,
+  0x00, 0x01, 0x5a, 0xeb, 0xb5, 0x96, 0x9f, 0xef, 0x5d, 0x00, 0x9c, 0xf3,
+  0x85, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x94, 0x92, 0xa0, 0xef, 0x5d,
+  0x00, 0xbd, 0xf7, 0x85, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4a, 0x49,
+  0xa2, 0xef, 0x5d, 0x00, 0x4a, 0x49, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0x00, 0xb5, 0x96, 0xa2, 0xef, 0x5d, 0x00, 0xb5, 0x96, 0x84, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0xa4, 0xef, 0x5d, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0xa4, 0xef, 0x5d, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xb5, 0x96,
+  0xa2, 0xef, 0x5d, 0x00, 0xb5, 0x96, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0x00, 0x4a, 0x49, 0xa2, 0xef, 0x5d, 0x00, 0x4a, 0x49, 0x84, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x94, 0x92, 0xa0, 0xef, 0x5d, 0x00, 0x94, 0x92,
+  0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x01, 0x4a, 0x49, 0xb5, 0x96, 0x9c,
+  0xef, 0x5d, 0x01, 0xb5, 0x96, 0x4a, 0x49, 0x86, 0x00, 0x00, 0xaf, 0x00,
+  0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00,
+  0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00,
+  0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+};
+
+const unsigned char ICON_FOG_RLE[] PROGMEM = {
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x9c, 0x4a, 0x49, 0x00, 0x31, 0xa6,
+  0x89, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x9e, 0x94, 0xb2,
+  0x00, 0x31, 0xa6, 0x88, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x31, 0xa6,
+  0x9e, 0x94, 0xb2, 0x00, 0x31, 0xa6, 0x88, 0x00, 0x00, 0x86, 0x00, 0x00,
+  0x00, 0x31, 0xa6, 0x9c, 0x4a, 0x49, 0x00, 0x31, 0xa6, 0x89, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x89, 0x00, 0x00,
+  0x00, 0x31, 0xa6, 0x9c, 0x4a, 0x49, 0x00, 0x31, 0xa6, 0x86, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x9e, 0x94, 0xb2, 0x00, 0x31, 0xa6,
+  0x85, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x9e, 0x94, 0xb2,
+  0x00, 0x31, 0xa6, 0x85, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x31, 0xa6,
+  0x9c, 0x4a, 0x49, 0x00, 0x31, 0xa6, 0x86, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x31, 0xa6,
+  0x9c, 0x4a, 0x49, 0x00, 0x31, 0xa6, 0x89, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0x00, 0x31, 0xa6, 0x9e, 0x94, 0xb2, 0x00, 0x31, 0xa6, 0x88, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x9e, 0x94, 0xb2, 0x00, 0x31, 0xa6,
+  0x88, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x9c, 0x4a, 0x49,
+  0x00, 0x31, 0xa6, 0x89, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x9c, 0x4a, 0x49,
+  0x00, 0x31, 0xa6, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x31, 0xa6,
+  0x9e, 0x94, 0xb2, 0x00, 0x31, 0xa6, 0x85, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x31, 0xa6, 0x9e, 0x94, 0xb2, 0x00, 0x31, 0xa6, 0x85, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x9c, 0x4a, 0x49, 0x00, 0x31, 0xa6,
+  0x86, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+};
+
+const unsigned char ICON_DRIZZLE_RLE[] PROGMEM = {
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x96, 0x00, 0x00, 0x02, 0x52, 0xaa, 0xa5, 0x14, 0xce,
+  0x79, 0x81, 0xef, 0x5d, 0x02, 0xce, 0x79, 0xa5, 0x14, 0x52, 0xaa, 0x90,
+  0x00, 0x00, 0x94, 0x00, 0x00, 0x01, 0x4a, 0x49, 0xce, 0x79, 0x87, 0xef,
+  0x5d, 0x01, 0xce, 0x79, 0x4a, 0x49, 0x8e, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x94, 0x92, 0x8b, 0xef, 0x5d, 0x00, 0x94, 0x92, 0x8d, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x94, 0x92, 0x8d, 0xef, 0x5d, 0x00, 0x94, 0x92,
+  0x8c, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x4a, 0x49, 0x8f, 0xef, 0x5d,
+  0x00, 0x4a, 0x49, 0x8b, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0xce, 0x79,
+  0x8f, 0xef, 0x5d, 0x00, 0xce, 0x79, 0x8b, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x52, 0xaa, 0x91, 0xef, 0x5d, 0x00, 0x52, 0xaa, 0x8a, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x02, 0x29, 0x45, 0x94, 0x92, 0xce, 0x79, 0x93, 0xef,
+  0x5d, 0x00, 0xa5, 0x14, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x08,
+  0x61, 0x84, 0x10, 0x96, 0xef, 0x5d, 0x00, 0xce, 0x79, 0x8a, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x01, 0x08, 0x61, 0xbd, 0xf7, 0x98, 0xef, 0x5d, 0x8a,
+  0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x84, 0x10, 0x99, 0xef, 0x5d, 0x01,
+  0x84, 0x10, 0x18, 0xe3, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x29,
+  0x45, 0x9b, 0xef, 0x5d, 0x01, 0xde, 0xfb, 0x52, 0xaa, 0x87, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x94, 0x92, 0x9d, 0xef, 0x5d, 0x00, 0x52, 0xaa,
+  0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xce, 0x79, 0x9d, 0xef, 0x5d,
+  0x01, 0xde, 0xfb, 0x18, 0xe3, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x4a, 0x49, 0x9f, 0xef, 0x5d, 0x00, 0x84, 0x10, 0x85, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x94, 0x92, 0xa0, 0xef, 0x5d, 0x00, 0xbd, 0xf7, 0x85,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4a, 0x49, 0xa2, 0xef, 0x5d, 0x00,
+  0x4a, 0x49, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xb5, 0x96, 0xa2,
+  0xef, 0x5d, 0x00, 0xb5, 0x96, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xa4,
+  0xef, 0x5d, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xa4, 0xef, 0x5d, 0x84,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xb5, 0x96, 0xa2, 0xef, 0x5d, 0x00,
+  0xb5, 0x96, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4a, 0x49, 0xa2,
+  0xef, 0x5d, 0x00, 0x4a, 0x49, 0x84, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x94, 0x92, 0xa0, 0xef, 0x5d, 0x00, 0x94, 0x92, 0x85, 0x00, 0x00, 0x87,
+  0x00, 0x00, 0x01, 0x4a, 0x49, 0xb5, 0x96, 0x9c, 0xef, 0x5d, 0x01, 0xb5,
+  0x96, 0x4a, 0x49, 0x86, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x08, 0x41, 0x81, 0x3a, 0xad, 0x00, 0x08, 0x41,
+  0x8b, 0x00, 0x00, 0x00, 0x08, 0x41, 0x81, 0x3a, 0xad, 0x00, 0x08, 0x41,
+  0x8d, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x3a, 0xad, 0x81, 0x8e, 0x5f,
+  0x00, 0x3a, 0xad, 0x8b, 0x00, 0x00, 0x00, 0x3a, 0xad, 0x81, 0x8e, 0x5f,
+  0x00, 0x3a, 0xad, 0x8d, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x3a, 0xad,
+  0x81, 0x8e, 0x5f, 0x00, 0x3a, 0xad, 0x8b, 0x00, 0x00, 0x00, 0x3a, 0xad,
+  0x81, 0x8e, 0x5f, 0x00, 0x3a, 0xad, 0x8d, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x08, 0x41, 0x81, 0x3a, 0xad, 0x00, 0x08, 0x41, 0x8b, 0x00, 0x00,
+  0x00, 0x08, 0x41, 0x81, 0x3a, 0xad, 0x00, 0x08, 0x41, 0x8d, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x08, 0x41, 0x81, 0x3a, 0xad, 0x00, 0x08, 0x41,
+  0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x3a, 0xad, 0x81, 0x8e, 0x5f,
+  0x00, 0x3a, 0xad, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x3a, 0xad,
+  0x81, 0x8e, 0x5f, 0x00, 0x3a, 0xad, 0x95, 0x00, 0x00, 0x91, 0x00, 0x00,
+  0x00, 0x08, 0x41, 0x81, 0x3a, 0xad, 0x81, 0x08, 0x41, 0x81, 0x3a, 0xad,
+  0x00, 0x08, 0x41, 0x95, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x3a, 0xad,
+  0x81, 0x8e, 0x5f, 0x00, 0x3a, 0xad, 0x83, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x81, 0x3a, 0xad, 0x00, 0x08, 0x41, 0x91, 0x00, 0x00, 0x91, 0x00, 0x00,
+  0x00, 0x3a, 0xad, 0x81, 0x8e, 0x5f, 0x00, 0x3a, 0xad, 0x83, 0x00, 0x00,
+  0x00, 0x3a, 0xad, 0x81, 0x8e, 0x5f, 0x00, 0x3a, 0xad, 0x91, 0x00, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x08, 0x41, 0x81, 0x3a, 0xad, 0x00, 0x08, 0x41,
+  0x83, 0x00, 0x00, 0x00, 0x3a, 0xad, 0x81, 0x8e, 0x5f, 0x00, 0x3a, 0xad,
+  0x91, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x08, 0x41, 0x81, 0x3a, 0xad,
+  0x00, 0x08, 0x41, 0x91, 0x00, 0x00, 0xaf, 0x00, 0x00,
+};
+
+const unsigned char ICON_RAIN_RLE[] PROGMEM = {
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x96, 0x00, 0x00, 0x02, 0x52, 0xaa, 0xa5, 0x14, 0xce,
+  0x79, 0x81, 0xef, 0x5d, 0x02, 0xce, 0x79, 0xa5, 0x14, 0x52, 0xaa, 0x90,
+  0x00, 0x00, 0x94, 0x00, 0x00, 0x01, 0x4a, 0x49, 0xce, 0x79, 0x87, 0xef,
+  0x5d, 0x01, 0xce, 0x79, 0x4a, 0x49, 0x8e, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x94, 0x92, 0x8b, 0xef, 0x5d, 0x00, 0x94, 0x92, 0x8d, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x94, 0x92, 0x8d, 0xef, 0x5d, 0x00, 0x94, 0x92,
+  0x8c, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x4a, 0x49, 0x8f, 0xef, 0x5d,
+  0x00, 0x4a, 0x49, 0x8b, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0xce, 0x79,
+  0x8f, 0xef, 0x5d, 0x00, 0xce, 0x79, 0x8b, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x52, 0xaa, 0x91, 0xef, 0x5d, 0x00, 0x52, 0xaa, 0x8a, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x02, 0x29, 0x45, 0x94, 0x92, 0xce, 0x79, 0x93, 0xef,
+  0x5d, 0x00, 0xa5, 0x14, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x08,
+  0x61, 0x84, 0x10, 0x96, 0xef, 0x5d, 0x00, 0xce, 0x79, 0x8a, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x01, 0x08, 0x61, 0xbd, 0xf7, 0x98, 0xef, 0x5d, 0x8a,
+  0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x84, 0x10, 0x99, 0xef, 0x5d, 0x01,
+  0x84, 0x10, 0x18, 0xe3, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x29,
+  0x45, 0x9b, 0xef, 0x5d, 0x01, 0xde, 0xfb, 0x52, 0xaa, 0x87, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x94, 0x92, 0x9d, 0xef, 0x5d, 0x00, 0x52, 0xaa,
+  0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xce, 0x79, 0x9d, 0xef, 0x5d,
+  0x01, 0xde, 0xfb, 0x18, 0xe3, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x4a, 0x49, 0x9f, 0xef, 0x5d, 0x00, 0x84, 0x10, 0x85, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x94, 0x92, 0xa0, 0xef, 0x5d, 0x00, 0xbd, 0xf7, 0x85,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4a, 0x49, 0xa2, 0xef, 0x5d, 0x00,
+  0x4a, 0x49, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xb5, 0x96, 0xa2,
+  0xef, 0x5d, 0x00, 0xb5, 0x96, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xa4,
+  0xef, 0x5d, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xa4, 0xef, 0x5d, 0x84,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xb5, 0x96, 0xa2, 0xef, 0x5d, 0x00,
+  0xb5, 0x96, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4a, 0x49, 0xa2,
+  0xef, 0x5d, 0x00, 0x4a, 0x49, 0x84, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x94, 0x92, 0xa0, 0xef, 0x5d, 0x00, 0x94, 0x92, 0x85, 0x00, 0x00, 0x87,
+  0x00, 0x00, 0x01, 0x4a, 0x49, 0xb5, 0x96, 0x9c, 0xef, 0x5d, 0x01, 0xb5,
+  0x96, 0x4a, 0x49, 0x86, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x81, 0x08, 0x83, 0x85, 0x00, 0x00,
+  0x81, 0x08, 0x83, 0x85, 0x00, 0x00, 0x81, 0x08, 0x83, 0x8d, 0x00, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x08, 0x83, 0x81, 0x44, 0xbf, 0x00, 0x08, 0x83,
+  0x83, 0x00, 0x00, 0x00, 0x08, 0x83, 0x81, 0x44, 0xbf, 0x00, 0x08, 0x83,
+  0x83, 0x00, 0x00, 0x00, 0x08, 0x83, 0x81, 0x44, 0xbf, 0x00, 0x08, 0x83,
+  0x8c, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x22, 0xb1, 0x81, 0x44, 0xbf,
+  0x00, 0x08, 0x83, 0x83, 0x00, 0x00, 0x00, 0x22, 0xb1, 0x81, 0x44, 0xbf,
+  0x00, 0x08, 0x83, 0x83, 0x00, 0x00, 0x00, 0x22, 0xb1, 0x81, 0x44, 0xbf,
+  0x00, 0x08, 0x83, 0x8c, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x02, 0x44, 0x7d,
+  0x44, 0xbf, 0x33, 0x97, 0x84, 0x00, 0x00, 0x02, 0x44, 0x7d, 0x44, 0xbf,
+  0x33, 0x97, 0x84, 0x00, 0x00, 0x02, 0x44, 0x7d, 0x44, 0xbf, 0x33, 0x97,
+  0x8d, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x19, 0xab, 0x81, 0x44, 0xbf,
+  0x00, 0x19, 0xab, 0x83, 0x00, 0x00, 0x00, 0x19, 0xab, 0x81, 0x44, 0xbf,
+  0x00, 0x19, 0xab, 0x83, 0x00, 0x00, 0x00, 0x19, 0xab, 0x81, 0x44, 0xbf,
+  0x00, 0x19, 0xab, 0x8d, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x02, 0x33, 0x97,
+  0x44, 0xbf, 0x44, 0x7d, 0x84, 0x00, 0x00, 0x02, 0x33, 0x97, 0x44, 0xbf,
+  0x44, 0x7d, 0x84, 0x00, 0x00, 0x02, 0x33, 0x97, 0x44, 0xbf, 0x44, 0x7d,
+  0x8e, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x08, 0x83, 0x81, 0x44, 0xbf,
+  0x00, 0x22, 0xb1, 0x83, 0x00, 0x00, 0x00, 0x08, 0x83, 0x81, 0x44, 0xbf,
+  0x00, 0x22, 0xb1, 0x83, 0x00, 0x00, 0x00, 0x08, 0x83, 0x81, 0x44, 0xbf,
+  0x00, 0x22, 0xb1, 0x8e, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x22, 0xb1,
+  0x81, 0x44, 0xbf, 0x00, 0x08, 0x83, 0x83, 0x00, 0x00, 0x00, 0x22, 0xb1,
+  0x81, 0x44, 0xbf, 0x00, 0x08, 0x83, 0x83, 0x00, 0x00, 0x00, 0x22, 0xb1,
+  0x81, 0x44, 0xbf, 0x00, 0x08, 0x83, 0x8e, 0x00, 0x00, 0x8c, 0x00, 0x00,
+  0x02, 0x44, 0x7d, 0x44, 0xbf, 0x33, 0x97, 0x84, 0x00, 0x00, 0x02, 0x44,
+  0x7d, 0x44, 0xbf, 0x33, 0x97, 0x84, 0x00, 0x00, 0x02, 0x44, 0x7d, 0x44,
+  0xbf, 0x33, 0x97, 0x8f, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x19, 0xab,
+  0x81, 0x44, 0xbf, 0x00, 0x19, 0xab, 0x83, 0x00, 0x00, 0x00, 0x19, 0xab,
+  0x81, 0x44, 0xbf, 0x00, 0x19, 0xab, 0x83, 0x00, 0x00, 0x00, 0x19, 0xab,
+  0x81, 0x44, 0xbf, 0x00, 0x19, 0xab, 0x8f, 0x00, 0x00, 0x8b, 0x00, 0x00,
+  0x02, 0x33, 0x97, 0x44, 0xbf, 0x44, 0x7d, 0x84, 0x00, 0x00, 0x02, 0x33,
+  0x97, 0x44, 0xbf, 0x44, 0x7d, 0x84, 0x00, 0x00, 0x02, 0x33, 0x97, 0x44,
+  0xbf, 0x44, 0x7d, 0x90, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x08, 0x83,
+  0x81, 0x44, 0xbf, 0x00, 0x22, 0xb1, 0x83, 0x00, 0x00, 0x00, 0x08, 0x83,
+  0x81, 0x44, 0xbf, 0x00, 0x22, 0xb1, 0x83, 0x00, 0x00, 0x00, 0x08, 0x83,
+  0x81, 0x44, 0xbf, 0x00, 0x22, 0xb1, 0x90, 0x00, 0x00, 0x8a, 0x00, 0x00,
+  0x00, 0x08, 0x83, 0x81, 0x44, 0xbf, 0x00, 0x08, 0x83, 0x83, 0x00, 0x00,
+  0x00, 0x08, 0x83, 0x81, 0x44, 0xbf, 0x00, 0x08, 0x83, 0x83, 0x00, 0x00,
+  0x00, 0x08, 0x83, 0x81, 0x44, 0xbf, 0x00, 0x08, 0x83, 0x90, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x81, 0x08, 0x83, 0x85, 0x00, 0x00, 0x81, 0x08, 0x83,
+  0x85, 0x00, 0x00, 0x81, 0x08, 0x83, 0x91, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00,
+};
+
+const unsigned char ICON_SNOW_RLE[] PROGMEM = {
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x96, 0x00, 0x00, 0x02, 0x52, 0xaa, 0xa5, 0x14, 0xce,
+  0x79, 0x81, 0xef, 0x5d, 0x02, 0xce, 0x79, 0xa5, 0x14, 0x52, 0xaa, 0x90,
+  0x00, 0x00, 0x94, 0x00, 0x00, 0x01, 0x4a, 0x49, 0xce, 0x79, 0x87, 0xef,
+  0x5d, 0x01, 0xce, 0x79, 0x4a, 0x49, 0x8e, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x94, 0x92, 0x8b, 0xef, 0x5d, 0x00, 0x94, 0x92, 0x8d, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x94, 0x92, 0x8d, 0xef, 0x5d, 0x00, 0x94, 0x92,
+  0x8c, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x4a, 0x49, 0x8f, 0xef, 0x5d,
+  0x00, 0x4a, 0x49, 0x8b, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0xce, 0x79,
+  0x8f, 0xef, 0x5d, 0x00, 0xce, 0x79, 0x8b, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x52, 0xaa, 0x91, 0xef, 0x5d, 0x00, 0x52, 0xaa, 0x8a, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x02, 0x29, 0x45, 0x94, 0x92, 0xce, 0x79, 0x93, 0xef,
+  0x5d, 0x00, 0xa5, 0x14, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x08,
+  0x61, 0x84, 0x10, 0x96, 0xef, 0x5d, 0x00, 0xce, 0x79, 0x8a, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x01, 0x08, 0x61, 0xbd, 0xf7, 0x98, 0xef, 0x5d, 0x8a,
+  0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x84, 0x10, 0x99, 0xef, 0x5d, 0x01,
+  0x84, 0x10, 0x18, 0xe3, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x29,
+  0x45, 0x9b, 0xef, 0x5d, 0x01, 0xde, 0xfb, 0x52, 0xaa, 0x87, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x94, 0x92, 0x9d, 0xef, 0x5d, 0x00, 0x52, 0xaa,
+  0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xce, 0x79, 0x9d, 0xef, 0x5d,
+  0x01, 0xde, 0xfb, 0x18, 0xe3, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x4a, 0x49, 0x9f, 0xef, 0x5d, 0x00, 0x84, 0x10, 0x85, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x94, 0x92, 0xa0, 0xef, 0x5d, 0x00, 0xbd, 0xf7, 0x85,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4a, 0x49, 0xa2, 0xef, 0x5d, 0x00,
+  0x4a, 0x49, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xb5, 0x96, 0xa2,
+  0xef, 0x5d, 0x00, 0xb5, 0x96, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xa4,
+  0xef, 0x5d, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xa4, 0xef, 0x5d, 0x84,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xb5, 0x96, 0xa2, 0xef, 0x5d, 0x00,
+  0xb5, 0x96, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4a, 0x49, 0xa2,
+  0xef, 0x5d, 0x00, 0x4a, 0x49, 0x84, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x94, 0x92, 0xa0, 0xef, 0x5d, 0x00, 0x94, 0x92, 0x85, 0x00, 0x00, 0x87,
+  0x00, 0x00, 0x01, 0x4a, 0x49, 0xb5, 0x96, 0x9c, 0xef, 0x5d, 0x01, 0xb5,
+  0x96, 0x4a, 0x49, 0x86, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x8c, 0x00, 0x00,
+  0x00, 0x39, 0xc7, 0x81, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x8d, 0x00, 0x00,
+  0x00, 0x39, 0xc7, 0x81, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x8c, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x01, 0x29, 0x45, 0xef, 0x5d, 0x81, 0x63, 0x2c, 0x01,
+  0xef, 0x5d, 0x29, 0x45, 0x8b, 0x00, 0x00, 0x01, 0x29, 0x45, 0xef, 0x5d,
+  0x81, 0x63, 0x2c, 0x01, 0xef, 0x5d, 0x29, 0x45, 0x8b, 0x00, 0x00, 0x8c,
+  0x00, 0x00, 0x00, 0xb5, 0x96, 0x81, 0xde, 0xfb, 0x00, 0xb5, 0x96, 0x8d,
+  0x00, 0x00, 0x00, 0xb5, 0x96, 0x81, 0xde, 0xfb, 0x00, 0xb5, 0x96, 0x8c,
+  0x00, 0x00, 0x8a, 0x00, 0x00, 0x02, 0x73, 0xae, 0xb5, 0x96, 0xbd, 0xf7,
+  0x81, 0xef, 0x5d, 0x02, 0xbd, 0xf7, 0xb5, 0x96, 0x73, 0xae, 0x89, 0x00,
+  0x00, 0x02, 0x73, 0xae, 0xb5, 0x96, 0xbd, 0xf7, 0x81, 0xef, 0x5d, 0x02,
+  0xbd, 0xf7, 0xb5, 0x96, 0x73, 0xae, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00,
+  0x02, 0x73, 0xae, 0xb5, 0x96, 0xbd, 0xf7, 0x81, 0xef, 0x5d, 0x02, 0xbd,
+  0xf7, 0xb5, 0x96, 0x73, 0xae, 0x82, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x81,
+  0x00, 0x00, 0x00, 0x39, 0xc7, 0x82, 0x00, 0x00, 0x02, 0x73, 0xae, 0xb5,
+  0x96, 0xbd, 0xf7, 0x81, 0xef, 0x5d, 0x02, 0xbd, 0xf7, 0xb5, 0x96, 0x73,
+  0xae, 0x8a, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xb5, 0x96, 0x81, 0xde,
+  0xfb, 0x00, 0xb5, 0x96, 0x83, 0x00, 0x00, 0x01, 0x29, 0x45, 0xef, 0x5d,
+  0x81, 0x63, 0x2c, 0x01, 0xef, 0x5d, 0x29, 0x45, 0x83, 0x00, 0x00, 0x00,
+  0xb5, 0x96, 0x81, 0xde, 0xfb, 0x00, 0xb5, 0x96, 0x8c, 0x00, 0x00, 0x8b,
+  0x00, 0x00, 0x01, 0x29, 0x45, 0xef, 0x5d, 0x81, 0x63, 0x2c, 0x01, 0xef,
+  0x5d, 0x29, 0x45, 0x83, 0x00, 0x00, 0x00, 0xb5, 0x96, 0x81, 0xde, 0xfb,
+  0x00, 0xb5, 0x96, 0x83, 0x00, 0x00, 0x01, 0x29, 0x45, 0xef, 0x5d, 0x81,
+  0x63, 0x2c, 0x01, 0xef, 0x5d, 0x29, 0x45, 0x8b, 0x00, 0x00, 0x8c, 0x00,
+  0x00, 0x00, 0x39, 0xc7, 0x81, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x82, 0x00,
+  0x00, 0x02, 0x73, 0xae, 0xb5, 0x96, 0xbd, 0xf7, 0x81, 0xef, 0x5d, 0x02,
+  0xbd, 0xf7, 0xb5, 0x96, 0x73, 0xae, 0x82, 0x00, 0x00, 0x00, 0x39, 0xc7,
+  0x81, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x8c, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x02, 0x73, 0xae, 0xb5, 0x96, 0xbd, 0xf7, 0x81, 0xef, 0x5d, 0x02, 0xbd,
+  0xf7, 0xb5, 0x96, 0x73, 0xae, 0x93, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0xb5, 0x96, 0x81, 0xde, 0xfb, 0x00, 0xb5, 0x96, 0x95, 0x00, 0x00, 0x94,
+  0x00, 0x00, 0x01, 0x29, 0x45, 0xef, 0x5d, 0x81, 0x63, 0x2c, 0x01, 0xef,
+  0x5d, 0x29, 0x45, 0x94, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x39, 0xc7,
+  0x81, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x95, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00,
+};
+
+const unsigned char ICON_THUNDERSTORM_RLE[] PROGMEM = {
+  0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x96, 0x00, 0x00, 0x02, 0x21, 0x04, 0x42, 0x09, 0x52,
+  0x8b, 0x81, 0x5a, 0xed, 0x02, 0x52, 0x8b, 0x42, 0x09, 0x21, 0x04, 0x90,
+  0x00, 0x00, 0x94, 0x00, 0x00, 0x01, 0x18, 0xe4, 0x52, 0x8b, 0x87, 0x5a,
+  0xed, 0x01, 0x52, 0x8b, 0x18, 0xe4, 0x8e, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x39, 0xc8, 0x8b, 0x5a, 0xed, 0x00, 0x39, 0xc8, 0x8d, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x39, 0xc8, 0x8d, 0x5a, 0xed, 0x00, 0x39, 0xc8,
+  0x8c, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x18, 0xe4, 0x8f, 0x5a, 0xed,
+  0x00, 0x18, 0xe4, 0x8b, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x52, 0x8b,
+  0x8f, 0x5a, 0xed, 0x00, 0x52, 0x8b, 0x8b, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x21, 0x04, 0x91, 0x5a, 0xed, 0x00, 0x21, 0x04, 0x8a, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x02, 0x10, 0x82, 0x39, 0xc8, 0x52, 0x8b, 0x93, 0x5a,
+  0xed, 0x00, 0x42, 0x09, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x00,
+  0x20, 0x31, 0xa7, 0x96, 0x5a, 0xed, 0x00, 0x52, 0x8b, 0x8a, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x01, 0x00, 0x20, 0x4a, 0x6a, 0x98, 0x5a, 0xed, 0x8a,
+  0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x31, 0xa7, 0x99, 0x5a, 0xed, 0x01,
+  0x31, 0xa7, 0x08, 0x41, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x10,
+  0x82, 0x9b, 0x5a, 0xed, 0x01, 0x5a, 0xcc, 0x21, 0x04, 0x87, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x39, 0xc8, 0x9d, 0x5a, 0xed, 0x00, 0x21, 0x04,
+  0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x52, 0x8b, 0x9d, 0x5a, 0xed,
+  0x01, 0x5a, 0xcc, 0x08, 0x41, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x18, 0xe4, 0x9f, 0x5a, 0xed, 0x00, 0x31, 0xa7, 0x85, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x39, 0xc8, 0xa0, 0x5a, 0xed, 0x00, 0x4a, 0x6a, 0x85,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x18, 0xe4, 0xa2, 0x5a, 0xed, 0x00,
+  0x18, 0xe4, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x42, 0x29, 0xa2,
+  0x5a, 0xed, 0x00, 0x42, 0x29, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xa4,
+  0x5a, 0xed, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0xa4, 0x5a, 0xed, 0x84,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x42, 0x29, 0xa2, 0x5a, 0xed, 0x00,
+  0x42, 0x29, 0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x18, 0xe4, 0xa2,
+  0x5a, 0xed, 0x00, 0x18, 0xe4, 0x84, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x39, 0xc8, 0xa0, 0x5a, 0xed, 0x00, 0x39, 0xc8, 0x85, 0x00, 0x00, 0x87,
+  0x00, 0x00, 0x01, 0x18, 0xe4, 0x42, 0x29, 0x9c, 0x5a, 0xed, 0x01, 0x42,
+  0x29, 0x18, 0xe4, 0x86, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x98, 0x00, 0x00,
+  0x00, 0x5a, 0x41, 0x81, 0xfe, 0x45, 0x00, 0xac, 0x43, 0x92, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x29, 0x20, 0x81, 0xfe, 0x45, 0x01, 0xed, 0xc4,
+  0x08, 0x40, 0x92, 0x00, 0x00, 0x96, 0x00, 0x00, 0x01, 0x08, 0x40, 0xed,
+  0xc4, 0x81, 0xfe, 0x45, 0x00, 0x49, 0xe1, 0x93, 0x00, 0x00, 0x96, 0x00,
+  0x00, 0x00, 0xcd, 0x04, 0x81, 0xfe, 0x45, 0x00, 0xac, 0x43, 0x94, 0x00,
+  0x00, 0x95, 0x00, 0x00, 0x00, 0x9b, 0xe3, 0x81, 0xfe, 0x45, 0x01, 0xed,
+  0xc4, 0x08, 0x40, 0x94, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x5a, 0x41,
+  0x82, 0xfe, 0x45, 0x00, 0x49, 0xe1, 0x95, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x29, 0x20, 0x87, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x91, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x01, 0x08, 0x40, 0xed, 0xc4, 0x86, 0xfe, 0x45, 0x00,
+  0x5a, 0x41, 0x92, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xcd, 0x04, 0x86,
+  0xfe, 0x45, 0x00, 0x5a, 0x41, 0x93, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x9b, 0xe3, 0x86, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x94, 0x00, 0x00, 0x95,
+  0x00, 0x00, 0x00, 0x39, 0x81, 0x81, 0xfe, 0x45, 0x00, 0x5a, 0x41, 0x95,
+  0x00, 0x00, 0x95, 0x00, 0x00, 0x02, 0xdd, 0x64, 0xfe, 0x45, 0x5a, 0x41,
+  0x96, 0x00, 0x00, 0x94, 0x00, 0x00, 0x02, 0x6a, 0xa2, 0xfe, 0x45, 0x5a,
+  0x41, 0x97, 0x00, 0x00, 0x93, 0x00, 0x00, 0x02, 0x08, 0x40, 0xed, 0xc4,
+  0x5a, 0x41, 0x98, 0x00, 0x00, 0x93, 0x00, 0x00, 0x01, 0x8b, 0x82, 0x5a,
+  0x41, 0x99, 0x00, 0x00, 0x92, 0x00, 0x00, 0x01, 0x18, 0xc0, 0x5a, 0x41,
+  0x9a, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x9b, 0x00, 0x00,
+  0xaf, 0x00, 0x00,
+};
+
+// Indexed by WeatherIcon; ICON_UNKNOWN has no image
+const unsigned char* const WEATHER_ICON_RLE[] = {
+  ICON_CLEAR_DAY_RLE,
+  ICON_CLEAR_NIGHT_RLE,
+  ICON_PARTLY_CLOUDY_RLE,
+  ICON_CLOUDY_RLE,
+  ICON_FOG_RLE,
+  ICON_DRIZZLE_RLE,
+  ICON_RAIN_RLE,
+  ICON_SNOW_RLE,
+  ICON_THUNDERSTORM_RLE,
+};
+const unsigned int WEATHER_ICON_RLE_LEN[] = {
+  1016,
+  535,
+  925,
+  718,
+  336,
+  681,
+  891,
+  807,
+  639,
+};
+const int WEATHER_ICON_COUNT = 9;
@@ -0,0 +1,185 @@
+#include "backlight.h"
+#include "logger.h"
+#include "settings.h"
+
+#include <driver/ledc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <time.h>
+
+// --- Hardware ---
+
+static const ledc_mode_t    LEDC_MODE    = LEDC_LOW_SPEED_MODE;
+static const ledc_channel_t LEDC_CH      = (ledc_channel_t)BACKLIGHT_LEDC_CHANNEL;
+static const ledc_timer_t   LEDC_TIMER   = (ledc_timer_t)BACKLIGHT_LEDC_TIMER;
+static const uint16_t       DUTY_MAX     = (1 << BACKLIGHT_PWM_BITS) - 1;
+static const uint32_t       SCHEDULE_CHECK_MS = 1000;
+
+// --- Module state ---
+
+static SemaphoreHandle_t lock = nullptr;
+static bool              ready = false;
+static BacklightCurve    curve;
+static BacklightFader    fader;
+static BacklightSchedule schedule;
+static BacklightMode     mode = BACKLIGHT_MODE_NORMAL;
+static bool              dipped = false;
+static int               minuteOfDay = -1;     // -1 until NTP has set the clock
+static unsigned long     lastScheduleCheck = 0;
+static BacklightStats    stats;
+
+// --- Internal helpers (lock held) ---
+
+static void execute(const BacklightCommand& cmd) {
+    switch (cmd.action) {
+        case BACKLIGHT_SET:
+            ledc_set_duty(LEDC_MODE, LEDC_CH, cmd.duty);
+            ledc_update_duty(LEDC_MODE, LEDC_CH);
+            break;
+        case BACKLIGHT_FADE:
+            ledc_set_fade_time_and_start(LEDC_MODE, LEDC_CH, cmd.duty, cmd.ms, LEDC_FADE_NO_WAIT);
+            stats.fades++;
+            break;
+        default:
+            break;
+    }
+}
+
+// Recompute the level and fade there. Queued behind a running fade if needed.
+static void apply(uint16_t fadeMs) {
+    uint8_t level = dipped ? 0 : backlightScheduleLevel(schedule, mode, minuteOfDay);
+    stats.level  = level;
+    stats.night  = backlightScheduleIsNight(schedule, minuteOfDay);
+    stats.dipped = dipped;
+
+    uint32_t now = millis();
+    bool wasBusy = backlightFaderBusy(fader, now);
+    BacklightCommand cmd = backlightFaderRequest(fader, backlightCurveDuty(curve, level),
+                                                 fadeMs, now);
+    if (wasBusy && fader.pending) stats.queued++;
+    execute(cmd);
+}
+
+static int currentMinuteOfDay() {
+    time_t now = time(nullptr);
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    if (timeinfo.tm_year < (2016 - 1900)) return -1;
+    return timeinfo.tm_hour * 60 + timeinfo.tm_min;
+}
+
+// --- Public API ---
+
+void backlightInit() {
+    ledc_timer_config_t timerCfg = {};
+    timerCfg.speed_mode      = LEDC_MODE;
+    timerCfg.duty_resolution = (ledc_timer_bit_t)BACKLIGHT_PWM_BITS;
+    timerCfg.timer_num       = LEDC_TIMER;
+    timerCfg.freq_hz         = BACKLIGHT_PWM_FREQ;
+    timerCfg.clk_cfg         = LEDC_AUTO_CLK;
+
+    ledc_channel_config_t chCfg = {};
+    chCfg.gpio_num   = TFT_BL;
+    chCfg.speed_mode = LEDC_MODE;
+    chCfg.channel    = LEDC_CH;
+    chCfg.intr_type  = LEDC_INTR_DISABLE;
+    chCfg.timer_sel  = LEDC_TIMER;
+    chCfg.duty       = 0;
+    chCfg.hpoint     = 0;
+    chCfg.flags.output_invert = BACKLIGHT_INVERT;
+
+    if (ledc_timer_config(&timerCfg) != ESP_OK ||
+        ledc_channel_config(&chCfg) != ESP_OK ||
+        ledc_fade_func_install(0) != ESP_OK) {
+        logPrintf("Backlight: LEDC setup failed");
+        return;
+    }
+
+    lock = xSemaphoreCreateMutex();
+    backlightCurveInit(curve, DUTY_MAX);
+    backlightFaderInit(fader, 0);
+
+    memset(&schedule, 0, sizeof(schedule));
+    schedule.dayLevel   = BRIGHTNESS_DEFAULT;
+    schedule.nightLevel = BRIGHTNESS_DEFAULT;
+    schedule.dimLevel   = BRIGHTNESS_DIM;
+
+    memset(&stats, 0, sizeof(stats));
+    stats.dutyMax = DUTY_MAX;
+    ready = true;
+
+    logPrintf("Backlight: LEDC ch %d, %d Hz, %d-bit, %d%% = duty %u",
+              BACKLIGHT_LEDC_CHANNEL, BACKLIGHT_PWM_FREQ, BACKLIGHT_PWM_BITS,
+              BRIGHTNESS_DEFAULT, backlightCurveDuty(curve, BRIGHTNESS_DEFAULT));
+}
+
+void backlightConfigure(const BacklightSchedule& sched) {
+    if (!ready) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    schedule = sched;
+    apply(BACKLIGHT_FADE_MS);
+    xSemaphoreGive(lock);
+}
+
+void backlightLoadSettings() {
+    const Settings& s = settingsGet();
+    BacklightSchedule sched;
+    sched.dayLevel      = s.brightness;
+    sched.nightLevel    = s.nightBrightness;
+    sched.nightStartMin = s.nightStartMin;
+    sched.nightEndMin   = s.nightEndMin;
+    sched.dimLevel      = BRIGHTNESS_DIM;
+    backlightConfigure(sched);
+}
+
+void backlightSetMode(BacklightMode newMode) {
+    if (!ready) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (newMode != mode) {
+        // Drifting into dim is slow; waking up is quick
+        uint16_t ms = (newMode == BACKLIGHT_MODE_DIM) ? BACKLIGHT_DIM_FADE_MS : BACKLIGHT_FADE_MS;
+        mode = newMode;
+        apply(ms);
+    }
+    xSemaphoreGive(lock);
+}
+
+BacklightMode backlightGetMode() {
+    return mode;
+}
+
+void backlightDip(bool down, uint16_t ms) {
+    if (!ready) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    dipped = down;
+    apply(ms);
+    xSemaphoreGive(lock);
+}
+
+void backlightUpdate() {
+    if (!ready) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    uint32_t now = millis();
+    execute(backlightFaderPoll(fader, now));     // Start a queued fade
+
+    if (now - lastScheduleCheck >= SCHEDULE_CHECK_MS) {
+        lastScheduleCheck = now;
+        int minute = currentMinuteOfDay();
+        if (minute != minuteOfDay) {
+            bool wasNight = backlightScheduleIsNight(schedule, minuteOfDay);
+            minuteOfDay = minute;
+            if (backlightScheduleIsNight(schedule, minuteOfDay) != wasNight) {
+                logPrintf("Backlight: %s", wasNight ? "day level" : "night level");
+                apply(BACKLIGHT_DIM_FADE_MS);
+            }
+        }
+    }
+
+    stats.duty = backlightFaderDuty(fader, now);
+    xSemaphoreGive(lock);
+}
+
+const BacklightStats& backlightGetStats() {
+    return stats;
+}
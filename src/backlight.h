@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "backlight_model.h"
+
+// ============================================================
+// Backlight - LEDC PWM with hardware fades
+// ============================================================
+//
+// Drives TFT_BL from an LEDC channel. Level changes run as LEDC
+// hardware fades: the peripheral steps the duty by itself, so a fade
+// costs no CPU and never blocks the caller. Levels go through the
+// perceptual curve in backlight_model.h; the panel's inverted backlight
+// is handled by the LEDC output inverter.
+//
+// What is shown follows the schedule: user level by day, night level
+// inside the night window, capped by dim mode, zero when off. Safe to
+// call from any task (the render task uses backlightDip() for fade
+// transitions).
+
+struct BacklightStats {
+    uint8_t  level;             // Percent currently targeted
+    uint16_t duty;              // Where the PWM is now (model estimate)
+    uint16_t dutyMax;
+    uint32_t fades;             // Hardware fades started
+    uint32_t queued;            // Requests that waited for a running fade
+    bool     night;             // Inside the night window
+    bool     dipped;            // Held dark by a page transition
+};
+
+void    backlightInit();                                // LEDC setup, starts dark
+void    backlightConfigure(const BacklightSchedule& sched);     // Levels and night window
+void    backlightLoadSettings();                        // backlightConfigure() from settingsGet()
+void    backlightSetMode(BacklightMode mode);           // Normal / dim / off
+BacklightMode backlightGetMode();
+
+// Fade to dark (down) or back to the scheduled level, over ms
+void    backlightDip(bool down, uint16_t ms);
+
+void    backlightUpdate();                              // Call in main loop
+const BacklightStats& backlightGetStats();
@@ -0,0 +1,130 @@
+#include "backlight_model.h"
+
+#include <math.h>
+#include <string.h>
+
+// ============================================================
+// Backlight Model Implementation
+// ============================================================
+
+// The LEDC fade engine rounds the fade into whole steps, so it can run
+// a little past the requested time. Treat it as busy that much longer.
+static const uint32_t FADE_MARGIN_MS = 10;
+
+// --- Curve ---
+
+void backlightCurveInit(BacklightCurve& curve, uint16_t dutyMax) {
+    for (int level = 0; level < BACKLIGHT_LEVELS; level++) {
+        // CIE 1931: lightness L* (0-100) to relative luminance Y (0-1)
+        float l = (float)level;
+        float y = (l <= 8.0f) ? l / 903.3f : powf((l + 16.0f) / 116.0f, 3.0f);
+
+        uint32_t duty = (uint32_t)lroundf(y * dutyMax);
+        if (level > 0 && duty < 1) duty = 1;
+        if (level > 0 && duty < curve.duty[level - 1]) duty = curve.duty[level - 1];
+        if (duty > dutyMax) duty = dutyMax;
+        curve.duty[level] = (uint16_t)duty;
+    }
+}
+
+uint16_t backlightCurveDuty(const BacklightCurve& curve, uint8_t percent) {
+    if (percent >= BACKLIGHT_LEVELS) percent = BACKLIGHT_LEVELS - 1;
+    return curve.duty[percent];
+}
+
+// --- Fader ---
+
+void backlightFaderInit(BacklightFader& fader, uint16_t duty) {
+    memset(&fader, 0, sizeof(fader));
+    fader.fromDuty = duty;
+    fader.toDuty   = duty;
+}
+
+bool backlightFaderBusy(const BacklightFader& fader, uint32_t nowMs) {
+    return fader.fading && (nowMs - fader.startMs) < fader.durationMs + FADE_MARGIN_MS;
+}
+
+uint16_t backlightFaderDuty(const BacklightFader& fader, uint32_t nowMs) {
+    if (!fader.fading) return fader.toDuty;
+
+    uint32_t elapsed = nowMs - fader.startMs;
+    if (elapsed >= fader.durationMs) return fader.toDuty;
+
+    // The hardware steps duty linearly over the fade
+    int32_t delta = (int32_t)fader.toDuty - (int32_t)fader.fromDuty;
+    return (uint16_t)(fader.fromDuty + delta * (int32_t)elapsed / (int32_t)fader.durationMs);
+}
+
+BacklightCommand backlightFaderRequest(BacklightFader& fader, uint16_t duty,
+                                       uint16_t ms, uint32_t nowMs) {
+    BacklightCommand cmd = { BACKLIGHT_NONE, duty, ms };
+
+    if (backlightFaderBusy(fader, nowMs)) {
+        if (duty == fader.toDuty) {
+            fader.pending = false;      // Already heading there
+        } else {
+            fader.pending     = true;
+            fader.pendingDuty = duty;
+            fader.pendingMs   = ms;
+        }
+        return cmd;
+    }
+
+    // Idle: whatever ran before has landed
+    fader.fading   = false;
+    fader.pending  = false;
+    fader.fromDuty = fader.toDuty;
+    if (duty == fader.toDuty) return cmd;
+
+    fader.toDuty = duty;
+    if (ms == 0) {
+        fader.fromDuty = duty;
+        cmd.action = BACKLIGHT_SET;
+        return cmd;
+    }
+
+    fader.startMs    = nowMs;
+    fader.durationMs = ms;
+    fader.fading     = true;
+    cmd.action = BACKLIGHT_FADE;
+    return cmd;
+}
+
+BacklightCommand backlightFaderPoll(BacklightFader& fader, uint32_t nowMs) {
+    BacklightCommand cmd = { BACKLIGHT_NONE, fader.toDuty, 0 };
+    if (backlightFaderBusy(fader, nowMs)) return cmd;
+
+    if (fader.fading) {
+        fader.fading   = false;
+        fader.fromDuty = fader.toDuty;
+    }
+    if (fader.pending) {
+        fader.pending = false;
+        return backlightFaderRequest(fader, fader.pendingDuty, fader.pendingMs, nowMs);
+    }
+    return cmd;
+}
+
+// --- Schedule ---
+
+bool backlightScheduleIsNight(const BacklightSchedule& sched, int minuteOfDay) {
+    if (minuteOfDay < 0 || sched.nightStartMin == sched.nightEndMin) return false;
+
+    if (sched.nightStartMin < sched.nightEndMin) {
+        return minuteOfDay >= sched.nightStartMin && minuteOfDay < sched.nightEndMin;
+    }
+    // Window wraps past midnight
+    return minuteOfDay >= sched.nightStartMin || minuteOfDay < sched.nightEndMin;
+}
+
+uint8_t backlightScheduleLevel(const BacklightSchedule& sched, BacklightMode mode,
+                               int minuteOfDay) {
+    if (mode == BACKLIGHT_MODE_OFF) return 0;
+
+    uint8_t level = backlightScheduleIsNight(sched, minuteOfDay) ? sched.nightLevel
+                                                                 : sched.dayLevel;
+    if (mode == BACKLIGHT_MODE_DIM && level > sched.dimLevel) {
+        level = sched.dimLevel;
+    }
+    return level;
+}
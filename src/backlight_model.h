@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============================================================
+// Backlight Model - brightness curve, fade queue, night schedule
+// ============================================================
+//
+// The decisions behind the backlight, separate from the LEDC hardware
+// in backlight.cpp:
+//
+// - Curve: 0-100% brightness to PWM duty through CIE 1931 lightness,
+//   so equal steps look equal. The linear mapping spent the whole
+//   useful range of the cheap panel in the bottom third.
+// - Fader: the LEDC fade engine cannot be retargeted mid-fade without
+//   blocking the caller until the running fade ends. The fader tracks
+//   where the hardware is and holds the newest request until then.
+// - Schedule: a night window (may wrap past midnight) with its own
+//   level, plus dim/off modes layered on top.
+//
+// Plain C++ with no Arduino dependencies: time is passed in, so fades
+// and schedules can be stepped through on a desktop.
+
+#define BACKLIGHT_LEVELS    101     // 0-100 %
+
+// --- Curve ---
+
+struct BacklightCurve {
+    uint16_t duty[BACKLIGHT_LEVELS];
+};
+
+// Any level above 0 maps to at least duty 1, and the curve never decreases
+void     backlightCurveInit(BacklightCurve& curve, uint16_t dutyMax);
+uint16_t backlightCurveDuty(const BacklightCurve& curve, uint8_t percent);
+
+// --- Fader ---
+
+struct BacklightFader {
+    uint16_t fromDuty;          // Duty when the running fade started
+    uint16_t toDuty;            // Target of the running fade (= duty when idle)
+    uint32_t startMs;
+    uint32_t durationMs;
+    bool     fading;
+    bool     pending;           // A request is waiting for the fade to end
+    uint16_t pendingDuty;
+    uint16_t pendingMs;
+};
+
+enum BacklightAction {
+    BACKLIGHT_NONE,             // Nothing to do (same target, or queued)
+    BACKLIGHT_SET,              // Write duty now
+    BACKLIGHT_FADE              // Start a hardware fade to duty over ms
+};
+
+struct BacklightCommand {
+    BacklightAction action;
+    uint16_t        duty;
+    uint16_t        ms;
+};
+
+void     backlightFaderInit(BacklightFader& fader, uint16_t duty);
+uint16_t backlightFaderDuty(const BacklightFader& fader, uint32_t nowMs);  // Where the PWM is now
+bool     backlightFaderBusy(const BacklightFader& fader, uint32_t nowMs);
+
+// New target. Returns what to tell the hardware now; while a fade runs
+// the request is queued (latest wins) and comes back from the poll.
+BacklightCommand backlightFaderRequest(BacklightFader& fader, uint16_t duty,
+                                       uint16_t ms, uint32_t nowMs);
+BacklightCommand backlightFaderPoll(BacklightFader& fader, uint32_t nowMs);
+
+// --- Schedule ---
+
+enum BacklightMode {
+    BACKLIGHT_MODE_NORMAL,
+    BACKLIGHT_MODE_DIM,         // Idle: no brighter than the dim level
+    BACKLIGHT_MODE_OFF
+};
+
+struct BacklightSchedule {
+    uint8_t  dayLevel;          // User brightness, 0-100
+    uint8_t  nightLevel;
+    uint16_t nightStartMin;     // Minute of day; start == end disables the window
+    uint16_t nightEndMin;
+    uint8_t  dimLevel;
+};
+
+bool    backlightScheduleIsNight(const BacklightSchedule& sched, int minuteOfDay);
+
+// Level to show. minuteOfDay < 0 = local time unknown (no night window).
+uint8_t backlightScheduleLevel(const BacklightSchedule& sched, BacklightMode mode,
+                               int minuteOfDay);
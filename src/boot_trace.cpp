@@ -0,0 +1,28 @@
+#include "boot_trace.h"
+#include "logger.h"
+
+static BootTraceEntry entries[BOOT_TRACE_MAX];
+static int            entryCount = 0;
+static portMUX_TYPE   traceMux = portMUX_INITIALIZER_UNLOCKED;
+
+void bootTraceMark(const char* stage) {
+    uint32_t ms = millis();
+
+    portENTER_CRITICAL(&traceMux);
+    if (entryCount < BOOT_TRACE_MAX) {
+        entries[entryCount].stage = stage;
+        entries[entryCount].ms    = ms;
+        entryCount++;
+    }
+    portEXIT_CRITICAL(&traceMux);
+
+    logPrintf("Boot: %s at %lu ms", stage, (unsigned long)ms);
+}
+
+int bootTraceCount() {
+    return entryCount;
+}
+
+const BootTraceEntry& bootTraceGet(int index) {
+    return entries[index];
+}
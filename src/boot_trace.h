@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ============================================================
+// Boot Trace - milestones from reset to a live screen
+// ============================================================
+//
+// Each mark records milliseconds since the app started (millis(); ROM
+// and bootloader time before that are not included) and is logged as
+// "Boot: <stage> at N ms". Marks may come from any task. The first
+// BOOT_TRACE_MAX are kept for /api/perf.
+
+#define BOOT_TRACE_MAX  16
+
+struct BootTraceEntry {
+    const char* stage;          // String literal
+    uint32_t    ms;
+};
+
+void                  bootTraceMark(const char* stage);
+int                   bootTraceCount();
+const BootTraceEntry& bootTraceGet(int index);
@@ -0,0 +1,307 @@
+#include "bus_trace.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================
+// Bus Trace Implementation
+// ============================================================
+
+// --- ST7789 commands the decoder understands ---
+static const uint8_t CMD_CASET = 0x2A;     // Column address set
+static const uint8_t CMD_RASET = 0x2B;     // Row address set
+static const uint8_t CMD_RAMWR = 0x2C;     // Memory write
+
+BusTrace::BusTrace()
+    : _inner(nullptr), _cmd(0), _argCount(0),
+      _xs(0), _xe(0), _ys(0), _ye(0), _cx(0), _cy(0),
+      _pixHi(0), _pixHalf(false),
+      _fb(nullptr), _fbW(0), _fbH(0),
+      _dmaBuf(nullptr), _dmaLen(0) {
+    resetStats();
+}
+
+BusTrace::~BusTrace() {
+    free(_dmaBuf);
+}
+
+void BusTrace::attachFramebuffer(uint16_t* fb, int16_t width, int16_t height) {
+    _fb  = fb;
+    _fbW = width;
+    _fbH = height;
+}
+
+void BusTrace::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+bool BusTrace::writePPM(FILE* out, int16_t x, int16_t y, int16_t w, int16_t h) const {
+    if (!_fb || !out || x < 0 || y < 0 || x + w > _fbW || y + h > _fbH) return false;
+
+    fprintf(out, "P6\n%d %d\n255\n", w, h);
+    for (int row = y; row < y + h; row++) {
+        for (int col = x; col < x + w; col++) {
+            uint16_t c = _fb[row * _fbW + col];
+            uint8_t r5 = (c >> 11) & 0x1F;
+            uint8_t g6 = (c >> 5) & 0x3F;
+            uint8_t b5 = c & 0x1F;
+            uint8_t rgb[3] = {
+                (uint8_t)((r5 << 3) | (r5 >> 2)),
+                (uint8_t)((g6 << 2) | (g6 >> 4)),
+                (uint8_t)((b5 << 3) | (b5 >> 2))
+            };
+            if (fwrite(rgb, 1, 3, out) != 3) return false;
+        }
+    }
+    return true;
+}
+
+// --- Decoder (capture mode) ---
+
+void BusTrace::decodeCommand(uint8_t cmd) {
+    _cmd      = cmd;
+    _argCount = 0;
+    _pixHalf  = false;
+
+    if (cmd == CMD_RAMWR) {
+        _cx = _xs;
+        _cy = _ys;
+    }
+}
+
+void BusTrace::storePixel(uint16_t color) {
+    if (_fb && _cx < _fbW && _cy < _fbH) {
+        _fb[_cy * _fbW + _cx] = color;
+    }
+    _stats.pixels++;
+
+    // Advance inside the window, wrapping like the panel's RAM pointer
+    if (_cx < _xe) {
+        _cx++;
+    } else {
+        _cx = _xs;
+        _cy = (_cy < _ye) ? (uint16_t)(_cy + 1) : _ys;
+    }
+}
+
+void BusTrace::decodeData(const uint8_t* data, uint32_t length) {
+    if (_cmd == CMD_RAMWR) {
+        for (uint32_t i = 0; i < length; i++) {
+            if (_pixHalf) {
+                storePixel((uint16_t)(_pixHi << 8) | data[i]);   // Big-endian on the wire
+                _pixHalf = false;
+            } else {
+                _pixHi = data[i];
+                _pixHalf = true;
+            }
+        }
+        return;
+    }
+
+    if (_cmd != CMD_CASET && _cmd != CMD_RASET) return;
+
+    for (uint32_t i = 0; i < length && _argCount < 4; i++) {
+        _args[_argCount++] = data[i];
+    }
+    if (_argCount < 4) return;
+
+    uint16_t start = (uint16_t)(_args[0] << 8) | _args[1];
+    uint16_t end   = (uint16_t)(_args[2] << 8) | _args[3];
+    if (_cmd == CMD_CASET) {
+        _xs = start;
+        _xe = end;
+    } else {
+        _ys = start;
+        _ye = end;
+    }
+}
+
+// --- lgfx::IBus ---
+
+lgfx::bus_type_t BusTrace::busType(void) const {
+    return _inner ? _inner->busType() : lgfx::bus_spi;
+}
+
+bool BusTrace::init(void) {
+    return _inner ? _inner->init() : true;
+}
+
+void BusTrace::release(void) {
+    if (_inner) _inner->release();
+}
+
+void BusTrace::beginTransaction(void) {
+    _stats.transactions++;
+    if (_inner) _inner->beginTransaction();
+}
+
+void BusTrace::endTransaction(void) {
+    if (_inner) _inner->endTransaction();
+}
+
+void BusTrace::wait(void) {
+    if (_inner) _inner->wait();
+}
+
+bool BusTrace::busy(void) const {
+    return _inner ? _inner->busy() : false;
+}
+
+uint32_t BusTrace::getClock(void) const {
+    return _inner ? _inner->getClock() : 0;
+}
+
+void BusTrace::setClock(uint32_t freq) {
+    if (_inner) _inner->setClock(freq);
+}
+
+void BusTrace::flush(void) {
+    if (_inner) _inner->flush();
+}
+
+bool BusTrace::writeCommand(uint32_t data, uint_fast8_t bit_length) {
+    _stats.bytes += bit_length >> 3;
+    _stats.commands++;
+
+    uint8_t cmd = (uint8_t)data;
+    if (cmd == CMD_CASET || cmd == CMD_RASET) _stats.addrWindows++;
+    else if (cmd == CMD_RAMWR) _stats.ramWrites++;
+
+    if (_inner) {
+        _cmd = cmd;     // Still needed to tell pixel data from arguments
+        return _inner->writeCommand(data, bit_length);
+    }
+    decodeCommand(cmd);
+    return true;
+}
+
+void BusTrace::writeData(uint32_t data, uint_fast8_t bit_length) {
+    uint32_t len = bit_length >> 3;
+    _stats.bytes += len;
+
+    if (_inner) {
+        if (_cmd == CMD_RAMWR) _stats.pixels += len >> 1;
+        _inner->writeData(data, bit_length);
+        return;
+    }
+
+    // The bus shifts the register out low byte first
+    uint8_t bytes[4];
+    for (uint32_t i = 0; i < len && i < 4; i++) {
+        bytes[i] = (uint8_t)(data >> (i * 8));
+    }
+    decodeData(bytes, len);
+}
+
+void BusTrace::writeDataRepeat(uint32_t data, uint_fast8_t bit_length, uint32_t count) {
+    uint32_t len = bit_length >> 3;
+    _stats.bytes += (uint64_t)len * count;
+
+    if (_inner) {
+        if (_cmd == CMD_RAMWR) _stats.pixels += count;
+        _inner->writeDataRepeat(data, bit_length, count);
+        return;
+    }
+
+    if (_cmd == CMD_RAMWR && len == 2 && !_pixHalf) {
+        uint16_t color = (uint16_t)(((data & 0xFF) << 8) | ((data >> 8) & 0xFF));
+        for (uint32_t i = 0; i < count; i++) storePixel(color);
+        return;
+    }
+
+    uint8_t bytes[4];
+    for (uint32_t i = 0; i < len && i < 4; i++) {
+        bytes[i] = (uint8_t)(data >> (i * 8));
+    }
+    for (uint32_t i = 0; i < count; i++) decodeData(bytes, len);
+}
+
+void BusTrace::writePixels(lgfx::pixelcopy_t* param, uint32_t length) {
+    uint32_t bpp = param->dst_bits >> 3;
+    _stats.bytes += (uint64_t)bpp * length;
+
+    if (_inner) {
+        _stats.pixels += length;
+        _inner->writePixels(param, length);
+        return;
+    }
+
+    // Convert in small chunks into wire format, then decode
+    uint8_t  chunk[64 * 3];
+    uint32_t perChunk = sizeof(chunk) / (bpp ? bpp : 1);
+    while (length) {
+        uint32_t n = (length < perChunk) ? length : perChunk;
+        param->fp_copy(chunk, 0, n, param);
+        decodeData(chunk, n * bpp);
+        length -= n;
+    }
+}
+
+void BusTrace::writeBytes(const uint8_t* data, uint32_t length, bool dc, bool use_dma) {
+    _stats.bytes += length;
+
+    if (_inner) {
+        if (dc && _cmd == CMD_RAMWR) _stats.pixels += length >> 1;
+        _inner->writeBytes(data, length, dc, use_dma);
+        return;
+    }
+
+    if (dc) {
+        decodeData(data, length);
+    } else {
+        for (uint32_t i = 0; i < length; i++) decodeCommand(data[i]);
+    }
+}
+
+void BusTrace::initDMA(void) {
+    if (_inner) _inner->initDMA();
+}
+
+void BusTrace::addDMAQueue(const uint8_t* data, uint32_t length) {
+    _stats.bytes += length;
+
+    if (_inner) {
+        if (_cmd == CMD_RAMWR) _stats.pixels += length >> 1;
+        _inner->addDMAQueue(data, length);
+        return;
+    }
+    decodeData(data, length);
+}
+
+void BusTrace::execDMAQueue(void) {
+    if (_inner) _inner->execDMAQueue();
+}
+
+uint8_t* BusTrace::getDMABuffer(uint32_t length) {
+    if (_inner) return _inner->getDMABuffer(length);
+
+    if (length > _dmaLen) {
+        uint8_t* buf = (uint8_t*)realloc(_dmaBuf, length);
+        if (!buf) return nullptr;
+        _dmaBuf = buf;
+        _dmaLen = length;
+    }
+    return _dmaBuf;
+}
+
+void BusTrace::beginRead(void) {
+    if (_inner) _inner->beginRead();
+}
+
+void BusTrace::endRead(void) {
+    if (_inner) _inner->endRead();
+}
+
+uint32_t BusTrace::readData(uint_fast8_t bit_length) {
+    return _inner ? _inner->readData(bit_length) : 0;
+}
+
+bool BusTrace::readBytes(uint8_t* dst, uint32_t length, bool use_dma) {
+    if (_inner) return _inner->readBytes(dst, length, use_dma);
+    memset(dst, 0, length);
+    return true;
+}
+
+void BusTrace::readPixels(void* dst, lgfx::pixelcopy_t* param, uint32_t length) {
+    if (_inner) _inner->readPixels(dst, param, length);
+}
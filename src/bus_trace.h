@@ -0,0 +1,102 @@
+#pragma once
+
+#include <LovyanGFX.hpp>
+#include <stdint.h>
+#include <stdio.h>
+
+// ============================================================
+// Bus Trace - counting / capturing LovyanGFX bus
+// ============================================================
+//
+// Sits between the panel driver and the real bus. Every command and data
+// byte the panel emits passes through here and is counted, so the firmware
+// knows exactly what each render pass costs on the wire.
+//
+// With no inner bus (a native build, no SmallTV attached) it decodes the
+// ST7789 command stream itself: CASET/RASET set the address window, RAMWR
+// pixels land in an in-memory RGB565 framebuffer that can be dumped as a
+// PPM image. The result is what the panel would show, byte for byte.
+//
+// Uses only LovyanGFX, no Arduino APIs.
+
+struct BusTraceStats {
+    uint64_t bytes;             // Command + data bytes on the wire
+    uint32_t commands;
+    uint32_t addrWindows;       // CASET/RASET commands (address window changes)
+    uint32_t ramWrites;         // RAMWR commands (one per pixel burst)
+    uint32_t transactions;      // beginTransaction() calls (bus acquisitions)
+    uint64_t pixels;            // Pixels sent after RAMWR
+};
+
+class BusTrace : public lgfx::IBus {
+public:
+    BusTrace();
+    ~BusTrace() override;
+
+    // Forward everything to inner (the real SPI bus). nullptr = capture only.
+    void setInner(lgfx::IBus* inner) { _inner = inner; }
+
+    // Decode RAMWR pixels into fb (width x height RGB565, native byte order).
+    // Only possible without an inner bus: pixel sources are consumed once.
+    void attachFramebuffer(uint16_t* fb, int16_t width, int16_t height);
+
+    const BusTraceStats& stats() const { return _stats; }
+    void resetStats();
+
+    // Write a region of the framebuffer as binary PPM (P6)
+    bool writePPM(FILE* out, int16_t x, int16_t y, int16_t w, int16_t h) const;
+
+    // --- lgfx::IBus ---
+    lgfx::bus_type_t busType(void) const override;
+    bool init(void) override;
+    void release(void) override;
+
+    void beginTransaction(void) override;
+    void endTransaction(void) override;
+    void wait(void) override;
+    bool busy(void) const override;
+    uint32_t getClock(void) const override;
+    void setClock(uint32_t freq) override;
+
+    void flush(void) override;
+    bool writeCommand(uint32_t data, uint_fast8_t bit_length) override;
+    void writeData(uint32_t data, uint_fast8_t bit_length) override;
+    void writeDataRepeat(uint32_t data, uint_fast8_t bit_length, uint32_t count) override;
+    void writePixels(lgfx::pixelcopy_t* param, uint32_t length) override;
+    void writeBytes(const uint8_t* data, uint32_t length, bool dc, bool use_dma) override;
+
+    void initDMA(void) override;
+    void addDMAQueue(const uint8_t* data, uint32_t length) override;
+    void execDMAQueue(void) override;
+    uint8_t* getDMABuffer(uint32_t length) override;
+
+    void beginRead(void) override;
+    void endRead(void) override;
+    uint32_t readData(uint_fast8_t bit_length) override;
+    bool readBytes(uint8_t* dst, uint32_t length, bool use_dma = false) override;
+    void readPixels(void* dst, lgfx::pixelcopy_t* param, uint32_t length) override;
+
+private:
+    void decodeCommand(uint8_t cmd);
+    void decodeData(const uint8_t* data, uint32_t length);
+    void storePixel(uint16_t color);
+    bool decoding() const { return _inner == nullptr; }
+
+    lgfx::IBus*   _inner;
+    BusTraceStats _stats;
+
+    // Command stream decoder (capture mode)
+    uint8_t   _cmd;                 // Last command byte
+    uint8_t   _args[4];
+    uint8_t   _argCount;
+    uint16_t  _xs, _xe, _ys, _ye;   // Current address window
+    uint16_t  _cx, _cy;             // RAMWR write cursor
+    uint8_t   _pixHi;               // First byte of a pixel split across writes
+    bool      _pixHalf;
+
+    uint16_t* _fb;
+    int16_t   _fbW, _fbH;
+
+    uint8_t*  _dmaBuf;              // Scratch for getDMABuffer() in capture mode
+    uint32_t  _dmaLen;
+};
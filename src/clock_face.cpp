@@ -0,0 +1,54 @@
+#include "clock_face.h"
+
+#include <math.h>
+
+// ============================================================
+// Clock Face Implementation
+// ============================================================
+
+static const float DEG_TO_RAD_F = 3.14159265f / 180.0f;
+
+// sinf/cosf leave residue at right angles (cos 90 = -4e-8); without this
+// floor/ceil would grow axis-aligned boxes by a pixel
+static const float SNAP_EPSILON = 0.001f;
+
+void clockFaceAngles(int hour, int minute, int second, int millis,
+                     uint16_t secondStepMs, ClockAngles& out) {
+    if (secondStepMs == 0) secondStepMs = 1000;
+
+    // Position within the minute, snapped down to the step
+    uint32_t msOfMinute = (uint32_t)second * 1000 + (uint32_t)millis;
+    msOfMinute -= msOfMinute % secondStepMs;
+
+    out.hour   = (float)(hour % 12) * 30.0f + (float)minute * 0.5f;
+    out.minute = (float)minute * 6.0f;
+    out.second = (float)msOfMinute * 0.006f;
+}
+
+DirtyRect clockHandBounds(const ClockHand& hand, float angleDeg, int cx, int cy) {
+    float s = sinf(angleDeg * DEG_TO_RAD_F);
+    float c = cosf(angleDeg * DEG_TO_RAD_F);
+    float half = hand.width * 0.5f;
+
+    // Corners of the unrotated bar: tip toward -y
+    const float xs[2] = { -half, half };
+    const float ys[2] = { -(float)hand.length, (float)hand.tail };
+
+    float minX = 0, maxX = 0, minY = 0, maxY = 0;
+    for (int i = 0; i < 4; i++) {
+        float x = xs[i & 1];
+        float y = ys[i >> 1];
+        float rx = x * c - y * s;
+        float ry = x * s + y * c;
+        if (i == 0 || rx < minX) minX = rx;
+        if (i == 0 || rx > maxX) maxX = rx;
+        if (i == 0 || ry < minY) minY = ry;
+        if (i == 0 || ry > maxY) maxY = ry;
+    }
+
+    int x0 = cx + (int)floorf(minX + SNAP_EPSILON) - CLOCK_FACE_AA_MARGIN;
+    int y0 = cy + (int)floorf(minY + SNAP_EPSILON) - CLOCK_FACE_AA_MARGIN;
+    int x1 = cx + (int)ceilf(maxX - SNAP_EPSILON) + CLOCK_FACE_AA_MARGIN;
+    int y1 = cy + (int)ceilf(maxY - SNAP_EPSILON) + CLOCK_FACE_AA_MARGIN;
+    return { (int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0 + 1), (int16_t)(y1 - y0 + 1) };
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include "dirty_rect.h"
+
+// ============================================================
+// Clock Face Geometry - analog hand angles and bounding boxes
+// ============================================================
+//
+// The analog clock page redraws only the boxes a hand leaves and
+// enters. This module decides where the hands point and which pixels a
+// hand at a given angle can touch; display.cpp does the drawing.
+//
+// Angles are degrees clockwise from 12 o'clock, screen coordinates
+// (y grows downward). A hand is a bar centred on its pivot, reaching
+// `length` toward the tip and `tail` behind the pivot.
+//
+// Plain C++ with no Arduino dependencies so the geometry can be checked
+// against known values on a desktop.
+
+#ifndef CLOCK_FACE_AA_MARGIN
+#define CLOCK_FACE_AA_MARGIN    2       // Pixels around a hand for rounding and anti-aliased edges
+#endif
+
+struct ClockHand {
+    int16_t length;             // Pivot to tip
+    int16_t tail;               // Pivot to the back end
+    int16_t width;
+};
+
+struct ClockAngles {
+    float hour;                 // Creeps with the minutes
+    float minute;               // Whole minutes
+    float second;               // Quantized to the step
+};
+
+// secondStepMs: how far the seconds hand moves at a time (1000 = ticks
+// once a second, 250 = four steps per second)
+void clockFaceAngles(int hour, int minute, int second, int millis,
+                     uint16_t secondStepMs, ClockAngles& out);
+
+// Box holding every pixel of hand at angleDeg pivoting at (cx, cy),
+// CLOCK_FACE_AA_MARGIN included. Not clipped to the screen.
+DirtyRect clockHandBounds(const ClockHand& hand, float angleDeg, int cx, int cy);
@@ -0,0 +1,141 @@
+#include "dirty_rect.h"
+
+// ============================================================
+// Dirty Rectangle Implementation
+// ============================================================
+
+// --- Internal helpers ---
+
+static inline int32_t rectArea(const DirtyRect& r) {
+    return (int32_t)r.w * (int32_t)r.h;
+}
+
+static DirtyRect rectUnion(const DirtyRect& a, const DirtyRect& b) {
+    int16_t x0 = (a.x < b.x) ? a.x : b.x;
+    int16_t y0 = (a.y < b.y) ? a.y : b.y;
+    int16_t x1 = (a.x + a.w > b.x + b.w) ? (a.x + a.w) : (b.x + b.w);
+    int16_t y1 = (a.y + a.h > b.y + b.h) ? (a.y + a.h) : (b.y + b.h);
+    return { x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+}
+
+static int32_t rectOverlap(const DirtyRect& a, const DirtyRect& b) {
+    int32_t x0 = (a.x > b.x) ? a.x : b.x;
+    int32_t y0 = (a.y > b.y) ? a.y : b.y;
+    int32_t x1 = (a.x + a.w < b.x + b.w) ? (a.x + a.w) : (b.x + b.w);
+    int32_t y1 = (a.y + a.h < b.y + b.h) ? (a.y + a.h) : (b.y + b.h);
+    if (x1 <= x0 || y1 <= y0) return 0;
+    return (x1 - x0) * (y1 - y0);
+}
+
+static bool rectContains(const DirtyRect& outer, const DirtyRect& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.w <= outer.x + outer.w &&
+           inner.y + inner.h <= outer.y + outer.h;
+}
+
+// Extra pixels pushed if a and b are sent as one rect instead of two.
+// Negative when they overlap enough that merging saves bandwidth too.
+static int32_t mergeCost(const DirtyRect& a, const DirtyRect& b) {
+    int32_t separate = rectArea(a) + rectArea(b) - rectOverlap(a, b);
+    return rectArea(rectUnion(a, b)) - separate;
+}
+
+static void removeAt(DirtyRegion& region, int index) {
+    region.rects[index] = region.rects[region.count - 1];
+    region.count--;
+}
+
+// --- Public API ---
+
+void dirtyRegionInit(DirtyRegion& region, int16_t width, int16_t height) {
+    region.boundsW = width;
+    region.boundsH = height;
+    region.count   = 0;
+}
+
+void dirtyRegionClear(DirtyRegion& region) {
+    region.count = 0;
+}
+
+void dirtyRegionAdd(DirtyRegion& region, int x, int y, int w, int h) {
+    // Clip to screen bounds
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > region.boundsW) w = region.boundsW - x;
+    if (y + h > region.boundsH) h = region.boundsH - y;
+    if (w <= 0 || h <= 0) return;
+
+    DirtyRect r = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+
+    // Already covered, or covers existing rects
+    for (int i = 0; i < region.count; i++) {
+        if (rectContains(region.rects[i], r)) return;
+    }
+    for (int i = region.count - 1; i >= 0; i--) {
+        if (rectContains(r, region.rects[i])) removeAt(region, i);
+    }
+
+    if (region.count < DIRTY_RECT_MAX) {
+        region.rects[region.count++] = r;
+        return;
+    }
+
+    // List is full: fold the new rect into whichever existing rect grows least
+    int     best     = 0;
+    int32_t bestCost = mergeCost(region.rects[0], r);
+    for (int i = 1; i < region.count; i++) {
+        int32_t cost = mergeCost(region.rects[i], r);
+        if (cost < bestCost) {
+            bestCost = cost;
+            best = i;
+        }
+    }
+    region.rects[best] = rectUnion(region.rects[best], r);
+}
+
+void dirtyRegionAddAll(DirtyRegion& region) {
+    region.rects[0] = { 0, 0, region.boundsW, region.boundsH };
+    region.count = 1;
+}
+
+void dirtyRegionMerge(DirtyRegion& region) {
+    // Greedy pairwise merge: repeatedly combine the cheapest pair while the
+    // extra pixels cost less than a separate address-window transaction.
+    // N is tiny (DIRTY_RECT_MAX), so O(N^3) worst case is fine.
+    bool merged = true;
+    while (merged && region.count > 1) {
+        merged = false;
+
+        int     bestI = -1, bestJ = -1;
+        int32_t bestCost = DIRTY_MERGE_SLACK_PX + 1;
+
+        for (int i = 0; i < region.count; i++) {
+            for (int j = i + 1; j < region.count; j++) {
+                int32_t cost = mergeCost(region.rects[i], region.rects[j]);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestI = i;
+                    bestJ = j;
+                }
+            }
+        }
+
+        if (bestI >= 0) {
+            region.rects[bestI] = rectUnion(region.rects[bestI], region.rects[bestJ]);
+            removeAt(region, bestJ);
+            merged = true;
+        }
+    }
+}
+
+uint32_t dirtyRegionArea(const DirtyRegion& region) {
+    uint32_t area = 0;
+    for (int i = 0; i < region.count; i++) {
+        area += (uint32_t)rectArea(region.rects[i]);
+    }
+    return area;
+}
+
+bool dirtyRegionIsEmpty(const DirtyRegion& region) {
+    return region.count == 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============================================================
+// Dirty Rectangle Tracking
+// Collects changed screen regions and merges them into a small
+// number of rectangles, each flushed as one address-window burst.
+// ============================================================
+//
+// Plain C++ with no Arduino dependencies so the merge logic can be
+// compiled and benchmarked on a desktop machine.
+
+#ifndef DIRTY_RECT_MAX
+#define DIRTY_RECT_MAX          16      // Rects tracked per frame before forced merging
+#endif
+
+#ifndef DIRTY_MERGE_SLACK_PX
+#define DIRTY_MERGE_SLACK_PX    256     // Extra pixels we accept to save one bus transaction
+#endif
+
+struct DirtyRect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+struct DirtyRegion {
+    DirtyRect rects[DIRTY_RECT_MAX];
+    int       count;
+    int16_t   boundsW;      // Clip bounds (screen size)
+    int16_t   boundsH;
+};
+
+void     dirtyRegionInit(DirtyRegion& region, int16_t width, int16_t height);
+void     dirtyRegionClear(DirtyRegion& region);
+void     dirtyRegionAdd(DirtyRegion& region, int x, int y, int w, int h);  // Clipped to bounds
+void     dirtyRegionAddAll(DirtyRegion& region);                          // Whole screen
+void     dirtyRegionMerge(DirtyRegion& region);  // Coalesce overlapping/nearby rects
+uint32_t dirtyRegionArea(const DirtyRegion& region);
+bool     dirtyRegionIsEmpty(const DirtyRegion& region);
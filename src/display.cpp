@@ -1,10 +1,30 @@
 #include "display.h"
+#include "dirty_rect.h"
+#include "clock_face.h"
+#include "gif_decoder.h"
+#include "layout.h"
+#include "render_scheduler.h"
+#include "spsc_ring.h"
+#include "rle565.h"
+#include "vlw_font.h"
 #include "weather.h"
 #include "config.h"
 #include "logger.h"
-
-#include <WiFi.h>
+#include "weather_icons.h"
+#include "backlight.h"
+#include "boot_trace.h"
+#include "splash.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+
+#include <atomic>
+#include <ctype.h>
 #include <math.h>
+#include <sys/time.h>
+#include <time.h>
 
 // ============================================================
 // Display Implementation
@@ -19,492 +39,2786 @@ static const uint16_t COL_RED       = 0xF800;
 static const uint16_t COL_GREY      = 0x7BEF;
 static const uint16_t COL_DARK_GREY = 0x3186;
 
-// --- Layout constants (clock page) ---
-static const int TIME_Y       = 55;     // Large clock vertical position
-static const int DATE_Y       = 110;    // Date line below clock
-static const int DIVIDER_Y    = 140;    // Horizontal divider
-static const int WEATHER_Y    = 160;    // Weather description
-static const int TEMP_Y       = 195;    // Temperature value
-static const int WIFI_DOT_X   = 228;    // WiFi indicator position
-static const int WIFI_DOT_Y   = 8;
-static const int WIFI_DOT_R   = 5;
-static const int IP_Y         = 4;      // IP address line
 static const int CENTER_X     = DISPLAY_WIDTH / 2;
 
-// --- Differential rendering state (clock page) ---
-struct PreviousClockState {
-    char time[6];           // "HH:MM\0"
-    char date[32];
-    char weatherDesc[24];
-    float temperature;
-    bool weatherValid;
-    bool wifiConnected;
-    bool showIP;
+// --- Last drawn text bounds, so shorter strings don't leave remnants ---
+struct TextBox {
+    int16_t x, y, w, h;
+};
+
+// --- Differential rendering state (AP, message and OTA screens) ---
+struct PreviousOverlayState {
+    char ssid[33];          // AP screen
     char ip[16];
-    bool initialized;       // False until first full draw
+    char message[48];       // Message screen
+    int  otaFillW;          // OTA progress bar, filled width in pixels
+    int  otaPercent;
 };
 
-// --- Differential rendering state (system info page) ---
-struct PreviousSysInfoState {
-    char fwVersion[16];
-    char wifiStatus[40];
-    char ip[20];
-    char rssi[16];
-    char heap[16];
-    char uptime[24];
-    char ota[16];
-    char mac[20];
+static LGFX lcd;
+static PreviousOverlayState prevOverlay;
+
+// --- Compositor ---
+// Widgets draw into a full-frame RGB565 sprite. Every draw marks its bounds
+// dirty; at the end of a frame the dirty rects are merged and streamed to
+// the panel as a few DMA bursts. If the 115 KB buffer can't be allocated,
+// gfx points straight at the panel and rendering works as before.
+static lgfx::LGFX_Sprite frame(&lcd);
+static lgfx::LovyanGFX*  gfx = &lcd;
+static DirtyRegion       dirty;
+static DisplayFrameStats frameStats;
+
+// --- Screen capture ---
+// One bit per 16x16 tile, set wherever the back buffer changes and
+// cleared as the mirror stream reads tiles. captureLock is held by the
+// render task while it draws and by the main loop while it copies out.
+static const int CAPTURE_TILES_X = DISPLAY_WIDTH / DISPLAY_TILE_SIZE;
+static const int CAPTURE_TILES_Y = DISPLAY_HEIGHT / DISPLAY_TILE_SIZE;
+static_assert(CAPTURE_TILES_X <= 16, "captureDirty rows are 16-bit masks");
+
+static uint16_t          captureDirty[CAPTURE_TILES_Y];
+static SemaphoreHandle_t captureLock = nullptr;
+
+static TextBox boxOTAPct;
+static TextBox boxMessage, boxAPSsid, boxAPUrl;
+
+// --- Clock digit atlas ---
+// Font7 digits and the colon, rasterized once at init into 1-bit palette
+// sprites (~2 KB total). The minute tick blits only the cells whose
+// character changed instead of re-rasterizing the whole "HH:MM" string.
+static const int ATLAS_GLYPHS = 11;     // '0'-'9', ':'
+static const int ATLAS_COLON  = 10;
+
+static lgfx::LGFX_Sprite glyphCells[ATLAS_GLYPHS];
+static bool              atlasReady = false;
+static int               digitW = 0, colonW = 0, glyphH = 0;
+static DisplayClockStats clockStats;
+
+// --- Smooth font ---
+// Optional VLW font on LittleFS. Glyphs come through the vlw_font LRU
+// cache; without the file every label keeps its bitmap font.
+static File             uiFontFile;
+static VlwFont          uiFont;
+static bool             uiFontReady = false;
+static DisplayFontStats fontStats;
+
+// --- Log console ---
+// The console page scrolls with the ST7789's own vertical scrolling.
+// VSCRDEF splits the panel into a fixed header and a scroll area, and
+// VSCSAD picks the GRAM row shown at the top of that area. A new line is
+// written over the row about to scroll off, then the start row moves by
+// one line: each line costs its own pixels plus two short commands. The
+// back buffer keeps the console in screen order so screenshots and
+// mirroring still see what the panel shows.
+static const uint8_t ST7789_VSCRDEF   = 0x33;
+static const uint8_t ST7789_VSCSAD    = 0x37;
+static const int     ST7789_GRAM_ROWS = 320;    // 240x320 controller behind the 240x240 glass
+
+static const int CONSOLE_HEADER_H = 20;         // Fixed area above the scroll area
+static const int CONSOLE_LINE_H   = 10;         // Font0 (8 px) plus spacing
+static const int CONSOLE_CHAR_W   = 6;
+static const int CONSOLE_COLS     = DISPLAY_WIDTH / CONSOLE_CHAR_W;
+
+// --- Performance HUD ---
+// Two Font0 lines in a strip along the bottom. Screens keep their content
+// above HUD_Y; the console shortens its scroll area while the HUD is up.
+static const int HUD_H = 20;
+static const int HUD_Y = DISPLAY_HEIGHT - HUD_H;
+
+static_assert((DISPLAY_HEIGHT - CONSOLE_HEADER_H) % CONSOLE_LINE_H == 0 &&
+              (HUD_Y - CONSOLE_HEADER_H) % CONSOLE_LINE_H == 0,
+              "console rows must not straddle the scroll wrap");
+
+struct PreviousHudState {
+    char loop[CONSOLE_COLS + 1];
+    char mem[CONSOLE_COLS + 1];
     bool initialized;
 };
 
-// --- Page tracking ---
-static DisplayPage currentPage = PAGE_CLOCK_WEATHER;
-static DisplayPage lastRenderedPage = (DisplayPage)-1;  // Force initial clear
+static bool             hudShown = false;       // Render task's view of the toggle
+static PreviousHudState prevHud;
 
-static LGFX lcd;
-static PreviousClockState prevClock;
-static PreviousSysInfoState prevSysInfo;
+struct ConsoleState {
+    uint32_t nextSeq;       // First log line not drawn yet
+    int      areaH;         // Scroll area height (shorter while the HUD is up)
+    int      scroll;        // Scroll area offset in pixels, multiple of CONSOLE_LINE_H
+    char     header[16];    // Line count last drawn
+};
 
-// --- Internal helpers ---
+static ConsoleState        console;
+static std::atomic<bool>   consoleVisible(false);  // Log listener only wakes the task while shown
+static DisplayConsoleStats consoleStats;
+
+// --- Analog clock ---
+// Hands are pre-rendered upright into small sprites, pivot at the hub,
+// and rotated into the back buffer with pushRotateZoom. A tick repaints
+// each box a hand left or entered - clipped to the box - with the dial
+// background, the ticks that cross it and all three hands in z-order,
+// so crossings come out right without keeping a copy of the empty dial.
+// Blending the rotated edges needs the back buffer; without one the page
+// falls back to the digital clock.
+static const uint16_t COL_HAND_KEY      = 0xF81F;   // Transparent in hand sprites
+static const int      ANALOG_RADIUS     = DISPLAY_WIDTH / 2 - 6;  // Dial at full size
+static const int      ANALOG_HAND_COUNT = 3;        // Hour, minute, second (z-order)
+static const int      ANALOG_TICKS      = 60;
+
+static const ClockHand ANALOG_HANDS[ANALOG_HAND_COUNT] = {
+    { 56, 12, 8 },
+    { 86, 14, 6 },
+    { 98, 22, 2 },
+};
+static const uint16_t ANALOG_HAND_COLORS[ANALOG_HAND_COUNT] = { COL_WHITE, COL_WHITE, COL_RED };
+
+struct AnalogTick {
+    float     x0, y0, x1, y1;
+    float     r;            // Half width
+    DirtyRect bounds;
+};
+
+// Dial placement, recomputed on entry: the face shrinks above the HUD
+struct AnalogLayout {
+    int        cx, cy, radius;
+    float      zoom;                            // Hand sprite scale
+    ClockHand  hands[ANALOG_HAND_COUNT];        // Scaled, for bounds
+    AnalogTick ticks[ANALOG_TICKS];
+};
+
+struct PreviousAnalogState {
+    float     angles[ANALOG_HAND_COUNT];
+    DirtyRect bounds[ANALOG_HAND_COUNT];
+    bool      initialized;
+};
+
+static lgfx::LGFX_Sprite   handSprites[ANALOG_HAND_COUNT];
+static bool                analogReady = false;
+static AnalogLayout        analog;
+static PreviousAnalogState prevAnalog;
+static DirtyRegion         analogDamage;        // Boxes to repaint this tick
+static DisplayAnalogStats  analogStats;
+
+// --- Boot splash ---
+// displayShowSplash() puts the saved frame on the panel; displayInit()
+// decodes it into the back buffer as well and frees it. The render task
+// keeps it up (SCREEN_SPLASH) instead of "Waiting for NTP...".
+static bool        panelReady = false;
+static SplashImage splashImage;
+static bool        splashHeld = false;      // Splash on the panel, no live screen yet
+static uint32_t    splashShownMs = 0;
+static bool        firstPixelMarked = false;
+static bool        clockLiveMarked = false;
+
+// --- Photo frame ---
+// The main loop hands photos over through photoRing (see photo.h). The
+// render task decodes the newest into the frame, frees its bytes and
+// keeps only the path, so re-entering the page decodes it again from
+// flash rather than holding the compressed file in RAM.
+struct PreviousPhotoState {
+    bool drawn;                 // shownPhoto (or the hint) is in the frame
+};
+
+static SpscRing<DisplayPhoto, 2> photoRing;
+static DisplayPhoto       shownPhoto;           // Render task; data always null
+static bool               havePhoto = false;
+static PreviousPhotoState prevPhoto;
+static DisplayPhotoStats  photoStats;
+
+// --- Animated GIF ---
+// .gif files in PHOTO_DIR, played in name order. The decoder (~18 KB of
+// LZW tables and buffers) is allocated on page entry and freed on leave.
+// Each frame writes only its own rectangle. Frames are paced by their
+// delays against a running deadline (dueUs += delay), so rounding and
+// wakeup jitter never accumulate into drift.
+struct GifPlayer {
+    GifDecoder* dec;
+    File        file;
+    char        names[DISPLAY_GIF_MAX_FILES][PHOTO_NAME_MAX + 1];
+    int         count;
+    int         index;              // File playing
+    bool        playing;
+    int16_t     ox, oy;             // Logical screen position on the panel
+    int16_t     clipH;              // Rows above the HUD
+    GifFrame    prev;               // Its disposal applies before the next frame
+    bool        havePrev;
+    uint16_t    loopsDone;
+    uint32_t    dueUs;              // When the next frame should be on screen
+    uint32_t    windowStartMs;      // fps window
+    uint32_t    windowShown;
+    uint32_t    windowFrames;
+    uint32_t    windowDelayMs;
+};
+
+static GifPlayer       gif;
+static DisplayGifStats gifStats;
+
+// --- Page layouts ---
+// The clock and system info pages are widget tables compiled into layout
+// ops at init (see layout.h). A JSON file on LittleFS with the same
+// widgets replaces the built-in table; a file that fails to parse or
+// compile is logged and ignored.
+static const LayoutWidget CLOCK_WIDGETS[] = {
+    // kind        binding            font            align                 x    y  size  color          format
+    { LAYOUT_TEXT,  BIND_STA_IP,       LAYOUT_FONT_0,  LAYOUT_ALIGN_LEFT,     4,   4,   0, COL_DARK_GREY, "%s" },
+    { LAYOUT_DOT,   BIND_WIFI,         LAYOUT_FONT_0,  LAYOUT_ALIGN_CENTER, 228,   8,   5, COL_RED,       nullptr },
+    { LAYOUT_CLOCK, BIND_TIME,         LAYOUT_FONT_7,  LAYOUT_ALIGN_CENTER, 120,  55,   0, COL_WHITE,     nullptr },
+    { LAYOUT_TEXT,  BIND_DATE,         LAYOUT_FONT_UI, LAYOUT_ALIGN_CENTER, 120, 110,   0, COL_GREY,      "%s" },
+    { LAYOUT_HLINE, BIND_NONE,         LAYOUT_FONT_0,  LAYOUT_ALIGN_LEFT,    40, 140, 160, COL_DARK_GREY, nullptr },
+    { LAYOUT_TEXT,  BIND_WEATHER,      LAYOUT_FONT_UI, LAYOUT_ALIGN_CENTER, 120, 160,   0, COL_WHITE,     "%s" },
+    { LAYOUT_ICON,  BIND_WEATHER_ICON, LAYOUT_FONT_0,  LAYOUT_ALIGN_LEFT,    40, 171,   0, COL_WHITE,     nullptr },
+    { LAYOUT_TEXT,  BIND_TEMPERATURE,  LAYOUT_FONT_4,  LAYOUT_ALIGN_CENTER, 144, 195,   0, COL_CYAN,      "%s" },
+};
+
+static const LayoutWidget SYSINFO_WIDGETS[] = {
+    { LAYOUT_TEXT,  BIND_FIRMWARE,     LAYOUT_FONT_2,  LAYOUT_ALIGN_LEFT,    10,  10,   0, COL_WHITE,     "FW: %s" },
+    { LAYOUT_TEXT,  BIND_NETWORK,      LAYOUT_FONT_2,  LAYOUT_ALIGN_LEFT,    10,  28,   0, COL_WHITE,     "WiFi: %s" },
+    { LAYOUT_TEXT,  BIND_IP,           LAYOUT_FONT_2,  LAYOUT_ALIGN_LEFT,    10,  46,   0, COL_WHITE,     "IP: %s" },
+    { LAYOUT_TEXT,  BIND_RSSI,         LAYOUT_FONT_2,  LAYOUT_ALIGN_LEFT,    10,  64,   0, COL_WHITE,     "RSSI: %s dBm" },
+    { LAYOUT_TEXT,  BIND_HEAP,         LAYOUT_FONT_2,  LAYOUT_ALIGN_LEFT,    10,  82,   0, COL_WHITE,     "Heap: %s KB" },
+    { LAYOUT_TEXT,  BIND_UPTIME,       LAYOUT_FONT_2,  LAYOUT_ALIGN_LEFT,    10, 100,   0, COL_WHITE,     "Up: %s" },
+    { LAYOUT_TEXT,  BIND_OTA,          LAYOUT_FONT_2,  LAYOUT_ALIGN_LEFT,    10, 118,   0, COL_WHITE,     "OTA: %s" },
+    { LAYOUT_TEXT,  BIND_MAC,          LAYOUT_FONT_2,  LAYOUT_ALIGN_LEFT,    10, 136,   0, COL_WHITE,     "MAC: %s" },
+};
+
+static_assert(WEATHER_ICON_W == 48 && WEATHER_ICON_H == 48, "layout icons are 48x48");
+
+enum LayoutPage : uint8_t {
+    LAYOUT_PAGE_CLOCK = 0,
+    LAYOUT_PAGE_SYSINFO,
+    LAYOUT_PAGE_COUNT
+};
+
+struct PageLayout {
+    const char*         name;
+    const char*         path;           // JSON override on LittleFS
+    const LayoutWidget* builtin;
+    int                 builtinCount;
+    LayoutProgram       program;
+    LayoutState         state;
+};
+
+static PageLayout pageLayouts[LAYOUT_PAGE_COUNT] = {
+    { "clock",   DISPLAY_LAYOUT_DIR "/clock.json",   CLOCK_WIDGETS,
+      (int)(sizeof(CLOCK_WIDGETS) / sizeof(CLOCK_WIDGETS[0])), {}, {} },
+    { "sysinfo", DISPLAY_LAYOUT_DIR "/sysinfo.json", SYSINFO_WIDGETS,
+      (int)(sizeof(SYSINFO_WIDGETS) / sizeof(SYSINFO_WIDGETS[0])), {}, {} },
+};
+static DisplayLayoutStats layoutStats;
+
+// --- Invalidation ---
+static RenderScheduler   sched;
+
+// --- Render task handoff ---
+// The main loop is the only producer, the render task the only consumer.
+
+enum DisplayOverlay : uint8_t {
+    OVERLAY_NONE,
+    OVERLAY_MESSAGE,
+    OVERLAY_OTA
+};
+
+struct DisplaySnapshot {
+    DisplayState   state;
+    DisplayPage    page;
+    DisplayOverlay overlay;
+    int8_t         otaPercent;
+    char           message[48];
+    bool           remote;          // Remote framebuffer active
+    bool           hud;             // Performance HUD on
+    uint32_t       dirty;           // RenderDirty flags raised since the last push
+};
+
+static SpscRing<DisplaySnapshot, DISPLAY_QUEUE_DEPTH> snapshotRing;
+static SpscRing<DisplayTile, DISPLAY_TILE_QUEUE>      tileRing;
+static std::atomic<uint32_t> externalDirty(0);     // displayInvalidate() flags
+static TaskHandle_t          renderTaskHandle = nullptr;
+static DisplayTaskStats      taskStats;
+static DisplayBusStats       busStats;
+static DisplayPerfStats      perfStats;
 
-static bool apRendered = false;
-static bool otaScreenInitialized = false;
+static DisplaySnapshot producerSnap;                // Main loop's view (producer side only)
 
+static void renderTask(void* arg);
+static void onLogLine();
+
+// --- Internal helpers ---
+
+// Forget everything drawn so far. Called on every screen transition,
+// right after the screen is cleared.
 static void clearAllPrevState() {
-    memset(&prevClock, 0, sizeof(prevClock));
-    prevClock.initialized = false;
-    prevClock.temperature = -999.0f;
+    for (int i = 0; i < LAYOUT_PAGE_COUNT; i++) {
+        layoutReset(pageLayouts[i].state);
+    }
 
-    memset(&prevSysInfo, 0, sizeof(prevSysInfo));
-    prevSysInfo.initialized = false;
+    memset(&prevOverlay, 0, sizeof(prevOverlay));
+    prevOverlay.otaPercent = -1;
 
-    apRendered = false;
-    otaScreenInitialized = false;
+    memset(&prevHud, 0, sizeof(prevHud));
+
+    memset(&prevAnalog, 0, sizeof(prevAnalog));
+    prevAnalog.initialized = false;
+
+    prevPhoto.drawn = false;
+
+    memset(&boxOTAPct, 0, sizeof(boxOTAPct));
+    memset(&boxMessage, 0, sizeof(boxMessage));
+    memset(&boxAPSsid, 0, sizeof(boxAPSsid));
+    memset(&boxAPUrl, 0, sizeof(boxAPUrl));
 }
 
-// Draw centered text with background fill to avoid flicker.
-// The datum is set to middle_center so x,y is the center point.
-static void drawCenteredText(int x, int y, const char* text,
-                             const lgfx::IFont* font, float scale,
-                             uint16_t fg, uint16_t bg) {
-    lcd.setFont(font);
-    lcd.setTextSize(scale);
-    lcd.setTextColor(fg, bg);
-    lcd.setTextDatum(lgfx::middle_center);
-    lcd.drawString(text, x, y);
+// --- Compositor helpers ---
+
+static bool usingBackBuffer() {
+    return gfx == &frame;
 }
 
-// --- Boot color test ---
+static void captureMarkAll() {
+    for (int ty = 0; ty < CAPTURE_TILES_Y; ty++) {
+        captureDirty[ty] = (uint16_t)((1u << CAPTURE_TILES_X) - 1);
+    }
+}
 
-static void bootColorTest() {
-    const uint16_t colors[] = { TFT_RED, TFT_GREEN, TFT_BLUE, TFT_WHITE, TFT_BLACK };
-    const char* names[] = { "RED", "GREEN", "BLUE", "WHITE", "BLACK" };
+static void captureMark(int x, int y, int w, int h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > DISPLAY_WIDTH)  w = DISPLAY_WIDTH - x;
+    if (y + h > DISPLAY_HEIGHT) h = DISPLAY_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    int tx0 = x / DISPLAY_TILE_SIZE, tx1 = (x + w - 1) / DISPLAY_TILE_SIZE;
+    int ty0 = y / DISPLAY_TILE_SIZE, ty1 = (y + h - 1) / DISPLAY_TILE_SIZE;
+    uint16_t mask = (uint16_t)(((1u << (tx1 + 1)) - 1) & ~((1u << tx0) - 1));
+    for (int ty = ty0; ty <= ty1; ty++) {
+        captureDirty[ty] |= mask;
+    }
+}
 
-    for (int i = 0; i < 5; i++) {
-        lcd.fillScreen(colors[i]);
-        logPrintf("Display test: %s", names[i]);
-        delay(200);
+static void markDirty(int x, int y, int w, int h) {
+    if (usingBackBuffer()) {
+        dirtyRegionAdd(dirty, x, y, w, h);
+        captureMark(x, y, w, h);
     }
+}
 
-    lcd.fillScreen(COL_BG);
+// Held around every render pass that writes the back buffer
+static void lockFrame() {
+    if (!captureLock) return;
+    uint32_t start = micros();
+    xSemaphoreTake(captureLock, portMAX_DELAY);
+    histogramAdd(perfStats.captureWaitUs, micros() - start);
 }
 
-// --- Public API ---
+static void unlockFrame() {
+    if (captureLock) xSemaphoreGive(captureLock);
+}
 
-void displayInit() {
-    lcd.init();
-    lcd.setRotation(0);
-    lcd.setBrightness(0);  // Start dark, brightness set after boot
-    lcd.fillScreen(COL_BG);
+// Called before drawing into the back buffer. The previous frame's DMA
+// may still be reading it, so wait for the bus to drain first.
+static void beginFrame() {
+    if (usingBackBuffer()) {
+        uint32_t start = micros();
+        lcd.waitDMA();
+        histogramAdd(perfStats.dmaWaitUs, micros() - start);
+    }
+}
 
-    clearAllPrevState();
+// Push all dirty regions of the back buffer to the panel. Each merged rect
+// is one address window; full-width rects are contiguous in the sprite and
+// go out as a single DMA transfer, narrower ones as one DMA per row inside
+// the same window. Returns without waiting for DMA to finish.
+static void flushFrame() {
+    if (!usingBackBuffer() || dirtyRegionIsEmpty(dirty)) return;
 
-    logPrintf("Display initialized (%dx%d ST7789V)", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    dirtyRegionMerge(dirty);
 
-    bootColorTest();
+    const lgfx::swap565_t* buf = (const lgfx::swap565_t*)frame.getBuffer();
+    uint32_t bytes = 0;
 
-    // Set default brightness
-    lcd.setBrightness((BRIGHTNESS_DEFAULT * 255) / 100);
-    logPrintf("Brightness set to %d%%", BRIGHTNESS_DEFAULT);
+    for (int i = 0; i < dirty.count; i++) {
+        const DirtyRect& r = dirty.rects[i];
+        lcd.setAddrWindow(r.x, r.y, r.w, r.h);
+
+        if (r.w == DISPLAY_WIDTH) {
+            lcd.writePixelsDMA(buf + r.y * DISPLAY_WIDTH, r.w * r.h);
+        } else {
+            for (int row = 0; row < r.h; row++) {
+                lcd.writePixelsDMA(buf + (r.y + row) * DISPLAY_WIDTH + r.x, r.w);
+            }
+        }
+        bytes += (uint32_t)r.w * r.h * 2;
+    }
+
+    frameStats.frames++;
+    frameStats.lastBytes         = bytes;
+    frameStats.lastTransactions  = dirty.count;
+    frameStats.totalBytes       += bytes;
+    frameStats.totalTransactions += dirty.count;
+    if (bytes > frameStats.maxBytes) frameStats.maxBytes = bytes;
+
+    dirtyRegionClear(dirty);
 }
 
-void displaySetBrightness(uint8_t brightness) {
-    if (brightness > 100) brightness = 100;
-    uint8_t hw = (brightness * 255) / 100;
-    lcd.setBrightness(hw);
+static void clearScreen(uint16_t color) {
+    gfx->fillScreen(color);
+    if (usingBackBuffer()) {
+        dirtyRegionAddAll(dirty);
+        captureMarkAll();
+    }
 }
 
-LGFX* displayGetLCD() {
-    return &lcd;
+// Draw centered text with background fill to avoid flicker.
+// The datum is set to middle_center so x,y is the center point.
+// If prev is given, the area of the previously drawn string is cleared
+// first so a shorter string doesn't leave old glyphs behind.
+static void drawCenteredText(int x, int y, const char* text,
+                             const lgfx::IFont* font, float scale,
+                             uint16_t fg, uint16_t bg, TextBox* prev = nullptr) {
+    gfx->setFont(font);
+    gfx->setTextSize(scale);
+    gfx->setTextColor(fg, bg);
+    gfx->setTextDatum(lgfx::middle_center);
+
+    int w = gfx->textWidth(text);
+    int h = gfx->fontHeight();
+    int left = x - w / 2;
+    int top  = y - h / 2;
+
+    if (prev && prev->w > 0) {
+        gfx->fillRect(prev->x, prev->y, prev->w, prev->h, bg);
+        markDirty(prev->x, prev->y, prev->w, prev->h);
+    }
+
+    gfx->drawString(text, x, y);
+    markDirty(left - 1, top - 1, w + 2, h + 2);
+
+    if (prev) {
+        *prev = { (int16_t)(left - 1), (int16_t)(top - 1), (int16_t)(w + 2), (int16_t)(h + 2) };
+    }
 }
 
-void displaySetPage(DisplayPage page) {
-    currentPage = page;
+// --- Smooth font text ---
+
+static bool readFontFile(void* ctx, uint32_t offset, uint8_t* dst, uint32_t len) {
+    File* f = (File*)ctx;
+    return f->seek(offset) && f->read(dst, len) == len;
 }
 
-DisplayPage displayGetPage() {
-    return currentPage;
+static bool loadUIFont() {
+    if (!LittleFS.begin(false)) {
+        logPrintf("Display: LittleFS not mounted, using bitmap fonts");
+        return false;
+    }
+    uiFontFile = LittleFS.open(DISPLAY_FONT_PATH, "r");
+    if (!uiFontFile) {
+        logPrintf("Display: %s not found, using bitmap fonts", DISPLAY_FONT_PATH);
+        return false;
+    }
+    if (!vlwOpen(uiFont, readFontFile, &uiFontFile)) {
+        logPrintf("Display: %s is not a valid VLW font", DISPLAY_FONT_PATH);
+        uiFontFile.close();
+        return false;
+    }
+    logPrintf("Display: smooth font %s (%u glyphs, %dpx)",
+              DISPLAY_FONT_PATH, uiFont.glyphCount, vlwLineHeight(uiFont));
+    return true;
+}
+
+// Blend one glyph at (gx, gy). Alpha indexes the pre-blended shades;
+// fully transparent pixels are skipped so overlapping glyphs survive.
+static void blitGlyph(const VlwGlyph& g, int gx, int gy, const uint16_t lut[16]) {
+    for (int row = 0; row < g.height; row++) {
+        int py = gy + row;
+        if (py < 0 || py >= DISPLAY_HEIGHT) continue;
+        const uint8_t* a = g.alpha + row * g.width;
+
+        if (usingBackBuffer()) {
+            uint8_t* dst = (uint8_t*)frame.getBuffer() + py * DISPLAY_WIDTH * 2;
+            for (int col = 0; col < g.width; col++) {
+                int px = gx + col;
+                uint8_t shade = a[col] >> 4;
+                if (shade == 0 || px < 0 || px >= DISPLAY_WIDTH) continue;
+                dst[px * 2]     = (uint8_t)(lut[shade] >> 8);    // Big-endian
+                dst[px * 2 + 1] = (uint8_t)lut[shade];
+            }
+        } else {
+            int x0 = gx < 0 ? 0 : gx;
+            int x1 = gx + g.width > DISPLAY_WIDTH ? DISPLAY_WIDTH : gx + g.width;
+            if (x1 <= x0) return;
+            uint8_t line[DISPLAY_WIDTH * 2];
+            for (int px = x0; px < x1; px++) {
+                uint16_t c = lut[a[px - gx] >> 4];
+                line[(px - x0) * 2]     = (uint8_t)(c >> 8);
+                line[(px - x0) * 2 + 1] = (uint8_t)c;
+            }
+            lcd.setAddrWindow(x0, py, x1 - x0, 1);
+            lcd.writePixels((const lgfx::swap565_t*)line, x1 - x0);
+        }
+    }
 }
 
-// --- Clock screen (differential) ---
+// Same contract as drawCenteredText(), with the smooth font when it is
+// loaded and the given bitmap font otherwise. Text is UTF-8.
+static void drawLabel(int x, int y, const char* text,
+                      const lgfx::IFont* fallback, uint16_t fg, uint16_t bg,
+                      TextBox* prev = nullptr) {
+    if (!uiFontReady) {
+        drawCenteredText(x, y, text, fallback, 1.0f, fg, bg, prev);
+        return;
+    }
+
+    uint32_t start = micros();
 
-static void renderClock(const char* timeStr, const char* dateStr, const WeatherData* weather) {
-    // Full redraw on first call after page entry
-    if (!prevClock.initialized) {
-        prevClock.initialized = true;
+    int w = vlwTextWidth(uiFont, text);
+    int h = vlwLineHeight(uiFont);
+    int left = x - w / 2;
+    int top  = y - h / 2;
 
-        // Draw static divider line
-        lcd.drawFastHLine(40, DIVIDER_Y, DISPLAY_WIDTH - 80, COL_DARK_GREY);
+    if (prev && prev->w > 0) {
+        gfx->fillRect(prev->x, prev->y, prev->w, prev->h, bg);
+        markDirty(prev->x, prev->y, prev->w, prev->h);
     }
+    gfx->fillRect(left - 1, top - 1, w + 2, h + 2, bg);
 
-    // --- Time (large) ---
-    if (strcmp(timeStr, prevClock.time) != 0) {
-        drawCenteredText(CENTER_X, TIME_Y, timeStr,
-                         &fonts::Font7, 1.0f, COL_WHITE, COL_BG);
-        strncpy(prevClock.time, timeStr, sizeof(prevClock.time) - 1);
-        prevClock.time[sizeof(prevClock.time) - 1] = '\0';
+    uint16_t lut[16];
+    vlwBlendLut(fg, bg, lut);
+
+    int penX     = left;
+    int baseline = top + uiFont.ascent;
+    VlwGlyph g;
+    for (const char* p = text; *p; ) {
+        if (vlwGetGlyph(uiFont, vlwNextCodepoint(p), g) && g.alpha) {
+            blitGlyph(g, penX + g.leftExtent, baseline - g.topExtent, lut);
+        }
+        penX += g.xAdvance;
     }
+    markDirty(left - 1, top - 1, w + 2, h + 2);
 
-    // --- Date ---
-    if (strcmp(dateStr, prevClock.date) != 0) {
-        drawCenteredText(CENTER_X, DATE_Y, dateStr,
-                         &fonts::Font2, 1.0f, COL_GREY, COL_BG);
-        strncpy(prevClock.date, dateStr, sizeof(prevClock.date) - 1);
-        prevClock.date[sizeof(prevClock.date) - 1] = '\0';
-    }
-
-    // --- Weather (bottom half) ---
-    if (weather && weather->valid) {
-        // Weather description (derived from icon enum)
-        const char* desc = weatherIconName(weather->icon);
-        if (strcmp(desc, prevClock.weatherDesc) != 0) {
-            drawCenteredText(CENTER_X, WEATHER_Y, desc,
-                             &fonts::Font2, 1.0f, COL_WHITE, COL_BG);
-            strncpy(prevClock.weatherDesc, desc, sizeof(prevClock.weatherDesc) - 1);
-            prevClock.weatherDesc[sizeof(prevClock.weatherDesc) - 1] = '\0';
-        }
-
-        // Temperature (use epsilon to avoid float equality issues)
-        if (fabsf(weather->temperature - prevClock.temperature) > 0.05f) {
-            char tempBuf[16];
-            snprintf(tempBuf, sizeof(tempBuf), "%.0f%s",
-                     weather->temperature,
-                     TEMP_UNIT_FAHRENHEIT ? "F" : "C");
-            drawCenteredText(CENTER_X, TEMP_Y, tempBuf,
-                             &fonts::Font4, 1.0f, COL_CYAN, COL_BG);
-            prevClock.temperature = weather->temperature;
-        }
-
-        prevClock.weatherValid = true;
-
-    } else if (prevClock.weatherValid) {
-        // Weather became invalid or first draw with no weather
-        drawCenteredText(CENTER_X, WEATHER_Y, "No weather data",
-                         &fonts::Font2, 1.0f, COL_DARK_GREY, COL_BG);
-
-        // Clear temperature area (Font4 is ~26px tall, use 30px to be safe)
-        lcd.fillRect(0, TEMP_Y - 15, DISPLAY_WIDTH, 30, COL_BG);
-
-        prevClock.weatherValid = false;
-        prevClock.temperature = -999.0f;
-        memset(prevClock.weatherDesc, 0, sizeof(prevClock.weatherDesc));
-    }
-
-    // --- WiFi status dot (top-right) ---
-    bool wifiUp = (WiFi.status() == WL_CONNECTED);
-    if (wifiUp != prevClock.wifiConnected) {
-        uint16_t dotColor = wifiUp ? COL_GREEN : COL_RED;
-        lcd.fillCircle(WIFI_DOT_X, WIFI_DOT_Y, WIFI_DOT_R, dotColor);
-        prevClock.wifiConnected = wifiUp;
-    }
-
-    // --- IP address (top, small, only when connected) ---
-    if (wifiUp) {
-        String ipStr = WiFi.localIP().toString();
-        if (strcmp(ipStr.c_str(), prevClock.ip) != 0) {
-            // Clear previous IP area
-            lcd.fillRect(0, 0, WIFI_DOT_X - WIFI_DOT_R - 4, 14, COL_BG);
-            lcd.setFont(&fonts::Font0);
-            lcd.setTextSize(1.0f);
-            lcd.setTextColor(COL_DARK_GREY, COL_BG);
-            lcd.setTextDatum(lgfx::top_left);
-            lcd.drawString(ipStr.c_str(), 4, IP_Y);
-            strncpy(prevClock.ip, ipStr.c_str(), sizeof(prevClock.ip) - 1);
-            prevClock.ip[sizeof(prevClock.ip) - 1] = '\0';
-        }
-    } else if (prevClock.ip[0] != '\0') {
-        // WiFi dropped, clear IP
-        lcd.fillRect(0, 0, WIFI_DOT_X - WIFI_DOT_R - 4, 14, COL_BG);
-        prevClock.ip[0] = '\0';
-    }
-}
-
-// --- System info screen (differential) ---
-
-static void renderSystemInfo(const char* fwVersion, bool wifiConnected, bool wifiAP,
-                             const char* ssid, const char* ip, int rssi,
-                             const char* mac, uint32_t freeHeapKB,
-                             unsigned long uptimeSec, bool otaConfirmed) {
-    const int lineHeight = 18;
-    const int startX = 10;
-    int y = 10;
-
-    // Helper: draw a line only if its text changed. Uses two-arg setTextColor
-    // to overwrite old text with background color (no fillScreen needed).
-    auto drawInfoLine = [&](int lineY, const char* newText, char* prevBuf, size_t prevBufSize) {
-        if (strcmp(newText, prevBuf) != 0) {
-            // Set font state for this draw
-            lcd.setFont(&fonts::Font2);
-            lcd.setTextSize(1);
-            lcd.setTextDatum(lgfx::top_left);
-
-            // Erase old text by drawing it in background color
-            if (prevBuf[0] != '\0') {
-                lcd.setTextColor(COL_BG, COL_BG);
-                lcd.drawString(prevBuf, startX, lineY);
-            }
+    if (prev) {
+        *prev = { (int16_t)(left - 1), (int16_t)(top - 1), (int16_t)(w + 2), (int16_t)(h + 2) };
+    }
 
-            // Draw new text
-            lcd.setTextColor(COL_WHITE, COL_BG);
-            lcd.drawString(newText, startX, lineY);
+    fontStats.strings++;
+    histogramAdd(fontStats.stringUs, micros() - start);
+}
 
-            strncpy(prevBuf, newText, prevBufSize - 1);
-            prevBuf[prevBufSize - 1] = '\0';
-        }
-    };
+// --- Clock digit atlas ---
 
-    // Build current strings
-    char fwBuf[sizeof(prevSysInfo.fwVersion)];
-    snprintf(fwBuf, sizeof(fwBuf), "FW: %s", fwVersion);
-    drawInfoLine(y, fwBuf, prevSysInfo.fwVersion, sizeof(prevSysInfo.fwVersion));
-    y += lineHeight;
+static bool buildDigitAtlas() {
+    lcd.setFont(&fonts::Font7);
+    lcd.setTextSize(1.0f);
+    digitW = lcd.textWidth("0");
+    colonW = lcd.textWidth(":");
+    glyphH = lcd.fontHeight();
 
-    char wifiBuf[sizeof(prevSysInfo.wifiStatus)];
-    if (wifiConnected) {
-        snprintf(wifiBuf, sizeof(wifiBuf), "WiFi: %s", ssid);
-    } else if (wifiAP) {
-        snprintf(wifiBuf, sizeof(wifiBuf), "WiFi: AP Mode");
-    } else {
-        snprintf(wifiBuf, sizeof(wifiBuf), "WiFi: Disconnected");
+    for (int i = 0; i < ATLAS_GLYPHS; i++) {
+        lgfx::LGFX_Sprite& cell = glyphCells[i];
+        int w = (i == ATLAS_COLON) ? colonW : digitW;
+
+        cell.setColorDepth(1);
+        if (!cell.createSprite(w, glyphH)) {
+            for (int j = 0; j <= i; j++) glyphCells[j].deleteSprite();
+            return false;
+        }
+        cell.createPalette();
+        cell.setPaletteColor(0, 0, 0, 0);           // COL_BG
+        cell.setPaletteColor(1, 255, 255, 255);     // COL_WHITE
+        cell.fillScreen(0);
+
+        char glyph[2] = { (i == ATLAS_COLON) ? ':' : (char)('0' + i), '\0' };
+        cell.setFont(&fonts::Font7);
+        cell.setTextSize(1.0f);
+        cell.setTextColor(1, 0);
+        cell.setTextDatum(lgfx::top_left);
+        cell.drawString(glyph, 0, 0);
+    }
+    return true;
+}
+
+// True if str is exactly "HH:MM" made of characters the atlas holds.
+static bool isAtlasTime(const char* str) {
+    if (strlen(str) != 5 || str[2] != ':') return false;
+    for (int i = 0; i < 5; i++) {
+        if (i != 2 && (str[i] < '0' || str[i] > '9')) return false;
     }
-    drawInfoLine(y, wifiBuf, prevSysInfo.wifiStatus, sizeof(prevSysInfo.wifiStatus));
-    y += lineHeight;
+    return true;
+}
 
-    char ipBuf[sizeof(prevSysInfo.ip)];
-    snprintf(ipBuf, sizeof(ipBuf), "IP: %s", ip);
-    drawInfoLine(y, ipBuf, prevSysInfo.ip, sizeof(prevSysInfo.ip));
-    y += lineHeight;
+// Blit only the "HH:MM" cells that differ from prevStr, centered on
+// (cx, cy). Cell positions match drawString() with middle_center datum,
+// so both paths line up. Returns the whole string's box.
+static DirtyRect drawClockDigits(int cx, int cy, const char* timeStr, const char* prevStr) {
+    int totalW = digitW * 4 + colonW;
+    int x = cx - totalW / 2;
+    int y = cy - glyphH / 2;
+    DirtyRect box = { (int16_t)x, (int16_t)y, (int16_t)totalW, (int16_t)glyphH };
+    bool prevValid = isAtlasTime(prevStr);
 
-    char rssiBuf[sizeof(prevSysInfo.rssi)];
-    snprintf(rssiBuf, sizeof(rssiBuf), "RSSI: %d dBm", rssi);
-    drawInfoLine(y, rssiBuf, prevSysInfo.rssi, sizeof(prevSysInfo.rssi));
-    y += lineHeight;
+    for (int i = 0; i < 5; i++) {
+        int cellW = (i == 2) ? colonW : digitW;
 
-    char heapBuf[sizeof(prevSysInfo.heap)];
-    snprintf(heapBuf, sizeof(heapBuf), "Heap: %u KB", freeHeapKB);
-    drawInfoLine(y, heapBuf, prevSysInfo.heap, sizeof(prevSysInfo.heap));
-    y += lineHeight;
+        if (!prevValid || timeStr[i] != prevStr[i]) {
+            int idx = (i == 2) ? ATLAS_COLON : (timeStr[i] - '0');
+            glyphCells[idx].pushSprite(gfx, x, y);
+            markDirty(x, y, cellW, glyphH);
 
-    unsigned long hours   = uptimeSec / 3600;
-    unsigned long minutes = (uptimeSec % 3600) / 60;
-    unsigned long secs    = uptimeSec % 60;
-    char uptimeBuf[sizeof(prevSysInfo.uptime)];
-    snprintf(uptimeBuf, sizeof(uptimeBuf), "Up: %luh %lum %lus", hours, minutes, secs);
-    drawInfoLine(y, uptimeBuf, prevSysInfo.uptime, sizeof(prevSysInfo.uptime));
-    y += lineHeight;
+            clockStats.cellBlits++;
+            clockStats.pixelsWritten += (uint32_t)cellW * glyphH;
+        }
+        x += cellW;
+    }
 
-    char otaBuf[sizeof(prevSysInfo.ota)];
-    snprintf(otaBuf, sizeof(otaBuf), "OTA: %s", otaConfirmed ? "Confirmed" : "Pending");
-    drawInfoLine(y, otaBuf, prevSysInfo.ota, sizeof(prevSysInfo.ota));
-    y += lineHeight;
+    // What the full-string path would have written for this update
+    clockStats.fullPathPixels += (uint32_t)totalW * glyphH;
+    clockStats.updates++;
+    return box;
+}
 
-    char macBuf[sizeof(prevSysInfo.mac)];
-    snprintf(macBuf, sizeof(macBuf), "MAC: %s", mac);
-    drawInfoLine(y, macBuf, prevSysInfo.mac, sizeof(prevSysInfo.mac));
+// --- Analog hand sprites ---
+
+// Each hand upright on the key color: a bar with a pointed tip on the wide
+// hands. The pivot sits on the bar's centre line, `length` below the tip.
+static bool buildHandSprites() {
+    for (int i = 0; i < ANALOG_HAND_COUNT; i++) {
+        const ClockHand& hand = ANALOG_HANDS[i];
+        lgfx::LGFX_Sprite& spr = handSprites[i];
+        int h = hand.length + hand.tail;
+
+        spr.setColorDepth(16);
+        spr.setPsram(false);
+        if (!spr.createSprite(hand.width, h)) {
+            for (int j = 0; j <= i; j++) handSprites[j].deleteSprite();
+            return false;
+        }
+        spr.fillScreen(COL_HAND_KEY);
 
-    prevSysInfo.initialized = true;
+        int tip = (hand.width > 2) ? hand.width : 0;
+        spr.fillRect(0, tip, hand.width, h - tip, ANALOG_HAND_COLORS[i]);
+        if (tip) {
+            spr.fillTriangle(0, tip, hand.width - 1, tip, (hand.width - 1) / 2, 0,
+                             ANALOG_HAND_COLORS[i]);
+        }
+        spr.setPivot((hand.width - 1) * 0.5f, (float)hand.length);
+    }
+    return true;
 }
 
-// ============================================================
-// Centralized display update
-// ============================================================
-// All normal display rendering passes through here. This function
-// detects page/mode changes and calls fillScreen ONLY on transitions,
-// then routes to the appropriate page renderer.
-
-void displayUpdate(const char* timeStr, const char* dateStr,
-                   const WeatherData* weather, bool apMode,
-                   const char* apSSID, const char* apIP,
-                   const char* fwVersion, bool wifiConnected,
-                   bool wifiAP, const char* ssid, const char* ip,
-                   int rssi, const char* mac, uint32_t freeHeapKB,
-                   unsigned long uptimeSec, bool otaConfirmed) {
-
-    // AP mode overrides everything. Treat it as a special "page" for
-    // transition detection. The existing render-once logic (apRendered)
-    // is still respected inside displayRenderAPMode.
-    if (apMode) {
-        // Detect transition INTO AP mode
-        if (lastRenderedPage != (DisplayPage)-2) {
-            // -2 is our sentinel for "AP mode active"
-            clearAllPrevState();
-            // apRendered was cleared by clearAllPrevState, so
-            // displayRenderAPMode will do its full draw including fillScreen
-            lastRenderedPage = (DisplayPage)-2;
-        }
-        displayRenderAPMode(apSSID, apIP);
+// --- Weather icons ---
+// Decoded row by row from flash. With the back buffer each row lands
+// directly in the sprite; without it, one row buffer is streamed into
+// the panel's address window.
+
+static void drawWeatherIcon(WeatherIcon icon, int x, int y) {
+    // Rows are written straight into the frame, unclipped. Layouts are
+    // checked when compiled; this keeps a bad caller from writing past it.
+    if (x < 0 || y < 0 || x + WEATHER_ICON_W > DISPLAY_WIDTH || y + WEATHER_ICON_H > DISPLAY_HEIGHT) {
         return;
     }
 
-    lcd.startWrite();
+    if ((int)icon < 0 || (int)icon >= WEATHER_ICON_COUNT) {
+        gfx->fillRect(x, y, WEATHER_ICON_W, WEATHER_ICON_H, COL_BG);
+        markDirty(x, y, WEATHER_ICON_W, WEATHER_ICON_H);
+        return;
+    }
 
-    // Detect page change (including return from AP mode)
-    if (currentPage != lastRenderedPage) {
-        lcd.fillScreen(COL_BG);
-        clearAllPrevState();
-        lastRenderedPage = currentPage;
-        logPrintf("Display: page transition -> %d (screen cleared)", (int)currentPage);
+    Rle565Decoder dec;
+    rle565Begin(dec, WEATHER_ICON_RLE[icon], WEATHER_ICON_RLE_LEN[icon],
+                WEATHER_ICON_W, WEATHER_ICON_H);
+
+    if (usingBackBuffer()) {
+        uint8_t* dst = (uint8_t*)frame.getBuffer() + (y * DISPLAY_WIDTH + x) * 2;
+        while (rle565NextRow(dec, dst)) {
+            dst += DISPLAY_WIDTH * 2;
+        }
+        markDirty(x, y, WEATHER_ICON_W, WEATHER_ICON_H);
+    } else {
+        uint8_t line[WEATHER_ICON_W * 2];
+        lcd.setAddrWindow(x, y, WEATHER_ICON_W, WEATHER_ICON_H);
+        while (rle565NextRow(dec, line)) {
+            lcd.writePixels((const lgfx::swap565_t*)line, WEATHER_ICON_W);
+        }
     }
+}
 
-    switch (currentPage) {
-        case PAGE_CLOCK_WEATHER:
-            if (timeStr && dateStr) {
-                renderClock(timeStr, dateStr, weather);
-            }
-            break;
+// --- Boot color test ---
 
-        case PAGE_SYSTEM_INFO:
-            renderSystemInfo(fwVersion, wifiConnected, wifiAP, ssid, ip,
-                             rssi, mac, freeHeapKB, uptimeSec, otaConfirmed);
-            break;
+static void bootColorTest() {
+    const uint16_t colors[] = { TFT_RED, TFT_GREEN, TFT_BLUE, TFT_WHITE, TFT_BLACK };
+    const char* names[] = { "RED", "GREEN", "BLUE", "WHITE", "BLACK" };
 
-        default:
-            break;
+    for (int i = 0; i < 5; i++) {
+        lcd.fillScreen(colors[i]);
+        logPrintf("Display test: %s", names[i]);
+        delay(200);
     }
 
-    lcd.endWrite();
+    lcd.fillScreen(COL_BG);
 }
 
-// --- AP Mode screen (standalone, render-once) ---
+// --- Boot splash ---
 
-void displayRenderAPMode(const char* ssid, const char* ip) {
-    if (apRendered) return;
-    apRendered = true;
+static void initPanel() {
+    if (panelReady) return;
+    lcd.init();
+    lcd.setRotation(0);
+    lcd.fillScreen(COL_BG);     // Backlight is still dark (backlightInit)
+    panelReady = true;
+}
 
-    lcd.startWrite();
-    lcd.fillScreen(COL_BG);
+// Decode the splash rows into dst, one row at a time. False if malformed.
+static bool decodeSplash(void (*emit)(int y, const uint8_t* row)) {
+    Rle565Decoder dec;
+    rle565Begin(dec, splashImage.data + SPLASH_HEADER_SIZE, splashImage.size - SPLASH_HEADER_SIZE,
+                DISPLAY_WIDTH, DISPLAY_HEIGHT);
 
-    // Title - "SmallTV"
-    drawCenteredText(CENTER_X, 35, "SmallTV",
-                     &fonts::Font4, 1.0f, COL_WHITE, COL_BG);
+    uint8_t row[DISPLAY_WIDTH * 2];
+    int y = 0;
+    while (y < DISPLAY_HEIGHT && rle565NextRow(dec, row)) {
+        emit(y++, row);
+    }
+    return y == DISPLAY_HEIGHT;
+}
 
-    // Firmware version
-    char verBuf[24];
-    snprintf(verBuf, sizeof(verBuf), "v%s", FW_VERSION);
-    drawCenteredText(CENTER_X, 62, verBuf,
-                     &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+static void splashRowToPanel(int y, const uint8_t* row) {
+    lcd.writePixels((const lgfx::swap565_t*)row, DISPLAY_WIDTH);
+}
 
-    // Divider
-    lcd.drawFastHLine(30, 82, DISPLAY_WIDTH - 60, COL_DARK_GREY);
+static void splashRowToFrame(int y, const uint8_t* row) {
+    memcpy((uint8_t*)frame.getBuffer() + y * DISPLAY_WIDTH * 2, row, DISPLAY_WIDTH * 2);
+}
 
-    // "Connect to WiFi:" label
-    drawCenteredText(CENTER_X, 102, "Connect to WiFi:",
-                     &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+// --- Page layouts: drawing backend ---
 
-    // AP SSID name
-    drawCenteredText(CENTER_X, 130, ssid,
-                     &fonts::Font4, 1.0f, COL_CYAN, COL_BG);
+static const lgfx::IFont* layoutFont(LayoutFont font) {
+    switch (font) {
+        case LAYOUT_FONT_0: return &fonts::Font0;
+        case LAYOUT_FONT_4: return &fonts::Font4;
+        case LAYOUT_FONT_7: return &fonts::Font7;
+        default:            return &fonts::Font2;
+    }
+}
 
-    // Divider
-    lcd.drawFastHLine(30, 158, DISPLAY_WIDTH - 60, COL_DARK_GREY);
+static DirtyRect toRect(const TextBox& box) {
+    return { box.x, box.y, box.w, box.h };
+}
 
-    // "Then open:" label
-    drawCenteredText(CENTER_X, 178, "Then open:",
-                     &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+static DirtyRect drawLayoutText(const LayoutOp& op, const LayoutValue& v) {
+    TextBox box = { 0, 0, 0, 0 };
+    if (op.font == LAYOUT_FONT_UI) {
+        drawLabel(op.x, op.y, v.text, &fonts::Font2, v.color, COL_BG, &box);
+        return toRect(box);
+    }
+    if (op.align == LAYOUT_ALIGN_CENTER) {
+        drawCenteredText(op.x, op.y, v.text, layoutFont(op.font), 1.0f, v.color, COL_BG, &box);
+        return toRect(box);
+    }
 
-    // IP address
-    char urlBuf[32];
-    snprintf(urlBuf, sizeof(urlBuf), "http://%s", ip);
-    drawCenteredText(CENTER_X, 206, urlBuf,
-                     &fonts::Font2, 1.0f, COL_CYAN, COL_BG);
+    gfx->setFont(layoutFont(op.font));
+    gfx->setTextSize(1.0f);
+    gfx->setTextDatum(lgfx::top_left);
+    gfx->setTextColor(v.color, COL_BG);
+    gfx->drawString(v.text, op.x, op.y);
+    DirtyRect r = { op.x, op.y, (int16_t)gfx->textWidth(v.text), (int16_t)gfx->fontHeight() };
+    markDirty(r.x, r.y, r.w, r.h);
+    return r;
+}
 
-    lcd.endWrite();
+static DirtyRect layoutDraw(void* arg, const LayoutOp& op, const LayoutValue& v,
+                            const LayoutOpState& prev) {
+    (void)arg;
+    const DirtyRect& box = op.box;
+
+    switch (op.kind) {
+        case LAYOUT_TEXT:
+            return drawLayoutText(op, v);
+
+        case LAYOUT_CLOCK: {
+            const char* prevText = prev.valid && prev.value.visible ? prev.value.text : "";
+            if (atlasReady && isAtlasTime(v.text)) {
+                return drawClockDigits(op.x, op.y, v.text, prevText);
+            }
+            TextBox tb = { prev.drawn.x, prev.drawn.y, prev.drawn.w, prev.drawn.h };
+            drawCenteredText(op.x, op.y, v.text, &fonts::Font7, 1.0f, v.color, COL_BG, &tb);
+            return toRect(tb);
+        }
+
+        case LAYOUT_ICON:
+            drawWeatherIcon((WeatherIcon)atoi(v.text), box.x, box.y);
+            return box;
+
+        case LAYOUT_DOT:
+            gfx->fillCircle(box.x + op.size, box.y + op.size, op.size, v.color);
+            break;
+
+        case LAYOUT_HLINE:
+            gfx->drawFastHLine(box.x, box.y, box.w, v.color);
+            break;
 
-    logPrintf("Rendered AP mode screen (SSID: %s, IP: %s)", ssid, ip);
+        default:
+            return { 0, 0, 0, 0 };
+    }
+    markDirty(box.x, box.y, box.w, box.h);
+    return box;
 }
 
-// --- Full-screen message ---
+static void layoutErase(void* arg, const DirtyRect& box) {
+    (void)arg;
+    gfx->fillRect(box.x, box.y, box.w, box.h, COL_BG);
+    markDirty(box.x, box.y, box.w, box.h);
+}
 
-void displayRenderMessage(const char* msg) {
-    clearAllPrevState();
-    // Force re-clear on next displayUpdate call
-    lastRenderedPage = (DisplayPage)-1;
+// --- Page layouts: loading ---
 
-    lcd.startWrite();
-    lcd.fillScreen(COL_BG);
+// "#RRGGBB" to RGB565
+static bool parseLayoutColor(const char* str, uint16_t& out) {
+    if (!str || str[0] != '#' || strlen(str) != 7) return false;
+    char* end = nullptr;
+    uint32_t rgb = strtoul(str + 1, &end, 16);
+    if (*end != '\0') return false;
+    out = (uint16_t)(((rgb >> 8) & 0xF800) | ((rgb >> 5) & 0x07E0) | ((rgb >> 3) & 0x001F));
+    return true;
+}
 
-    drawCenteredText(CENTER_X, DISPLAY_HEIGHT / 2, msg,
-                     &fonts::Font4, 1.0f, COL_WHITE, COL_BG);
+// {"widgets": [{"kind": "text", "bind": "date", "font": "ui", "x": 120,
+// "y": 110, "align": "center", "color": "#7B7D7B", "format": "%s"}, ...]}
+// Omitted fields default to text / none / Font2 / center / white.
+static bool loadLayoutFile(PageLayout& page) {
+    if (!LittleFS.exists(page.path)) return false;
+
+    File f = LittleFS.open(page.path, "r");
+    if (!f) return false;
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, f);
+    f.close();
+    if (err) {
+        logPrintf("Display: %s: %s", page.path, err.c_str());
+        return false;
+    }
 
-    lcd.endWrite();
+    LayoutWidget widgets[LAYOUT_MAX_OPS];
+    int count = 0;
+    for (JsonObject w : doc["widgets"].as<JsonArray>()) {
+        if (count == LAYOUT_MAX_OPS) {
+            logPrintf("Display: %s: more than %d widgets", page.path, LAYOUT_MAX_OPS);
+            return false;
+        }
+        LayoutWidget& lw = widgets[count];
+        memset(&lw, 0, sizeof(lw));
+        if (!layoutKindFromName(w["kind"] | "text", lw.kind) ||
+            !layoutBindingFromName(w["bind"] | "none", lw.bind) ||
+            !layoutFontFromName(w["font"] | "2", lw.font) ||
+            !layoutAlignFromName(w["align"] | "center", lw.align) ||
+            !parseLayoutColor(w["color"] | "#FFFFFF", lw.color)) {
+            logPrintf("Display: %s: widget %d has an unknown kind, bind, font, align or color",
+                      page.path, count);
+            return false;
+        }
+        lw.x      = w["x"] | 0;
+        lw.y      = w["y"] | 0;
+        lw.size   = w["size"] | 0;
+        lw.format = w["format"] | (const char*)nullptr;
+        count++;
+    }
+
+    // Formats are copied into the ops, so doc may go once this returns
+    const char* compileErr = layoutCompile(widgets, count, page.program);
+    if (compileErr) {
+        logPrintf("Display: %s: %s", page.path, compileErr);
+        return false;
+    }
+    return true;
 }
 
-// --- OTA progress screen ---
+static void loadPageLayouts() {
+    memset(&layoutStats, 0, sizeof(layoutStats));
+    histogramInit(layoutStats.runUs);
+    bool fs = LittleFS.begin(false);
+
+    for (int i = 0; i < LAYOUT_PAGE_COUNT; i++) {
+        PageLayout& page = pageLayouts[i];
+        if (fs && loadLayoutFile(page)) {
+            if (i == LAYOUT_PAGE_CLOCK) layoutStats.clockFromFile = true;
+            else                        layoutStats.sysinfoFromFile = true;
+            logPrintf("Display: %s layout from %s (%d widgets)",
+                      page.name, page.path, page.program.count);
+        } else {
+            // Built-in tables are fixed; a compile error here is a bug
+            const char* err = layoutCompile(page.builtin, page.builtinCount, page.program);
+            if (err) logPrintf("Display: built-in %s layout: %s", page.name, err);
+        }
+        layoutReset(page.state);
+    }
+}
 
-void displayRenderOTAProgress(int percent) {
-    if (percent < 0) percent = 0;
-    if (percent > 100) percent = 100;
+// --- Public API ---
+
+void displayShowSplash() {
+    initPanel();
+    if (!splashLoad(splashImage)) {
+        logPrintf("Display: no boot splash");
+        return;
+    }
 
     lcd.startWrite();
+    lcd.setAddrWindow(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    bool ok = decodeSplash(splashRowToPanel);
+    lcd.endWrite();
 
-    // Only redraw full background on first call (percent == 0)
-    if (!otaScreenInitialized || percent == 0) {
-        clearAllPrevState();
-        // Force re-clear on next displayUpdate call
-        lastRenderedPage = (DisplayPage)-1;
+    if (!ok) {
+        logPrintf("Display: boot splash is corrupt");
         lcd.fillScreen(COL_BG);
+        splashRelease(splashImage);
+        return;
+    }
 
-        drawCenteredText(CENTER_X, 60, "Updating...",
-                         &fonts::Font4, 1.0f, COL_CYAN, COL_BG);
+    splashHeld = true;
+    splashShownMs = millis();
+    firstPixelMarked = true;
+    bootTraceMark("first pixel (splash)");
+}
 
-        drawCenteredText(CENTER_X, 90, "Do not power off",
-                         &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+void displayInit() {
+    initPanel();
+
+    clearAllPrevState();
+    renderSchedInit(sched);
+
+    logPrintf("Display initialized (%dx%d ST7789V)", DISPLAY_WIDTH, DISPLAY_HEIGHT);
 
-        otaScreenInitialized = true;
+    // Skipped under a splash: it would wipe it, and costs a second
+    if (!splashHeld) {
+        bootColorTest();
     }
 
-    // Progress bar dimensions
-    const int barX = 30;
-    const int barY = 130;
-    const int barW = DISPLAY_WIDTH - 60;
-    const int barH = 20;
+    // Back buffer: allocate early, before WiFi fragments the heap.
+    // Must be internal DMA-capable RAM so flushFrame() can stream from it.
+    dirtyRegionInit(dirty, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    memset(&frameStats, 0, sizeof(frameStats));
+    frame.setColorDepth(16);
+    frame.setPsram(false);
+    if (frame.createSprite(DISPLAY_WIDTH, DISPLAY_HEIGHT)) {
+        gfx = &frame;
+        frame.fillScreen(COL_BG);
+        if (splashHeld) decodeSplash(splashRowToFrame);     // Keep it matching the panel
+        frameStats.backBuffer = true;
+        lcd.initDMA();
+        captureLock = xSemaphoreCreateMutex();
+        captureMarkAll();
+        logPrintf("Display: back buffer allocated (%u bytes)",
+                  DISPLAY_WIDTH * DISPLAY_HEIGHT * 2);
+    } else {
+        gfx = &lcd;
+        frameStats.backBuffer = false;
+        logPrintf("Display: back buffer allocation failed, drawing direct to panel");
+    }
+    splashRelease(splashImage);
+
+    memset(&fontStats, 0, sizeof(fontStats));
+    histogramInit(fontStats.stringUs);
+    uiFontReady = loadUIFont();
+    fontStats.loaded = uiFontReady;
+    fontStats.glyphs = uiFontReady ? uiFont.glyphCount : 0;
+
+    memset(&clockStats, 0, sizeof(clockStats));
+    atlasReady = buildDigitAtlas();
+    if (atlasReady) {
+        logPrintf("Display: clock digit atlas ready (%dx%d digits, %dpx colon)",
+                  digitW, glyphH, colonW);
+    } else {
+        logPrintf("Display: clock digit atlas allocation failed, using Font7 text");
+    }
 
-    // Bar outline
-    lcd.drawRect(barX, barY, barW, barH, COL_GREY);
+    loadPageLayouts();
 
-    // Filled portion
-    int fillW = ((barW - 2) * percent) / 100;
-    if (fillW > 0) {
-        lcd.fillRect(barX + 1, barY + 1, fillW, barH - 2, COL_CYAN);
+    memset(&analogStats, 0, sizeof(analogStats));
+    histogramInit(analogStats.tickPixels);
+    histogramInit(analogStats.tickUs);
+    analogReady = usingBackBuffer() && buildHandSprites();
+    if (analogReady) {
+        logPrintf("Display: analog hand sprites ready (%d ms second step)", DISPLAY_ANALOG_STEP_MS);
+    } else {
+        logPrintf("Display: analog clock unavailable, page shows the digital clock");
     }
 
-    // Clear remaining bar interior (in case percent decreased, which shouldn't
-    // happen but keeps things robust)
-    int remainW = (barW - 2) - fillW;
-    if (remainW > 0) {
-        lcd.fillRect(barX + 1 + fillW, barY + 1, remainW, barH - 2, COL_BG);
+    memset(&photoStats, 0, sizeof(photoStats));
+    histogramInit(photoStats.decodeUs);
+    memset(&gifStats, 0, sizeof(gifStats));
+    histogramInit(gifStats.decodeUs);
+
+    // From here on only the render task touches the panel
+    memset(&producerSnap, 0, sizeof(producerSnap));
+    producerSnap.page = PAGE_CLOCK_WEATHER;
+    memset(&taskStats, 0, sizeof(taskStats));
+    memset(&busStats, 0, sizeof(busStats));
+    for (int i = 0; i < PERF_KIND_COUNT; i++) {
+        memset(&perfStats.kinds[i], 0, sizeof(perfStats.kinds[i]));
+        histogramInit(perfStats.kinds[i].renderUs);
+    }
+    histogramInit(perfStats.dmaWaitUs);
+    histogramInit(perfStats.captureWaitUs);
+    memset(&perfStats.transition, 0, sizeof(perfStats.transition));
+    histogramInit(perfStats.transition.frameUs);
+    memset(&consoleStats, 0, sizeof(consoleStats));
+
+    BaseType_t ok = xTaskCreatePinnedToCore(renderTask, "render", DISPLAY_TASK_STACK,
+                                            nullptr, DISPLAY_TASK_PRIORITY,
+                                            &renderTaskHandle, DISPLAY_TASK_CORE);
+    if (ok == pdPASS) {
+        logPrintf("Display: render task started on core %d", DISPLAY_TASK_CORE);
+        logSetListener(onLogLine);
+    } else {
+        renderTaskHandle = nullptr;
+        logPrintf("Display: failed to start render task");
     }
+}
 
-    // Percentage text
-    char pctBuf[8];
-    snprintf(pctBuf, sizeof(pctBuf), "%d%%", percent);
-    drawCenteredText(CENTER_X, barY + barH + 25, pctBuf,
-                     &fonts::Font4, 1.0f, COL_WHITE, COL_BG);
+LGFX* displayGetLCD() {
+    // Callers drawing to the panel directly must not race a pending flush
+    beginFrame();
+    return &lcd;
+}
 
-    lcd.endWrite();
+const DisplayFrameStats& displayGetFrameStats() {
+    return frameStats;
+}
 
-    // Reset flag when complete so next OTA starts fresh
-    if (percent >= 100) {
-        otaScreenInitialized = false;
-    }
+const DisplayClockStats& displayGetClockStats() {
+    return clockStats;
+}
+
+const DisplayTaskStats& displayGetTaskStats() {
+    return taskStats;
+}
+
+const DisplayBusStats& displayGetBusStats() {
+    return busStats;
+}
+
+const DisplayPerfStats& displayGetPerfStats() {
+    return perfStats;
+}
+
+const DisplayFontStats& displayGetFontStats() {
+    return fontStats;
+}
+
+const DisplayConsoleStats& displayGetConsoleStats() {
+    return consoleStats;
+}
+
+const DisplayAnalogStats& displayGetAnalogStats() {
+    return analogStats;
+}
+
+const DisplayPhotoStats& displayGetPhotoStats() {
+    return photoStats;
+}
+
+const DisplayGifStats& displayGetGifStats() {
+    return gifStats;
+}
+
+const DisplayLayoutStats& displayGetLayoutStats() {
+    return layoutStats;
+}
+
+const char* displayPerfKindName(DisplayPerfKind kind) {
+    switch (kind) {
+        case PERF_CLOCK:   return "clock";
+        case PERF_SYSINFO: return "sysinfo";
+        case PERF_AP:      return "ap";
+        case PERF_MESSAGE: return "message";
+        case PERF_OTA:     return "ota";
+        case PERF_REMOTE:  return "remote";
+        case PERF_CONSOLE: return "console";
+        case PERF_ANALOG:  return "analog";
+        case PERF_PHOTO:   return "photo";
+        case PERF_GIF:     return "gif";
+        default:           return "unknown";
+    }
+}
+
+const RenderSchedulerStats& displayGetSchedulerStats() {
+    return sched.stats;
+}
+
+// ============================================================
+// Screen state machine (render task)
+// ============================================================
+// Every full-screen view - the pages, the AP screen, messages and OTA
+// progress - is a screen. Exactly one is current. Switching screens is
+// the only place the panel is cleared; after that, enter() draws the
+// static parts once and update() redraws only what changed since the
+// last pass, so re-rendering an unchanged screen sends nothing.
+
+enum ScreenId : uint8_t {
+    SCREEN_NONE = 0,        // Nothing drawn yet (forces the first clear)
+    SCREEN_CLOCK,
+    SCREEN_SYSINFO,
+    SCREEN_AP,
+    SCREEN_MESSAGE,
+    SCREEN_OTA,
+    SCREEN_REMOTE,
+    SCREEN_CONSOLE,
+    SCREEN_ANALOG,
+    SCREEN_PHOTO,
+    SCREEN_GIF,
+    SCREEN_SPLASH,          // Boot splash, until the clock has live time
+    SCREEN_COUNT
+};
+
+// Everything a screen needs for one pass, resolved once per pass
+struct RenderContext {
+    const DisplaySnapshot* snap;
+    ScreenId    screen;
+    uint32_t    dirty;          // RenderDirty flags that triggered this pass
+    const char* message;        // SCREEN_MESSAGE text
+    char        time[8];        // "HH:MM", valid on SCREEN_CLOCK
+    char        date[16];
+    int8_t      hour;           // Local time, valid on SCREEN_ANALOG
+    int8_t      minute;
+    int8_t      second;
+    int16_t     millis;
+};
+
+struct ScreenOps {
+    const char* name;
+    void (*enter)(const RenderContext& ctx);    // Static parts, screen already cleared
+    void (*update)(const RenderContext& ctx);   // Differential redraw
+    void (*leave)();                            // Undo panel state the screen changed
+};
+
+static ScreenId currentScreen = SCREEN_NONE;
+
+// Wall clock for everything the render task shows. Capture builds read a
+// clock the host test sets, so the goldens don't depend on when they ran.
+#ifdef BUS_TRACE_CAPTURE
+static int64_t traceClockMs = 0;
+
+static void readWallClock(struct timeval& tv) {
+    tv.tv_sec  = (time_t)(traceClockMs / 1000);
+    tv.tv_usec = (suseconds_t)(traceClockMs % 1000) * 1000;
+}
+#else
+static void readWallClock(struct timeval& tv) {
+    gettimeofday(&tv, nullptr);
+}
+#endif
+
+// Local time as "HH:MM" and "Mon Feb 10". False until NTP has synced.
+// Reads the RTC directly (non-blocking) so it works on the render task.
+static bool formatLocalTime(char* timeBuf, size_t timeBufLen,
+                            char* dateBuf, size_t dateBufLen) {
+    struct timeval tv;
+    readWallClock(tv);
+    time_t now = tv.tv_sec;
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    if (timeinfo.tm_year < (2016 - 1900)) {
+        return false;
+    }
+
+    strftime(timeBuf, timeBufLen, "%H:%M", &timeinfo);
+    strftime(dateBuf, dateBufLen, "%a %b %d", &timeinfo);
+    return true;
+}
+
+// Local time down to the millisecond for the analog hands. False until
+// NTP has synced.
+static bool readLocalClock(RenderContext& ctx) {
+    struct timeval tv;
+    readWallClock(tv);
+    time_t now = tv.tv_sec;
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    if (timeinfo.tm_year < (2016 - 1900)) {
+        return false;
+    }
+
+    ctx.hour   = (int8_t)timeinfo.tm_hour;
+    ctx.minute = (int8_t)timeinfo.tm_min;
+    ctx.second = (int8_t)timeinfo.tm_sec;
+    ctx.millis = (int16_t)(tv.tv_usec / 1000);
+    return true;
+}
+
+static bool wantsRemoteScreen(const DisplaySnapshot& snap) {
+    return snap.remote && snap.overlay == OVERLAY_NONE;
+}
+
+// Decide which screen this snapshot shows. Overlays win over the remote
+// framebuffer, which wins over AP mode, which wins over the pages. The
+// log console is the exception: it stays reachable in AP mode, where
+// there may be no other way to see what went wrong.
+static void resolveScreen(const DisplaySnapshot& snap, RenderContext& ctx) {
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.snap = &snap;
+
+    if (wantsRemoteScreen(snap)) {
+        ctx.screen = SCREEN_REMOTE;
+    } else if (snap.overlay == OVERLAY_OTA) {
+        ctx.screen = SCREEN_OTA;
+    } else if (snap.overlay == OVERLAY_MESSAGE) {
+        ctx.screen  = SCREEN_MESSAGE;
+        ctx.message = snap.message;
+    } else if (snap.page == PAGE_LOG) {
+        ctx.screen = SCREEN_CONSOLE;
+    } else if (snap.state.apMode) {
+        ctx.screen = SCREEN_AP;
+    } else if (snap.page == PAGE_SYSTEM_INFO) {
+        ctx.screen = SCREEN_SYSINFO;
+    } else if (snap.page == PAGE_PHOTO) {
+        ctx.screen = SCREEN_PHOTO;
+    } else if (snap.page == PAGE_GIF) {
+        ctx.screen = SCREEN_GIF;
+    } else if (snap.page == PAGE_ANALOG_CLOCK && analogReady && readLocalClock(ctx)) {
+        ctx.screen = SCREEN_ANALOG;
+    } else if (formatLocalTime(ctx.time, sizeof(ctx.time), ctx.date, sizeof(ctx.date))) {
+        ctx.screen = SCREEN_CLOCK;
+    } else if (splashHeld && millis() - splashShownMs < DISPLAY_SPLASH_HOLD_MS) {
+        ctx.screen = SCREEN_SPLASH;     // Last clock frame beats "Waiting for NTP..."
+    } else {
+        // Clock pages before NTP sync
+        ctx.screen  = SCREEN_MESSAGE;
+        ctx.message = "Waiting for NTP...";
+    }
+}
+
+// --- Clock and system info pages (layout engine) ---
+
+// Raw value of a binding; the op's format is applied by the engine
+static void layoutValue(void* arg, LayoutBinding bind, LayoutValue& v) {
+    const RenderContext& ctx = *(const RenderContext*)arg;
+    const DisplayState&  s   = ctx.snap->state;
+    const size_t         len = sizeof(v.text);
+
+    switch (bind) {
+        case BIND_TIME:
+            snprintf(v.text, len, "%s", ctx.time);
+            break;
+        case BIND_DATE:
+            snprintf(v.text, len, "%s", ctx.date);
+            break;
+        case BIND_WEATHER:
+            if (s.weather.valid) {
+                snprintf(v.text, len, "%s", weatherIconName(s.weather.icon));
+            } else {
+                snprintf(v.text, len, "No weather data");
+                v.color = COL_DARK_GREY;
+            }
+            break;
+        case BIND_WEATHER_ICON:
+            v.visible = s.weather.valid;
+            snprintf(v.text, len, "%d", (int)s.weather.icon);
+            break;
+        case BIND_TEMPERATURE:
+            v.visible = s.weather.valid;
+            snprintf(v.text, len, "%.0f%s", s.weather.temperature, TEMP_UNIT_FAHRENHEIT ? "F" : "C");
+            break;
+        case BIND_WIFI:
+            snprintf(v.text, len, "%s", s.wifiConnected ? "up" : "down");
+            v.color = s.wifiConnected ? COL_GREEN : COL_RED;
+            break;
+        case BIND_STA_IP:
+            v.visible = s.wifiConnected;
+            snprintf(v.text, len, "%s", s.ip);
+            break;
+        case BIND_IP:
+            snprintf(v.text, len, "%s", s.ip);
+            break;
+        case BIND_FIRMWARE:
+            snprintf(v.text, len, "%s", FW_VERSION);
+            break;
+        case BIND_NETWORK:
+            snprintf(v.text, len, "%s", s.wifiConnected ? s.ssid : s.apMode ? "AP Mode" : "Disconnected");
+            break;
+        case BIND_RSSI:
+            snprintf(v.text, len, "%d", s.rssi);
+            break;
+        case BIND_HEAP:
+            snprintf(v.text, len, "%lu", (unsigned long)s.freeHeapKB);
+            break;
+        case BIND_UPTIME: {
+            unsigned long up = millis() / 1000;
+            snprintf(v.text, len, "%luh %lum %lus", up / 3600, (up % 3600) / 60, up % 60);
+            break;
+        }
+        case BIND_OTA:
+            snprintf(v.text, len, "%s", s.otaConfirmed ? "Confirmed" : "Pending");
+            break;
+        case BIND_MAC:
+            snprintf(v.text, len, "%s", s.mac);
+            break;
+        default:
+            break;
+    }
+}
+
+static void runPageLayout(PageLayout& page, const RenderContext& ctx) {
+    LayoutBackend backend = { (void*)&ctx, layoutValue, layoutDraw, layoutErase };
+    LayoutRunStats run;
+
+    uint32_t start = micros();
+    layoutRun(page.program, page.state, ctx.dirty, backend, &run);
+    histogramAdd(layoutStats.runUs, micros() - start);
+
+    layoutStats.runs++;
+    layoutStats.opsSkipped   += run.skipped;
+    layoutStats.opsEvaluated += run.evaluated;
+    layoutStats.opsDrawn     += run.drawn;
+    layoutStats.opsErased    += run.erased;
+}
+
+static void updateClockScreen(const RenderContext& ctx) {
+    runPageLayout(pageLayouts[LAYOUT_PAGE_CLOCK], ctx);
+}
+
+static void updateSysInfoScreen(const RenderContext& ctx) {
+    runPageLayout(pageLayouts[LAYOUT_PAGE_SYSINFO], ctx);
+}
+
+// --- Analog clock screen ---
+
+static bool rectsOverlap(const DirtyRect& a, const DirtyRect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w &&
+           a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static void layoutAnalog(bool hud) {
+    int areaH = hud ? HUD_Y : DISPLAY_HEIGHT;
+    analog.cx     = CENTER_X;
+    analog.cy     = areaH / 2;
+    analog.radius = areaH / 2 - 6;
+    analog.zoom   = (float)analog.radius / ANALOG_RADIUS;
+
+    for (int i = 0; i < ANALOG_HAND_COUNT; i++) {
+        analog.hands[i].length = (int16_t)ceilf(ANALOG_HANDS[i].length * analog.zoom);
+        analog.hands[i].tail   = (int16_t)ceilf(ANALOG_HANDS[i].tail * analog.zoom);
+        analog.hands[i].width  = (int16_t)ceilf(ANALOG_HANDS[i].width * analog.zoom);
+    }
+
+    // Minute ticks, longer and wider every five
+    for (int i = 0; i < ANALOG_TICKS; i++) {
+        AnalogTick& t = analog.ticks[i];
+        bool  major = (i % 5) == 0;
+        float a  = i * 6.0f * (float)DEG_TO_RAD;
+        float r0 = analog.radius - (major ? 12.0f : 5.0f) * analog.zoom;
+        float r1 = (float)analog.radius;
+        t.x0 = analog.cx + r0 * sinf(a);
+        t.y0 = analog.cy - r0 * cosf(a);
+        t.x1 = analog.cx + r1 * sinf(a);
+        t.y1 = analog.cy - r1 * cosf(a);
+        t.r  = major ? 1.5f : 0.5f;
+
+        int x0 = (int)floorf(fminf(t.x0, t.x1)) - 2, x1 = (int)ceilf(fmaxf(t.x0, t.x1)) + 2;
+        int y0 = (int)floorf(fminf(t.y0, t.y1)) - 2, y1 = (int)ceilf(fmaxf(t.y0, t.y1)) + 2;
+        t.bounds = { (int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0 + 1), (int16_t)(y1 - y0 + 1) };
+    }
+
+    // Repaints stay above the HUD
+    dirtyRegionInit(analogDamage, DISPLAY_WIDTH, areaH);
+}
+
+// Repaint one box from scratch: background, ticks, hands, hub. Drawing is
+// clipped to the box, so nothing outside it changes.
+static void drawAnalogRegion(const DirtyRect& r) {
+    gfx->setClipRect(r.x, r.y, r.w, r.h);
+    gfx->fillRect(r.x, r.y, r.w, r.h, COL_BG);
+
+    for (int i = 0; i < ANALOG_TICKS; i++) {
+        const AnalogTick& t = analog.ticks[i];
+        if (!rectsOverlap(t.bounds, r)) continue;
+        gfx->drawWideLine(t.x0, t.y0, t.x1, t.y1, t.r, (i % 5) ? COL_GREY : COL_WHITE);
+    }
+
+    for (int i = 0; i < ANALOG_HAND_COUNT; i++) {
+        if (!rectsOverlap(prevAnalog.bounds[i], r)) continue;
+        handSprites[i].pushRotateZoomWithAA(gfx, analog.cx, analog.cy, prevAnalog.angles[i],
+                                            analog.zoom, analog.zoom, COL_HAND_KEY);
+    }
+    gfx->fillSmoothCircle(analog.cx, analog.cy, 4, COL_RED);
+
+    gfx->clearClipRect();
+    markDirty(r.x, r.y, r.w, r.h);
+}
+
+// Hands that moved add their old and new boxes; the merged boxes are
+// repainted. The first pass after a clear paints the whole face.
+static void updateAnalogScreen(const RenderContext& ctx) {
+    uint32_t startUs = micros();
+
+    ClockAngles a;
+    clockFaceAngles(ctx.hour, ctx.minute, ctx.second, ctx.millis, DISPLAY_ANALOG_STEP_MS, a);
+    const float angles[ANALOG_HAND_COUNT] = { a.hour, a.minute, a.second };
+
+    bool fullFace = !prevAnalog.initialized;
+    if (fullFace) {
+        layoutAnalog(hudShown);
+    }
+    dirtyRegionClear(analogDamage);
+
+    for (int i = 0; i < ANALOG_HAND_COUNT; i++) {
+        if (!fullFace && angles[i] == prevAnalog.angles[i]) continue;
+
+        DirtyRect box = clockHandBounds(analog.hands[i], angles[i], analog.cx, analog.cy);
+        if (!fullFace) {
+            const DirtyRect& old = prevAnalog.bounds[i];
+            dirtyRegionAdd(analogDamage, old.x, old.y, old.w, old.h);
+            dirtyRegionAdd(analogDamage, box.x, box.y, box.w, box.h);
+        }
+        prevAnalog.angles[i] = angles[i];
+        prevAnalog.bounds[i] = box;
+    }
+    prevAnalog.initialized = true;
+
+    if (fullFace) dirtyRegionAddAll(analogDamage);
+    if (dirtyRegionIsEmpty(analogDamage)) return;
+    dirtyRegionMerge(analogDamage);
+
+    uint32_t pixels = dirtyRegionArea(analogDamage);
+    for (int i = 0; i < analogDamage.count; i++) {
+        drawAnalogRegion(analogDamage.rects[i]);
+    }
+
+    if (fullFace) {
+        analogStats.faces++;
+        return;
+    }
+    uint32_t elapsedUs = micros() - startUs;
+    analogStats.ticks++;
+    analogStats.lastPixels   = pixels;
+    analogStats.lastRects    = (uint16_t)analogDamage.count;
+    analogStats.totalPixels += pixels;
+    histogramAdd(analogStats.tickPixels, pixels);
+    histogramAdd(analogStats.tickUs, elapsedUs);
+}
+
+// --- AP Mode screen ---
+
+static void enterAPScreen(const RenderContext& ctx) {
+    // Title - "SmallTV"
+    drawCenteredText(CENTER_X, 35, "SmallTV",
+                     &fonts::Font4, 1.0f, COL_WHITE, COL_BG);
+
+    // Firmware version
+    char verBuf[24];
+    snprintf(verBuf, sizeof(verBuf), "v%s", FW_VERSION);
+    drawCenteredText(CENTER_X, 62, verBuf,
+                     &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+
+    // Divider
+    gfx->drawFastHLine(30, 82, DISPLAY_WIDTH - 60, COL_DARK_GREY);
+
+    // "Connect to WiFi:" label
+    drawCenteredText(CENTER_X, 102, "Connect to WiFi:",
+                     &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+
+    // Divider
+    gfx->drawFastHLine(30, 158, DISPLAY_WIDTH - 60, COL_DARK_GREY);
+
+    // "Then open:" label
+    drawCenteredText(CENTER_X, 178, "Then open:",
+                     &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+}
+
+static void updateAPScreen(const RenderContext& ctx) {
+    const DisplayState& s = ctx.snap->state;
+
+    // AP SSID name
+    if (strcmp(s.ssid, prevOverlay.ssid) != 0) {
+        drawCenteredText(CENTER_X, 130, s.ssid,
+                         &fonts::Font4, 1.0f, COL_CYAN, COL_BG, &boxAPSsid);
+        strncpy(prevOverlay.ssid, s.ssid, sizeof(prevOverlay.ssid) - 1);
+    }
+
+    // IP address
+    if (strcmp(s.ip, prevOverlay.ip) != 0) {
+        char urlBuf[32];
+        snprintf(urlBuf, sizeof(urlBuf), "http://%s", s.ip);
+        drawCenteredText(CENTER_X, 206, urlBuf,
+                         &fonts::Font2, 1.0f, COL_CYAN, COL_BG, &boxAPUrl);
+        strncpy(prevOverlay.ip, s.ip, sizeof(prevOverlay.ip) - 1);
+
+        logPrintf("Rendered AP mode screen (SSID: %s, IP: %s)", s.ssid, s.ip);
+    }
+}
+
+// --- Full-screen message ---
+
+static void updateMessageScreen(const RenderContext& ctx) {
+    if (strcmp(ctx.message, prevOverlay.message) == 0) return;
+
+    drawCenteredText(CENTER_X, DISPLAY_HEIGHT / 2, ctx.message,
+                     &fonts::Font4, 1.0f, COL_WHITE, COL_BG, &boxMessage);
+    strncpy(prevOverlay.message, ctx.message, sizeof(prevOverlay.message) - 1);
+}
+
+// --- OTA progress screen ---
+
+static const int OTA_BAR_X = 30;
+static const int OTA_BAR_Y = 130;
+static const int OTA_BAR_W = DISPLAY_WIDTH - 60;
+static const int OTA_BAR_H = 20;
+
+static void enterOTAScreen(const RenderContext& ctx) {
+    drawCenteredText(CENTER_X, 60, "Updating...",
+                     &fonts::Font4, 1.0f, COL_CYAN, COL_BG);
+
+    drawCenteredText(CENTER_X, 90, "Do not power off",
+                     &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+
+    // Bar outline
+    gfx->drawRect(OTA_BAR_X, OTA_BAR_Y, OTA_BAR_W, OTA_BAR_H, COL_GREY);
+}
+
+static void updateOTAScreen(const RenderContext& ctx) {
+    int percent = ctx.snap->otaPercent;
+    if (percent == prevOverlay.otaPercent) return;
+
+    // Only the columns between the old and new fill width change
+    const int innerW = OTA_BAR_W - 2;
+    int fillW = (innerW * percent) / 100;
+    int prevW = prevOverlay.otaFillW;
+
+    if (fillW > prevW) {
+        gfx->fillRect(OTA_BAR_X + 1 + prevW, OTA_BAR_Y + 1, fillW - prevW, OTA_BAR_H - 2, COL_CYAN);
+        markDirty(OTA_BAR_X + 1 + prevW, OTA_BAR_Y + 1, fillW - prevW, OTA_BAR_H - 2);
+    } else if (fillW < prevW) {
+        // Percent went backwards (restarted upload)
+        gfx->fillRect(OTA_BAR_X + 1 + fillW, OTA_BAR_Y + 1, prevW - fillW, OTA_BAR_H - 2, COL_BG);
+        markDirty(OTA_BAR_X + 1 + fillW, OTA_BAR_Y + 1, prevW - fillW, OTA_BAR_H - 2);
+    }
+    prevOverlay.otaFillW = fillW;
+
+    // Percentage text
+    char pctBuf[8];
+    snprintf(pctBuf, sizeof(pctBuf), "%d%%", percent);
+    drawCenteredText(CENTER_X, OTA_BAR_Y + OTA_BAR_H + 25, pctBuf,
+                     &fonts::Font4, 1.0f, COL_WHITE, COL_BG, &boxOTAPct);
+    prevOverlay.otaPercent = percent;
+}
+
+// --- Log console screen ---
+
+static void consoleSendScroll() {
+    lcd.waitDMA();      // Rows for the new position must land first
+    lcd.writeCommand(ST7789_VSCSAD);
+    lcd.writeData16(CONSOLE_HEADER_H + console.scroll);
+}
+
+// on = header plus scroll area, off = the controller's reset layout
+static void consoleDefineScrollArea(bool on) {
+    lcd.waitDMA();
+    lcd.writeCommand(ST7789_VSCRDEF);
+    lcd.writeData16(on ? CONSOLE_HEADER_H : 0);
+    lcd.writeData16(on ? console.areaH : ST7789_GRAM_ROWS);
+    lcd.writeData16(on ? ST7789_GRAM_ROWS - CONSOLE_HEADER_H - console.areaH : 0);
+    lcd.writeCommand(ST7789_VSCSAD);
+    lcd.writeData16(on ? CONSOLE_HEADER_H : 0);
+    console.scroll = 0;
+}
+
+// Panel GRAM row holding screen row y of the scroll area
+static int consoleGramRow(int y) {
+    return CONSOLE_HEADER_H + (y - CONSOLE_HEADER_H + console.scroll) % console.areaH;
+}
+
+// Console rows a log line wraps to
+static int consoleRowCount(const char* line) {
+    int len = strlen(line);
+    return len == 0 ? 1 : (len + CONSOLE_COLS - 1) / CONSOLE_COLS;
+}
+
+// Draw row `row` of a wrapped log line at y of dst. The "[  12345]"
+// timestamp on the first row is grey.
+static void consoleDrawRow(lgfx::LovyanGFX* dst, int y, const char* line, int row) {
+    char text[CONSOLE_COLS + 1];
+    int len = strlen(line);
+    int start = row * CONSOLE_COLS;
+    int n = (len - start > CONSOLE_COLS) ? CONSOLE_COLS : (len > start ? len - start : 0);
+    memcpy(text, line + start, n);
+    text[n] = '\0';
+
+    dst->fillRect(0, y, DISPLAY_WIDTH, CONSOLE_LINE_H, COL_BG);
+    dst->setFont(&fonts::Font0);
+    dst->setTextSize(1);
+    dst->setTextDatum(lgfx::top_left);
+
+    int x = 0;
+    const char* close = (row == 0 && text[0] == '[') ? strchr(text, ']') : nullptr;
+    if (close) {
+        char stamp[CONSOLE_COLS + 1];
+        int stampLen = close - text + 1;
+        memcpy(stamp, text, stampLen);
+        stamp[stampLen] = '\0';
+        dst->setTextColor(COL_GREY, COL_BG);
+        dst->drawString(stamp, 0, y + 1);
+        x = stampLen * CONSOLE_CHAR_W;
+    }
+    dst->setTextColor(COL_WHITE, COL_BG);
+    dst->drawString(close ? close + 1 : text, x, y + 1);
+}
+
+// Screen row y after the scroll: draw into the back buffer in screen
+// order and send it to the GRAM rows now mapped there
+static void consoleWriteRow(int y, const char* line, int row) {
+    int gramY = consoleGramRow(y);
+    if (usingBackBuffer()) {
+        const lgfx::swap565_t* buf = (const lgfx::swap565_t*)frame.getBuffer();
+        consoleDrawRow(&frame, y, line, row);
+        lcd.setAddrWindow(0, gramY, DISPLAY_WIDTH, CONSOLE_LINE_H);
+        lcd.writePixelsDMA(buf + y * DISPLAY_WIDTH, DISPLAY_WIDTH * CONSOLE_LINE_H);
+    } else {
+        consoleDrawRow(&lcd, gramY, line, row);
+    }
+}
+
+// Repaint the scroll area with the newest lines, bottom up
+static void consoleRedraw() {
+    if (console.scroll != 0) {
+        console.scroll = 0;
+        consoleSendScroll();
+    }
+    gfx->fillRect(0, CONSOLE_HEADER_H, DISPLAY_WIDTH, console.areaH, COL_BG);
+
+    uint32_t end = logSequence();
+    char line[LOG_LINE_LENGTH];
+    int y = CONSOLE_HEADER_H + console.areaH;
+    for (uint32_t seq = end; seq > 0 && y > CONSOLE_HEADER_H; seq--) {
+        if (!logGetLine(seq - 1, line, sizeof(line))) break;
+        int rows = consoleRowCount(line);
+        y -= rows * CONSOLE_LINE_H;
+        for (int r = 0; r < rows; r++) {
+            int ry = y + r * CONSOLE_LINE_H;
+            if (ry >= CONSOLE_HEADER_H) consoleDrawRow(gfx, ry, line, r);
+        }
+    }
+    markDirty(0, CONSOLE_HEADER_H, DISPLAY_WIDTH, console.areaH);
+
+    console.nextSeq = end;
+    consoleStats.redraws++;
+}
+
+// Scroll in the lines logged since the last pass. A burst that would
+// scroll the whole area is one redraw instead.
+static void consoleAppend() {
+    uint32_t end = logSequence();
+    if (console.nextSeq == end) return;
+
+    uint32_t oldest = (end > LOG_BUFFER_SIZE) ? end - LOG_BUFFER_SIZE : 0;
+    if (console.nextSeq < oldest) {
+        consoleStats.dropped += oldest - console.nextSeq;
+        console.nextSeq = oldest;
+    }
+
+    char line[LOG_LINE_LENGTH];
+    int newRows = 0;
+    for (uint32_t seq = console.nextSeq; seq < end; seq++) {
+        newRows += logGetLine(seq, line, sizeof(line)) ? consoleRowCount(line) : 1;
+    }
+    if (newRows >= console.areaH / CONSOLE_LINE_H) {
+        consoleStats.lines += end - console.nextSeq;
+        consoleRedraw();
+        return;
+    }
+
+    const int shift = newRows * CONSOLE_LINE_H;
+    console.scroll = (console.scroll + shift) % console.areaH;
+
+    // Back buffer: move the area up in screen order
+    if (usingBackBuffer()) {
+        uint8_t* buf = (uint8_t*)frame.getBuffer();
+        memmove(buf + CONSOLE_HEADER_H * DISPLAY_WIDTH * 2,
+                buf + (CONSOLE_HEADER_H + shift) * DISPLAY_WIDTH * 2,
+                (console.areaH - shift) * DISPLAY_WIDTH * 2);
+        captureMark(0, CONSOLE_HEADER_H, DISPLAY_WIDTH, console.areaH);
+    }
+
+    // New rows go over the GRAM rows that scroll off the top
+    const int bottom = CONSOLE_HEADER_H + console.areaH;
+    int y = bottom - shift;
+    for (uint32_t seq = console.nextSeq; seq < end; seq++) {
+        if (!logGetLine(seq, line, sizeof(line))) line[0] = '\0';    // Overwritten meanwhile
+        int rows = consoleRowCount(line);
+        for (int r = 0; r < rows && y < bottom; r++, y += CONSOLE_LINE_H) {
+            consoleWriteRow(y, line, r);
+        }
+        consoleStats.lines++;
+    }
+    for (; y < bottom; y += CONSOLE_LINE_H) {
+        consoleWriteRow(y, "", 0);      // A line shrank while being read
+    }
+    consoleSendScroll();
+    consoleStats.scrolls++;
+
+    console.nextSeq = end;
+}
+
+static void enterConsoleScreen(const RenderContext& ctx) {
+    gfx->setFont(&fonts::Font2);
+    gfx->setTextSize(1);
+    gfx->setTextDatum(lgfx::top_left);
+    gfx->setTextColor(COL_CYAN, COL_BG);
+    gfx->drawString("Log", 6, 1);
+    gfx->drawFastHLine(0, CONSOLE_HEADER_H - 2, DISPLAY_WIDTH, COL_DARK_GREY);
+    markDirty(0, 0, DISPLAY_WIDTH, CONSOLE_HEADER_H);
+
+    memset(&console, 0, sizeof(console));
+    console.areaH = (hudShown ? HUD_Y : DISPLAY_HEIGHT) - CONSOLE_HEADER_H;
+    consoleDefineScrollArea(true);
+    consoleRedraw();
+    consoleVisible.store(true);
+}
+
+static void updateConsoleScreen(const RenderContext& ctx) {
+    consoleAppend();
+
+    char header[sizeof(console.header)];
+    snprintf(header, sizeof(header), "%lu lines", (unsigned long)console.nextSeq);
+    if (strcmp(header, console.header) != 0) {
+        const int x = DISPLAY_WIDTH / 2;
+        gfx->fillRect(x, 0, DISPLAY_WIDTH - x, CONSOLE_HEADER_H - 2, COL_BG);
+        gfx->setFont(&fonts::Font2);
+        gfx->setTextSize(1);
+        gfx->setTextDatum(lgfx::top_right);
+        gfx->setTextColor(COL_GREY, COL_BG);
+        gfx->drawString(header, DISPLAY_WIDTH - 6, 1);
+        markDirty(x, 0, DISPLAY_WIDTH - x, CONSOLE_HEADER_H - 2);
+        strncpy(console.header, header, sizeof(console.header) - 1);
+    }
+}
+
+// Back to the reset scroll layout without changing what is shown, so
+// the next page can slide in over the console
+static void leaveConsoleScreen() {
+    consoleVisible.store(false);
+    bool scrolled = console.scroll != 0;
+    consoleDefineScrollArea(false);
+
+    if (scrolled && usingBackBuffer()) {
+        const lgfx::swap565_t* buf = (const lgfx::swap565_t*)frame.getBuffer();
+        lcd.setAddrWindow(0, CONSOLE_HEADER_H, DISPLAY_WIDTH, console.areaH);
+        lcd.writePixelsDMA(buf + CONSOLE_HEADER_H * DISPLAY_WIDTH, DISPLAY_WIDTH * console.areaH);
+        lcd.waitDMA();      // The next screen clears the back buffer
+    }
+}
+
+// --- Photo frame ---
+// Decoding goes through gfx like any other draw: into the back buffer,
+// or straight into panel address windows without one. LovyanGFX feeds
+// tjpgd/pngle from RAM or the open file a few KB at a time and pushes
+// each decoded MCU block or row as it comes out. The image is scaled
+// down to fit and centred above the HUD.
+
+static bool decodePhoto(const DisplayPhoto& p, int h) {
+    const int w = DISPLAY_WIDTH;
+    if (p.data) {
+        if (p.format == DISPLAY_PHOTO_PNG) {
+            return gfx->drawPng(p.data, p.len, 0, 0, w, h, 0, 0, 0.0f, 0.0f, lgfx::middle_center);
+        }
+        return gfx->drawJpg(p.data, p.len, 0, 0, w, h, 0, 0, 0.0f, 0.0f, lgfx::middle_center);
+    }
+#ifdef BUS_TRACE_CAPTURE
+    return false;                       // No LittleFS on the host
+#else
+    if (p.format == DISPLAY_PHOTO_PNG) {
+        return gfx->drawPngFile(LittleFS, p.path, 0, 0, w, h, 0, 0, 0.0f, 0.0f, lgfx::middle_center);
+    }
+    return gfx->drawJpgFile(LittleFS, p.path, 0, 0, w, h, 0, 0, 0.0f, 0.0f, lgfx::middle_center);
+#endif
+}
+
+static void drawPhoto(const DisplayPhoto& p, int h) {
+    gfx->fillRect(0, 0, DISPLAY_WIDTH, h, COL_BG);
+
+    uint32_t startUs = micros();
+    bool ok = decodePhoto(p, h);
+    uint32_t us = micros() - startUs;
+    markDirty(0, 0, DISPLAY_WIDTH, h);
+
+    if (!ok) {
+        photoStats.failures++;
+        logPrintf("Display: cannot decode %s (progressive JPEG?)", p.path);
+        drawCenteredText(CENTER_X, h / 2, "Cannot show photo",
+                         &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+        return;
+    }
+    photoStats.decodes++;
+    photoStats.lastUs    = us;
+    photoStats.lastBytes = p.len;
+    histogramAdd(photoStats.decodeUs, us);
+    if (p.data) {
+        photoStats.fromRam++;
+    } else {
+        photoStats.fromFlash++;
+    }
+}
+
+static void discardPhotos() {
+    DisplayPhoto p;
+    while (photoRing.pop(p)) {
+        free(p.data);
+        photoStats.dropped++;
+    }
+}
+
+static void updatePhotoScreen(const RenderContext& ctx) {
+    const int h = hudShown ? HUD_Y : DISPLAY_HEIGHT;
+
+    // Only the newest photo is worth decoding
+    DisplayPhoto next;
+    bool got = false;
+    DisplayPhoto p;
+    while (photoRing.pop(p)) {
+        if (got) {
+            free(next.data);
+            photoStats.dropped++;
+        }
+        next = p;
+        got = true;
+    }
+
+    if (got) {
+        drawPhoto(next, h);
+        free(next.data);
+        next.data  = nullptr;
+        shownPhoto = next;
+        havePhoto  = true;
+        prevPhoto.drawn = true;
+        return;
+    }
+    if (prevPhoto.drawn) return;
+    prevPhoto.drawn = true;
+
+    if (havePhoto) {
+        drawPhoto(shownPhoto, h);
+    } else {
+        drawCenteredText(CENTER_X, h / 2 - 10, "No photos",
+                         &fonts::Font4, 1.0f, COL_WHITE, COL_BG);
+        drawCenteredText(CENTER_X, h / 2 + 16, "POST to /api/photos",
+                         &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+    }
+}
+
+// --- Animated GIF ---
+
+static bool hasGifExtension(const char* name) {
+    size_t len = strlen(name);
+    if (len < 5 || name[0] == '.') return false;
+    const char* ext = name + len - 4;
+    return ext[0] == '.' && tolower((unsigned char)ext[1]) == 'g' &&
+           tolower((unsigned char)ext[2]) == 'i' && tolower((unsigned char)ext[3]) == 'f';
+}
+
+static void scanGifs() {
+    gif.count = 0;
+    File dir = LittleFS.open(PHOTO_DIR, "r");
+    if (!dir || !dir.isDirectory()) return;
+    for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+        const char* name = f.name();
+        if (!f.isDirectory() && hasGifExtension(name) && strlen(name) <= PHOTO_NAME_MAX &&
+            gif.count < DISPLAY_GIF_MAX_FILES) {
+            int i = gif.count++;
+            while (i > 0 && strcmp(gif.names[i - 1], name) > 0) {
+                memcpy(gif.names[i], gif.names[i - 1], sizeof(gif.names[i]));
+                i--;
+            }
+            strcpy(gif.names[i], name);
+        }
+        f.close();
+    }
+}
+
+static int32_t readGifFile(void* ctx, uint32_t offset, uint8_t* dst, uint32_t len) {
+    File& f = *(File*)ctx;
+    if (f.position() != offset && !f.seek(offset)) return -1;
+    return (int32_t)f.read(dst, len);
+}
+
+// One row of palette indices. With the back buffer, opaque pixels are
+// written in place; without it, each run of opaque pixels is its own
+// address window on the panel.
+static void gifRow(void* arg, const GifFrame& f, int y, const uint8_t* idx) {
+    int py = gif.oy + y;
+    if (py >= gif.clipH) return;
+    int px = gif.ox + f.x;
+
+    if (usingBackBuffer()) {
+        uint8_t* dst = (uint8_t*)frame.getBuffer() + (py * DISPLAY_WIDTH + px) * 2;
+        for (int i = 0; i < f.w; i++, dst += 2) {
+            if (idx[i] == f.transparent) continue;
+            uint16_t c = f.palette[idx[i]];
+            dst[0] = c >> 8;
+            dst[1] = c & 0xFF;
+        }
+        return;
+    }
+
+    uint8_t line[GIF_MAX_WIDTH * 2];
+    int i = 0;
+    while (i < f.w) {
+        while (i < f.w && idx[i] == f.transparent) i++;
+        int start = i, n = 0;
+        while (i < f.w && idx[i] != f.transparent) {
+            uint16_t c = f.palette[idx[i++]];
+            line[n * 2]     = c >> 8;
+            line[n * 2 + 1] = c & 0xFF;
+            n++;
+        }
+        if (n > 0) {
+            lcd.setAddrWindow(px + start, py, n, 1);
+            lcd.writePixels((const lgfx::swap565_t*)line, n);
+        }
+    }
+}
+
+static void markGifRect(int x, int y, int w, int h) {
+    x += gif.ox;
+    y += gif.oy;
+    if (y + h > gif.clipH) h = gif.clipH - y;
+    if (w > 0 && h > 0) markDirty(x, y, w, h);
+}
+
+static bool openGif(int index) {
+    if (gif.file) gif.file.close();
+
+    char path[48];
+    snprintf(path, sizeof(path), "%s/%s", PHOTO_DIR, gif.names[index]);
+    gif.file = LittleFS.open(path, "r");
+    if (!gif.file || !gifOpen(*gif.dec, readGifFile, &gif.file)) {
+        gifStats.errors++;
+        logPrintf("Display: %s is not a playable GIF (max %dx%d)", path, GIF_MAX_WIDTH, GIF_MAX_HEIGHT);
+        return false;
+    }
+
+    gif.index     = index;
+    gif.ox        = (DISPLAY_WIDTH - gif.dec->width) / 2;
+    gif.oy        = (gif.clipH - gif.dec->height) / 2;
+    if (gif.oy < 0) gif.oy = 0;
+    gif.havePrev  = false;
+    gif.loopsDone = 0;
+
+    gfx->fillRect(0, 0, DISPLAY_WIDTH, gif.clipH, COL_BG);
+    markDirty(0, 0, DISPLAY_WIDTH, gif.clipH);
+    return true;
+}
+
+// The first file after `from` that opens, wrapping around
+static bool openNextGif(int from) {
+    for (int k = 1; k <= gif.count; k++) {
+        if (openGif((from + k) % gif.count)) {
+            gif.playing = true;
+            return true;
+        }
+    }
+    gif.playing = false;
+    return false;
+}
+
+static uint32_t gifDelayMs(const GifFrame& f) {
+    return f.delayMs < DISPLAY_GIF_MIN_DELAY_MS ? 100 : f.delayMs;
+}
+
+// Decode the next frame into the frame buffer, looping or moving to the
+// next file at the end. False when nothing is playable any more.
+static bool stepGif() {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (gif.havePrev && gif.prev.disposal == GIF_DISPOSE_BACKGROUND) {
+            // GIF_DISPOSE_PREVIOUS would need a copy of the rectangle; it is kept instead
+            int y = gif.oy + gif.prev.y;
+            int h = gif.prev.h;
+            if (y + h > gif.clipH) h = gif.clipH - y;
+            if (h > 0) gfx->fillRect(gif.ox + gif.prev.x, y, gif.prev.w, h, COL_BG);
+            markGifRect(gif.prev.x, gif.prev.y, gif.prev.w, gif.prev.h);
+        }
+
+        GifFrame f;
+        uint32_t startUs = micros();
+        GifResult r = gifNextFrame(*gif.dec, f, gifRow, nullptr);
+
+        if (r == GIF_FRAME) {
+            histogramAdd(gifStats.decodeUs, micros() - startUs);
+            markGifRect(f.x, f.y, f.w, f.h);
+            gifStats.frames++;
+            gifStats.lastPixels = (uint32_t)f.w * f.h;
+
+            uint32_t delay = gifDelayMs(f);
+            gif.dueUs += delay * 1000;
+            gif.windowFrames++;
+            gif.windowDelayMs += delay;
+            gif.prev = f;
+            gif.havePrev = true;
+            return true;
+        }
+
+        if (r == GIF_END) {
+            gifStats.loops++;
+            gif.loopsDone++;
+            if (gif.count > 1 && gif.loopsDone >= DISPLAY_GIF_LOOPS) {
+                if (!openNextGif(gif.index)) return false;
+            } else {
+                gifRewind(*gif.dec);
+            }
+            continue;
+        }
+
+        gifStats.errors++;
+        logPrintf("Display: %s is malformed, skipping", gif.names[gif.index]);
+        if (gif.count == 1 || !openNextGif(gif.index)) {
+            gif.playing = false;
+            return false;
+        }
+    }
+    gif.playing = false;    // Two ends in a row: no frames at all
+    return false;
+}
+
+static void enterGifScreen(const RenderContext& ctx) {
+    gif.clipH = hudShown ? HUD_Y : DISPLAY_HEIGHT;
+
+    if (!gif.dec) {
+        gif.dec = (GifDecoder*)malloc(sizeof(GifDecoder));
+        if (!gif.dec) {
+            drawCenteredText(CENTER_X, gif.clipH / 2, "Not enough memory",
+                             &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+            return;
+        }
+    }
+
+    // Every entry (a HUD toggle too) starts over from the first file
+    scanGifs();
+    gifStats.files = gif.count;
+    openNextGif(-1);
+
+    if (!gif.playing) {
+        drawCenteredText(CENTER_X, gif.clipH / 2 - 10, "No GIFs",
+                         &fonts::Font4, 1.0f, COL_WHITE, COL_BG);
+        drawCenteredText(CENTER_X, gif.clipH / 2 + 16, "POST .gif to /api/photos",
+                         &fonts::Font2, 1.0f, COL_GREY, COL_BG);
+        return;
+    }
+    gif.dueUs = micros();
+    gif.windowStartMs = millis();
+    gif.windowShown = gif.windowFrames = gif.windowDelayMs = 0;
+}
+
+static void updateGifScreen(const RenderContext& ctx) {
+    if (!gif.playing) return;
+    if ((int32_t)(micros() - gif.dueUs) < 0) return;   // Woken for something else
+
+    // Frames that are already overdue when decoded are never flushed:
+    // later frames draw over them, so the next flush carries both.
+    for (int late = 0;; late++) {
+        if (!stepGif()) return;
+        bool behind = (int32_t)(micros() - gif.dueUs) >= 0;
+        if (!behind || !usingBackBuffer() || late >= DISPLAY_GIF_CATCHUP) break;
+        gifStats.dropped++;
+    }
+    gifStats.shown++;
+    gif.windowShown++;
+
+    // After a long stall start the clock again instead of racing to catch up
+    if ((int32_t)(micros() - gif.dueUs) > 500000) gif.dueUs = micros();
+
+    uint32_t nowMs = millis();
+    uint32_t elapsedMs = nowMs - gif.windowStartMs;
+    if (elapsedMs >= 1000) {
+        gifStats.lastFps       = gif.windowShown * 1000 / elapsedMs;
+        gifStats.lastTargetFps = gif.windowDelayMs ? gif.windowFrames * 1000 / gif.windowDelayMs : 0;
+        gif.windowStartMs = nowMs;
+        gif.windowShown = gif.windowFrames = gif.windowDelayMs = 0;
+    }
+}
+
+static void leaveGifScreen() {
+    if (gif.file) gif.file.close();
+    free(gif.dec);
+    gif.dec = nullptr;
+    gif.playing = false;
+}
+
+// Render task: ms until the next GIF frame is due (0 = now)
+static uint32_t gifMsUntilDue() {
+    int32_t us = (int32_t)(gif.dueUs - micros());
+    return us <= 0 ? 0 : (uint32_t)(us + 999) / 1000;
+}
+
+// --- Remote framebuffer ---
+// Tiles are copied into the back buffer as they arrive and only flushed
+// when the sender marks the end of a frame, so a frame never shows half
+// updated. Without a back buffer each tile goes straight to the panel.
+
+static void applyTile(const DisplayTile& tile) {
+    int x = tile.tx * DISPLAY_TILE_SIZE;
+    int y = tile.ty * DISPLAY_TILE_SIZE;
+    if (x + DISPLAY_TILE_SIZE > DISPLAY_WIDTH || y + DISPLAY_TILE_SIZE > DISPLAY_HEIGHT) return;
+
+    const int rowBytes = DISPLAY_TILE_SIZE * 2;
+    if (usingBackBuffer()) {
+        uint8_t* dst = (uint8_t*)frame.getBuffer() + (y * DISPLAY_WIDTH + x) * 2;
+        for (int row = 0; row < DISPLAY_TILE_SIZE; row++) {
+            memcpy(dst + row * DISPLAY_WIDTH * 2, tile.px + row * rowBytes, rowBytes);
+        }
+        markDirty(x, y, DISPLAY_TILE_SIZE, DISPLAY_TILE_SIZE);
+    } else {
+        lcd.startWrite();
+        lcd.setAddrWindow(x, y, DISPLAY_TILE_SIZE, DISPLAY_TILE_SIZE);
+        lcd.writePixels((const lgfx::swap565_t*)tile.px, DISPLAY_TILE_SIZE * DISPLAY_TILE_SIZE);
+        lcd.endWrite();
+    }
+}
+
+// Move queued tiles into the back buffer (render task, remote screen only)
+static void drainTiles() {
+    DisplayTile tile;
+    bool waited = false;
+    while (tileRing.pop(tile)) {
+        if (!waited) {
+            lockFrame();
+            beginFrame();   // Previous present may still be streaming
+            waited = true;
+        }
+        applyTile(tile);
+    }
+    if (waited) unlockFrame();
+}
+
+static void discardTiles() {
+    DisplayTile tile;
+    while (tileRing.pop(tile)) {}
+}
+
+static void updateRemoteScreen(const RenderContext& ctx) {
+    drainTiles();
+}
+
+// --- Screen table (indexed by ScreenId) ---
+
+static const ScreenOps screens[SCREEN_COUNT] = {
+    { "none",    nullptr,            nullptr,             nullptr },
+    { "clock",   nullptr,            updateClockScreen,   nullptr },
+    { "sysinfo", nullptr,            updateSysInfoScreen, nullptr },
+    { "ap",      enterAPScreen,      updateAPScreen,      nullptr },
+    { "message", nullptr,            updateMessageScreen, nullptr },
+    { "ota",     enterOTAScreen,     updateOTAScreen,     nullptr },
+    { "remote",  nullptr,            updateRemoteScreen,  nullptr },
+    { "console", enterConsoleScreen, updateConsoleScreen, leaveConsoleScreen },
+    { "analog",  nullptr,            updateAnalogScreen,  nullptr },
+    { "photo",   nullptr,            updatePhotoScreen,   nullptr },
+    { "gif",     enterGifScreen,     updateGifScreen,     leaveGifScreen },
+    { "splash",  nullptr,            nullptr,             nullptr },
+};
+
+// Leave the current screen and enter next: one clear, one static draw
+static void switchScreen(ScreenId next, const RenderContext& ctx) {
+    logPrintf("Display: screen %s -> %s", screens[currentScreen].name, screens[next].name);
+
+    // The splash was drawn by displayShowSplash() and is only ever the
+    // first screen. Any other screen ends the hold for good.
+    if (next == SCREEN_SPLASH) {
+        currentScreen = next;           // Already on the panel and in the back buffer
+        return;
+    }
+    splashHeld = false;
+
+    if (screens[currentScreen].leave) screens[currentScreen].leave();
+    clearScreen(COL_BG);
+    clearAllPrevState();
+    currentScreen = next;
+
+    if (screens[next].enter) screens[next].enter(ctx);
+}
+
+// --- Page transitions ---
+// The outgoing page is still on the panel and the incoming page is fully
+// drawn in the back buffer, so no second page buffer is needed. A slide
+// streams the incoming page in from the right edge, covering the old one;
+// a fade dips the backlight, swaps the frame and brings it back up.
+// Position is driven by elapsed time, so a slow bus shows fewer frames
+// but never a longer animation.
+
+static bool isPageScreen(ScreenId screen) {
+    return screen == SCREEN_CLOCK || screen == SCREEN_ANALOG ||
+           screen == SCREEN_SYSINFO || screen == SCREEN_CONSOLE ||
+           screen == SCREEN_PHOTO || screen == SCREEN_GIF;
+}
+
+static bool shouldAnimate(ScreenId from, ScreenId to) {
+    return DISPLAY_TRANSITION != 0 && usingBackBuffer() &&
+           isPageScreen(from) && isPageScreen(to);
+}
+
+// Smoothstep, t in [0, 1024] -> [0, 1024]
+static uint32_t easeInOut(uint32_t t) {
+    return (t * t * (3 * 1024 - 2 * t)) >> 20;
+}
+
+// Push columns [0, cols) of the back buffer to the right edge of the panel
+static void pushSlideFrame(int cols) {
+    const lgfx::swap565_t* buf = (const lgfx::swap565_t*)frame.getBuffer();
+
+    lcd.setAddrWindow(DISPLAY_WIDTH - cols, 0, cols, DISPLAY_HEIGHT);
+    if (cols == DISPLAY_WIDTH) {
+        lcd.writePixelsDMA(buf, DISPLAY_WIDTH * DISPLAY_HEIGHT);
+    } else {
+        for (int row = 0; row < DISPLAY_HEIGHT; row++) {
+            lcd.writePixelsDMA(buf + row * DISPLAY_WIDTH, cols);
+        }
+    }
+}
+
+static void playTransition() {
+    DisplayTransitionStats& ts = perfStats.transition;
+    const uint32_t basePeriodUs = 1000000 / DISPLAY_TRANSITION_FPS;
+    const uint32_t durationUs   = DISPLAY_TRANSITION_MS * 1000UL;
+
+    uint32_t periodUs = basePeriodUs;
+    uint32_t frames = 0, overruns = 0;
+    uint32_t startUs = micros();
+    uint32_t elapsedUs = 0;
+    int      lastCols = 0;
+    bool     swapped = false;
+
+    lcd.waitDMA();
+    if (DISPLAY_TRANSITION == 2) {
+        backlightDip(true, DISPLAY_TRANSITION_MS / 2);
+    }
+
+    while (true) {
+        uint32_t frameStartUs = micros();
+        elapsedUs = frameStartUs - startUs;
+        uint32_t t = (elapsedUs >= durationUs) ? 1024 : (elapsedUs * 1024ULL) / durationUs;
+
+        if (DISPLAY_TRANSITION == 2) {
+            // Fade: LEDC fades the backlight down over the first half,
+            // frame swap, back up over the second
+            if (t >= 512 && !swapped) {
+                dirtyRegionAddAll(dirty);
+                flushFrame();
+                backlightDip(false, DISPLAY_TRANSITION_MS / 2);
+                swapped = true;
+            }
+        } else {
+            int cols = (int)((DISPLAY_WIDTH * easeInOut(t)) >> 10);
+            if (cols > lastCols) {
+                pushSlideFrame(cols);
+                lastCols = cols;
+            }
+        }
+        lcd.waitDMA();
+
+        uint32_t busyUs = micros() - frameStartUs;
+        histogramAdd(ts.frameUs, busyUs);
+        frames++;
+
+        if (t >= 1024) break;
+
+        // Back off to the next slower steady rate rather than jittering
+        if (busyUs > periodUs) {
+            overruns++;
+            periodUs += basePeriodUs;
+        } else {
+            uint32_t idleMs = (periodUs - busyUs) / 1000;
+            if (idleMs > 0) vTaskDelay(pdMS_TO_TICKS(idleMs));
+        }
+    }
+
+    // Panel now matches the back buffer
+    dirtyRegionClear(dirty);
+
+    uint32_t totalMs = (micros() - startUs) / 1000;
+    ts.count++;
+    ts.lastFrames     = frames;
+    ts.lastOverruns   = overruns;
+    ts.lastDurationMs = totalMs;
+    ts.lastFps        = totalMs ? (frames * 1000) / totalMs : frames;
+    ts.lastPeriodUs   = periodUs;
+}
+
+// ============================================================
+// Render task
+// ============================================================
+// Drains the snapshot ring (keeping only the newest state, but every
+// dirty flag), asks the scheduler whether anything on screen changed,
+// renders, then sleeps until the next wall-clock second or until the
+// main loop notifies it of new state.
+
+static int64_t wallClockMs() {
+    struct timeval tv;
+    readWallClock(tv);
+    return (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+// Which dirty flags the current screen cares about. Everything redraws on
+// page/mode changes and clock jumps; beyond that each page only wakes for
+// the data it actually shows.
+static uint32_t interestFor(const DisplaySnapshot& snap) {
+    if (wantsRemoteScreen(snap)) {
+        return RENDER_DIRTY_PAGE | RENDER_DIRTY_REMOTE;
+    }
+    uint32_t hud = snap.hud ? (uint32_t)RENDER_DIRTY_SYSTEM : 0u;
+    if (snap.overlay != OVERLAY_NONE) {
+        return RENDER_DIRTY_PAGE | hud;
+    }
+
+    uint32_t interest = RENDER_DIRTY_PAGE | RENDER_DIRTY_TIME | RENDER_DIRTY_WIFI | hud;
+    switch (snap.page) {
+        case PAGE_CLOCK_WEATHER:
+            interest |= pageLayouts[LAYOUT_PAGE_CLOCK].program.deps;
+            break;
+        case PAGE_ANALOG_CLOCK:
+            if (analogReady) {
+                interest |= RENDER_DIRTY_MINUTE | RENDER_DIRTY_SECOND | RENDER_DIRTY_FRAME;
+            } else {
+                interest |= pageLayouts[LAYOUT_PAGE_CLOCK].program.deps;  // Digital fallback
+            }
+            break;
+        case PAGE_SYSTEM_INFO:
+            interest |= pageLayouts[LAYOUT_PAGE_SYSINFO].program.deps;
+            break;
+        case PAGE_LOG:
+            interest |= RENDER_DIRTY_LOG;
+            break;
+        case PAGE_PHOTO:
+            interest |= RENDER_DIRTY_PHOTO;
+            break;
+        case PAGE_GIF:
+            interest |= RENDER_DIRTY_FRAME;
+            break;
+        default:
+            interest = RENDER_DIRTY_ALL;
+            break;
+    }
+    return interest;
+}
+
+static DisplayPerfKind perfKindFor(ScreenId screen) {
+    switch (screen) {
+        case SCREEN_SYSINFO: return PERF_SYSINFO;
+        case SCREEN_AP:      return PERF_AP;
+        case SCREEN_MESSAGE: return PERF_MESSAGE;
+        case SCREEN_OTA:     return PERF_OTA;
+        case SCREEN_REMOTE:  return PERF_REMOTE;
+        case SCREEN_CONSOLE: return PERF_CONSOLE;
+        case SCREEN_ANALOG:  return PERF_ANALOG;
+        case SCREEN_PHOTO:   return PERF_PHOTO;
+        case SCREEN_GIF:     return PERF_GIF;
+        default:             return PERF_CLOCK;
+    }
+}
+
+// --- Performance HUD ---
+
+static bool hudAllowed(ScreenId screen) {
+    return screen != SCREEN_NONE && screen != SCREEN_REMOTE && screen != SCREEN_SPLASH;
+}
+
+static void drawHudLine(int y, const char* text, char* prev, size_t prevSize) {
+    if (strcmp(text, prev) == 0) return;
+
+    gfx->fillRect(0, y, DISPLAY_WIDTH, 8, COL_BG);
+    gfx->setFont(&fonts::Font0);
+    gfx->setTextSize(1);
+    gfx->setTextDatum(lgfx::top_left);
+    gfx->setTextColor(COL_GREEN, COL_BG);
+    gfx->drawString(text, 4, y);
+    markDirty(0, y, DISPLAY_WIDTH, 8);
+
+    strncpy(prev, text, prevSize - 1);
+    prev[prevSize - 1] = '\0';
+}
+
+// Render time is the previous pass on this screen; this one is not over yet
+static void updateHud(const DisplayState& s) {
+    if (!prevHud.initialized) {
+        gfx->fillRect(0, HUD_Y, DISPLAY_WIDTH, HUD_H, COL_BG);
+        gfx->drawFastHLine(0, HUD_Y, DISPLAY_WIDTH, COL_DARK_GREY);
+        markDirty(0, HUD_Y, DISPLAY_WIDTH, HUD_H);
+        prevHud.initialized = true;
+    }
+
+    uint32_t renderUs = perfStats.kinds[perfKindFor(currentScreen)].lastUs;
+    char loopBuf[sizeof(prevHud.loop)];
+    snprintf(loopBuf, sizeof(loopBuf), "loop %lu/s  max %lu.%lums  draw %lu.%lums",
+             (unsigned long)s.loopsPerSec,
+             (unsigned long)(s.worstLoopUs / 1000), (unsigned long)(s.worstLoopUs / 100 % 10),
+             (unsigned long)(renderUs / 1000), (unsigned long)(renderUs / 100 % 10));
+    drawHudLine(HUD_Y + 3, loopBuf, prevHud.loop, sizeof(prevHud.loop));
+
+    char memBuf[sizeof(prevHud.mem)];
+    if (s.wifiConnected) {
+        snprintf(memBuf, sizeof(memBuf), "heap %luK  block %luK  rssi %d",
+                 (unsigned long)s.freeHeapKB, (unsigned long)s.largestBlockKB, s.rssi);
+    } else {
+        snprintf(memBuf, sizeof(memBuf), "heap %luK  block %luK  rssi --",
+                 (unsigned long)s.freeHeapKB, (unsigned long)s.largestBlockKB);
+    }
+    drawHudLine(HUD_Y + 12, memBuf, prevHud.mem, sizeof(prevHud.mem));
+}
+
+static void renderSnapshot(const DisplaySnapshot& snap, uint32_t dirty) {
+    BusTraceStats before = lcd.busTrace().stats();
+    uint32_t startUs = micros();
+
+    RenderContext ctx;
+    resolveScreen(snap, ctx);
+    ctx.dirty = dirty;
+
+    lockFrame();
+    beginFrame();
+    lcd.startWrite();
+
+    // Toggling the HUD re-enters the screen so it can make room
+    bool relayout = snap.hud != hudShown && hudAllowed(ctx.screen);
+    hudShown = snap.hud;
+
+    bool animate = false;
+    if (ctx.screen != currentScreen || relayout) {
+        animate = ctx.screen != currentScreen && shouldAnimate(currentScreen, ctx.screen);
+        switchScreen(ctx.screen, ctx);
+    }
+    if (screens[currentScreen].update) screens[currentScreen].update(ctx);
+    if (hudShown && hudAllowed(currentScreen)) {
+        updateHud(snap.state);
+    }
+
+    if (animate) {
+        playTransition();
+    } else {
+        flushFrame();
+    }
+    lcd.endWrite();
+    unlockFrame();
+
+    uint32_t elapsedUs = micros() - startUs;
+
+    if (!firstPixelMarked) {
+        firstPixelMarked = true;
+        bootTraceMark("first pixel");
+    }
+    if (!clockLiveMarked && (currentScreen == SCREEN_CLOCK || currentScreen == SCREEN_ANALOG)) {
+        clockLiveMarked = true;
+        bootTraceMark("clock live");
+    }
+
+    // DMA still in flight has already been counted: BusTrace sees the
+    // bytes when they are queued, not when they leave the wire.
+    const BusTraceStats& after = lcd.busTrace().stats();
+    uint32_t bytes = (uint32_t)(after.bytes - before.bytes);
+    busStats.passes++;
+    busStats.lastBytes        = bytes;
+    busStats.lastCommands     = after.commands - before.commands;
+    busStats.lastAddrWindows  = after.addrWindows - before.addrWindows;
+    busStats.lastTransactions = after.transactions - before.transactions;
+    busStats.totalBytes      += bytes;
+    if (bytes > busStats.maxBytes) busStats.maxBytes = bytes;
+
+    DisplayPerfEntry& perf = perfStats.kinds[perfKindFor(ctx.screen)];
+    histogramAdd(perf.renderUs, elapsedUs);
+    perf.lastUs        = elapsedUs;
+    perf.pixels       += after.pixels - before.pixels;
+    perf.bytes        += bytes;
+    perf.addrWindows  += busStats.lastAddrWindows;
+    perf.ramWrites    += after.ramWrites - before.ramWrites;
+    perf.transactions += busStats.lastTransactions;
+}
+
+// Render task loop state. Only the render task (or displayTraceStep())
+// touches it.
+struct RenderLoop {
+    DisplaySnapshot snap;
+    DisplaySnapshot incoming;
+    bool            haveSnap;
+    uint32_t        lastPassMs;
+};
+
+static RenderLoop renderLoop;
+
+// One pass of the render task. Returns how long it may sleep.
+static uint32_t renderPass() {
+    RenderLoop& rl = renderLoop;
+
+    uint32_t nowMs = millis();
+    uint32_t gap = nowMs - rl.lastPassMs;
+    rl.lastPassMs = nowMs;
+    taskStats.passes++;
+    taskStats.lastGapMs = gap;
+    if (gap > taskStats.maxGapMs) taskStats.maxGapMs = gap;
+
+    while (snapshotRing.pop(rl.incoming)) {
+        renderSchedInvalidate(sched, rl.incoming.dirty);
+        rl.snap = rl.incoming;
+        rl.haveSnap = true;
+        taskStats.snapshots++;
+    }
+    renderSchedInvalidate(sched, externalDirty.exchange(0));
+
+    // Remote tiles are staged as they arrive so the ring never backs
+    // up mid-frame; entering the screen first clears it once.
+    if (rl.haveSnap && wantsRemoteScreen(rl.snap)) {
+        if (currentScreen != SCREEN_REMOTE) renderSnapshot(rl.snap, RENDER_DIRTY_ALL);
+        drainTiles();
+    } else {
+        discardTiles();
+    }
+    if (!rl.haveSnap || rl.snap.page != PAGE_PHOTO) {
+        discardPhotos();
+    }
+
+    // Sweeping seconds hand: extra ticks between the second boundaries
+    bool sweep = currentScreen == SCREEN_ANALOG && DISPLAY_ANALOG_STEP_MS < 1000;
+    renderSchedSetFrameMs(sched, sweep ? DISPLAY_ANALOG_STEP_MS : 0);
+
+    // GIF frames keep their own deadlines
+    if (currentScreen == SCREEN_GIF && gif.playing && gifMsUntilDue() == 0) {
+        renderSchedInvalidate(sched, RENDER_DIRTY_FRAME);
+    }
+
+    int64_t wallMs = wallClockMs();
+    uint32_t work = rl.haveSnap ? renderSchedPoll(sched, wallMs, interestFor(rl.snap)) : 0;
+    if (work != 0) {
+        renderSnapshot(rl.snap, work);
+    }
+
+    // Sleep until the next tick or new state, whichever first
+    uint32_t waitMs = renderSchedMsUntilTick(sched, wallClockMs());
+    if (waitMs == 0 || waitMs > DISPLAY_TASK_MAX_SLEEP_MS) {
+        waitMs = DISPLAY_TASK_MAX_SLEEP_MS;
+    }
+    if (currentScreen == SCREEN_GIF && gif.playing && gifMsUntilDue() < waitMs) {
+        waitMs = gifMsUntilDue();
+    }
+    return waitMs;
+}
+
+static void renderTask(void* arg) {
+    (void)arg;
+
+    // Hold the bus for the lifetime of the task. Nested startWrite/endWrite
+    // pairs become no-ops, so DMA flushes run in the background instead of
+    // being waited on by every endWrite().
+    if (usingBackBuffer()) {
+        lcd.startWrite();
+    }
+
+    renderLoop.lastPassMs = millis();
+    for (;;) {
+        uint32_t waitMs = renderPass();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs) + 1);
+    }
+}
+
+#ifdef BUS_TRACE_CAPTURE
+void displayTraceSetClock(int64_t epochMs) {
+    traceClockMs = epochMs;
+}
+
+// Benchmarks switch the digit atlas off to measure the Font7 path
+void displayTraceUseAtlas(bool on) {
+    atlasReady = on && glyphCells[0].getBuffer() != nullptr;
+}
+
+// Same bus hold as renderTask(), taken on the first step
+void displayTraceStep() {
+    static bool holding = false;
+    if (!holding) {
+        if (usingBackBuffer()) lcd.startWrite();
+        renderLoop.lastPassMs = millis();
+        holding = true;
+    }
+    renderPass();
+}
+#endif
+
+// ============================================================
+// Producer API (main loop)
+// ============================================================
+
+// Copy the producer view into the ring. If the ring is full the dirty
+// flags stay accumulated and go out with the next push.
+static void pushSnapshot(uint32_t dirtyFlags) {
+    producerSnap.dirty |= dirtyFlags;
+
+    if (snapshotRing.push(producerSnap)) {
+        producerSnap.dirty = 0;
+    } else {
+        taskStats.queueFull++;
+    }
+
+    if (renderTaskHandle) {
+        xTaskNotifyGive(renderTaskHandle);
+    }
+}
+
+void displayPublish(const DisplayState& state) {
+    const DisplayState& prev = producerSnap.state;
+    uint32_t flags = 0;
+
+    if (state.apMode != prev.apMode ||
+        state.wifiConnected != prev.wifiConnected ||
+        strcmp(state.ssid, prev.ssid) != 0 ||
+        strcmp(state.ip, prev.ip) != 0) {
+        flags |= RENDER_DIRTY_WIFI;
+    }
+
+    if (state.weather.valid != prev.weather.valid ||
+        state.weather.lastFetchMs != prev.weather.lastFetchMs) {
+        flags |= RENDER_DIRTY_WEATHER;
+    }
+
+    if (state.freeHeapKB != prev.freeHeapKB ||
+        state.largestBlockKB != prev.largestBlockKB ||
+        state.loopsPerSec != prev.loopsPerSec ||
+        state.worstLoopUs != prev.worstLoopUs ||
+        state.rssi != prev.rssi ||
+        state.otaConfirmed != prev.otaConfirmed ||
+        strcmp(state.mac, prev.mac) != 0) {
+        flags |= RENDER_DIRTY_SYSTEM;
+    }
+
+    if (flags == 0 && producerSnap.dirty == 0) return;
+
+    producerSnap.state = state;
+    pushSnapshot(flags);
+}
+
+void displaySetPage(DisplayPage page) {
+    producerSnap.page = page;
+    pushSnapshot(RENDER_DIRTY_PAGE);
+}
+
+DisplayPage displayGetPage() {
+    return producerSnap.page;
+}
+
+void displaySetHud(bool on) {
+    producerSnap.hud = on;
+    pushSnapshot(RENDER_DIRTY_PAGE);
+}
+
+bool displayGetHud() {
+    return producerSnap.hud;
+}
+
+// Logger listener: new lines only need a pass while the console is shown
+static void onLogLine() {
+    if (consoleVisible.load()) {
+        displayInvalidate(RENDER_DIRTY_LOG);
+    }
+}
+
+void displayInvalidate(uint32_t flags) {
+    externalDirty.fetch_or(flags);
+    if (renderTaskHandle) {
+        xTaskNotifyGive(renderTaskHandle);
+    }
+}
+
+bool displayShowPhoto(const DisplayPhoto& photo) {
+    if (!photoRing.push(photo)) return false;
+    displayInvalidate(RENDER_DIRTY_PHOTO);
+    return true;
+}
+
+void displaySetRemote(bool active) {
+    if (producerSnap.remote == active) return;
+    producerSnap.remote = active;
+    pushSnapshot(RENDER_DIRTY_PAGE);
+}
+
+bool displayPushTile(const DisplayTile& tile) {
+    if (tileRing.push(tile)) return true;
+
+    // Full: let the render task stage what it has, caller retries
+    if (renderTaskHandle) {
+        xTaskNotifyGive(renderTaskHandle);
+    }
+    return false;
+}
+
+void displayPresentTiles() {
+    displayInvalidate(RENDER_DIRTY_REMOTE);
+}
+
+// --- Screen capture ---
+
+bool displayCaptureAvailable() {
+    return captureLock != nullptr;
+}
+
+void displayCaptureInvalidateAll() {
+    if (!captureLock) return;
+    xSemaphoreTake(captureLock, portMAX_DELAY);
+    captureMarkAll();
+    xSemaphoreGive(captureLock);
+}
+
+DisplayCaptureResult displayCaptureNextTile(DisplayTile& out) {
+    if (!captureLock) return CAPTURE_NONE;
+    if (xSemaphoreTake(captureLock, 0) != pdTRUE) return CAPTURE_BUSY;
+
+    DisplayCaptureResult result = CAPTURE_NONE;
+    for (int ty = 0; ty < CAPTURE_TILES_Y; ty++) {
+        if (captureDirty[ty] == 0) continue;
+
+        int tx = __builtin_ctz(captureDirty[ty]);
+        captureDirty[ty] &= (uint16_t)~(1u << tx);
+
+        const int rowBytes = DISPLAY_TILE_SIZE * 2;
+        const uint8_t* src = (const uint8_t*)frame.getBuffer() +
+                             (ty * DISPLAY_TILE_SIZE * DISPLAY_WIDTH + tx * DISPLAY_TILE_SIZE) * 2;
+        for (int row = 0; row < DISPLAY_TILE_SIZE; row++) {
+            memcpy(out.px + row * rowBytes, src + row * DISPLAY_WIDTH * 2, rowBytes);
+        }
+        out.tx = (uint8_t)tx;
+        out.ty = (uint8_t)ty;
+        result = CAPTURE_TILE;
+        break;
+    }
+
+    xSemaphoreGive(captureLock);
+    return result;
+}
+
+// Render task state read without the lock: a stale answer only moves a
+// splash save by one loop, and splash.cpp rejects frames that change
+// while being copied
+bool displayCaptureSplashReady() {
+    return captureLock && currentScreen == SCREEN_CLOCK && !hudShown;
+}
+
+bool displayCaptureRow(int y, uint8_t* dst) {
+    if (!captureLock || y < 0 || y >= DISPLAY_HEIGHT) return false;
+    if (xSemaphoreTake(captureLock, pdMS_TO_TICKS(DISPLAY_CAPTURE_WAIT_MS)) != pdTRUE) return false;
+
+    memcpy(dst, (const uint8_t*)frame.getBuffer() + y * DISPLAY_WIDTH * 2, DISPLAY_WIDTH * 2);
+
+    xSemaphoreGive(captureLock);
+    return true;
+}
+
+void displayRenderMessage(const char* msg) {
+    if (producerSnap.overlay == OVERLAY_MESSAGE &&
+        strncmp(producerSnap.message, msg, sizeof(producerSnap.message) - 1) == 0) {
+        return;
+    }
+    producerSnap.overlay = OVERLAY_MESSAGE;
+    strncpy(producerSnap.message, msg, sizeof(producerSnap.message) - 1);
+    producerSnap.message[sizeof(producerSnap.message) - 1] = '\0';
+    pushSnapshot(RENDER_DIRTY_PAGE);
+}
+
+void displayRenderOTAProgress(int percent) {
+    if (percent < 0) percent = 0;
+    if (percent > 100) percent = 100;
+
+    if (producerSnap.overlay == OVERLAY_OTA && producerSnap.otaPercent == percent) {
+        return;
+    }
+    producerSnap.overlay = OVERLAY_OTA;
+    producerSnap.otaPercent = (int8_t)percent;
+    pushSnapshot(RENDER_DIRTY_PAGE);
+}
+
+void displayClearOverlay() {
+    if (producerSnap.overlay == OVERLAY_NONE) return;
+    producerSnap.overlay = OVERLAY_NONE;
+    pushSnapshot(RENDER_DIRTY_PAGE);
 }
@@ -2,32 +2,292 @@
 
 #include <Arduino.h>
 #include <LovyanGFX.hpp>
+#include "bus_trace.h"
+#include "histogram.h"
+#include "render_scheduler.h"
+#include "weather.h"
 
 // ============================================================
 // Display Driver - SmallTV Pro (ST7789V 240x240)
-// LovyanGFX-based with differential rendering
+// LovyanGFX-based with differential rendering into an off-screen
+// back buffer, flushed to the panel as merged dirty-rect DMA bursts
 // ============================================================
-
-// Weather data struct is defined in weather.h
-struct WeatherData;
+//
+// Threading: all drawing happens on a dedicated render task pinned to
+// DISPLAY_TASK_CORE. The public API below is called from the main loop
+// only; it copies state into immutable snapshots handed to the render
+// task over a lock-free ring, so blocking network code in loop() never
+// stalls the clock.
 
 // --- Display pages ---
 
 enum DisplayPage {
     PAGE_CLOCK_WEATHER = 0,
+    PAGE_ANALOG_CLOCK,              // Analog face with a sweeping seconds hand
     PAGE_SYSTEM_INFO,
+    PAGE_LOG,                       // Live log console (also reachable in AP mode)
+    PAGE_PHOTO,                     // Photo frame (see photo.h)
+    PAGE_GIF,                       // Animated GIFs from the photo directory
     PAGE_COUNT
 };
 
+// --- State published by the main loop ---
+// Everything the pages show that comes from other modules. Time and
+// uptime are read by the render task itself so they keep ticking.
+
+struct DisplayState {
+    bool        apMode;
+    bool        wifiConnected;      // STA connected (false in AP mode)
+    char        ssid[33];           // Connected SSID, or AP SSID in AP mode
+    char        ip[16];             // STA IP, or AP IP in AP mode
+    char        mac[18];
+    int         rssi;
+    uint32_t    freeHeapKB;
+    uint32_t    largestBlockKB;     // Largest free heap block
+    bool        otaConfirmed;
+    uint32_t    loopsPerSec;        // Main loop iterations in the last second
+    uint32_t    worstLoopUs;        // Slowest loop() in the last second, excluding its yield
+    WeatherData weather;            // weather.valid is false until first fetch
+};
+
+// --- Remote framebuffer tiles ---
+// A 16x16 block of big-endian RGB565 pixels at tile grid position
+// (tx, ty), pushed by the remote display module.
+
+#define DISPLAY_TILE_SIZE   16
+
+struct DisplayTile {
+    uint8_t tx;
+    uint8_t ty;
+    uint8_t px[DISPLAY_TILE_SIZE * DISPLAY_TILE_SIZE * 2];
+};
+
+// --- Photo frame ---
+// A compressed image handed to the render task. With data set the render
+// task decodes from RAM and frees it (malloc'd by the sender); with data
+// null it decodes the file at path instead. Either way the decoder
+// streams MCU blocks (JPEG) or rows (PNG) into the frame through a small
+// fixed work buffer, so no full-size pixel buffer is ever allocated.
+
+enum DisplayPhotoFormat : uint8_t {
+    DISPLAY_PHOTO_JPEG = 0,      // Baseline only; tjpgd rejects progressive files
+    DISPLAY_PHOTO_PNG
+};
+
+struct DisplayPhoto {
+    char               path[48];
+    uint8_t*           data;     // Whole file, or null to decode from flash
+    uint32_t           len;
+    DisplayPhotoFormat format;
+};
+
+// --- Screen capture ---
+// The back buffer always holds what the panel shows, so it doubles as
+// the shadow framebuffer for screenshots and mirroring. Changed tiles
+// are tracked from the same dirty marks the compositor flushes.
+
+enum DisplayCaptureResult {
+    CAPTURE_TILE,                // out holds a changed tile
+    CAPTURE_NONE,                // Nothing changed since the last read
+    CAPTURE_BUSY                 // Render pass in progress, try again later
+};
+
+// --- Compositor statistics ---
+// Per-frame SPI traffic from the back buffer flush. "Transactions" are
+// address-window bursts (one per merged dirty rect).
+
+struct DisplayFrameStats {
+    uint32_t frames;             // Frames flushed since boot
+    uint32_t lastBytes;          // Pixel bytes pushed by the most recent frame
+    uint16_t lastTransactions;   // Address windows in the most recent frame
+    uint32_t maxBytes;           // Largest single frame
+    uint64_t totalBytes;
+    uint32_t totalTransactions;
+    bool     backBuffer;         // false = allocation failed, drawing direct to panel
+};
+
+// Clock digit atlas: pixels actually blitted vs. what rasterizing the whole
+// "HH:MM" string would have written for the same updates.
+
+struct DisplayClockStats {
+    uint32_t updates;            // Time changes drawn via the atlas
+    uint32_t cellBlits;          // Glyph cells copied
+    uint32_t pixelsWritten;      // Pixels copied from the atlas
+    uint32_t fullPathPixels;     // Pixels the full-string path would have written
+};
+
+// Render task health. A gap is the time between two consecutive passes
+// of the render loop; it should stay near one second even while loop()
+// is blocked in a weather fetch or WiFi connect.
+
+struct DisplayTaskStats {
+    uint32_t passes;             // Render loop iterations
+    uint32_t snapshots;          // Snapshots consumed from the ring
+    uint32_t queueFull;          // Publishes that found the ring full (retried)
+    uint32_t lastGapMs;
+    uint32_t maxGapMs;           // Worst render gap observed
+};
+
+// Wire traffic per render pass, counted at the bus by BusTrace. Unlike
+// DisplayFrameStats this includes command bytes, address-window setup and
+// anything drawn straight to the panel.
+
+struct DisplayBusStats {
+    uint32_t passes;             // Render passes measured
+    uint32_t lastBytes;          // Bytes on the wire in the most recent pass
+    uint32_t lastCommands;
+    uint32_t lastAddrWindows;    // CASET/RASET changes
+    uint32_t lastTransactions;   // Bus acquisitions
+    uint32_t maxBytes;
+    uint64_t totalBytes;
+};
+
+// Smooth font text. Time covers layout, glyph lookups (cache or flash)
+// and blending into the frame for one string.
+
+struct DisplayFontStats {
+    bool      loaded;            // false = VLW font missing, bitmap fonts used
+    uint16_t  glyphs;            // Glyphs in the font file
+    uint32_t  strings;           // Strings drawn with it
+    Histogram stringUs;
+};
+
+// Log console page. New lines scroll in with the panel's vertical
+// scroll registers; only the rows of the new lines are sent. A redraw
+// repaints the whole console (page entry, or more new lines than fit).
+
+struct DisplayConsoleStats {
+    uint32_t lines;              // Log lines drawn
+    uint32_t scrolls;            // Hardware scroll updates
+    uint32_t redraws;            // Full console repaints
+    uint32_t dropped;            // Lines overwritten in the log buffer before drawn
+};
+
+// Layout engine (clock and system info pages). A run walks the page's
+// ops; ops whose dependencies are not dirty are skipped before their
+// value is even formatted.
+
+struct DisplayLayoutStats {
+    uint32_t  runs;
+    uint32_t  opsSkipped;
+    uint32_t  opsEvaluated;      // Value formatted and compared
+    uint32_t  opsDrawn;
+    uint32_t  opsErased;
+    Histogram runUs;             // One layoutRun(), drawing into the frame included
+    bool      clockFromFile;     // Layout loaded from LittleFS instead of built in
+    bool      sysinfoFromFile;
+};
+
+// Analog clock page. A tick erases and redraws only the boxes the hands
+// left and entered (merged); its pixels are the area of those boxes.
+// A face draw repaints the whole dial (page entry, HUD toggle).
+
+struct DisplayAnalogStats {
+    uint32_t  ticks;             // Hand moves drawn
+    uint32_t  faces;             // Full face draws
+    uint32_t  lastPixels;        // Pixels redrawn by the most recent tick
+    uint16_t  lastRects;
+    uint64_t  totalPixels;       // All ticks
+    Histogram tickPixels;
+    Histogram tickUs;            // Drawing into the frame; the flush is in perf "analog"
+};
+
+// Photo page. Decode time covers the whole image into the frame; bytes
+// are the compressed size, so bytes / time is decoder throughput.
+
+struct DisplayPhotoStats {
+    uint32_t  decodes;
+    uint32_t  failures;          // Corrupt, unsupported (progressive JPEG) or missing
+    uint32_t  fromRam;           // Prefetched by the main loop
+    uint32_t  fromFlash;         // Read from LittleFS during the decode
+    uint32_t  dropped;           // Handed over but superseded or off-page
+    uint32_t  lastUs;
+    uint32_t  lastBytes;
+    Histogram decodeUs;
+};
+
+// Animated GIF page. Frames are paced by their own delays against a
+// running deadline. A frame still being decoded when the next one is
+// due is decoded (later frames build on it) but never flushed: it is
+// counted as dropped. fps figures cover the last full second.
+
+struct DisplayGifStats {
+    uint16_t  files;             // .gif files found on page entry
+    uint32_t  frames;            // Decoded
+    uint32_t  shown;             // Flushed to the panel
+    uint32_t  dropped;           // Decoded late and merged into the next flush
+    uint32_t  loops;
+    uint32_t  errors;            // Unreadable or malformed files skipped
+    uint32_t  lastFps;           // Frames shown
+    uint32_t  lastTargetFps;     // Frames the GIF's delays asked for
+    uint32_t  lastPixels;        // Sub-rectangle of the last frame
+    Histogram decodeUs;          // One frame, into the frame buffer
+};
+
+// Render profile, split by what was drawn. Durations are CPU time of one
+// render pass in microseconds, from the first draw call to the last DMA
+// burst being queued. Pixel and byte counts are measured at the bus.
+
+enum DisplayPerfKind {
+    PERF_CLOCK = 0,              // Clock/weather page
+    PERF_SYSINFO,
+    PERF_AP,
+    PERF_MESSAGE,                // Messages, incl. "Waiting for NTP..."
+    PERF_OTA,
+    PERF_REMOTE,                 // Remote framebuffer (present passes)
+    PERF_CONSOLE,                // Log console page
+    PERF_ANALOG,                 // Analog clock page
+    PERF_PHOTO,                  // Photo page (decode and flush)
+    PERF_GIF,                    // Animated GIF page
+    PERF_KIND_COUNT
+};
+
+struct DisplayPerfEntry {
+    Histogram renderUs;
+    uint32_t  lastUs;
+    uint64_t  pixels;
+    uint64_t  bytes;
+    uint32_t  addrWindows;
+    uint32_t  ramWrites;         // Pixel bursts
+    uint32_t  transactions;      // Bus acquisitions
+};
+
+// Page transition animation. Frame time is bus time: pushing the frame
+// plus waiting for its DMA to drain. Pacing starts at the target rate and
+// backs off one step (60 -> 30 -> 20 fps ...) when a frame overruns.
+
+struct DisplayTransitionStats {
+    uint32_t  count;             // Transitions played
+    uint32_t  lastFrames;
+    uint32_t  lastOverruns;      // Frames that took longer than their slot
+    uint32_t  lastDurationMs;
+    uint32_t  lastFps;           // Average rate actually achieved
+    uint32_t  lastPeriodUs;      // Frame period after pacing adapted
+    Histogram frameUs;           // All transition frames since boot
+};
+
+struct DisplayPerfStats {
+    DisplayPerfEntry kinds[PERF_KIND_COUNT];
+    Histogram        dmaWaitUs;  // Time spent waiting for the previous flush
+    Histogram        captureWaitUs; // Render task blocked by a screen capture copy
+    DisplayTransitionStats transition;
+};
+
 // --- LovyanGFX hardware configuration ---
+// Built with BUS_TRACE_CAPTURE (the native_display env) there is no SPI
+// bus: the panel talks to BusTrace alone, which decodes the command
+// stream into a framebuffer the host tests compare against goldens.
 
 class LGFX : public lgfx::LGFX_Device {
     lgfx::Panel_ST7789  _panel;
+#ifndef BUS_TRACE_CAPTURE
     lgfx::Bus_SPI       _bus;
-    lgfx::Light_PWM     _light;
+#endif
+    BusTrace            _trace;     // Counts everything the panel sends to _bus
 
 public:
     LGFX() {
+#ifndef BUS_TRACE_CAPTURE
         // SPI bus
         auto busCfg = _bus.config();
         busCfg.spi_host   = VSPI_HOST;
@@ -39,57 +299,107 @@ public:
         busCfg.pin_miso    = -1;
         busCfg.pin_dc      = TFT_DC;
         _bus.config(busCfg);
-        _panel.setBus(&_bus);
+        _trace.setInner(&_bus);
+#else
+        _trace.setInner(nullptr);
+#endif
+        _panel.setBus(&_trace);
 
         // Panel
         auto panelCfg = _panel.config();
         panelCfg.pin_cs    = -1;
+#ifndef BUS_TRACE_CAPTURE
         panelCfg.pin_rst   = TFT_RST;
+#else
+        panelCfg.pin_rst   = -1;
+#endif
         panelCfg.panel_width   = DISPLAY_WIDTH;
         panelCfg.panel_height  = DISPLAY_HEIGHT;
         panelCfg.invert    = true;
         panelCfg.readable  = false;
         _panel.config(panelCfg);
 
-        // Backlight (PWM)
-        auto lightCfg = _light.config();
-        lightCfg.pin_bl     = TFT_BL;
-        lightCfg.invert     = true;
-        lightCfg.freq       = 44100;
-        lightCfg.pwm_channel = 0;
-        _light.config(lightCfg);
-        _panel.setLight(&_light);
-
+        // Backlight is driven by the backlight module (LEDC hardware fades)
         setPanel(&_panel);
     }
+
+    BusTrace& busTrace() { return _trace; }
 };
 
 // --- Public API ---
 
-void    displayInit();
+// Boot splash (see splash.h). Brings the panel up and shows the last saved
+// clock frame; call before anything slow in setup(). The splash stays up
+// until the clock has live time (or DISPLAY_SPLASH_HOLD_MS passes).
+void    displayShowSplash();
+
+void    displayInit();          // Panel, back buffer, atlas, then starts the render task
+
+// Hand the latest module state to the render task. Cheap when nothing
+// changed; otherwise raises the matching RenderDirty flags.
+void    displayPublish(const DisplayState& state);
 
 // Page management
 void        displaySetPage(DisplayPage page);
 DisplayPage displayGetPage();
 
-// Centralized update - call from main loop, routes to correct renderer.
-// Handles page-transition screen clears internally.
-void    displayUpdate(const char* timeStr, const char* dateStr,
-                      const WeatherData* weather, bool apMode,
-                      const char* apSSID, const char* apIP,
-                      // System info parameters
-                      const char* fwVersion, bool wifiConnected,
-                      bool wifiAP, const char* ssid, const char* ip,
-                      int rssi, const char* mac, uint32_t freeHeapKB,
-                      unsigned long uptimeSec, bool otaConfirmed);
-
-// Standalone renderers (used outside the normal update loop)
-void    displayRenderAPMode(const char* ssid, const char* ip);
-void    displayRenderMessage(const char* msg);
+// Invalidation. Extra producers can mark what changed (RenderDirty flags).
+// The render task wakes on these and on wall-clock second/minute ticks.
+void        displayInvalidate(uint32_t flags);
+const RenderSchedulerStats& displayGetSchedulerStats();
+
+// Performance HUD: loop rate, worst loop, render time, heap and RSSI in a
+// 20 px strip along the bottom of every screen but the remote framebuffer
+void    displaySetHud(bool on);
+bool    displayGetHud();
+
+// Overlays drawn instead of the pages (AP mode is part of DisplayState)
+void    displayRenderMessage(const char* msg);     // Shown until displayClearOverlay()
 void    displayRenderOTAProgress(int percent);
+void    displayClearOverlay();
+
+// Remote framebuffer. While active (and no overlay is up) the screen
+// shows tiles pushed from the network instead of the pages. Tiles are
+// staged in the back buffer and shown together on displayPresentTiles().
+void    displaySetRemote(bool active);
+bool    displayPushTile(const DisplayTile& tile);  // false = queue full, retry later
+void    displayPresentTiles();                     // End of frame
+
+// Photo page. Takes ownership of photo.data on success; false = a photo
+// is already waiting, keep it and retry later.
+bool    displayShowPhoto(const DisplayPhoto& photo);
+
+// Screen capture (main loop). Each call copies one tile or row under a
+// lock the render task holds while drawing, so a capture delays a render
+// pass by at most one copy. Unavailable without the back buffer.
+bool                 displayCaptureAvailable();
+void                 displayCaptureInvalidateAll();     // Next reads return every tile
+DisplayCaptureResult displayCaptureNextTile(DisplayTile& out);   // Never waits
+bool                 displayCaptureRow(int y, uint8_t* dst);     // Big-endian RGB565, waits for the pass
+bool                 displayCaptureSplashReady();       // Clock page up with nothing over it
+
+// Compositor traffic counters
+const DisplayFrameStats& displayGetFrameStats();
+const DisplayClockStats& displayGetClockStats();
+const DisplayTaskStats&  displayGetTaskStats();
+const DisplayBusStats&   displayGetBusStats();
+const DisplayPerfStats&  displayGetPerfStats();
+const DisplayFontStats&  displayGetFontStats();
+const DisplayConsoleStats& displayGetConsoleStats();
+const DisplayAnalogStats&  displayGetAnalogStats();
+const DisplayLayoutStats&  displayGetLayoutStats();
+const DisplayPhotoStats&   displayGetPhotoStats();
+const DisplayGifStats&     displayGetGifStats();
+const char*              displayPerfKindName(DisplayPerfKind kind);
 
-// Brightness (0-100)
-void    displaySetBrightness(uint8_t brightness);
+#ifdef BUS_TRACE_CAPTURE
+// Host capture builds only. No render task runs: each step is one pass
+// of its loop on the caller's thread, against a wall clock the caller sets.
+void    displayTraceSetClock(int64_t epochMs);
+void    displayTraceStep();
+void    displayTraceUseAtlas(bool on);      // false = clock digits via Font7
+#endif
 
-// Raw access for advanced use
+// Raw access for advanced use. Only safe from the render task; waits for
+// any in-flight back buffer flush.
 LGFX*   displayGetLCD();
@@ -0,0 +1,349 @@
+#include "gif_decoder.h"
+
+#include <string.h>
+
+// ============================================================
+// GIF Decoder Implementation
+// ============================================================
+
+static const uint8_t BLOCK_EXTENSION  = 0x21;
+static const uint8_t BLOCK_IMAGE      = 0x2C;
+static const uint8_t BLOCK_TRAILER    = 0x3B;
+static const uint8_t EXT_GRAPHIC_CTRL = 0xF9;
+static const uint8_t EXT_APPLICATION  = 0xFF;
+
+// Interlaced rows: four passes starting at these rows, with these steps
+static const uint8_t INTERLACE_START[4] = { 0, 4, 2, 1 };
+static const uint8_t INTERLACE_STEP[4]  = { 8, 8, 4, 2 };
+
+// --- Input ---
+
+static int readByte(GifDecoder& dec) {
+    if (dec.inPos >= dec.inLen) {
+        if (dec.eof || dec.ioError) return -1;
+        dec.pos += dec.inLen;
+        int32_t n = dec.read(dec.ctx, dec.pos, dec.in, sizeof(dec.in));
+        dec.inPos = 0;
+        dec.inLen = n > 0 ? (uint16_t)n : 0;
+        if (n <= 0) {
+            if (n < 0) dec.ioError = true;
+            else       dec.eof = true;
+            return -1;
+        }
+    }
+    return dec.in[dec.inPos++];
+}
+
+static bool readBytes(GifDecoder& dec, uint8_t* dst, int len) {
+    for (int i = 0; i < len; i++) {
+        int b = readByte(dec);
+        if (b < 0) return false;
+        dst[i] = (uint8_t)b;
+    }
+    return true;
+}
+
+static int readU16(GifDecoder& dec) {
+    int lo = readByte(dec);
+    int hi = readByte(dec);
+    if (lo < 0 || hi < 0) return -1;
+    return lo | (hi << 8);
+}
+
+// File offset of the next unread byte
+static uint32_t tell(const GifDecoder& dec) {
+    return dec.pos + dec.inPos;
+}
+
+static void seekTo(GifDecoder& dec, uint32_t offset) {
+    dec.pos = offset;
+    dec.inLen = 0;
+    dec.inPos = 0;
+    dec.eof = false;
+    dec.ioError = false;
+}
+
+// Skip data sub-blocks up to and including the zero-length terminator
+static bool skipSubBlocks(GifDecoder& dec) {
+    for (;;) {
+        int len = readByte(dec);
+        if (len < 0) return false;
+        if (len == 0) return true;
+        for (int i = 0; i < len; i++) {
+            if (readByte(dec) < 0) return false;
+        }
+    }
+}
+
+static bool readPalette(GifDecoder& dec, uint16_t* palette, int count) {
+    uint8_t rgb[3];
+    for (int i = 0; i < count; i++) {
+        if (!readBytes(dec, rgb, 3)) return false;
+        palette[i] = (uint16_t)(((rgb[0] & 0xF8) << 8) | ((rgb[1] & 0xFC) << 3) | (rgb[2] >> 3));
+    }
+    for (int i = count; i < 256; i++) palette[i] = 0;
+    return true;
+}
+
+// --- Extensions ---
+
+static bool readExtension(GifDecoder& dec) {
+    int label = readByte(dec);
+    if (label < 0) return false;
+
+    if (label == EXT_GRAPHIC_CTRL) {
+        uint8_t b[5];
+        if (!readBytes(dec, b, 5) || b[0] < 4) return false;
+        dec.gceDisposal    = (b[1] >> 2) & 0x07;
+        dec.gceDelay       = (uint16_t)(b[2] | (b[3] << 8));
+        dec.gceTransparent = (b[1] & 0x01) ? b[4] : GIF_NO_TRANSPARENT;
+        // Block size is always 4; skip anything else a writer appended
+        for (int i = 4; i < b[0]; i++) {
+            if (readByte(dec) < 0) return false;
+        }
+        return skipSubBlocks(dec);
+    }
+
+    if (label == EXT_APPLICATION) {
+        uint8_t id[12];
+        int len = readByte(dec);
+        if (len != 11 || !readBytes(dec, id, 11)) return false;
+        if (memcmp(id, "NETSCAPE2.0", 11) == 0 || memcmp(id, "ANIMEXTS1.0", 11) == 0) {
+            uint8_t sub[4];
+            int subLen = readByte(dec);
+            if (subLen == 3) {
+                if (!readBytes(dec, sub, 3)) return false;
+                if (sub[0] == 1) {
+                    dec.loops    = (uint16_t)(sub[1] | (sub[2] << 8));
+                    dec.hasLoops = true;
+                }
+            } else if (subLen > 0) {
+                for (int i = 0; i < subLen; i++) {
+                    if (readByte(dec) < 0) return false;
+                }
+            } else if (subLen == 0) {
+                return true;
+            } else {
+                return false;
+            }
+        }
+        return skipSubBlocks(dec);
+    }
+
+    return skipSubBlocks(dec);     // Comments, plain text
+}
+
+// --- LZW ---
+
+struct LzwState {
+    GifDecoder&     dec;
+    GifFrame&       frame;
+    GifRowFn        emit;
+    void*           ctx;
+    uint16_t        fullW;      // Row length in the stream
+    uint16_t        fullH;
+    uint16_t        x;          // Column within the current row
+    uint16_t        rowsDone;
+    uint16_t        y;          // Row within the frame
+    uint8_t         pass;
+    int             blockLeft;  // Bytes left in the current sub-block, -1 = terminator read
+};
+
+static int nextDataByte(LzwState& s) {
+    while (s.blockLeft == 0) {
+        int len = readByte(s.dec);
+        if (len <= 0) {
+            s.blockLeft = -1;
+            return -1;
+        }
+        s.blockLeft = len;
+    }
+    if (s.blockLeft < 0) return -1;
+    s.blockLeft--;
+    return readByte(s.dec);
+}
+
+static void advanceRow(LzwState& s) {
+    s.rowsDone++;
+    if (!s.frame.interlaced) {
+        s.y++;
+        return;
+    }
+    s.y += INTERLACE_STEP[s.pass];
+    while (s.y >= s.fullH && s.pass < 3) {
+        s.pass++;
+        s.y = INTERLACE_START[s.pass];
+    }
+}
+
+static void putPixel(LzwState& s, uint8_t index) {
+    if (s.rowsDone >= s.fullH) return;     // Excess data after the last row
+    s.dec.row[s.x++] = index;
+    if (s.x < s.fullW) return;
+
+    s.x = 0;
+    if (s.y < s.frame.h) {
+        s.emit(s.ctx, s.frame, s.frame.y + s.y, s.dec.row);
+    }
+    advanceRow(s);
+}
+
+static bool decodeImage(LzwState& s) {
+    GifDecoder& dec = s.dec;
+
+    int minCodeSize = readByte(dec);
+    if (minCodeSize < 1 || minCodeSize > 8) return false;
+
+    const int clear = 1 << minCodeSize;
+    const int eoi   = clear + 1;
+    int  codeSize = minCodeSize + 1;
+    int  next     = clear + 2;
+    int  prev     = -1;
+    uint8_t first = 0;
+
+    uint32_t bits  = 0;
+    int      nbits = 0;
+
+    for (;;) {
+        while (nbits < codeSize) {
+            int b = nextDataByte(s);
+            if (b < 0) goto done;           // Data ended without an end code
+            bits |= (uint32_t)b << nbits;
+            nbits += 8;
+        }
+        int code = bits & ((1 << codeSize) - 1);
+        bits >>= codeSize;
+        nbits -= codeSize;
+
+        if (code == clear) {
+            codeSize = minCodeSize + 1;
+            next     = clear + 2;
+            prev     = -1;
+            continue;
+        }
+        if (code == eoi) break;
+
+        if (prev < 0) {
+            if (code > clear) return false;
+            first = (uint8_t)code;
+            putPixel(s, first);
+            prev = code;
+            continue;
+        }
+
+        int in = code;
+        int sp = 0;
+        if (code >= next) {
+            if (code > next) return false;
+            dec.stack[sp++] = first;        // KwKwK: previous string + its first byte
+            code = prev;
+        }
+        while (code >= clear) {
+            if (sp >= GIF_LZW_CODES - 1) return false;
+            dec.stack[sp++] = dec.suffix[code];
+            code = dec.prefix[code];
+        }
+        first = (uint8_t)code;
+        dec.stack[sp++] = first;
+
+        if (next < GIF_LZW_CODES) {
+            dec.prefix[next] = (uint16_t)prev;
+            dec.suffix[next] = first;
+            next++;
+            if (next == (1 << codeSize) && codeSize < 12) codeSize++;
+        }
+        prev = in;
+
+        while (sp > 0) putPixel(s, dec.stack[--sp]);
+    }
+
+done:
+    // Whatever follows the end code up to the terminator
+    if (s.blockLeft > 0) {
+        while (s.blockLeft > 0) {
+            if (readByte(dec) < 0) return false;
+            s.blockLeft--;
+        }
+    }
+    if (s.blockLeft == 0 && !skipSubBlocks(dec)) return false;
+    return !dec.ioError;
+}
+
+// --- Public API ---
+
+bool gifOpen(GifDecoder& dec, GifReadFn read, void* ctx) {
+    memset(&dec, 0, sizeof(dec));
+    dec.read = read;
+    dec.ctx  = ctx;
+    dec.gceTransparent = GIF_NO_TRANSPARENT;
+
+    uint8_t hdr[13];
+    if (!readBytes(dec, hdr, sizeof(hdr))) return false;
+    if (memcmp(hdr, "GIF87a", 6) != 0 && memcmp(hdr, "GIF89a", 6) != 0) return false;
+
+    dec.width      = (uint16_t)(hdr[6] | (hdr[7] << 8));
+    dec.height     = (uint16_t)(hdr[8] | (hdr[9] << 8));
+    dec.background = hdr[11];
+    if (dec.width == 0 || dec.height == 0 ||
+        dec.width > GIF_MAX_WIDTH || dec.height > GIF_MAX_HEIGHT) {
+        return false;
+    }
+
+    if (hdr[10] & 0x80) {
+        if (!readPalette(dec, dec.globalPalette, 2 << (hdr[10] & 0x07))) return false;
+    }
+    dec.firstFrame = tell(dec);
+    return true;
+}
+
+GifResult gifNextFrame(GifDecoder& dec, GifFrame& frame, GifRowFn row, void* ctx) {
+    for (;;) {
+        int b = readByte(dec);
+        if (b < 0) return dec.ioError ? GIF_ERROR : GIF_END;   // A missing trailer ends it too
+        if (b == BLOCK_TRAILER) return GIF_END;
+
+        if (b == BLOCK_EXTENSION) {
+            if (!readExtension(dec)) return GIF_ERROR;
+            continue;
+        }
+        if (b != BLOCK_IMAGE) return GIF_ERROR;
+
+        int x = readU16(dec), y = readU16(dec), w = readU16(dec), h = readU16(dec);
+        int flags = readByte(dec);
+        if (x < 0 || y < 0 || w < 0 || h < 0 || flags < 0) return GIF_ERROR;
+        if (w == 0 || h == 0 || w > GIF_MAX_WIDTH) return GIF_ERROR;
+
+        frame.palette = dec.globalPalette;
+        if (flags & 0x80) {
+            if (!readPalette(dec, dec.localPalette, 2 << (flags & 0x07))) return GIF_ERROR;
+            frame.palette = dec.localPalette;
+        }
+
+        // Rows and columns off the logical screen are decoded but not emitted
+        frame.x = (uint16_t)x;
+        frame.y = (uint16_t)y;
+        frame.w = (x >= dec.width)  ? 0 : (uint16_t)(w < dec.width - x ? w : dec.width - x);
+        frame.h = (y >= dec.height) ? 0 : (uint16_t)(h < dec.height - y ? h : dec.height - y);
+        frame.delayMs     = (uint16_t)(dec.gceDelay * 10);
+        frame.disposal    = (GifDisposal)(dec.gceDisposal <= GIF_DISPOSE_PREVIOUS ? dec.gceDisposal : 0);
+        frame.transparent = dec.gceTransparent;
+        frame.interlaced  = (flags & 0x40) != 0;
+
+        // A graphic control extension applies to one image only
+        dec.gceDelay       = 0;
+        dec.gceDisposal    = 0;
+        dec.gceTransparent = GIF_NO_TRANSPARENT;
+
+        LzwState s = { dec, frame, row, ctx, (uint16_t)w, (uint16_t)h, 0, 0, 0, 0, 0 };
+        if (frame.w == 0) s.frame.h = 0;    // Entirely off screen: emit nothing
+        if (!decodeImage(s)) return GIF_ERROR;
+        return GIF_FRAME;
+    }
+}
+
+void gifRewind(GifDecoder& dec) {
+    seekTo(dec, dec.firstFrame);
+    dec.gceDelay       = 0;
+    dec.gceDisposal    = 0;
+    dec.gceTransparent = GIF_NO_TRANSPARENT;
+}
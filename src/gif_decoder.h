@@ -0,0 +1,111 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================
+// GIF Decoder - streaming LZW, one row at a time
+// ============================================================
+//
+// Reads a GIF through a read callback (the file stays on LittleFS) and
+// decodes one frame per gifNextFrame() call. Pixels never land in a
+// frame-sized buffer: each row of the frame's sub-rectangle is handed
+// to a callback as palette indices as soon as it is complete, so the
+// caller writes only the pixels the frame actually covers. Memory is
+// fixed: the LZW table (4096 codes), its output stack, both palettes,
+// a row of indices and a small input buffer, about 18 KB in all.
+// Interlaced frames come out in pass order; the callback gets the real
+// row each time.
+//
+// Disposal is left to the caller (GifFrame::disposal of the previous
+// frame applies before the next one is drawn).
+//
+// Plain C++ with no Arduino dependencies so decoding can be checked and
+// benchmarked on a desktop.
+
+#ifndef GIF_MAX_WIDTH
+#define GIF_MAX_WIDTH       240     // Widest logical screen / frame accepted
+#endif
+
+#ifndef GIF_MAX_HEIGHT
+#define GIF_MAX_HEIGHT      240
+#endif
+
+#ifndef GIF_INPUT_BUF
+#define GIF_INPUT_BUF       512     // Bytes read from the file at a time
+#endif
+
+#define GIF_LZW_CODES       4096
+#define GIF_NO_TRANSPARENT  (-1)
+
+// Read up to len bytes at offset. Returns the bytes read (short at the end
+// of the file), or -1 on an I/O error.
+typedef int32_t (*GifReadFn)(void* ctx, uint32_t offset, uint8_t* dst, uint32_t len);
+
+enum GifDisposal : uint8_t {
+    GIF_DISPOSE_NONE = 0,       // Unspecified: leave in place
+    GIF_DISPOSE_KEEP,           // Leave in place
+    GIF_DISPOSE_BACKGROUND,     // Clear the frame's rectangle
+    GIF_DISPOSE_PREVIOUS        // Restore what was there before the frame
+};
+
+struct GifFrame {
+    uint16_t        x, y;       // Position on the logical screen
+    uint16_t        w, h;       // Clipped to the logical screen
+    uint16_t        delayMs;    // As stored (10 ms units); 0 = none given
+    GifDisposal     disposal;
+    int16_t         transparent;    // Palette index, or GIF_NO_TRANSPARENT
+    bool            interlaced;
+    const uint16_t* palette;    // RGB565, 256 entries (unused ones black)
+};
+
+enum GifResult {
+    GIF_FRAME = 0,              // A frame was decoded
+    GIF_END,                    // Trailer reached: gifRewind() to loop
+    GIF_ERROR                   // Malformed, unsupported or I/O error
+};
+
+// Called once per row of the frame, y on the logical screen.
+// indices holds frame.w palette indices starting at frame.x.
+typedef void (*GifRowFn)(void* ctx, const GifFrame& frame, int y, const uint8_t* indices);
+
+struct GifDecoder {
+    GifReadFn read;
+    void*     ctx;
+    uint32_t  pos;              // File offset of in[0]
+    uint32_t  firstFrame;       // Offset just past the header and global palette
+    uint16_t  width;            // Logical screen
+    uint16_t  height;
+    uint8_t   background;       // Background palette index
+    uint16_t  loops;            // NETSCAPE loop count, 0 = forever
+    bool      hasLoops;
+
+    // Graphic control extension for the next image
+    uint16_t  gceDelay;
+    uint8_t   gceDisposal;
+    int16_t   gceTransparent;
+
+    uint16_t  globalPalette[256];
+    uint16_t  localPalette[256];
+
+    uint16_t  prefix[GIF_LZW_CODES];
+    uint8_t   suffix[GIF_LZW_CODES];
+    uint8_t   stack[GIF_LZW_CODES];
+    uint8_t   row[GIF_MAX_WIDTH];
+
+    uint8_t   in[GIF_INPUT_BUF];
+    uint16_t  inLen;
+    uint16_t  inPos;
+    bool      eof;
+    bool      ioError;
+};
+
+// Reads the header and global palette. false = not a GIF, bigger than
+// GIF_MAX_WIDTH x GIF_MAX_HEIGHT, or unreadable.
+bool gifOpen(GifDecoder& dec, GifReadFn read, void* ctx);
+
+// Decode the next frame, calling row() for each of its rows
+GifResult gifNextFrame(GifDecoder& dec, GifFrame& frame, GifRowFn row, void* ctx);
+
+// Back to the first frame
+void gifRewind(GifDecoder& dec);
@@ -0,0 +1,52 @@
+#include "histogram.h"
+
+#include <string.h>
+
+// ============================================================
+// Histogram Implementation
+// ============================================================
+
+static int bucketFor(uint32_t value) {
+    int b = 0;
+    while (value > 1 && b < HISTOGRAM_BUCKETS - 1) {
+        value >>= 1;
+        b++;
+    }
+    return b;
+}
+
+void histogramInit(Histogram& h) {
+    memset(&h, 0, sizeof(h));
+}
+
+void histogramAdd(Histogram& h, uint32_t value) {
+    h.buckets[bucketFor(value)]++;
+    if (h.count == 0 || value < h.min) h.min = value;
+    if (value > h.max) h.max = value;
+    h.count++;
+    h.sum += value;
+}
+
+uint32_t histogramMean(const Histogram& h) {
+    return h.count ? (uint32_t)(h.sum / h.count) : 0;
+}
+
+uint32_t histogramPercentile(const Histogram& h, uint8_t pct) {
+    if (h.count == 0) return 0;
+
+    uint64_t target = ((uint64_t)h.count * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+        seen += h.buckets[b];
+        if (seen >= target) {
+            uint32_t limit = histogramBucketLimit(b);
+            return (limit > h.max) ? h.max : limit;
+        }
+    }
+    return h.max;
+}
+
+uint32_t histogramBucketLimit(int bucket) {
+    if (bucket >= HISTOGRAM_BUCKETS - 1) return UINT32_MAX;
+    return (uint32_t)2 << bucket;
+}
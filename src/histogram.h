@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============================================================
+// Histogram - fixed-size power-of-two bucket histogram
+// ============================================================
+//
+// Bucket 0 counts values 0-1, bucket i counts [2^i, 2^(i+1)), the last
+// bucket everything above. Constant memory, O(1) insert, no allocation,
+// so it can be updated from any task. Percentiles are bucket upper
+// bounds, accurate to a factor of two.
+//
+// Plain C++ with no Arduino dependencies.
+
+#ifndef HISTOGRAM_BUCKETS
+#define HISTOGRAM_BUCKETS   20      // Top bucket starts at 2^19 (~0.5 s in us)
+#endif
+
+struct Histogram {
+    uint32_t buckets[HISTOGRAM_BUCKETS];
+    uint32_t count;
+    uint64_t sum;
+    uint32_t min;
+    uint32_t max;
+};
+
+void     histogramInit(Histogram& h);
+void     histogramAdd(Histogram& h, uint32_t value);
+uint32_t histogramMean(const Histogram& h);
+uint32_t histogramPercentile(const Histogram& h, uint8_t pct);  // Upper bound of the bucket
+uint32_t histogramBucketLimit(int bucket);                      // Exclusive upper bound
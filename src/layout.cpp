@@ -0,0 +1,278 @@
+#include "layout.h"
+#include "render_scheduler.h"
+
+#include <string.h>
+
+// ============================================================
+// Layout Engine Implementation
+// ============================================================
+
+#ifndef LAYOUT_ICON_SIZE
+#define LAYOUT_ICON_SIZE        48      // Weather icons are square
+#endif
+
+// --- Tables (indexed by enum) ---
+
+static const char* const KIND_NAMES[LAYOUT_KIND_COUNT] = {
+    "text", "clock", "icon", "dot", "hline"
+};
+
+static const char* const BINDING_NAMES[BIND_COUNT] = {
+    "none", "time", "date", "weather", "weather_icon", "temperature", "wifi",
+    "sta_ip", "ip", "firmware", "network", "rssi", "heap", "uptime", "ota", "mac"
+};
+
+static const uint32_t BINDING_DEPS[BIND_COUNT] = {
+    0,                                          // none: drawn once per page entry
+    RENDER_DIRTY_MINUTE | RENDER_DIRTY_TIME,    // time
+    RENDER_DIRTY_MINUTE | RENDER_DIRTY_TIME,    // date
+    RENDER_DIRTY_WEATHER,                       // weather
+    RENDER_DIRTY_WEATHER,                       // weather_icon
+    RENDER_DIRTY_WEATHER,                       // temperature
+    RENDER_DIRTY_WIFI,                          // wifi
+    RENDER_DIRTY_WIFI,                          // sta_ip
+    RENDER_DIRTY_WIFI,                          // ip
+    0,                                          // firmware
+    RENDER_DIRTY_WIFI,                          // network
+    RENDER_DIRTY_SYSTEM,                        // rssi
+    RENDER_DIRTY_SYSTEM,                        // heap
+    RENDER_DIRTY_SECOND,                        // uptime
+    RENDER_DIRTY_SYSTEM,                        // ota
+    RENDER_DIRTY_SYSTEM,                        // mac
+};
+
+static const char* const FONT_NAMES[LAYOUT_FONT_COUNT] = {
+    "0", "2", "4", "7", "ui"
+};
+
+// --- Internal helpers ---
+
+static bool lookup(const char* const* names, int count, const char* name, int& out) {
+    if (!name) return false;
+    for (int i = 0; i < count; i++) {
+        if (strcmp(names[i], name) == 0) {
+            out = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Templates are spliced by hand rather than passed to printf, so a JSON
+// layout can't smuggle in other conversions. "%%" is a literal percent.
+static const char* checkFormat(const char* fmt, bool bound) {
+    int slots = 0;
+    for (const char* p = fmt; *p; p++) {
+        if (*p != '%') continue;
+        p++;
+        if (*p == 's') {
+            slots++;
+        } else if (*p != '%') {
+            return "format may only contain %s and %%";
+        }
+    }
+    if (slots > 1) return "format has more than one %s";
+    if (slots == 1 && !bound) return "static text has a %s";
+    return nullptr;
+}
+
+static void applyFormat(const char* fmt, const char* value, char* out, size_t len) {
+    size_t n = 0;
+    for (const char* p = fmt; *p && n + 1 < len; p++) {
+        if (*p == '%' && (p[1] == 's' || p[1] == '%')) {
+            p++;
+            if (*p == '%') {
+                out[n++] = '%';
+                continue;
+            }
+            for (const char* v = value; *v && n + 1 < len; v++) out[n++] = *v;
+            continue;
+        }
+        out[n++] = *p;
+    }
+    out[n] = '\0';
+}
+
+static bool sameValue(const LayoutValue& a, const LayoutValue& b) {
+    return a.visible == b.visible && a.color == b.color && strcmp(a.text, b.text) == 0;
+}
+
+// Extent known without drawing; false for text and the clock, which are
+// measured when drawn. Worked in int so a huge size can't wrap int16_t.
+static bool fixedExtent(const LayoutOp& op, int& x, int& y, int& w, int& h) {
+    switch (op.kind) {
+        case LAYOUT_ICON:  w = h = LAYOUT_ICON_SIZE; break;
+        case LAYOUT_DOT:   w = h = op.size * 2 + 1;  break;
+        case LAYOUT_HLINE: w = op.size; h = 1;       break;
+        default:           return false;
+    }
+    x = op.x;
+    y = op.y;
+    if (op.align != LAYOUT_ALIGN_LEFT) {
+        x -= w / 2;
+        y -= h / 2;
+    }
+    return true;
+}
+
+static const char* compileWidget(const LayoutWidget& w, LayoutOp& op) {
+    if (w.kind >= LAYOUT_KIND_COUNT)   return "unknown widget kind";
+    if (w.bind >= BIND_COUNT)          return "unknown binding";
+    if (w.font >= LAYOUT_FONT_COUNT)   return "unknown font";
+    if (w.align > LAYOUT_ALIGN_LEFT)   return "unknown alignment";
+
+    memset(&op, 0, sizeof(op));
+    op.kind  = w.kind;
+    op.bind  = w.bind;
+    op.font  = w.font;
+    op.align = w.align;
+    op.x     = w.x;
+    op.y     = w.y;
+    op.size  = w.size;
+    op.color = w.color;
+    op.deps  = BINDING_DEPS[w.bind];
+
+    switch (w.kind) {
+        case LAYOUT_TEXT: {
+            bool bound = w.bind != BIND_NONE;
+            const char* fmt = (w.format && w.format[0]) ? w.format : (bound ? "%s" : nullptr);
+            if (!fmt) return "static text needs a format";
+            if (strlen(fmt) >= LAYOUT_FORMAT_LEN) return "format too long";
+            const char* err = checkFormat(fmt, bound);
+            if (err) return err;
+            if (w.font == LAYOUT_FONT_UI && w.align != LAYOUT_ALIGN_CENTER) {
+                return "ui font text must be centered";
+            }
+            strcpy(op.format, fmt);
+            break;
+        }
+        case LAYOUT_CLOCK:
+            if (w.bind != BIND_TIME) return "clock must bind time";
+            strcpy(op.format, "%s");
+            break;
+        case LAYOUT_ICON:
+            if (w.bind != BIND_WEATHER_ICON) return "icon must bind weather_icon";
+            break;
+        case LAYOUT_DOT:
+        case LAYOUT_HLINE:
+            if (w.size <= 0) return "size must be positive";
+            if (w.kind == LAYOUT_HLINE && w.bind != BIND_NONE) return "hline cannot bind";
+            break;
+        default:
+            break;
+    }
+
+    // Backends draw fixed boxes unclipped (the icon is decoded straight
+    // into the frame), so a box must lie wholly on the panel
+    int x, y, bw, bh;
+    if (fixedExtent(op, x, y, bw, bh)) {
+        if (x < 0 || y < 0 || x + bw > DISPLAY_WIDTH || y + bh > DISPLAY_HEIGHT) {
+            return "widget off screen";
+        }
+        op.box = { (int16_t)x, (int16_t)y, (int16_t)bw, (int16_t)bh };
+    }
+    return nullptr;
+}
+
+// --- Public API ---
+
+const char* layoutCompile(const LayoutWidget* widgets, int count, LayoutProgram& out) {
+    memset(&out, 0, sizeof(out));
+    if (count <= 0)             return "no widgets";
+    if (count > LAYOUT_MAX_OPS) return "too many widgets";
+
+    for (int i = 0; i < count; i++) {
+        const char* err = compileWidget(widgets[i], out.ops[i]);
+        if (err) {
+            memset(&out, 0, sizeof(out));
+            return err;
+        }
+        out.deps |= out.ops[i].deps;
+    }
+    out.count = count;
+    return nullptr;
+}
+
+void layoutReset(LayoutState& state) {
+    memset(&state, 0, sizeof(state));
+    state.initialized = false;
+}
+
+void layoutRun(const LayoutProgram& prog, LayoutState& state, uint32_t dirty,
+               const LayoutBackend& backend, LayoutRunStats* stats) {
+    LayoutRunStats local = { 0, 0, 0, 0 };
+    bool all = !state.initialized;
+
+    for (int i = 0; i < prog.count; i++) {
+        const LayoutOp& op = prog.ops[i];
+        LayoutOpState&  st = state.ops[i];
+
+        if (!all && st.valid && (op.deps & dirty) == 0) {
+            local.skipped++;
+            continue;
+        }
+        local.evaluated++;
+
+        LayoutValue v;
+        v.text[0] = '\0';
+        v.color   = op.color;
+        v.visible = true;
+        if (op.bind != BIND_NONE) {
+            backend.value(backend.ctx, op.bind, v);
+        }
+        if (op.kind == LAYOUT_TEXT || op.kind == LAYOUT_CLOCK) {
+            char raw[LAYOUT_VALUE_LEN];
+            memcpy(raw, v.text, sizeof(raw));
+            applyFormat(op.format, raw, v.text, sizeof(v.text));
+        }
+
+        if (st.valid && sameValue(st.value, v)) continue;
+
+        bool erase = st.drawn.w > 0 && (!v.visible || op.kind == LAYOUT_TEXT);
+        if (erase) {
+            backend.erase(backend.ctx, st.drawn);
+            local.erased++;
+        }
+        if (v.visible) {
+            // prev.drawn is stale after an erase; hand the op a clean slate
+            if (erase) st.drawn = { 0, 0, 0, 0 };
+            st.drawn = backend.draw(backend.ctx, op, v, st);
+            local.drawn++;
+        } else {
+            st.drawn = { 0, 0, 0, 0 };
+        }
+        st.value = v;
+        st.valid = true;
+    }
+    state.initialized = true;
+
+    if (stats) *stats = local;
+}
+
+bool layoutKindFromName(const char* name, LayoutKind& out) {
+    int i;
+    if (!lookup(KIND_NAMES, LAYOUT_KIND_COUNT, name, i)) return false;
+    out = (LayoutKind)i;
+    return true;
+}
+
+bool layoutBindingFromName(const char* name, LayoutBinding& out) {
+    int i;
+    if (!lookup(BINDING_NAMES, BIND_COUNT, name, i)) return false;
+    out = (LayoutBinding)i;
+    return true;
+}
+
+bool layoutFontFromName(const char* name, LayoutFont& out) {
+    int i;
+    if (!lookup(FONT_NAMES, LAYOUT_FONT_COUNT, name, i)) return false;
+    out = (LayoutFont)i;
+    return true;
+}
+
+bool layoutAlignFromName(const char* name, LayoutAlign& out) {
+    if (!name) return false;
+    if (strcmp(name, "center") == 0) { out = LAYOUT_ALIGN_CENTER; return true; }
+    if (strcmp(name, "left") == 0)   { out = LAYOUT_ALIGN_LEFT;   return true; }
+    return false;
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "dirty_rect.h"
+
+// ============================================================
+// Layout Engine - pages described as data, drawn differentially
+// ============================================================
+//
+// A page is a list of widgets (a built-in table in display.cpp, or a
+// JSON file on LittleFS), compiled once into a flat array of ops. Each op
+// carries its anchor, its data binding and the RenderDirty flags that
+// binding depends on. layoutRun() is the only differential renderer:
+// per op it skips if none of its flags are dirty, fetches the bound
+// value, compares it with what is on screen, erases what the op drew
+// last time and draws again - all through a small backend, so the
+// engine itself never touches the panel.
+//
+// Plain C++ with no Arduino dependencies so layouts can be compiled and
+// the engine benchmarked on a desktop.
+
+#ifndef LAYOUT_MAX_OPS
+#define LAYOUT_MAX_OPS          16      // Widgets per page
+#endif
+
+#ifndef LAYOUT_FORMAT_LEN
+#define LAYOUT_FORMAT_LEN       24      // Text template incl. terminator
+#endif
+
+#ifndef LAYOUT_VALUE_LEN
+#define LAYOUT_VALUE_LEN        40      // Formatted text incl. terminator
+#endif
+
+// --- Description ---
+
+enum LayoutKind : uint8_t {
+    LAYOUT_TEXT = 0,            // Formatted string
+    LAYOUT_CLOCK,               // "HH:MM" in Font7, only changed digits redrawn
+    LAYOUT_ICON,                // Weather icon, 48x48
+    LAYOUT_DOT,                 // Filled circle, radius = size
+    LAYOUT_HLINE,               // Horizontal rule, length = size
+    LAYOUT_KIND_COUNT
+};
+
+enum LayoutBinding : uint8_t {
+    BIND_NONE = 0,              // Static: the format is the text
+    BIND_TIME,                  // "HH:MM"
+    BIND_DATE,
+    BIND_WEATHER,               // Condition name, or "No weather data"
+    BIND_WEATHER_ICON,          // Hidden without weather
+    BIND_TEMPERATURE,           // "21F", hidden without weather
+    BIND_WIFI,                  // Colored by link state
+    BIND_STA_IP,                // Hidden unless connected as a station
+    BIND_IP,
+    BIND_FIRMWARE,
+    BIND_NETWORK,               // SSID, "AP Mode" or "Disconnected"
+    BIND_RSSI,
+    BIND_HEAP,                  // Free heap, KB
+    BIND_UPTIME,                // "1h 2m 3s"
+    BIND_OTA,                   // "Confirmed" / "Pending"
+    BIND_MAC,
+    BIND_COUNT
+};
+
+enum LayoutFont : uint8_t {
+    LAYOUT_FONT_0 = 0,          // 6x8
+    LAYOUT_FONT_2,              // 16 px
+    LAYOUT_FONT_4,              // 26 px
+    LAYOUT_FONT_7,              // 48 px seven-segment
+    LAYOUT_FONT_UI,             // Smooth VLW font when loaded, Font2 otherwise (centered only)
+    LAYOUT_FONT_COUNT
+};
+
+enum LayoutAlign : uint8_t {
+    LAYOUT_ALIGN_CENTER = 0,    // (x, y) is the middle of the text
+    LAYOUT_ALIGN_LEFT           // (x, y) is the top-left corner
+};
+
+struct LayoutWidget {
+    LayoutKind    kind;
+    LayoutBinding bind;
+    LayoutFont    font;
+    LayoutAlign   align;
+    int16_t       x;
+    int16_t       y;
+    int16_t       size;         // DOT radius, HLINE length
+    uint16_t      color;        // RGB565; a binding may override it
+    const char*   format;       // TEXT: template with at most one %s; copied by the compiler
+};
+
+// --- Compiled program ---
+
+struct LayoutOp {
+    LayoutKind    kind;
+    LayoutBinding bind;
+    LayoutFont    font;
+    LayoutAlign   align;
+    int16_t       x;
+    int16_t       y;
+    int16_t       size;
+    uint16_t      color;
+    DirtyRect     box;          // Fixed extent (ICON, DOT, HLINE); text is measured when drawn
+    uint32_t      deps;         // RenderDirty flags that can change the value
+    char          format[LAYOUT_FORMAT_LEN];
+};
+
+struct LayoutProgram {
+    LayoutOp ops[LAYOUT_MAX_OPS];
+    int      count;
+    uint32_t deps;              // Union of all ops, for the page's interest mask
+};
+
+// --- Runtime ---
+
+struct LayoutValue {
+    char     text[LAYOUT_VALUE_LEN];
+    uint16_t color;
+    bool     visible;
+};
+
+struct LayoutOpState {
+    LayoutValue value;          // As last drawn
+    DirtyRect   drawn;          // Pixels covered, erased before the next draw
+    bool        valid;
+};
+
+struct LayoutState {
+    LayoutOpState ops[LAYOUT_MAX_OPS];
+    bool          initialized;  // False = next run draws every op
+};
+
+// What the engine needs from the display. value() fills in the raw bound
+// value (text, and color/visible if the binding overrides them); draw()
+// draws it and returns the box it covered. Fixed-box ops and LAYOUT_CLOCK
+// overwrite their previous pixels themselves, so only text is erased.
+struct LayoutBackend {
+    void*     ctx;
+    void      (*value)(void* ctx, LayoutBinding bind, LayoutValue& out);
+    DirtyRect (*draw)(void* ctx, const LayoutOp& op, const LayoutValue& value,
+                      const LayoutOpState& prev);
+    void      (*erase)(void* ctx, const DirtyRect& box);
+};
+
+struct LayoutRunStats {
+    uint16_t skipped;           // No dependency dirty
+    uint16_t evaluated;         // Value fetched and compared
+    uint16_t drawn;
+    uint16_t erased;
+};
+
+// Returns nullptr on success, otherwise what is wrong (out is then empty)
+const char* layoutCompile(const LayoutWidget* widgets, int count, LayoutProgram& out);
+
+void layoutReset(LayoutState& state);
+
+// One differential pass. dirty = RenderDirty flags raised since the last
+// pass; ignored (everything drawn) after layoutReset().
+void layoutRun(const LayoutProgram& prog, LayoutState& state, uint32_t dirty,
+               const LayoutBackend& backend, LayoutRunStats* stats);
+
+// --- Names (JSON layouts) ---
+
+bool layoutKindFromName(const char* name, LayoutKind& out);
+bool layoutBindingFromName(const char* name, LayoutBinding& out);
+bool layoutFontFromName(const char* name, LayoutFont& out);
+bool layoutAlignFromName(const char* name, LayoutAlign& out);
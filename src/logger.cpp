@@ -6,6 +6,12 @@
 static char logBuffer[LOG_BUFFER_SIZE][LOG_LINE_LENGTH];
 static int  logHead  = 0;   // Next write position
 static int  logCount = 0;   // Entries currently stored (max LOG_BUFFER_SIZE)
+static uint32_t logSeq = 0; // Lines stored since boot
+
+static void (*logListener)() = nullptr;
+
+// The render task logs too, so buffer updates are guarded
+static portMUX_TYPE logMux = portMUX_INITIALIZER_UNLOCKED;
 
 // --- Public API ---
 
@@ -13,6 +19,7 @@ void logInit() {
     memset(logBuffer, 0, sizeof(logBuffer));
     logHead  = 0;
     logCount = 0;
+    logSeq   = 0;
     Serial.println(F("[LOG] Logger initialized"));
 }
 
@@ -25,6 +32,7 @@ void logPrint(const char* msg) {
     Serial.println(line);
 
     // Store in circular buffer
+    portENTER_CRITICAL(&logMux);
     strncpy(logBuffer[logHead], line, LOG_LINE_LENGTH - 1);
     logBuffer[logHead][LOG_LINE_LENGTH - 1] = '\0';
 
@@ -32,6 +40,12 @@ void logPrint(const char* msg) {
     if (logCount < LOG_BUFFER_SIZE) {
         logCount++;
     }
+    logSeq++;
+    portEXIT_CRITICAL(&logMux);
+
+    if (logListener) {
+        logListener();
+    }
 }
 
 void logPrintf(const char* format, ...) {
@@ -44,21 +58,53 @@ void logPrintf(const char* format, ...) {
 }
 
 String logGetAll() {
-    String out;
-    out.reserve(logCount * (LOG_LINE_LENGTH / 2));  // Conservative pre-alloc
+    portENTER_CRITICAL(&logMux);
+    uint32_t newest = logSeq;
+    int      count  = logCount;
+    portEXIT_CRITICAL(&logMux);
 
-    if (logCount == 0) {
+    if (count == 0) {
         return F("(no log entries)");
     }
 
-    // Start from the oldest entry in the buffer
-    int start = (logCount < LOG_BUFFER_SIZE) ? 0 : logHead;
+    String out;
+    out.reserve(count * (LOG_LINE_LENGTH / 2));  // Conservative pre-alloc
 
-    for (int i = 0; i < logCount; i++) {
-        int idx = (start + i) % LOG_BUFFER_SIZE;
-        out += logBuffer[idx];
-        out += '\n';
+    // Oldest first, each line copied under the mux by logGetLine(): other
+    // tasks keep logging while this runs. A line overwritten meanwhile is
+    // skipped rather than read half-written.
+    char line[LOG_LINE_LENGTH];
+    for (uint32_t seq = newest - count; seq != newest; seq++) {
+        if (logGetLine(seq, line, sizeof(line))) {
+            out += line;
+            out += '\n';
+        }
     }
 
     return out;
 }
+
+uint32_t logSequence() {
+    portENTER_CRITICAL(&logMux);
+    uint32_t seq = logSeq;
+    portEXIT_CRITICAL(&logMux);
+    return seq;
+}
+
+bool logGetLine(uint32_t seq, char* dst, size_t len) {
+    bool ok = false;
+    portENTER_CRITICAL(&logMux);
+    uint32_t age = logSeq - seq;    // 1 = newest line
+    if (seq < logSeq && age <= (uint32_t)logCount) {
+        int idx = (logHead - (int)age + LOG_BUFFER_SIZE) % LOG_BUFFER_SIZE;
+        strncpy(dst, logBuffer[idx], len - 1);
+        dst[len - 1] = '\0';
+        ok = true;
+    }
+    portEXIT_CRITICAL(&logMux);
+    return ok;
+}
+
+void logSetListener(void (*listener)()) {
+    logListener = listener;
+}
@@ -6,8 +6,19 @@
 // Simple circular log buffer with Serial output.
 // Stores the last LOG_BUFFER_SIZE entries, each up to LOG_LINE_LENGTH chars.
 // All entries are timestamped with millis().
+//
+// Every line gets a sequence number (0, 1, 2, ... since boot), so a reader
+// can pick up exactly the lines it has not seen yet, as long as they are
+// still in the buffer.
 
 void logInit();
 void logPrint(const char* msg);
 void logPrintf(const char* format, ...);
 String logGetAll();
+
+uint32_t logSequence();                                    // Sequence number of the next line
+bool     logGetLine(uint32_t seq, char* dst, size_t len);  // false = not written yet or overwritten
+
+// Called after every stored line, outside the buffer lock. Must be cheap:
+// it runs on whichever task logged.
+void logSetListener(void (*listener)());
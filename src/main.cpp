@@ -8,50 +8,293 @@
 #include "logger.h"
 #include "settings.h"
 #include "display.h"
+#include "backlight.h"
 #include "touch.h"
 #include "wifi_manager.h"
 #include "weather.h"
 #include "ota.h"
 #include "web_server.h"
+#include "remote_display.h"
+#include "screen_stream.h"
+#include "splash.h"
+#include "photo.h"
+#include "boot_trace.h"
+#include "scheduler.h"
 
 // ============================================================
-// Time Formatting
+// Loop Profiling
 // ============================================================
+// Iterations and the slowest iteration over one-second windows, for the
+// performance HUD. The wait for the next job is not counted as loop time.
 
-static bool getFormattedTime(char* timeBuf, size_t timeBufLen,
-                             char* dateBuf, size_t dateBufLen) {
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo, 100)) {
-        return false;
-    }
+static uint32_t      loopCount       = 0;
+static uint32_t      loopWorstUs     = 0;
+static unsigned long loopWindowStart = 0;
+static uint32_t      loopsPerSec     = 0;   // Last complete window
+static uint32_t      worstLoopUs     = 0;
 
-    // HH:MM (24-hour)
-    strftime(timeBuf, timeBufLen, "%H:%M", &timeinfo);
+static void profileLoop(uint32_t startUs) {
+    uint32_t elapsed = micros() - startUs;
+    if (elapsed > loopWorstUs) loopWorstUs = elapsed;
+    loopCount++;
 
-    // "Mon Feb 10"
-    strftime(dateBuf, dateBufLen, "%a %b %d", &timeinfo);
+    unsigned long now = millis();
+    if (now - loopWindowStart >= 1000) {
+        loopsPerSec     = (loopCount * 1000) / (now - loopWindowStart);
+        worstLoopUs     = loopWorstUs;
+        loopCount       = 0;
+        loopWorstUs     = 0;
+        loopWindowStart = now;
+    }
+}
 
-    return true;
+// ============================================================
+// Display State
+// ============================================================
+// Gather everything the display shows from other modules and hand it to
+// the render task. displayPublish() diffs against the previous state and
+// only wakes the render task for what changed.
+
+static void publishDisplayState() {
+    DisplayState state;
+    memset(&state, 0, sizeof(state));
+
+    String ssidStr = wifiGetSSID();
+    String ipStr   = wifiGetIP();
+    String macStr  = wifiGetMAC();
+
+    state.apMode        = wifiIsAPMode();
+    state.wifiConnected = wifiIsConnected();
+    strncpy(state.ssid, ssidStr.c_str(), sizeof(state.ssid) - 1);
+    strncpy(state.ip, ipStr.c_str(), sizeof(state.ip) - 1);
+    strncpy(state.mac, macStr.c_str(), sizeof(state.mac) - 1);
+    state.rssi          = wifiGetRSSI();
+    state.freeHeapKB    = ESP.getFreeHeap() / 1024;
+    state.largestBlockKB = ESP.getMaxAllocHeap() / 1024;
+    state.otaConfirmed  = otaIsConfirmed();
+    state.loopsPerSec   = loopsPerSec;
+    state.worstLoopUs   = worstLoopUs;
+    state.weather       = weatherGet();
+
+    displayPublish(state);
 }
 
 // ============================================================
 // Screen Dimming
 // ============================================================
+// A one-shot job SCREEN_DIM_MS after the last touch, pushed back by
+// every touch event.
 
-static unsigned long lastTouchTime = 0;
-static bool          screenDimmed  = false;
-static bool          screenOffByUser = false; // Set when long press turns screen off
+static int  dimJob          = -1;
+static bool screenDimmed    = false;
+static bool screenOffByUser = false; // Set when long press turns screen off
 
-static void handleScreenDimming() {
-    // Don't auto-dim or auto-wake while user explicitly turned screen off via long press.
+static void dimScreen() {
+    // Don't auto-dim while user explicitly turned screen off via long press.
     // Wake is handled by the tap event handler instead.
-    if (screenOffByUser) return;
+    if (screenOffByUser || screenDimmed) return;
+
+    backlightSetMode(BACKLIGHT_MODE_DIM);
+    screenDimmed = true;
+}
+
+static void noteTouch() {
+    schedRunIn(dimJob, SCREEN_DIM_MS);
+}
+
+// ============================================================
+// Touch Events
+// ============================================================
+
+static void handleTouchEvents() {
+    // Tap cycles pages, long press toggles backlight
+    if (touchWasTapped()) {
+        noteTouch();
+
+        // If screen was off (by user or auto-dim), wake it on tap instead of cycling pages
+        if (screenDimmed || screenOffByUser) {
+            backlightSetMode(BACKLIGHT_MODE_NORMAL);
+            screenDimmed = false;
+            screenOffByUser = false;
+        } else {
+            DisplayPage next = (DisplayPage)((displayGetPage() + 1) % PAGE_COUNT);
+            displaySetPage(next);
+            logPrintf("Page changed to %d", (int)next);
+        }
+    }
+
+    if (touchWasLongPressed()) {
+        noteTouch();
+
+        if (screenDimmed || screenOffByUser) {
+            // Wake from any dimmed/off state
+            backlightSetMode(BACKLIGHT_MODE_NORMAL);
+            screenDimmed = false;
+            screenOffByUser = false;
+        } else {
+            // Turn screen off
+            backlightSetMode(BACKLIGHT_MODE_OFF);
+            screenOffByUser = true;
+        }
+        logPrintf("Backlight toggled (off=%s)", screenOffByUser ? "true" : "false");
+    }
+
+    // Double tap toggles the performance HUD (and wakes like a tap)
+    if (touchWasDoubleTapped()) {
+        noteTouch();
+
+        if (screenDimmed || screenOffByUser) {
+            backlightSetMode(BACKLIGHT_MODE_NORMAL);
+            screenDimmed = false;
+            screenOffByUser = false;
+        } else {
+            displaySetHud(!displayGetHud());
+            logPrintf("Performance HUD %s", displayGetHud() ? "on" : "off");
+        }
+    }
+}
+
+// ============================================================
+// Network Up
+// ============================================================
+// WiFi connects in the background (see wifi_fsm.h), so what needs the
+// network starts when an IP arrives instead of in setup().
+
+static int  weatherJob  = -1;
+static bool wifiMarked  = false;
+static bool mdnsStarted = false;
+
+static void networkUp() {
+    if (!wifiIsConnected()) return;
+
+    if (!wifiMarked) {
+        bootTraceMark("wifi");
+        wifiMarked = true;
+    }
+
+    if (!mdnsStarted) {
+        Settings& settings = settingsGet();
+        mdnsStarted = MDNS.begin(settings.hostname);
+        if (mdnsStarted) {
+            MDNS.addService("http", "tcp", WEB_SERVER_PORT);
+            logPrintf("mDNS started: %s.local", settings.hostname);
+        } else {
+            logPrintf("mDNS failed to start");
+        }
+    }
+
+    // Fresh weather shortly after every (re)connect
+    schedRunIn(weatherJob, WEATHER_FIRST_FETCH_MS);
+}
+
+// ============================================================
+// Jobs
+// ============================================================
+// Everything loop() does, each at its own cadence (see scheduler.h).
+//
+// Sockets, captive portal DNS and the photo prefetch have no event to
+// wait on and are polled. Each polled job re-arms itself at the period
+// its module asks for: SCHED_POLL_MS only while it has work in flight,
+// SCHED_IDLE_POLL_MS otherwise. Re-arming on the aligned grid lets the
+// idle ones share one wakeup. Touch idles at TOUCH_IDLE_POLL_MS and its
+// pad interrupt wakes it when a finger lands; WiFi events wake the wifi
+// job.
+
+static int publishJob  = -1;
+static int netUpJob    = -1;
+static int touchJobId  = -1;
+static int webJobId    = -1;
+static int wifiJobId   = -1;
+static int otaJobId    = -1;
+static int remoteJobId = -1;
+static int streamJobId = -1;
+static int photoJobId  = -1;
+
+static void IRAM_ATTR touchWake() {
+    schedTriggerFromISR(touchJobId);
+}
+
+static void touchJob() {
+    touchUpdate();
+    handleTouchEvents();
+    schedRunAligned(touchJobId, touchPollMs());
+}
+
+static void webJob() {
+    webServerUpdate();
+    schedRunAligned(webJobId, webServerPollMs());
+}
+
+static void wifiJob() {
+    wifiUpdate();
+    schedRunAligned(wifiJobId, wifiPollMs());
+}
+
+static void otaJob() {
+    otaUpdate();        // An ArduinoOTA transfer runs inside this call
+    schedRunAligned(otaJobId, SCHED_IDLE_POLL_MS);
+}
+
+static void remoteJob() {
+    remoteDisplayUpdate();
+    schedRunAligned(remoteJobId, remoteDisplayPollMs());
+}
+
+static void streamJob() {
+    screenStreamUpdate();
+    schedRunAligned(streamJobId, screenStreamPollMs());
+}
 
-    // Auto-dim timeout: dim screen after SCREEN_DIM_MS of no touch events
-    if (!screenDimmed && (millis() - lastTouchTime) >= SCREEN_DIM_MS) {
-        displaySetBrightness(BRIGHTNESS_DIM);
-        screenDimmed = true;
+static void photoJob() {
+    photoUpdate();
+    schedRunAligned(photoJobId, photoPollMs());
+}
+
+static void registerJobs() {
+    schedInit();
+
+    // Input
+    touchJobId  = schedAfter("touch",  0, touchJob);
+    touchSetWakeISR(touchWake);
+
+    // Network services (polled, each re-arms itself)
+    webJobId    = schedAfter("web",    0, webJob);
+    wifiJobId   = schedAfter("wifi",   0, wifiJob);
+    otaJobId    = schedAfter("ota",    0, otaJob);
+    remoteJobId = schedAfter("remote", 0, remoteJob);
+    streamJobId = schedAfter("stream", 0, streamJob);
+    schedEvery("wifi-monitor", WIFI_MONITOR_INTERVAL, WIFI_MONITOR_INTERVAL, wifiMonitor);
+    weatherJob = schedEvery("weather", WEATHER_FETCH_INTERVAL, WEATHER_FIRST_FETCH_MS, weatherUpdate);
+
+    // Display state handoff (the render task draws on its own core)
+    publishJob = schedEvery("publish", DISPLAY_PUBLISH_MS, 0, publishDisplayState);
+    schedEvery("backlight",    BACKLIGHT_POLL_MS,     0, backlightUpdate);
+    schedEvery("splash",       SPLASH_POLL_MS,        SPLASH_POLL_MS, splashUpdate);
+    photoJobId  = schedAfter("photo",  0, photoJob);
+
+    // Deadlines (net-up runs once now, then again on every IP)
+    netUpJob = schedAfter("net-up", 0, networkUp);
+    dimJob = schedAfter("dim", SCREEN_DIM_MS, dimScreen);
+    uint32_t upMs = millis();
+    schedAfter("power-cycle", upMs < POWER_CYCLE_WINDOW_MS ? POWER_CYCLE_WINDOW_MS - upMs : 0,
+               powerCycleReset);
+    if (!otaIsConfirmed()) {
+        schedAfter("ota-rollback", OTA_CONFIRM_TIMEOUT_MS, otaCheckRollback);
     }
+
+    // WiFi state changes reach the state machine and the screen now rather
+    // than at the next poll or publish
+    WiFi.onEvent([](arduino_event_id_t, arduino_event_info_t) {
+                     schedTrigger(wifiJobId);
+                     schedTrigger(publishJob);
+                     schedTrigger(netUpJob);
+                 },
+                 ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent([](arduino_event_id_t, arduino_event_info_t) {
+                     schedTrigger(wifiJobId);
+                     schedTrigger(publishJob);
+                 },
+                 ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
 }
 
 // ============================================================
@@ -61,31 +304,20 @@ static void handleScreenDimming() {
 void setup() {
     // 1. Serial
     Serial.begin(SERIAL_BAUD);
-    delay(500);
 
     // 2. Logger
     logInit();
 
-    // 3. Firmware and chip info
-    logPrintf("SmallTV Firmware v%s", FW_VERSION);
-    logPrintf("Chip: %s, Rev %d, %d cores, %d MHz",
-              ESP.getChipModel(),
-              ESP.getChipRevision(),
-              ESP.getChipCores(),
-              ESP.getCpuFreqMHz());
-    logPrintf("Flash: %u KB, Heap: %u KB",
-              ESP.getFlashChipSize() / 1024,
-              ESP.getFreeHeap() / 1024);
-
-    // 4. Settings
+    // 2a. Settings (NVS), needed by the boot counter and the splash
     settingsInit();
     Settings& settings = settingsGet();
 
-    // 5. Boot failure counter
+    // 3. Boot failure counter, before anything that reads flash or drives
+    //    the panel, so a crash in the splash counts as a failed boot too
     bootCounterIncrement();
 
-    // 6. Emergency: if boot keeps failing and OTA is pending, roll back firmware.
-    //    Otherwise fall through to settings reset.
+    // 4. Emergency: if boot keeps failing and OTA is pending, roll back firmware.
+    //    Otherwise fall through to settings reset. Runs before the splash.
     if (bootCounterCheck()) {
         if (otaIsPending()) {
             logPrintf("Boot crash loop detected with pending OTA - rolling back firmware");
@@ -96,17 +328,37 @@ void setup() {
         // Does not return
     }
 
-    // 7. Power cycle counter
+    // 5. Boot splash: the last clock frame, up before the serial settle
+    //    delay and everything slow below. Skipped after a failed boot:
+    //    the saved frame may be what crashed it, and settingsReset()
+    //    does not touch LittleFS.
+    backlightInit();
+    if (bootCounterCount() <= 1) displayShowSplash();
+    backlightLoadSettings();
+    delay(500);
+
+    // 5a. Firmware and chip info, once serial has settled
+    logPrintf("SmallTV Firmware v%s", FW_VERSION);
+    logPrintf("Chip: %s, Rev %d, %d cores, %d MHz",
+              ESP.getChipModel(),
+              ESP.getChipRevision(),
+              ESP.getChipCores(),
+              ESP.getCpuFreqMHz());
+    logPrintf("Flash: %u KB, Heap: %u KB",
+              ESP.getFlashChipSize() / 1024,
+              ESP.getFreeHeap() / 1024);
+
+    // 6. Power cycle counter
     powerCycleIncrement();
 
-    // 8a. OTA rollback via 3 quick power cycles (only when firmware is pending)
+    // 7a. OTA rollback via 3 quick power cycles (only when firmware is pending)
     if (otaIsPending() && powerCycleCount() >= POWER_CYCLE_ROLLBACK) {
         logPrintf("Rapid power cycle rollback (%d cycles with pending OTA)", powerCycleCount());
         powerCycleReset();
         otaRollback();  // Marks invalid + reboots, does not return
     }
 
-    // 8b. Factory reset if rapid power cycling detected (5 cycles)
+    // 7b. Factory reset if rapid power cycling detected (5 cycles)
     if (powerCycleCheck()) {
         logPrintf("Factory reset triggered by rapid power cycling");
         // Clear the power cycle counter FIRST to prevent infinite reboot loop
@@ -117,159 +369,55 @@ void setup() {
         // Does not return
     }
 
-    // 9. Display
+    // 8. Display
     displayInit();
+    bootTraceMark("display");
 
-    // 10. Brightness
-    displaySetBrightness(settings.brightness);
-
-    // 11. Touch
+    // 9. Touch
     touchInit();
+    bootTraceMark("touch");
 
-    // 12. WiFi
+    // 10. WiFi (connects in the background; the "wifi" boot mark and
+    //     11. mDNS follow the first IP, see networkUp())
     wifiInit();
 
-    // 13. mDNS
-    if (wifiIsConnected()) {
-        delay(200);  // Let WiFi stack fully settle before mDNS
-
-        if (MDNS.begin(settings.hostname)) {
-            MDNS.addService("http", "tcp", WEB_SERVER_PORT);
-            logPrintf("mDNS started: %s.local", settings.hostname);
-        } else {
-            logPrintf("mDNS failed to start");
-        }
-    }
-
-    // 14. Web server
+    // 12. Web server
     webServerInit();
 
-    // 15. Weather
+    // 13. Weather
     weatherInit();
 
-    // 16. OTA
+    // 14. OTA
     otaInit();
 
-    // 17. NTP time sync
+    // 15. NTP time sync
     configTime(settings.gmtOffsetSec, 0, "pool.ntp.org");
     logPrintf("NTP configured: gmtOffset=%ld", settings.gmtOffsetSec);
 
-    // 18. Mark successful boot
-    bootCounterReset();
+    // 16. Remote display (UDP listener starts once the network is up)
+    remoteDisplayInit();
+
+    // 17. Photo frame index
+    photoInit();
 
-    // Initialize touch timer for dimming
-    lastTouchTime = millis();
+    // 18. Scheduler jobs (auto-dim counts from here)
+    registerJobs();
 
-    // 19. Done
+    // 19. Mark successful boot
+    bootCounterReset();
+
+    // 20. Done
     logPrintf("Setup complete");
+    bootTraceMark("setup");
 }
 
 // ============================================================
 // Main Loop
 // ============================================================
 
-static unsigned long lastDisplayUpdate = 0;
-
 void loop() {
-    // 1. Input polling
-    touchUpdate();
-
-    // 2. Network services
-    wifiUpdate();
-    webServerUpdate();
-    weatherUpdate();
-    otaUpdate();
-
-    // 3. Touch events: tap cycles pages, long press toggles backlight
-    if (touchWasTapped()) {
-        lastTouchTime = millis();
-
-        // If screen was off (by user or auto-dim), wake it on tap instead of cycling pages
-        if (screenDimmed || screenOffByUser) {
-            displaySetBrightness(settingsGet().brightness);
-            screenDimmed = false;
-            screenOffByUser = false;
-        } else {
-            DisplayPage next = (DisplayPage)((displayGetPage() + 1) % PAGE_COUNT);
-            displaySetPage(next);
-            logPrintf("Page changed to %d", (int)next);
-            lastDisplayUpdate = 0;  // Force immediate redraw
-        }
-    }
-
-    if (touchWasLongPressed()) {
-        lastTouchTime = millis();
-
-        if (screenDimmed || screenOffByUser) {
-            // Wake from any dimmed/off state
-            displaySetBrightness(settingsGet().brightness);
-            screenDimmed = false;
-            screenOffByUser = false;
-        } else {
-            // Turn screen off
-            displaySetBrightness(0);
-            screenOffByUser = true;
-        }
-        logPrintf("Backlight toggled (off=%s)", screenOffByUser ? "true" : "false");
-    }
-
-    // 4. Display update (every DISPLAY_UPDATE_MS)
-    unsigned long now = millis();
-
-    if ((now - lastDisplayUpdate) >= DISPLAY_UPDATE_MS) {
-        lastDisplayUpdate = now;
-
-        // Gather time data (may fail if NTP hasn't synced yet)
-        char timeBuf[8] = {0};
-        char dateBuf[16] = {0};
-        bool timeValid = getFormattedTime(timeBuf, sizeof(timeBuf),
-                                          dateBuf, sizeof(dateBuf));
-
-        // If time isn't available yet and we're on the clock page,
-        // show a waiting message instead
-        if (!timeValid && displayGetPage() == PAGE_CLOCK_WEATHER && !wifiIsAPMode()) {
-            displayRenderMessage("Waiting for NTP...");
-        } else {
-            // Gather all data needed by the display module
-            const WeatherData& weather = weatherGet();
-            String ssidStr = wifiGetSSID();
-            String ipStr   = wifiGetIP();
-            String macStr  = wifiGetMAC();
-
-            displayUpdate(
-                timeValid ? timeBuf : nullptr,
-                timeValid ? dateBuf : nullptr,
-                weather.valid ? &weather : nullptr,
-                wifiIsAPMode(),
-                ssidStr.c_str(),
-                ipStr.c_str(),
-                FW_VERSION,
-                wifiIsConnected(),
-                wifiIsAPMode(),
-                ssidStr.c_str(),
-                ipStr.c_str(),
-                wifiGetRSSI(),
-                macStr.c_str(),
-                ESP.getFreeHeap() / 1024,
-                millis() / 1000,
-                otaIsConfirmed()
-            );
-        }
-    }
-
-    // 5. Power cycle counter: reset once uptime exceeds window
-    if (now >= POWER_CYCLE_WINDOW_MS) {
-        // Only reset once (powerCycleReset logs, so guard with a static flag)
-        static bool powerCycleCleared = false;
-        if (!powerCycleCleared) {
-            powerCycleReset();
-            powerCycleCleared = true;
-        }
-    }
-
-    // 6. Screen dimming
-    handleScreenDimming();
-
-    // 7. Yield
-    delay(10);
+    uint32_t loopStartUs = micros();
+    schedRun();
+    profileLoop(loopStartUs);
+    schedWait();
 }
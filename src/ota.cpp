@@ -104,6 +104,7 @@ static void setupArduinoOTA() {
             case OTA_END_ERROR:     errStr = "End failed";      break;
         }
         logPrintf("[OTA] ArduinoOTA error: %s (%u)", errStr, error);
+        displayClearOverlay();
     });
 
     ArduinoOTA.begin();
@@ -133,6 +134,9 @@ void otaInit() {
 
 void otaUpdate() {
     ArduinoOTA.handle();
+}
+
+void otaCheckRollback() {
     checkRollbackTimeout();
 }
 
@@ -218,6 +222,7 @@ void otaHandleUpload(WebServer& server) {
                 logPrintf("[OTA] Rebooting to apply update...");
             } else {
                 logPrintf("[OTA] Update.end() failed: %s", Update.errorString());
+                displayClearOverlay();
             }
             break;
         }
@@ -225,6 +230,7 @@ void otaHandleUpload(WebServer& server) {
         case UPLOAD_FILE_ABORTED: {
             logPrintf("[OTA] Web upload aborted");
             Update.abort();
+            displayClearOverlay();
             break;
         }
     }
@@ -14,7 +14,8 @@
 // the bootloader rolls back to the previous partition.
 
 void otaInit();                             // Set up ArduinoOTA + rollback watchdog
-void otaUpdate();                           // Call in main loop
+void otaUpdate();                           // Poll often (ArduinoOTA)
+void otaCheckRollback();                    // Once OTA_CONFIRM_TIMEOUT_MS after otaInit(): roll back if unconfirmed
 void otaConfirmGood();                      // Cancel rollback timer, mark firmware valid
 void otaRollback();                         // Roll back to previous firmware and reboot
 bool otaIsConfirmed();                      // Has firmware been confirmed good?
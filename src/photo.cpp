@@ -0,0 +1,370 @@
+#include "photo.h"
+#include "display.h"
+#include "logger.h"
+
+#include <LittleFS.h>
+#include <ctype.h>
+
+static const char* PHOTO_TMP_PATH = PHOTO_DIR "/.upload";   // Dot names are never indexed
+
+// --- Module state ---
+
+enum PrefetchPhase {
+    PREFETCH_IDLE,              // Nothing pending
+    PREFETCH_READING,           // pending.data filling, PHOTO_READ_CHUNK per loop
+    PREFETCH_READY              // pending can be handed over
+};
+
+static PhotoStats    stats;
+static bool          fsReady = false;
+
+static char          names[PHOTO_MAX_FILES][PHOTO_NAME_MAX + 1];
+static uint32_t      sizes[PHOTO_MAX_FILES];
+static int           fileCount = 0;
+static int           nextIndex = 0;         // Next photo to show
+
+static PrefetchPhase phase = PREFETCH_IDLE;
+static DisplayPhoto  pending;
+static File          readFile;
+static uint32_t      readPos = 0;
+static unsigned long readStartMs = 0;
+
+static bool          onPage = false;
+static bool          shownOnce = false;     // A photo went up since the page was entered
+static unsigned long lastShownMs = 0;
+
+static File              uploadFile;
+static char              uploadName[PHOTO_NAME_MAX + 1];
+static uint32_t          uploadLen = 0;
+static PhotoUploadResult uploadError = PHOTO_UPLOAD_NONE;   // First failure of the running upload
+static PhotoUploadResult uploadResult = PHOTO_UPLOAD_NONE;
+
+// --- Internal helpers ---
+
+static bool endsWithNoCase(const char* str, size_t len, const char* suffix) {
+    size_t n = strlen(suffix);
+    if (len < n) return false;
+    for (size_t i = 0; i < n; i++) {
+        if (tolower((unsigned char)str[len - n + i]) != suffix[i]) return false;
+    }
+    return true;
+}
+
+// A plain file name in PHOTO_DIR of a usable length
+static bool isPlainName(const char* name) {
+    if (!name) return false;
+    size_t len = strlen(name);
+    if (len == 0 || len > PHOTO_NAME_MAX || name[0] == '.') return false;
+    return !strchr(name, '/') && !strchr(name, '\\');
+}
+
+// ...with an image extension
+static bool isPhotoName(const char* name) {
+    if (!isPlainName(name)) return false;
+    size_t len = strlen(name);
+    return endsWithNoCase(name, len, ".jpg") || endsWithNoCase(name, len, ".jpeg") ||
+           endsWithNoCase(name, len, ".png");
+}
+
+// Photos plus the .gif files the animation page plays from the same directory
+static bool isStoredName(const char* name) {
+    return isPhotoName(name) || (isPlainName(name) && endsWithNoCase(name, strlen(name), ".gif"));
+}
+
+static DisplayPhotoFormat formatFor(const char* name) {
+    return endsWithNoCase(name, strlen(name), ".png") ? DISPLAY_PHOTO_PNG : DISPLAY_PHOTO_JPEG;
+}
+
+// Rebuild the index, sorted by name
+static void scanPhotos() {
+    fileCount = 0;
+    if (fsReady) {
+        File dir = LittleFS.open(PHOTO_DIR, "r");
+        if (dir && dir.isDirectory()) {
+            for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+                const char* name = f.name();
+                if (!f.isDirectory() && isPhotoName(name) && fileCount < PHOTO_MAX_FILES) {
+                    int i = fileCount++;
+                    while (i > 0 && strcmp(names[i - 1], name) > 0) {
+                        memcpy(names[i], names[i - 1], sizeof(names[i]));
+                        sizes[i] = sizes[i - 1];
+                        i--;
+                    }
+                    strncpy(names[i], name, PHOTO_NAME_MAX);
+                    names[i][PHOTO_NAME_MAX] = '\0';
+                    sizes[i] = f.size();
+                }
+                f.close();
+            }
+        }
+        stats.fsTotal = LittleFS.totalBytes();
+        stats.fsUsed  = LittleFS.usedBytes();
+    }
+    stats.files = fileCount;
+    if (nextIndex >= fileCount) nextIndex = 0;
+}
+
+static int findPhoto(const char* name) {
+    for (int i = 0; i < fileCount; i++) {
+        if (strcmp(names[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+static void abortPrefetch() {
+    if (readFile) readFile.close();
+    free(pending.data);
+    memset(&pending, 0, sizeof(pending));
+    phase = PREFETCH_IDLE;
+}
+
+static void advance() {
+    if (fileCount > 0) nextIndex = (nextIndex + 1) % fileCount;
+}
+
+// Small enough files are read into RAM over the next few loops; the rest
+// go over by path and the render task reads them while decoding.
+static void startPrefetch() {
+    memset(&pending, 0, sizeof(pending));
+    snprintf(pending.path, sizeof(pending.path), "%s/%s", PHOTO_DIR, names[nextIndex]);
+    pending.format = formatFor(names[nextIndex]);
+    pending.len    = sizes[nextIndex];
+    readStartMs    = millis();
+
+    if (pending.len == 0 || pending.len > PHOTO_PREFETCH_MAX ||
+        ESP.getMaxAllocHeap() < pending.len + PHOTO_HEAP_RESERVE) {
+        phase = PREFETCH_READY;
+        return;
+    }
+
+    readFile = LittleFS.open(pending.path, "r");
+    pending.data = readFile ? (uint8_t*)malloc(pending.len) : nullptr;
+    if (!pending.data) {
+        if (readFile) readFile.close();
+        phase = PREFETCH_READY;             // Let the decoder try the file
+        return;
+    }
+    readPos = 0;
+    phase = PREFETCH_READING;
+}
+
+static void readChunk() {
+    uint32_t n = pending.len - readPos;
+    if (n > PHOTO_READ_CHUNK) n = PHOTO_READ_CHUNK;
+
+    uint32_t startUs = micros();
+    size_t got = readFile.read(pending.data + readPos, n);
+    histogramAdd(stats.chunkUs, micros() - startUs);
+
+    if (got != n) {
+        logPrintf("Photo: read of %s failed at %lu bytes", pending.path, (unsigned long)readPos);
+        stats.readFailures++;
+        abortPrefetch();
+        advance();
+        return;
+    }
+    readPos += n;
+    if (readPos == pending.len) {
+        readFile.close();
+        stats.lastReadMs = millis() - readStartMs;
+        phase = PREFETCH_READY;
+    }
+}
+
+static bool mountForWrite() {
+    if (!fsReady) {
+        fsReady = LittleFS.begin(true);
+        if (!fsReady) return false;
+    }
+    if (!LittleFS.exists(PHOTO_DIR)) LittleFS.mkdir(PHOTO_DIR);
+    return true;
+}
+
+static void failUpload(PhotoUploadResult result) {
+    if (uploadError == PHOTO_UPLOAD_NONE) uploadError = result;
+    if (uploadFile) {
+        uploadFile.close();
+        LittleFS.remove(PHOTO_TMP_PATH);
+    }
+}
+
+// --- Public API ---
+
+void photoInit() {
+    memset(&stats, 0, sizeof(stats));
+    histogramInit(stats.chunkUs);
+
+    // No formatting here: the first upload formats an empty partition
+    fsReady = LittleFS.begin(false);
+    scanPhotos();
+    logPrintf("Photo: %d photos in %s", fileCount, PHOTO_DIR);
+}
+
+void photoUpdate() {
+    if (displayGetPage() != PAGE_PHOTO) {
+        // Nothing held in RAM while the page is not up
+        if (phase != PREFETCH_IDLE) abortPrefetch();
+        onPage = false;
+        return;
+    }
+    if (!onPage) {
+        onPage = true;
+        shownOnce = false;
+    }
+    if (fileCount == 0) return;
+    if (shownOnce && fileCount == 1 && phase == PREFETCH_IDLE) return;    // Nothing to rotate to
+
+    switch (phase) {
+        case PREFETCH_IDLE:    startPrefetch(); break;
+        case PREFETCH_READING: readChunk();     break;
+        case PREFETCH_READY:   break;
+    }
+    if (phase != PREFETCH_READY) return;
+
+    // The first photo goes up as soon as it is read, the rest on the interval
+    if (shownOnce && millis() - lastShownMs < PHOTO_INTERVAL_MS) return;
+    bool fromRam = pending.data != nullptr;
+    if (!displayShowPhoto(pending)) return;     // Render task still busy, retry
+
+    stats.shown++;
+    if (fromRam) stats.prefetched++;
+    memset(&pending, 0, sizeof(pending));       // Display owns the bytes now
+    phase = PREFETCH_IDLE;
+    shownOnce = true;
+    lastShownMs = millis();
+    advance();
+}
+
+uint32_t photoPollMs() {
+    return phase == PREFETCH_READING ? SCHED_POLL_MS : SCHED_IDLE_POLL_MS;
+}
+
+int photoCount() {
+    return fileCount;
+}
+
+const char* photoName(int index) {
+    return (index >= 0 && index < fileCount) ? names[index] : "";
+}
+
+uint32_t photoSize(int index) {
+    return (index >= 0 && index < fileCount) ? sizes[index] : 0;
+}
+
+bool photoDelete(const char* name) {
+    if (!fsReady || !isStoredName(name)) return false;
+
+    char path[sizeof(pending.path)];
+    snprintf(path, sizeof(path), "%s/%s", PHOTO_DIR, name);
+    if (isPhotoName(name) ? findPhoto(name) < 0 : !LittleFS.exists(path)) return false;
+    abortPrefetch();
+    bool ok = LittleFS.remove(path);
+    scanPhotos();
+    shownOnce = false;                          // Replace it on screen right away
+    if (ok) logPrintf("Photo: deleted %s", name);
+    return ok;
+}
+
+void photoHandleUpload(WebServer& server) {
+    HTTPUpload& upload = server.upload();
+
+    switch (upload.status) {
+        case UPLOAD_FILE_START: {
+            uploadError = PHOTO_UPLOAD_NONE;
+            uploadLen = 0;
+            const char* name = upload.filename.c_str();
+            if (!isStoredName(name)) {
+                failUpload(PHOTO_UPLOAD_BAD_NAME);
+                break;
+            }
+            if (!mountForWrite()) {
+                failUpload(PHOTO_UPLOAD_WRITE_ERROR);
+                break;
+            }
+            // Content-Length includes the multipart framing, so it is an upper bound
+            uint32_t declared = server.header("Content-Length").toInt();
+            uint32_t freeBytes = LittleFS.totalBytes() - LittleFS.usedBytes();
+            if (declared > freeBytes || freeBytes - declared < PHOTO_FS_RESERVE) {
+                failUpload(PHOTO_UPLOAD_TOO_BIG);
+                break;
+            }
+            strncpy(uploadName, name, PHOTO_NAME_MAX);
+            uploadName[PHOTO_NAME_MAX] = '\0';
+            uploadFile = LittleFS.open(PHOTO_TMP_PATH, "w");
+            if (!uploadFile) failUpload(PHOTO_UPLOAD_WRITE_ERROR);
+            logPrintf("Photo: upload start: %s", uploadName);
+            break;
+        }
+
+        case UPLOAD_FILE_WRITE:
+            if (uploadError != PHOTO_UPLOAD_NONE) break;
+            if (uploadLen + upload.currentSize > PHOTO_UPLOAD_MAX) {
+                failUpload(PHOTO_UPLOAD_TOO_BIG);
+                break;
+            }
+            if (uploadFile.write(upload.buf, upload.currentSize) != upload.currentSize) {
+                failUpload(PHOTO_UPLOAD_WRITE_ERROR);
+                break;
+            }
+            uploadLen += upload.currentSize;
+            break;
+
+        case UPLOAD_FILE_END: {
+            if (uploadError != PHOTO_UPLOAD_NONE) {
+                uploadResult = uploadError;
+                logPrintf("Photo: upload rejected: %s", photoUploadResultName(uploadError));
+                break;
+            }
+            uploadFile.close();
+
+            // The prefetch may be reading the file about to be replaced
+            abortPrefetch();
+            char path[sizeof(pending.path)];
+            snprintf(path, sizeof(path), "%s/%s", PHOTO_DIR, uploadName);
+            if (LittleFS.exists(path)) LittleFS.remove(path);
+            if (!LittleFS.rename(PHOTO_TMP_PATH, path)) {
+                LittleFS.remove(PHOTO_TMP_PATH);
+                uploadResult = PHOTO_UPLOAD_WRITE_ERROR;
+                break;
+            }
+
+            stats.uploads++;
+            stats.uploadBytes += uploadLen;
+            uploadResult = PHOTO_UPLOAD_OK;
+            logPrintf("Photo: stored %s (%lu bytes)", uploadName, (unsigned long)uploadLen);
+
+            // Show the new photo next, right away if the page is up
+            scanPhotos();
+            int index = findPhoto(uploadName);
+            if (index >= 0) nextIndex = index;
+            shownOnce = false;
+            break;
+        }
+
+        case UPLOAD_FILE_ABORTED:
+            failUpload(PHOTO_UPLOAD_WRITE_ERROR);
+            uploadResult = uploadError;
+            logPrintf("Photo: upload aborted");
+            break;
+    }
+}
+
+PhotoUploadResult photoTakeUploadResult() {
+    PhotoUploadResult result = uploadResult;
+    uploadResult = PHOTO_UPLOAD_NONE;
+    return result;
+}
+
+const char* photoUploadResultName(PhotoUploadResult result) {
+    switch (result) {
+        case PHOTO_UPLOAD_OK:          return "ok";
+        case PHOTO_UPLOAD_BAD_NAME:    return "bad name";
+        case PHOTO_UPLOAD_TOO_BIG:     return "too big";
+        case PHOTO_UPLOAD_WRITE_ERROR: return "write error";
+        default:                       return "none";
+    }
+}
+
+const PhotoStats& photoGetStats() {
+    return stats;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include "config.h"
+#include "histogram.h"
+
+// ============================================================
+// Photo Frame - JPEG/PNG slideshow from LittleFS
+// ============================================================
+//
+// Photos live in PHOTO_DIR and are shown in name order, one every
+// PHOTO_INTERVAL_MS, while the photo page is up. Between photos the
+// main loop prefetches the next file into RAM, PHOTO_READ_CHUNK bytes
+// per loop() iteration, so the render task can decode it without
+// touching flash. Files over PHOTO_PREFETCH_MAX (or when the heap is
+// short) are handed over by path and decoded straight from flash.
+// Either way the decode itself streams into the frame through the
+// decoder's small work buffer; see DisplayPhoto in display.h.
+//
+// JPEGs must be baseline: the decoder has no progressive support.
+// tools/photo_prep.py resizes and converts images before upload.
+//
+// Uploads and deletes also take .gif files, which stay out of this index:
+// the animation page (PAGE_GIF in display.h) plays them.
+
+enum PhotoUploadResult {
+    PHOTO_UPLOAD_NONE = 0,      // No upload finished since the last call
+    PHOTO_UPLOAD_OK,
+    PHOTO_UPLOAD_BAD_NAME,      // Not a .jpg/.jpeg/.png/.gif name of a usable length
+    PHOTO_UPLOAD_TOO_BIG,       // Over PHOTO_UPLOAD_MAX or the free space
+    PHOTO_UPLOAD_WRITE_ERROR    // LittleFS unavailable or a write failed
+};
+
+struct PhotoStats {
+    uint16_t  files;            // Indexed in PHOTO_DIR
+    uint32_t  fsTotal;          // LittleFS size and usage at the last scan, bytes
+    uint32_t  fsUsed;
+    uint32_t  shown;            // Photos handed to the display
+    uint32_t  prefetched;       // Of those, read into RAM ahead of time
+    uint32_t  readFailures;     // Files that vanished or failed mid-read
+    uint32_t  uploads;
+    uint32_t  uploadBytes;
+    uint32_t  lastReadMs;       // Wall time of the last prefetch, spread over loops
+    Histogram chunkUs;          // One PHOTO_READ_CHUNK read (loop() cost)
+};
+
+void photoInit();               // Mount LittleFS and index PHOTO_DIR
+void photoUpdate();             // Call again photoPollMs() later; idle unless on the photo page
+uint32_t photoPollMs();         // SCHED_POLL_MS while a prefetch reads, else SCHED_IDLE_POLL_MS
+
+// Index, in display order
+int         photoCount();
+const char* photoName(int index);
+uint32_t    photoSize(int index);
+
+bool photoDelete(const char* name);    // False if missing or not a photo/.gif name
+
+// Multipart upload handler for WebServer. The file keeps its own name;
+// an existing photo with that name is replaced.
+void              photoHandleUpload(WebServer& server);
+PhotoUploadResult photoTakeUploadResult();  // Result of the last finished upload, then NONE
+const char*       photoUploadResultName(PhotoUploadResult result);
+
+const PhotoStats& photoGetStats();
@@ -0,0 +1,196 @@
+#include "remote_display.h"
+#include "display.h"
+#include "rle565.h"
+#include "wifi_manager.h"
+#include "logger.h"
+
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+// --- Protocol ---
+
+static const uint8_t  PROTO_MAGIC0      = 'S';
+static const uint8_t  PROTO_MAGIC1      = 'T';
+static const uint8_t  PROTO_VERSION     = 1;
+static const uint8_t  FLAG_END_OF_FRAME = 0x01;
+static const uint8_t  ENC_RAW           = 0;
+static const uint8_t  ENC_RLE565        = 1;
+static const size_t   HEADER_LEN        = 8;
+static const size_t   TILE_HEADER_LEN   = 6;
+static const size_t   TILE_RAW_LEN      = DISPLAY_TILE_SIZE * DISPLAY_TILE_SIZE * 2;
+static const int      TILES_X           = DISPLAY_WIDTH / DISPLAY_TILE_SIZE;
+static const int      TILES_Y           = DISPLAY_HEIGHT / DISPLAY_TILE_SIZE;
+
+// --- Module state ---
+
+static WiFiUDP            udp;
+static bool               listening = false;
+static RemoteDisplayStats stats;
+static unsigned long      lastPacketMs = 0;
+static uint8_t            packet[1472];         // One Ethernet-MTU UDP payload
+static DisplayTile        tile;
+
+// The packet in packet[] whose tiles are not all delivered yet
+static size_t             pendingLen = 0;   // 0 when nothing is pending
+static size_t             pendingPos;       // Offset of the next tile record
+static uint8_t            pendingLeft;      // Tile records from there on
+static uint8_t            pendingFlags;
+
+// --- Internal helpers ---
+
+static uint16_t readU16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Deliver the tile records of the packet in packet[], starting at
+// pendingPos. Never waits: a full ring means the render task is behind,
+// and waiting for it would stall loop() once per tile. Instead the
+// record that found the ring full stays pending, and the next pass
+// resumes from it before reading another datagram. Returns false while
+// tiles are still pending.
+static bool deliverPending() {
+    while (pendingLeft > 0) {
+        if (pendingPos + TILE_HEADER_LEN > pendingLen) {
+            stats.badPackets++;
+            break;
+        }
+        const uint8_t* rec = packet + pendingPos;
+        uint8_t  tx       = rec[0];
+        uint8_t  ty       = rec[1];
+        uint8_t  encoding = rec[2];
+        uint16_t plen     = readU16(rec + 4);
+        const uint8_t* payload = rec + TILE_HEADER_LEN;
+        size_t   next     = pendingPos + TILE_HEADER_LEN + plen;
+
+        if (next > pendingLen || tx >= TILES_X || ty >= TILES_Y) {
+            stats.badPackets++;
+            break;
+        }
+
+        tile.tx = tx;
+        tile.ty = ty;
+
+        bool decoded = false;
+        if (encoding == ENC_RAW && plen == TILE_RAW_LEN) {
+            memcpy(tile.px, payload, TILE_RAW_LEN);
+            decoded = true;
+        } else if (encoding == ENC_RLE565) {
+            Rle565Decoder dec;
+            rle565Begin(dec, payload, plen, DISPLAY_TILE_SIZE, DISPLAY_TILE_SIZE);
+            int rows = 0;
+            while (rle565NextRow(dec, tile.px + rows * DISPLAY_TILE_SIZE * 2)) {
+                rows++;
+            }
+            decoded = (rows == DISPLAY_TILE_SIZE);
+        }
+
+        if (!decoded) {
+            stats.badPackets++;
+        } else if (!displayPushTile(tile)) {
+            stats.retriedTiles++;
+            return false;               // Decoded again on the next pass; it's cheap
+        } else {
+            stats.tiles++;
+        }
+        pendingPos = next;
+        pendingLeft--;
+    }
+
+    if (pendingLeft == 0 && (pendingFlags & FLAG_END_OF_FRAME)) {
+        stats.frames++;
+        displayPresentTiles();
+    }
+    pendingLen  = 0;
+    pendingLeft = 0;
+    return true;
+}
+
+// Returns false if the tile ring filled up, so the caller leaves further
+// packets in the socket until the render task has caught up
+static bool handlePacket(size_t len) {
+    stats.packets++;
+    stats.bytes += len;
+
+    if (len < HEADER_LEN || packet[0] != PROTO_MAGIC0 || packet[1] != PROTO_MAGIC1 ||
+        packet[2] != PROTO_VERSION) {
+        stats.badPackets++;
+        return true;
+    }
+
+    if (!stats.active) {
+        stats.active = true;
+        displaySetRemote(true);
+        logPrintf("Remote display: active (sender %s)", udp.remoteIP().toString().c_str());
+    }
+    lastPacketMs = millis();
+
+    pendingLen   = len;
+    pendingPos   = HEADER_LEN;
+    pendingLeft  = packet[6];
+    pendingFlags = packet[3];
+    return deliverPending();
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void remoteDisplayInit() {
+    memset(&stats, 0, sizeof(stats));
+    listening = false;
+}
+
+void remoteDisplayUpdate() {
+    bool networkUp = wifiIsConnected() || wifiIsAPMode();
+
+    if (networkUp && !listening) {
+        listening = udp.begin(REMOTE_DISPLAY_PORT);
+        if (listening) {
+            logPrintf("Remote display: listening on UDP %d", REMOTE_DISPLAY_PORT);
+        }
+    } else if (!networkUp && listening) {
+        udp.stop();
+        listening = false;
+        pendingLen = 0;
+    }
+
+    // Finish the packet the last pass left off in before reading new ones
+    if (listening && pendingLen > 0) {
+        lastPacketMs = millis();
+        if (!deliverPending()) {
+            stats.deferredPasses++;
+            return;
+        }
+    }
+
+    if (listening) {
+        for (int i = 0; i < REMOTE_PACKETS_PER_LOOP; i++) {
+            int size = udp.parsePacket();
+            if (size <= 0) break;
+
+            int len = udp.read(packet, sizeof(packet));
+            if (len > 0 && !handlePacket((size_t)len)) {
+                stats.deferredPasses++;
+                break;
+            }
+        }
+    }
+
+    if (stats.active && millis() - lastPacketMs >= REMOTE_DISPLAY_TIMEOUT_MS) {
+        stats.active = false;
+        displaySetRemote(false);
+        logPrintf("Remote display: idle, back to pages");
+    }
+}
+
+bool remoteDisplayIsActive() {
+    return stats.active;
+}
+
+uint32_t remoteDisplayPollMs() {
+    return stats.active ? SCHED_POLL_MS : SCHED_IDLE_POLL_MS;
+}
+
+const RemoteDisplayStats& remoteDisplayGetStats() {
+    return stats;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================
+// Remote Display - UDP tile-delta framebuffer push
+// ============================================================
+//
+// Lets a server drive the screen as a plain 240x240 framebuffer. The
+// frame is cut into 16x16 tiles and the sender only sends tiles that
+// changed since its previous frame. The first packet switches the
+// display to the remote screen; REMOTE_DISPLAY_TIMEOUT_MS of silence
+// switches back to the pages. tools/frame_push.py is the reference sender.
+//
+// Packet (UDP, port REMOTE_DISPLAY_PORT, little-endian):
+//   0  'S' 'T'          magic
+//   2  version          1
+//   3  flags            bit 0: last packet of the frame (present it)
+//   4  u16 frame        sender's frame counter (informational)
+//   6  u8  tiles        tile records that follow
+//   7  u8  reserved
+//   then per tile:
+//   0  u8  tx, u8 ty    tile grid position (0..14)
+//   2  u8  encoding     0 = raw, 1 = RLE565 (see rle565.h)
+//   3  u8  reserved
+//   4  u16 length       payload bytes
+//   6  payload          raw: 512 bytes big-endian RGB565
+//
+// Packets are parsed on the main loop; decoded tiles are queued to the
+// render task, which stages them in the back buffer and flushes them as
+// merged windowed DMA bursts on the end-of-frame flag. The main loop
+// never waits on that queue: a tile that finds it full stays pending with
+// the rest of its packet, the packets behind it stay in the socket, and
+// the next pass resumes from that tile. No parsed tile is ever lost.
+
+struct RemoteDisplayStats {
+    uint32_t packets;
+    uint32_t badPackets;        // Wrong magic/version, truncated records
+    uint32_t tiles;
+    uint32_t retriedTiles;      // Render task queue was full; delivered on a later pass
+    uint32_t deferredPasses;    // Passes that stopped early for that reason
+    uint32_t frames;            // End-of-frame flags seen
+    uint64_t bytes;             // UDP payload bytes received
+    bool     active;
+};
+
+void remoteDisplayInit();
+void remoteDisplayUpdate();     // Call again remoteDisplayPollMs() later
+uint32_t remoteDisplayPollMs(); // SCHED_POLL_MS while frames arrive, else SCHED_IDLE_POLL_MS
+bool remoteDisplayIsActive();
+const RemoteDisplayStats& remoteDisplayGetStats();
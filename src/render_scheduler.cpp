@@ -0,0 +1,101 @@
+#include "render_scheduler.h"
+
+#include <string.h>
+
+// ============================================================
+// Render Scheduler Implementation
+// ============================================================
+
+// A wall clock step larger than this (either direction) is treated as a
+// jump rather than normal progress, and the tick boundaries are rebased.
+static const int64_t CLOCK_JUMP_MS = 5000;
+
+// --- Internal helpers ---
+
+static void alignBoundaries(RenderScheduler& sched, int64_t wallMs) {
+    sched.nextSecondMs = (wallMs / 1000 + 1) * 1000;
+    sched.nextMinuteMs = (wallMs / 60000 + 1) * 60000;
+    if (sched.frameMs) {
+        sched.nextFrameMs = (wallMs / sched.frameMs + 1) * sched.frameMs;
+    }
+}
+
+// --- Public API ---
+
+void renderSchedInit(RenderScheduler& sched) {
+    memset(&sched, 0, sizeof(sched));
+    sched.pending = RENDER_DIRTY_ALL;   // First poll draws everything
+    sched.started = false;
+}
+
+void renderSchedInvalidate(RenderScheduler& sched, uint32_t flags) {
+    sched.pending |= flags;
+}
+
+uint32_t renderSchedPoll(RenderScheduler& sched, int64_t wallMs, uint32_t interest) {
+    if (!sched.started) {
+        alignBoundaries(sched, wallMs);
+        sched.started = true;
+    }
+
+    // Clock jumped (NTP sync, settings change): rebase and redraw the time
+    if (wallMs < sched.nextSecondMs - 1000 - CLOCK_JUMP_MS ||
+        wallMs > sched.nextSecondMs + CLOCK_JUMP_MS) {
+        alignBoundaries(sched, wallMs);
+        sched.pending |= RENDER_DIRTY_TIME | RENDER_DIRTY_MINUTE | RENDER_DIRTY_SECOND;
+        sched.stats.clockJumps++;
+    }
+
+    bool secondTick = false;
+
+    if (wallMs >= sched.nextSecondMs) {
+        secondTick = true;
+        sched.pending |= RENDER_DIRTY_SECOND;
+        sched.stats.secondTicks++;
+        sched.nextSecondMs = (wallMs / 1000 + 1) * 1000;
+    }
+
+    if (wallMs >= sched.nextMinuteMs) {
+        uint32_t latency = (uint32_t)(wallMs - sched.nextMinuteMs);
+        sched.stats.lastRolloverLatencyMs = latency;
+        if (latency > sched.stats.maxRolloverLatencyMs) {
+            sched.stats.maxRolloverLatencyMs = latency;
+        }
+        sched.pending |= RENDER_DIRTY_MINUTE;
+        sched.nextMinuteMs = (wallMs / 60000 + 1) * 60000;
+    }
+
+    if (sched.frameMs && wallMs >= sched.nextFrameMs) {
+        sched.pending |= RENDER_DIRTY_FRAME;
+        sched.nextFrameMs = (wallMs / sched.frameMs + 1) * sched.frameMs;
+    }
+
+    uint32_t work = sched.pending & interest;
+    if (work == 0) {
+        // A fixed 1 s poll would have redrawn here for nothing
+        if (secondTick) sched.stats.wakeupsAvoided++;
+        return 0;
+    }
+
+    // Flags this screen doesn't show stay pending for the next screen
+    // that does, rather than being dropped with the ones it drew
+    sched.pending &= ~work;
+    sched.stats.renders++;
+    return work;
+}
+
+void renderSchedSetFrameMs(RenderScheduler& sched, uint16_t ms) {
+    if (ms == sched.frameMs) return;
+    sched.frameMs = ms;
+    sched.nextFrameMs = 0;      // Next poll ticks and realigns
+}
+
+uint32_t renderSchedMsUntilTick(const RenderScheduler& sched, int64_t wallMs) {
+    if (!sched.started || wallMs >= sched.nextSecondMs) return 0;
+    int64_t next = sched.nextSecondMs;
+    if (sched.frameMs) {
+        if (wallMs >= sched.nextFrameMs) return 0;
+        if (sched.nextFrameMs < next) next = sched.nextFrameMs;
+    }
+    return (uint32_t)(next - wallMs);
+}
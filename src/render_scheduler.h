@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============================================================
+// Render Scheduler - event-driven display invalidation
+// ============================================================
+//
+// Producers (time, weather, WiFi, heap, page changes) mark parts of the
+// display dirty. Time ticks are aligned to real second and minute
+// boundaries of the wall clock rather than to an arbitrary boot-relative
+// interval, so the minute rollover is drawn within one loop iteration.
+// The display is rendered only when something it shows is dirty.
+//
+// Plain C++ with no Arduino dependencies: the wall clock is passed in,
+// so the scheduler can be driven by a virtual clock on a desktop.
+
+enum RenderDirty : uint32_t {
+    RENDER_DIRTY_MINUTE  = 1 << 0,   // Wall clock crossed a minute boundary
+    RENDER_DIRTY_SECOND  = 1 << 1,   // Wall clock crossed a second boundary
+    RENDER_DIRTY_TIME    = 1 << 2,   // Clock jumped (NTP sync, timezone change)
+    RENDER_DIRTY_WEATHER = 1 << 3,
+    RENDER_DIRTY_WIFI    = 1 << 4,
+    RENDER_DIRTY_SYSTEM  = 1 << 5,   // Heap, RSSI, OTA state (system info page)
+    RENDER_DIRTY_PAGE    = 1 << 6,   // Page or screen mode changed, full redraw
+    RENDER_DIRTY_REMOTE  = 1 << 7,   // Remote frame complete, present it
+    RENDER_DIRTY_LOG     = 1 << 8,   // New log lines (log console page)
+    RENDER_DIRTY_FRAME   = 1 << 9,   // Sub-second frame tick (see renderSchedSetFrameMs)
+    RENDER_DIRTY_PHOTO   = 1 << 10,  // Next photo handed over (photo page)
+    RENDER_DIRTY_ALL     = 0xFFFFFFFF
+};
+
+struct RenderSchedulerStats {
+    uint32_t renders;               // Polls that returned work
+    uint32_t secondTicks;           // Second boundaries observed
+    uint32_t wakeupsAvoided;        // Second ticks that needed no render
+    uint32_t lastRolloverLatencyMs; // Boundary -> poll that noticed it
+    uint32_t maxRolloverLatencyMs;
+    uint32_t clockJumps;
+};
+
+struct RenderScheduler {
+    uint32_t pending;           // Accumulated dirty flags
+    int64_t  nextSecondMs;      // Next wall clock second boundary
+    int64_t  nextMinuteMs;      // Next wall clock minute boundary
+    uint16_t frameMs;           // Frame tick period, 0 = off
+    int64_t  nextFrameMs;
+    bool     started;
+    RenderSchedulerStats stats;
+};
+
+void     renderSchedInit(RenderScheduler& sched);
+void     renderSchedInvalidate(RenderScheduler& sched, uint32_t flags);
+
+// Advance to wallMs and return the dirty flags the current screen cares
+// about (interest mask). Returns 0 when nothing needs drawing. Only the
+// returned flags are consumed; the rest stay pending.
+uint32_t renderSchedPoll(RenderScheduler& sched, int64_t wallMs, uint32_t interest);
+
+// Raise RENDER_DIRTY_FRAME on wall clock multiples of ms (0 = off), for
+// screens that animate faster than once a second
+void     renderSchedSetFrameMs(RenderScheduler& sched, uint16_t ms);
+
+// Milliseconds until the next second or frame tick (for sleeping callers)
+uint32_t renderSchedMsUntilTick(const RenderScheduler& sched, int64_t wallMs);
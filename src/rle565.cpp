@@ -0,0 +1,96 @@
+#include "rle565.h"
+
+#include <string.h>
+
+// ============================================================
+// RLE565 Implementation
+// ============================================================
+
+void rle565Begin(Rle565Decoder& dec, const uint8_t* data, size_t size,
+                 uint16_t width, uint16_t height) {
+    dec.data   = data;
+    dec.size   = size;
+    dec.pos    = 0;
+    dec.width  = width;
+    dec.height = height;
+    dec.row    = 0;
+}
+
+bool rle565NextRow(Rle565Decoder& dec, uint8_t* dst) {
+    if (dec.row >= dec.height) return false;
+
+    uint32_t x = 0;
+    while (x < dec.width) {
+        if (dec.pos >= dec.size) return false;
+
+        uint8_t  h = dec.data[dec.pos++];
+        uint32_t n = (uint32_t)(h & 0x7F) + 1;
+        if (x + n > dec.width) return false;
+
+        if (h & 0x80) {
+            if (dec.pos + 2 > dec.size) return false;
+            uint8_t hi = dec.data[dec.pos];
+            uint8_t lo = dec.data[dec.pos + 1];
+            dec.pos += 2;
+
+            uint8_t* p = dst + x * 2;
+            if (hi == lo) {
+                memset(p, hi, n * 2);   // Black, white and greys
+            } else {
+                for (uint32_t i = 0; i < n; i++) {
+                    p[i * 2]     = hi;
+                    p[i * 2 + 1] = lo;
+                }
+            }
+        } else {
+            if (dec.pos + n * 2 > dec.size) return false;
+            memcpy(dst + x * 2, dec.data + dec.pos, n * 2);
+            dec.pos += n * 2;
+        }
+        x += n;
+    }
+
+    dec.row++;
+    return true;
+}
+
+// --- Encoder ---
+
+static const uint32_t MAX_PACKET = 128;
+
+static bool samePixel(const uint8_t* src, uint32_t a, uint32_t b) {
+    return src[a * 2] == src[b * 2] && src[a * 2 + 1] == src[b * 2 + 1];
+}
+
+size_t rle565EncodeRow(const uint8_t* src, uint16_t width, uint8_t* dst, size_t dstSize) {
+    size_t   out = 0;
+    uint32_t i   = 0;
+
+    while (i < width) {
+        uint32_t run = 1;
+        while (i + run < width && run < MAX_PACKET && samePixel(src, i, i + run)) {
+            run++;
+        }
+        if (run >= 2) {
+            if (out + 3 > dstSize) return 0;
+            dst[out++] = (uint8_t)(0x80 | (run - 1));
+            dst[out++] = src[i * 2];
+            dst[out++] = src[i * 2 + 1];
+            i += run;
+            continue;
+        }
+
+        // Literal until the next run of 2+ or the packet limit
+        uint32_t start = i;
+        while (i < width && i - start < MAX_PACKET) {
+            if (i + 1 < width && samePixel(src, i, i + 1)) break;
+            i++;
+        }
+        uint32_t n = i - start;
+        if (out + 1 + n * 2 > dstSize) return 0;
+        dst[out++] = (uint8_t)(n - 1);
+        memcpy(dst + out, src + start * 2, n * 2);
+        out += n * 2;
+    }
+    return out;
+}
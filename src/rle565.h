@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================
+// RLE565 - run-length encoded RGB565 images
+// ============================================================
+//
+// Produced at build time by tools/pack_icons.py (icons) and at run time
+// by rle565EncodeRow() (screen mirroring). Each row is a sequence
+// of packets that never crosses the row end:
+//   0x80 | (n - 1), hi, lo       run of n identical pixels
+//   (n - 1), n x (hi, lo)        n literal pixels
+// Pixels are big-endian RGB565 (panel byte order), so literals are copied
+// straight into a sprite buffer or SPI row without conversion.
+//
+// The decoder keeps only a read position: callers pull one row at a time
+// into whatever destination they have (back buffer row, small line
+// buffer), never a full-size intermediate image.
+//
+// Plain C++ with no Arduino dependencies.
+
+struct Rle565Decoder {
+    const uint8_t* data;
+    size_t         size;
+    size_t         pos;
+    uint16_t       width;
+    uint16_t       height;
+    uint16_t       row;        // Next row to decode
+};
+
+void rle565Begin(Rle565Decoder& dec, const uint8_t* data, size_t size,
+                 uint16_t width, uint16_t height);
+
+// Decode the next row into dst (width pixels, big-endian RGB565 bytes).
+// Returns false when all rows are done or the data is malformed.
+bool rle565NextRow(Rle565Decoder& dec, uint8_t* dst);
+
+// Encode one row of width big-endian RGB565 pixels, packet for packet the
+// same as tools/pack_icons.py. Returns the bytes written to dst, or 0 if
+// they would not fit in dstSize (worst case is width * 2 + width / 128 + 1).
+size_t rle565EncodeRow(const uint8_t* src, uint16_t width, uint8_t* dst, size_t dstSize);
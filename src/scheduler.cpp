@@ -0,0 +1,124 @@
+#include "scheduler.h"
+#include "config.h"
+#include "logger.h"
+
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+#include <atomic>
+
+// ============================================================
+// Scheduler Implementation
+// ============================================================
+
+static TimerWheel            wheel;
+static TaskHandle_t          loopTask = nullptr;
+static std::atomic<uint32_t> triggered(0);     // Bit per job id
+static SchedStats            stats;
+static uint32_t              idleUs = 0;
+static uint32_t              windowStartUs = 0;
+static uint32_t              cyclesPerUs = 240;
+
+static_assert(TIMER_WHEEL_MAX_JOBS <= 32, "trigger bits are a uint32_t");
+
+// --- Internal helpers ---
+
+// Milliseconds since boot, 64-bit so the wheel never sees a wrap
+static uint64_t nowMs() {
+    return (uint64_t)esp_timer_get_time() / 1000;
+}
+
+static uint32_t cycles() {
+    return ESP.getCycleCount();
+}
+
+// --- Public API ---
+
+void schedInit() {
+    memset(&stats, 0, sizeof(stats));
+    histogramInit(stats.passUs);
+    cyclesPerUs = ESP.getCpuFreqMHz();
+    timerWheelInit(wheel, nowMs(), cycles, cyclesPerUs);
+    loopTask = xTaskGetCurrentTaskHandle();
+    windowStartUs = micros();
+}
+
+int schedEvery(const char* name, uint32_t periodMs, uint32_t firstMs, TimerFn fn) {
+    int id = timerWheelAdd(wheel, nowMs(), name, firstMs, periodMs ? periodMs : 1, fn);
+    if (id < 0) logPrintf("Scheduler: no room for job %s", name);
+    return id;
+}
+
+int schedAfter(const char* name, uint32_t delayMs, TimerFn fn) {
+    int id = timerWheelAdd(wheel, nowMs(), name, delayMs, 0, fn);
+    if (id < 0) logPrintf("Scheduler: no room for job %s", name);
+    return id;
+}
+
+void schedRunIn(int id, uint32_t delayMs) {
+    timerWheelSchedule(wheel, id, nowMs(), delayMs);
+}
+
+void schedRunAligned(int id, uint32_t periodMs) {
+    uint64_t now = nowMs();
+    if (periodMs == 0) periodMs = 1;
+    timerWheelSchedule(wheel, id, now, periodMs - (uint32_t)(now % periodMs));
+}
+
+void schedCancel(int id) {
+    timerWheelCancel(wheel, id);
+}
+
+void schedTrigger(int id) {
+    if (id < 0 || id >= TIMER_WHEEL_MAX_JOBS) return;
+    triggered.fetch_or(1u << id);
+    if (loopTask) xTaskNotifyGive(loopTask);
+}
+
+void IRAM_ATTR schedTriggerFromISR(int id) {
+    if (id < 0 || id >= TIMER_WHEEL_MAX_JOBS) return;
+    triggered.fetch_or(1u << id);
+    if (!loopTask) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(loopTask, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+void schedRun() {
+    uint32_t start = cycles();
+    uint64_t now = nowMs();
+    uint32_t bits = triggered.exchange(0);
+    stats.triggers += __builtin_popcount(bits);
+    while (bits) {
+        int id = __builtin_ctz(bits);
+        bits &= bits - 1;
+        timerWheelSchedule(wheel, id, now, 0);
+    }
+    timerWheelRun(wheel, now);
+    stats.passes++;
+    histogramAdd(stats.passUs, (cycles() - start) / cyclesPerUs);
+}
+
+void schedWait() {
+    uint32_t waitMs = timerWheelMsUntilNext(wheel, nowMs(), SCHED_MAX_SLEEP_MS);
+    if (waitMs > 0 && triggered.load() == 0) {
+        uint32_t start = micros();
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs)) > 0) stats.wakeups++;
+        idleUs += micros() - start;
+    }
+
+    uint32_t now = micros();
+    if (now - windowStartUs >= 1000000) {
+        stats.lastIdlePct = (uint32_t)((uint64_t)idleUs * 100 / (now - windowStartUs));
+        idleUs = 0;
+        windowStartUs = now;
+    }
+}
+
+const SchedStats& schedGetStats() {
+    return stats;
+}
+
+const TimerWheel& schedGetWheel() {
+    return wheel;
+}
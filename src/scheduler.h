@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+#include "timer_wheel.h"
+
+// ============================================================
+// Scheduler - loop() as timer wheel jobs
+// ============================================================
+//
+// Periodic work (touch sampling, socket polling, weather, WiFi health,
+// display state) and one-shot deadlines (auto-dim, OTA rollback) are
+// jobs on a timer wheel (timer_wheel.h). loop() runs whatever is due,
+// then blocks on a task notification until the next deadline instead of
+// sleeping a fixed 10 ms and polling every module. Other tasks can make
+// a job run on the next pass with schedTrigger(), which also ends the
+// wait; interrupts use schedTriggerFromISR().
+//
+// Job and pass run times come from the CPU cycle counter: one register
+// read per job, cheap enough to leave on. The loop task is pinned to one
+// core, so start and end are read from the same counter.
+//
+// Everything but the triggers is for the loop task only.
+
+struct SchedStats {
+    uint32_t passes;            // schedRun() calls
+    uint32_t triggers;          // Jobs run early by schedTrigger()
+    uint32_t wakeups;           // Waits ended early by a trigger
+    uint32_t lastIdlePct;       // Share of the last second spent waiting
+    Histogram passUs;           // One schedRun(): every job that was due
+};
+
+void schedInit();
+
+// First run after firstMs, then every periodMs. Returns the job id (-1
+// when the wheel is full).
+int  schedEvery(const char* name, uint32_t periodMs, uint32_t firstMs, TimerFn fn);
+int  schedAfter(const char* name, uint32_t delayMs, TimerFn fn);   // Once; re-arm with schedRunIn()
+
+void schedRunIn(int id, uint32_t delayMs);  // (Re)arm; periodic jobs keep their period from there
+
+// (Re)arm for the next multiple of periodMs since boot. Polled jobs
+// re-armed this way land on a shared grid, so those polling at the same
+// period (or one dividing it) share a wakeup instead of each taking one.
+void schedRunAligned(int id, uint32_t periodMs);
+void schedCancel(int id);
+void schedTrigger(int id);                  // Any task: run on the next pass
+void schedTriggerFromISR(int id);           // The same, from an interrupt handler
+
+void schedRun();                // Run triggered and due jobs
+void schedWait();               // Block until the next deadline or a trigger
+
+const SchedStats& schedGetStats();
+const TimerWheel& schedGetWheel();          // Per-job counters and histograms
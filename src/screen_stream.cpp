@@ -0,0 +1,226 @@
+#include "screen_stream.h"
+#include "display.h"
+#include "rle565.h"
+#include "logger.h"
+
+#include <lwip/sockets.h>
+
+// --- Protocol (same packets as remote_display.cpp) ---
+
+static const uint8_t FLAG_END_OF_FRAME = 0x01;
+static const uint8_t ENC_RAW           = 0;
+static const uint8_t ENC_RLE565        = 1;
+static const size_t  HEADER_LEN        = 8;
+static const size_t  TILE_HEADER_LEN   = 6;
+static const size_t  TILE_RAW_LEN      = DISPLAY_TILE_SIZE * DISPLAY_TILE_SIZE * 2;
+static const size_t  ROW_RLE_MAX       = DISPLAY_TILE_SIZE * 2 + 1;    // One literal packet
+static const uint32_t FRAME_INTERVAL_MS = 1000 / SCREEN_STREAM_FPS;
+
+// --- Module state ---
+
+static WiFiClient        client;
+static ScreenStreamStats stats;
+static bool              inFrame        = false;    // Tiles of the current frame still coming
+static unsigned long     frameStartMs   = 0;
+static uint32_t          frameEncodeUs  = 0;
+static uint32_t          frameBytes     = 0;
+static uint16_t          frameSeq       = 0;
+static DisplayTile       tile;
+static uint8_t           packet[HEADER_LEN +
+                                SCREEN_STREAM_TILES_PER_LOOP * (TILE_HEADER_LEN + TILE_RAW_LEN)];
+
+// The packet in packet[] not yet all accepted by the socket
+static size_t            sendLen        = 0;        // 0 when nothing is pending
+static size_t            sendPos        = 0;
+static bool              sendEndsFrame  = false;
+static bool             sendFull       = false;
+static unsigned long     sendFullMs     = 0;        // Since then the socket has taken nothing
+
+// --- Internal helpers ---
+
+static void stopStream(const char* reason) {
+    client.stop();
+    stats.active = false;
+    inFrame = false;
+    sendLen = 0;
+    logPrintf("Screen stream: %s", reason);
+}
+
+static void writeHeader(uint8_t flags, uint8_t count) {
+    packet[0] = 'S';
+    packet[1] = 'T';
+    packet[2] = 1;
+    packet[3] = flags;
+    packet[4] = (uint8_t)(frameSeq & 0xFF);
+    packet[5] = (uint8_t)(frameSeq >> 8);
+    packet[6] = count;
+    packet[7] = 0;
+}
+
+// Append tile as a record at pos: RLE565 when it is smaller, raw otherwise
+static size_t encodeTile(size_t pos) {
+    uint8_t* rec     = packet + pos;
+    uint8_t* payload = rec + TILE_HEADER_LEN;
+    const size_t rowBytes = DISPLAY_TILE_SIZE * 2;
+
+    size_t  len = 0;
+    uint8_t enc = ENC_RLE565;
+    for (int row = 0; row < DISPLAY_TILE_SIZE; row++) {
+        uint8_t rowBuf[ROW_RLE_MAX];
+        size_t n = rle565EncodeRow(tile.px + row * rowBytes, DISPLAY_TILE_SIZE,
+                                   rowBuf, sizeof(rowBuf));
+        if (n == 0 || len + n >= TILE_RAW_LEN) {
+            enc = ENC_RAW;
+            break;
+        }
+        memcpy(payload + len, rowBuf, n);
+        len += n;
+    }
+    if (enc == ENC_RAW) {
+        memcpy(payload, tile.px, TILE_RAW_LEN);
+        len = TILE_RAW_LEN;
+    }
+
+    rec[0] = tile.tx;
+    rec[1] = tile.ty;
+    rec[2] = enc;
+    rec[3] = 0;
+    rec[4] = (uint8_t)(len & 0xFF);
+    rec[5] = (uint8_t)(len >> 8);
+    return TILE_HEADER_LEN + len;
+}
+
+static void finishFrame() {
+    stats.frames++;
+    stats.lastFrameBytes = frameBytes;
+    histogramAdd(stats.encodeUs, frameEncodeUs);
+    frameSeq++;
+    inFrame = false;
+}
+
+// Hand the socket as much of the pending packet as it takes without
+// blocking. WiFiClient::write() waits for room in the send buffer, so a
+// stalled client would hold up the main loop inside it; a non-blocking
+// send() returns at once and the rest goes on a later pass. A socket
+// that stays full longer than the limit ends the stream. Returns true
+// once the whole packet is sent.
+static bool flushPacket() {
+    uint32_t start = micros();
+    int n = send(client.fd(), packet + sendPos, sendLen - sendPos, MSG_DONTWAIT);
+    histogramAdd(stats.writeUs, micros() - start);
+
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        stopStream("client disconnected");
+        return false;
+    }
+    if (n > 0) {
+        sendPos     += n;
+        stats.bytes += n;
+        frameBytes  += n;
+    }
+    if (sendPos < sendLen) {
+        unsigned long now = millis();
+        if (n > 0 || !sendFull) {           // Any progress restarts the clock
+            sendFull   = true;
+            sendFullMs = now;
+        } else if (now - sendFullMs > SCREEN_STREAM_WRITE_TIMEOUT_MS) {
+            stats.stalled++;
+            stopStream("client too slow, dropped");
+            return false;
+        }
+        if (n <= 0) stats.writeFull++;
+        return false;
+    }
+
+    sendLen  = 0;
+    sendFull = false;
+    if (sendEndsFrame) finishFrame();
+    return true;
+}
+
+static void sendPacket(size_t len, bool endsFrame) {
+    sendLen       = len;
+    sendPos       = 0;
+    sendEndsFrame = endsFrame;
+    flushPacket();
+}
+
+// --- Public API ---
+
+void screenStreamBegin(WiFiClient& incoming) {
+    if (stats.active) stopStream("replaced by a new client");
+
+    client = incoming;
+    client.setNoDelay(true);
+    client.print("HTTP/1.1 200 OK\r\n"
+                 "Content-Type: application/octet-stream\r\n"
+                 "Cache-Control: no-store\r\n"
+                 "Access-Control-Allow-Origin: *\r\n"
+                 "Connection: close\r\n\r\n");
+
+    displayCaptureInvalidateAll();     // First frame is the whole screen
+    stats.clients++;
+    stats.active = true;
+    inFrame      = false;
+    sendLen      = 0;
+    sendFull     = false;
+    frameStartMs = millis() - FRAME_INTERVAL_MS;
+    logPrintf("Screen stream: client %s", client.remoteIP().toString().c_str());
+}
+
+void screenStreamUpdate() {
+    if (!stats.active) return;
+
+    if (!client.connected()) {
+        stopStream("client disconnected");
+        return;
+    }
+
+    // The socket still holds the last packet's tail: no new tiles until it drains
+    if (sendLen > 0 && !flushPacket()) return;
+
+    unsigned long now = millis();
+    if (!inFrame) {
+        if (now - frameStartMs < FRAME_INTERVAL_MS) return;
+        frameStartMs  = now;
+        frameEncodeUs = 0;
+        frameBytes    = 0;
+        inFrame       = true;
+    }
+
+    // Copy and encode a bounded batch of changed tiles
+    uint32_t start = micros();
+    size_t   pos   = HEADER_LEN;
+    uint8_t  count = 0;
+    DisplayCaptureResult result = CAPTURE_NONE;
+
+    while (count < SCREEN_STREAM_TILES_PER_LOOP) {
+        result = displayCaptureNextTile(tile);
+        if (result != CAPTURE_TILE) break;
+        pos += encodeTile(pos);
+        count++;
+    }
+    frameEncodeUs += micros() - start;
+    stats.tiles   += count;
+    if (result == CAPTURE_BUSY) stats.busy++;
+
+    // Nothing changed since the last frame: skip it entirely
+    if (result == CAPTURE_NONE && count == 0 && frameBytes == 0) {
+        inFrame = false;
+        return;
+    }
+
+    bool last = (result == CAPTURE_NONE);
+    if (count == 0 && !last) return;
+
+    writeHeader(last ? FLAG_END_OF_FRAME : 0, count);
+    sendPacket(pos, last);
+}
+
+uint32_t screenStreamPollMs() {
+    return stats.active ? SCHED_POLL_MS : SCHED_IDLE_POLL_MS;
+}
+
+const ScreenStreamStats& screenStreamGetStats() {
+    return stats;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "config.h"
+#include "histogram.h"
+
+// ============================================================
+// Screen Stream - live mirror of the panel over HTTP
+// ============================================================
+//
+// GET /api/screen/stream hands its socket to this module and returns, so
+// the synchronous web server keeps serving other requests. From then on
+// screenStreamUpdate() sends the screen as a continuous binary body:
+// the first frame has every tile, later frames only the 16x16 tiles the
+// render task changed. At most SCREEN_STREAM_FPS frames per second and
+// SCREEN_STREAM_TILES_PER_LOOP tiles per loop() iteration are sent.
+//
+// The body is a back-to-back sequence of remote display packets (see
+// remote_display.h): same header, same tile records, raw or RLE565,
+// end-of-frame flag on the last packet of each frame. One client at a
+// time; a new request replaces the old one. tools/screen_view.py reads it.
+
+struct ScreenStreamStats {
+    uint32_t  clients;           // Streams started since boot
+    uint32_t  frames;            // Delta frames completed
+    uint32_t  tiles;
+    uint64_t  bytes;
+    uint32_t  lastFrameBytes;
+    uint32_t  busy;              // Tile reads deferred by a render pass
+    uint32_t  writeFull;         // Passes skipped because the socket took nothing
+    uint32_t  stalled;           // Clients dropped for a socket full too long
+    Histogram encodeUs;          // Per frame: tile copies + RLE encode, no socket time
+    Histogram writeUs;           // Per non-blocking send, never a wait for room
+    bool      active;
+};
+
+void screenStreamBegin(WiFiClient& client);   // Takes over the request's socket
+void screenStreamUpdate();                    // Call again screenStreamPollMs() later
+uint32_t screenStreamPollMs();                // SCHED_POLL_MS while a client streams, else SCHED_IDLE_POLL_MS
+const ScreenStreamStats& screenStreamGetStats();
@@ -11,6 +11,9 @@ static const char* KEY_LONGITUDE     = "lon";
 static const char* KEY_HOSTNAME      = "hostname";
 static const char* KEY_GMT_OFFSET    = "gmtOff";
 static const char* KEY_TOUCH_THRESH  = "touchPct";
+static const char* KEY_NIGHT_BRIGHT  = "nightBrt";
+static const char* KEY_NIGHT_START   = "nightStart";
+static const char* KEY_NIGHT_END     = "nightEnd";
 static const char* KEY_BOOT_FAILS    = "bootFails";
 static const char* KEY_POWER_CYCLES  = "pwrCycles";
 
@@ -30,6 +33,9 @@ static void applyDefaults() {
     strncpy(currentSettings.hostname, "smalltv", sizeof(currentSettings.hostname) - 1);
     currentSettings.hostname[sizeof(currentSettings.hostname) - 1] = '\0';
     currentSettings.touchThresholdPct = TOUCH_THRESHOLD_PCT;
+    currentSettings.nightBrightness   = NIGHT_BRIGHTNESS_DEFAULT;
+    currentSettings.nightStartMin     = NIGHT_START_DEFAULT;
+    currentSettings.nightEndMin       = NIGHT_END_DEFAULT;
 }
 
 static void loadFromNVS() {
@@ -44,6 +50,9 @@ static void loadFromNVS() {
     strncpy(currentSettings.hostname, storedHostname.c_str(), sizeof(currentSettings.hostname) - 1);
     currentSettings.hostname[sizeof(currentSettings.hostname) - 1] = '\0';
     currentSettings.touchThresholdPct = prefs.getUChar(KEY_TOUCH_THRESH, TOUCH_THRESHOLD_PCT);
+    currentSettings.nightBrightness   = prefs.getUChar(KEY_NIGHT_BRIGHT, NIGHT_BRIGHTNESS_DEFAULT);
+    currentSettings.nightStartMin     = prefs.getUShort(KEY_NIGHT_START, NIGHT_START_DEFAULT);
+    currentSettings.nightEndMin       = prefs.getUShort(KEY_NIGHT_END, NIGHT_END_DEFAULT);
 }
 
 static void writeToNVS() {
@@ -55,6 +64,9 @@ static void writeToNVS() {
     prefs.putLong(KEY_GMT_OFFSET, currentSettings.gmtOffsetSec);
     prefs.putString(KEY_HOSTNAME, currentSettings.hostname);
     prefs.putUChar(KEY_TOUCH_THRESH, currentSettings.touchThresholdPct);
+    prefs.putUChar(KEY_NIGHT_BRIGHT, currentSettings.nightBrightness);
+    prefs.putUShort(KEY_NIGHT_START, currentSettings.nightStartMin);
+    prefs.putUShort(KEY_NIGHT_END, currentSettings.nightEndMin);
 }
 
 // --- Public API: Settings ---
@@ -62,6 +74,8 @@ static void writeToNVS() {
 void settingsInit() {
     prefs.begin(NVS_NAMESPACE, false);
 
+    // A version mismatch wipes everything, so only an incompatible change
+    // bumps it. Keys added since (night window) load with their defaults.
     uint8_t storedVersion = prefs.getUChar(KEY_VERSION, 0);
 
     if (storedVersion != SETTINGS_VERSION) {
@@ -128,6 +142,10 @@ bool bootCounterCheck() {
     return false;
 }
 
+int bootCounterCount() {
+    return prefs.getInt(KEY_BOOT_FAILS, 0);
+}
+
 // --- Public API: Power cycle counter ---
 
 void powerCycleIncrement() {
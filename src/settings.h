@@ -18,6 +18,9 @@ struct Settings {
     char    hostname[32];     // mDNS hostname
     long    gmtOffsetSec;     // Timezone offset in seconds
     uint8_t touchThresholdPct; // Touch sensitivity (0-100, lower = more sensitive)
+    uint8_t nightBrightness;  // 0-100, used inside the night window
+    uint16_t nightStartMin;   // Night window, minutes after local midnight
+    uint16_t nightEndMin;     // (start == end: no night window)
 };
 
 // --- Settings lifecycle ---
@@ -33,6 +36,7 @@ void     settingsReset();               // Wipe all NVS and reboot (factory rese
 void bootCounterIncrement();            // Call at very start of setup()
 void bootCounterReset();                // Call once boot is confirmed good
 bool bootCounterCheck();                // True if threshold exceeded
+int  bootCounterCount();                // Boots since the last good one, this one included
 
 // --- Power cycle counter ---
 // Tracks rapid power cycles (user yanking power repeatedly).
@@ -0,0 +1,167 @@
+#include "splash.h"
+#include "display.h"
+#include "logger.h"
+#include "rle565.h"
+
+#include <LittleFS.h>
+
+static const char     SPLASH_MAGIC[4] = { 'S', 'P', 'L', '1' };
+static const char*    SPLASH_TMP_PATH = "/splash.tmp";
+static const uint32_t SPLASH_RETRY_MS = 10000;     // After a torn frame or write error
+
+static SplashStats    stats;
+static bool           fsReady = false;
+static unsigned long  clockSinceMs = 0;     // 0 = clock page not up
+static unsigned long  lastSaveMs = 0;
+static unsigned long  lastAttemptMs = 0;
+static bool           savedOnce = false;
+
+// --- Boot side ---
+
+bool splashLoad(SplashImage& img) {
+    memset(&img, 0, sizeof(img));
+    uint32_t start = millis();
+
+    // No formatting here: an empty partition just means no splash yet
+    if (!LittleFS.begin(false)) return false;
+    fsReady = true;
+
+    File f = LittleFS.open(SPLASH_PATH, "r");
+    if (!f) return false;
+
+    size_t size = f.size();
+    if (size <= SPLASH_HEADER_SIZE || size > SPLASH_MAX_BYTES) {
+        f.close();
+        return false;
+    }
+
+    img.data = (uint8_t*)malloc(size);
+    if (!img.data) {
+        f.close();
+        return false;
+    }
+    bool ok = f.read(img.data, size) == size;
+    f.close();
+
+    if (ok && memcmp(img.data, SPLASH_MAGIC, 4) == 0) {
+        img.size   = size;
+        img.width  = img.data[4] | (img.data[5] << 8);
+        img.height = img.data[6] | (img.data[7] << 8);
+        ok = img.width == DISPLAY_WIDTH && img.height == DISPLAY_HEIGHT;
+    } else {
+        ok = false;
+    }
+    if (!ok) {
+        logPrintf("Splash: %s is not a usable splash", SPLASH_PATH);
+        splashRelease(img);
+        return false;
+    }
+
+    stats.loaded = true;
+    stats.loadMs = millis() - start;
+    return true;
+}
+
+void splashRelease(SplashImage& img) {
+    free(img.data);
+    memset(&img, 0, sizeof(img));
+}
+
+// --- Main loop side ---
+
+// Copy the back buffer out row by row and encode it. False if the frame
+// changed underneath (a render pass ran) or the result does not fit.
+static bool encodeFrame(uint8_t* out, size_t outSize, size_t* outLen) {
+    uint8_t row[DISPLAY_WIDTH * 2];
+    size_t  len = SPLASH_HEADER_SIZE;
+
+    memcpy(out, SPLASH_MAGIC, 4);
+    out[4] = DISPLAY_WIDTH & 0xFF;
+    out[5] = DISPLAY_WIDTH >> 8;
+    out[6] = DISPLAY_HEIGHT & 0xFF;
+    out[7] = DISPLAY_HEIGHT >> 8;
+
+    uint32_t framesBefore = displayGetFrameStats().frames;
+    for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+        if (!displayCaptureRow(y, row)) return false;
+        size_t n = rle565EncodeRow(row, DISPLAY_WIDTH, out + len, outSize - len);
+        if (n == 0) return false;
+        len += n;
+    }
+    if (displayGetFrameStats().frames != framesBefore) return false;     // Torn
+
+    *outLen = len;
+    return true;
+}
+
+static bool writeFile(const uint8_t* data, size_t len) {
+    File f = LittleFS.open(SPLASH_TMP_PATH, "w");
+    if (!f) return false;
+    bool ok = f.write(data, len) == len;
+    f.close();
+
+    if (!ok) {
+        LittleFS.remove(SPLASH_TMP_PATH);
+        return false;
+    }
+    return LittleFS.rename(SPLASH_TMP_PATH, SPLASH_PATH);
+}
+
+static bool save() {
+    uint32_t start = millis();
+
+    if (!fsReady) {
+        // First save on a blank partition formats it
+        fsReady = LittleFS.begin(true);
+        if (!fsReady) {
+            logPrintf("Splash: LittleFS unavailable, not saving");
+            stats.failures++;
+            return false;
+        }
+    }
+
+    uint8_t* buf = (uint8_t*)malloc(SPLASH_MAX_BYTES);
+    if (!buf) {
+        stats.failures++;
+        return false;
+    }
+
+    size_t len = 0;
+    bool ok = encodeFrame(buf, SPLASH_MAX_BYTES, &len) && writeFile(buf, len);
+    free(buf);
+
+    if (!ok) {
+        stats.failures++;
+        return false;
+    }
+
+    stats.saves++;
+    stats.lastBytes  = len;
+    stats.lastSaveMs = millis() - start;
+    logPrintf("Splash: saved %u bytes in %lu ms", (unsigned)len, (unsigned long)stats.lastSaveMs);
+    return true;
+}
+
+void splashUpdate() {
+    unsigned long now = millis();
+
+    if (!displayCaptureSplashReady()) {
+        clockSinceMs = 0;
+        return;
+    }
+    if (clockSinceMs == 0) clockSinceMs = now;
+
+    bool due = savedOnce ? (now - lastSaveMs >= SPLASH_SAVE_INTERVAL_MS)
+                         : (now - clockSinceMs >= SPLASH_FIRST_SAVE_MS);
+    if (!due || now - lastAttemptMs < SPLASH_RETRY_MS) return;
+
+    lastAttemptMs = now;
+    if (save()) {
+        lastSaveMs = now;
+        savedOnce  = true;
+    }
+}
+
+const SplashStats& splashGetStats() {
+    return stats;
+}
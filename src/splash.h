@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================
+// Boot Splash - last clock frame persisted to LittleFS
+// ============================================================
+//
+// While the clock page is up, splashUpdate() copies the back buffer out
+// row by row (display capture API), RLE565-encodes it and writes it to
+// SPLASH_PATH: first once the clock has been live for a minute, then
+// every SPLASH_SAVE_INTERVAL_MS. On the next boot the display pushes it
+// to the panel before anything slow runs, and keeps it up until the
+// clock has live time again.
+//
+// File layout (little-endian):
+//   "SPL1", u16 width, u16 height, then height rows of RLE565 packets
+//   (see rle565.h). Written to a temporary file and renamed over the old
+//   one, so a power cut mid-save leaves the previous splash intact.
+
+struct SplashImage {
+    uint8_t* data;              // Whole file, heap; rows start at SPLASH_HEADER_SIZE
+    size_t   size;
+    uint16_t width;
+    uint16_t height;
+};
+
+#define SPLASH_HEADER_SIZE  8
+
+struct SplashStats {
+    bool     loaded;            // A splash was found at boot
+    uint32_t loadMs;            // Reading it from flash
+    uint32_t saves;
+    uint32_t failures;          // Saves abandoned (too big, busy, write error)
+    uint32_t lastBytes;         // Size of the last saved file
+    uint32_t lastSaveMs;        // Capture + encode + write
+};
+
+// Boot side (display). The caller owns img.data until splashRelease().
+bool splashLoad(SplashImage& img);      // false = no usable splash
+void splashRelease(SplashImage& img);
+
+// Main loop side
+void splashUpdate();                    // Saves on schedule while the clock page shows
+const SplashStats& splashGetStats();
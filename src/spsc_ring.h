@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================
+// Lock-free single-producer / single-consumer ring buffer
+// ============================================================
+//
+// One task pushes, one other task pops. No locks, no allocation:
+// items are copied in and out by value. Head and tail are free-running
+// counters, so the capacity N must be a power of two.
+
+template <typename T, size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+    T                     _items[N];
+    std::atomic<uint32_t> _head{0};     // Next slot to write (producer only)
+    std::atomic<uint32_t> _tail{0};     // Next slot to read (consumer only)
+
+public:
+    // Producer side. Returns false (and copies nothing) when full.
+    bool push(const T& item) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t tail = _tail.load(std::memory_order_acquire);
+        if (head - tail >= N) return false;
+
+        _items[head & (N - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when empty.
+    bool pop(T& item) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        uint32_t head = _head.load(std::memory_order_acquire);
+        if (head == tail) return false;
+
+        item = _items[tail & (N - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+};
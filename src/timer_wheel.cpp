@@ -0,0 +1,234 @@
+#include "timer_wheel.h"
+
+#include <string.h>
+
+// ============================================================
+// Timer Wheel Implementation
+// ============================================================
+
+static_assert(TIMER_WHEEL_MAX_JOBS <= 127, "job links are int8_t");
+
+static const uint8_t  OVERFLOW_LEVEL = TIMER_WHEEL_LEVELS;
+static const uint64_t SLOT_MASK      = TIMER_WHEEL_SLOTS - 1;
+
+// Milliseconds covered by one slot of a level: 1, 64, 4096, ...
+static uint64_t levelSpan(int level) {
+    return 1ULL << (TIMER_WHEEL_BITS * level);
+}
+
+// --- Slot lists ---
+
+static int8_t& headOf(TimerWheel& w, const TimerJob& j) {
+    return j.level == OVERFLOW_LEVEL ? w.overflow : w.heads[j.level][j.slot];
+}
+
+static void unlink(TimerWheel& w, int id) {
+    TimerJob& j = w.jobs[id];
+    if (j.prev >= 0) {
+        w.jobs[j.prev].next = j.next;
+    } else {
+        headOf(w, j) = j.next;
+        if (j.next < 0 && j.level != OVERFLOW_LEVEL) {
+            w.occupied[j.level] &= ~(1ULL << j.slot);
+        }
+    }
+    if (j.next >= 0) w.jobs[j.next].prev = j.prev;
+    j.prev  = -1;
+    j.next  = -1;
+    j.armed = false;
+}
+
+// At the tail, so jobs due in the same millisecond run in the order they
+// were armed
+static void file(TimerWheel& w, int id) {
+    TimerJob& j = w.jobs[id];
+
+    // Never behind the clock; while a slot is firing, not into it either
+    uint64_t floor = w.firing ? w.cur + 1 : w.cur;
+    uint64_t at = j.dueMs > floor ? j.dueMs : floor;
+
+    j.level = OVERFLOW_LEVEL;
+    j.slot  = 0;
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        int shift = TIMER_WHEEL_BITS * (level + 1);
+        if ((at >> shift) == (w.cur >> shift)) {
+            j.level = (uint8_t)level;
+            j.slot  = (uint8_t)((at >> (TIMER_WHEEL_BITS * level)) & SLOT_MASK);
+            break;
+        }
+    }
+
+    int8_t& head = headOf(w, j);
+    j.next = -1;
+    j.prev = -1;
+    if (head < 0) {
+        head = (int8_t)id;
+    } else {
+        int tail = head;
+        while (w.jobs[tail].next >= 0) tail = w.jobs[tail].next;
+        w.jobs[tail].next = (int8_t)id;
+        j.prev = (int8_t)tail;
+    }
+    if (j.level != OVERFLOW_LEVEL) w.occupied[j.level] |= 1ULL << j.slot;
+    j.armed = true;
+}
+
+// Detach a whole list and file each job again against the current time
+static void refile(TimerWheel& w, int8_t& head, uint64_t* occupied, int slot) {
+    int id = head;
+    head = -1;
+    if (occupied) *occupied &= ~(1ULL << slot);
+    while (id >= 0) {
+        int next = w.jobs[id].next;
+        file(w, id);
+        w.cascaded++;
+        id = next;
+    }
+}
+
+// The clock just entered a new level 0 block. Higher levels go first so
+// jobs they move into a slot that cascades next are moved again.
+static void cascade(TimerWheel& w) {
+    if ((w.cur & (levelSpan(TIMER_WHEEL_LEVELS) - 1)) == 0) {
+        refile(w, w.overflow, nullptr, 0);
+    }
+    for (int level = TIMER_WHEEL_LEVELS - 1; level >= 1; level--) {
+        if (w.cur & (levelSpan(level) - 1)) continue;
+        int slot = (int)((w.cur >> (TIMER_WHEEL_BITS * level)) & SLOT_MASK);
+        refile(w, w.heads[level][slot], &w.occupied[level], slot);
+    }
+}
+
+// With level 0 empty, the first time a cascade brings anything down: the
+// lowest occupied slot of the lowest occupied level. No boundary before it
+// has jobs to move, so the clock can skip straight there.
+static uint64_t nextCascade(const TimerWheel& w) {
+    for (int level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+        if (w.occupied[level] == 0) continue;
+        uint64_t blockStart = w.cur & ~(levelSpan(level + 1) - 1);
+        return blockStart + ((uint64_t)__builtin_ctzll(w.occupied[level]) << (TIMER_WHEEL_BITS * level));
+    }
+    return (w.cur | (levelSpan(TIMER_WHEEL_LEVELS) - 1)) + 1;    // Overflow list
+}
+
+// --- Firing ---
+
+static uint32_t fireSlot(TimerWheel& w, uint64_t nowMs) {
+    uint32_t n = 0;
+    int slot = (int)(w.cur & SLOT_MASK);
+    int id;
+
+    w.firing = true;
+    while ((id = w.heads[0][slot]) >= 0) {
+        TimerJob& j = w.jobs[id];
+        unlink(w, id);
+        histogramAdd(j.lateMs, (uint32_t)(nowMs - j.dueMs));
+
+        // Re-armed before it runs, so the job can cancel or move itself
+        if (j.periodMs) {
+            uint64_t next = j.dueMs + j.periodMs;
+            if (next <= nowMs) {
+                uint64_t missed = (nowMs - j.dueMs) / j.periodMs;
+                j.skipped += (uint32_t)missed;
+                next = j.dueMs + (missed + 1) * j.periodMs;
+            }
+            j.dueMs = next;
+            file(w, id);
+        }
+
+        j.runs++;
+        w.fired++;
+        n++;
+        uint32_t start = w.clock ? w.clock() : 0;
+        j.fn();
+        if (w.clock) histogramAdd(j.runUs, (w.clock() - start) / w.ticksPerUs);
+    }
+    w.firing = false;
+    return n;
+}
+
+// --- Public API ---
+
+void timerWheelInit(TimerWheel& w, uint64_t nowMs, TimerClockFn clock, uint32_t ticksPerUs) {
+    memset(&w, 0, sizeof(w));
+    memset(w.heads, 0xFF, sizeof(w.heads));     // All -1
+    w.overflow   = -1;
+    w.cur        = nowMs;
+    w.clock      = clock;
+    w.ticksPerUs = ticksPerUs ? ticksPerUs : 1;
+}
+
+int timerWheelAdd(TimerWheel& w, uint64_t nowMs, const char* name,
+                  uint32_t delayMs, uint32_t periodMs, TimerFn fn) {
+    if (w.count >= TIMER_WHEEL_MAX_JOBS || !fn) return -1;
+    int id = w.count++;
+    TimerJob& j = w.jobs[id];
+    memset(&j, 0, sizeof(j));
+    j.name     = name;
+    j.fn       = fn;
+    j.periodMs = periodMs;
+    j.prev     = -1;
+    j.next     = -1;
+    histogramInit(j.lateMs);
+    histogramInit(j.runUs);
+    timerWheelSchedule(w, id, nowMs, delayMs);
+    return id;
+}
+
+void timerWheelSchedule(TimerWheel& w, int id, uint64_t nowMs, uint32_t delayMs) {
+    if (id < 0 || id >= w.count) return;
+    TimerJob& j = w.jobs[id];
+    if (j.armed) unlink(w, id);
+    j.dueMs = nowMs + delayMs;
+    file(w, id);
+}
+
+void timerWheelCancel(TimerWheel& w, int id) {
+    if (id < 0 || id >= w.count || !w.jobs[id].armed) return;
+    unlink(w, id);
+}
+
+uint32_t timerWheelRun(TimerWheel& w, uint64_t nowMs) {
+    uint32_t fired = 0;
+    while (w.cur <= nowMs) {
+        uint64_t pending = w.occupied[0] >> (w.cur & SLOT_MASK);
+        if (pending == 0) {
+            // Nothing left in this block: jump to the next cascade, or to now
+            uint64_t next = nextCascade(w);
+            w.cur = next < nowMs + 1 ? next : nowMs + 1;
+        } else {
+            uint64_t at = w.cur + __builtin_ctzll(pending);
+            if (at > nowMs) {
+                w.cur = nowMs + 1;      // Same block, nothing crossed
+                break;
+            }
+            w.cur = at;
+            fired += fireSlot(w, nowMs);
+            w.cur++;
+        }
+        if ((w.cur & SLOT_MASK) == 0) cascade(w);
+    }
+
+    return fired;
+}
+
+uint32_t timerWheelMsUntilNext(const TimerWheel& w, uint64_t nowMs, uint32_t maxMs) {
+    // Every deadline in a level comes before any in the levels above
+    uint64_t next = UINT64_MAX;
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVELS && w.occupied[level] == 0) level++;
+
+    if (level == 0) {
+        next = (w.cur & ~SLOT_MASK) | (uint64_t)__builtin_ctzll(w.occupied[0]);
+    } else {
+        int id = level < TIMER_WHEEL_LEVELS ? w.heads[level][__builtin_ctzll(w.occupied[level])]
+                                            : w.overflow;
+        for (; id >= 0; id = w.jobs[id].next) {
+            if (w.jobs[id].dueMs < next) next = w.jobs[id].dueMs;
+        }
+    }
+
+    if (next == UINT64_MAX) return maxMs;
+    if (next <= nowMs) return 0;
+    return next - nowMs < maxMs ? (uint32_t)(next - nowMs) : maxMs;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include "histogram.h"
+
+// ============================================================
+// Timer Wheel - hierarchical timing wheel for periodic and one-shot jobs
+// ============================================================
+//
+// Jobs are filed by deadline in TIMER_WHEEL_LEVELS wheels of 64 slots.
+// Level 0 has a slot per millisecond of the current 64 ms block, level 1
+// a slot per 64 ms block of the current 4096 ms block, and so on. A job
+// sits in the lowest level whose block holds both now and its deadline,
+// and moves down a level each time the clock enters its slot's block
+// (a cascade). Filing, cancelling and firing are O(1). The next deadline
+// comes from one occupancy bitmap per level, so the caller can sleep
+// until exactly then instead of polling.
+//
+// Periodic jobs are re-armed from their deadline, not from when they
+// ran, so a late run does not push the schedule back. A job that falls a
+// whole period behind skips the missed runs (counted) rather than
+// running back to back.
+//
+// Plain C++ with no Arduino dependencies: time is passed in, so the
+// wheel can be driven by a virtual clock on a desktop.
+
+#ifndef TIMER_WHEEL_MAX_JOBS
+#define TIMER_WHEEL_MAX_JOBS    24      // At most 127 (links are int8_t)
+#endif
+
+#define TIMER_WHEEL_BITS        6
+#define TIMER_WHEEL_SLOTS       (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS      5       // 64^5 ms = 12.4 days; later deadlines wait in an overflow list
+
+typedef void (*TimerFn)();
+typedef uint32_t (*TimerClockFn)();     // Free-running ticks (e.g. CPU cycles), for job run times
+
+struct TimerJob {
+    const char* name;
+    TimerFn     fn;
+    uint64_t    dueMs;          // Deadline as asked for (lateness is measured from here)
+    uint32_t    periodMs;       // 0 = one-shot
+    int8_t      prev, next;     // Links within a slot, -1 = none
+    uint8_t     level;          // TIMER_WHEEL_LEVELS = overflow list
+    uint8_t     slot;
+    bool        armed;
+    uint32_t    runs;
+    uint32_t    skipped;        // Periodic runs dropped after falling a period behind
+    Histogram   lateMs;         // Run time minus deadline
+    Histogram   runUs;          // Only with a clock
+};
+
+struct TimerWheel {
+    uint64_t     cur;           // Next millisecond to process; every deadline before it has fired
+    uint64_t     occupied[TIMER_WHEEL_LEVELS];  // Bit per non-empty slot
+    int8_t       heads[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+    int8_t       overflow;
+    bool         firing;        // A slot's jobs are running
+    TimerClockFn clock;
+    uint32_t     ticksPerUs;
+    uint32_t     fired;
+    uint32_t     cascaded;      // Jobs moved down a level
+    uint8_t      count;         // Jobs registered (never removed)
+    TimerJob     jobs[TIMER_WHEEL_MAX_JOBS];
+};
+
+// clock may be null (no run time histograms). Run times are read as
+// clock() deltas over ticksPerUs, so a 32-bit counter may wrap as long as
+// no single job runs for a whole wrap.
+void     timerWheelInit(TimerWheel& w, uint64_t nowMs, TimerClockFn clock, uint32_t ticksPerUs);
+
+// Register a job, first run delayMs from now, then every periodMs (0 =
+// once). Returns its id, or -1 when TIMER_WHEEL_MAX_JOBS are in use.
+int      timerWheelAdd(TimerWheel& w, uint64_t nowMs, const char* name,
+                       uint32_t delayMs, uint32_t periodMs, TimerFn fn);
+
+// (Re)arm a job delayMs from now; a periodic job keeps its period from
+// there. Safe from inside a job, including the job itself.
+void     timerWheelSchedule(TimerWheel& w, int id, uint64_t nowMs, uint32_t delayMs);
+void     timerWheelCancel(TimerWheel& w, int id);     // Disarm, keep the id and stats
+
+// Fire every job due at or before nowMs, in deadline order. Returns the
+// number fired.
+uint32_t timerWheelRun(TimerWheel& w, uint64_t nowMs);
+
+// Milliseconds from nowMs to the next deadline (0 = due now), at most maxMs
+uint32_t timerWheelMsUntilNext(const TimerWheel& w, uint64_t nowMs, uint32_t maxMs);
+
+// Ids run 0 .. w.count - 1; w.jobs[id] holds the name, counters and histograms
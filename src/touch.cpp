@@ -21,6 +21,12 @@ static uint16_t    _threshold      = 0;
 static uint16_t    _lastRaw        = 0;
 static bool        _paused         = false;
 
+// Recalibration after a WiFi scan, one sample per poll
+static bool          _recalibrating = false;
+static unsigned long _settleUntilMs = 0;
+static uint32_t      _calSum        = 0;
+static uint8_t       _calCount      = 0;
+
 // Timing
 static unsigned long _touchStartMs = 0;
 
@@ -36,6 +42,10 @@ static unsigned long _pendingTapMs = 0;
 // Long press tracking: prevents firing twice (once while held, once on release)
 static bool _longPressFired = false;
 
+// Touch pad interrupt that wakes the poller
+static void   (*_wakeIsr)()     = nullptr;
+static uint16_t _wakeThreshold  = 0;    // Threshold the interrupt is armed at, 0 = detached
+
 // --- Internal helpers ---
 
 // Read the touch pin with multi-sample averaging for noise reduction.
@@ -47,10 +57,25 @@ static uint16_t readTouchAvg() {
     return (uint16_t)(sum / TOUCH_SAMPLES);
 }
 
+// Keep the wake interrupt at the current threshold. Re-armed only when
+// the threshold moves, which baseline drift does a step at a time.
+static void armWake() {
+    if (!_wakeIsr || _paused || _threshold == _wakeThreshold) return;
+    touchAttachInterrupt(TOUCH_PIN, _wakeIsr, _threshold);
+    _wakeThreshold = _threshold;
+}
+
+static void disarmWake() {
+    if (!_wakeThreshold) return;
+    touchDetachInterrupt(TOUCH_PIN);
+    _wakeThreshold = 0;
+}
+
 // Recalculate threshold from current baseline.
 static void recalcThreshold() {
     uint8_t pct = settingsGet().touchThresholdPct;
     _threshold = (_baseline * pct) / 100;
+    armWake();
 }
 
 // Perform full calibration: average many samples to establish baseline.
@@ -66,6 +91,22 @@ static void calibrate() {
               _baseline, _threshold, TOUCH_THRESHOLD_PCT);
 }
 
+// One step of the recalibration after a WiFi scan: wait for the ADC to
+// settle, then take one sample per poll instead of blocking for all of
+// them. Returns true once the new baseline is in place.
+static bool recalibrateStep() {
+    if ((long)(millis() - _settleUntilMs) < 0) return false;
+
+    _lastRaw = readTouchAvg();
+    _calSum += _lastRaw;
+    if (++_calCount < TOUCH_BASELINE_SAMPLES) return false;
+
+    _baseline = (uint16_t)(_calSum / TOUCH_BASELINE_SAMPLES);
+    recalcThreshold();
+    logPrintf("Touch recalibrated: baseline=%u threshold=%u", _baseline, _threshold);
+    return true;
+}
+
 // Adaptive baseline drift using exponential moving average.
 // Only applied while not touching, so the baseline tracks slow
 // environmental changes (temperature, humidity) without being
@@ -82,6 +123,7 @@ static void adaptBaseline(uint16_t reading) {
 
 void touchInit() {
     _state = TOUCH_IDLE;
+    _recalibrating = false;
     _flagTap = false;
     _flagLongPress = false;
     _flagDoubleTap = false;
@@ -94,6 +136,10 @@ void touchInit() {
 
 void touchUpdate() {
     if (_paused) return;
+    if (_recalibrating) {
+        _recalibrating = !recalibrateStep();
+        return;
+    }
 
     _lastRaw = readTouchAvg();
     bool isTouching = (_lastRaw < _threshold);
@@ -170,6 +216,18 @@ void touchUpdate() {
     }
 }
 
+uint32_t touchPollMs() {
+    if (_paused) return TOUCH_IDLE_POLL_MS;
+    bool busy = _state == TOUCH_TOUCHING || _pendingTap || _recalibrating;
+    return (busy || !_wakeThreshold) ? TOUCH_POLL_MS : TOUCH_IDLE_POLL_MS;
+}
+
+void touchSetWakeISR(void (*isr)()) {
+    disarmWake();
+    _wakeIsr = isr;
+    if (!_recalibrating) armWake();
+}
+
 bool touchWasTapped() {
     bool val = _flagTap;
     _flagTap = false;
@@ -189,7 +247,7 @@ bool touchWasDoubleTapped() {
 }
 
 bool touchIsTouched() {
-    if (_paused) return false;
+    if (_paused || _recalibrating) return false;
     return (_lastRaw < _threshold);
 }
 
@@ -203,13 +261,17 @@ uint16_t touchGetBaseline() {
 
 void touchPauseForWiFi() {
     _paused = true;
+    disarmWake();       // Radio activity on the shared ADC reads as touches
     logPrintf("Touch paused for WiFi");
 }
 
 void touchResumeAfterWiFi() {
-    _paused = false;
-    delay(50);  // Let ADC settle after WiFi radio activity
-    calibrate();
+    // Gestures resume once touchUpdate() has a new baseline
+    _paused        = false;
+    _recalibrating = true;
+    _settleUntilMs = millis() + TOUCH_SETTLE_MS;  // Let ADC settle after WiFi radio activity
+    _calSum        = 0;
+    _calCount      = 0;
     _state = TOUCH_IDLE;
     _flagTap = false;
     _flagLongPress = false;
@@ -8,7 +8,17 @@
 // ============================================================
 
 void     touchInit();
-void     touchUpdate();             // Call every loop iteration
+void     touchUpdate();             // Call again touchPollMs() later
+
+// TOUCH_POLL_MS while a gesture is in progress or a recalibration runs,
+// TOUCH_IDLE_POLL_MS otherwise, when all an idle sample does is track
+// baseline drift. Idle polling is only that slow with a wake ISR set.
+uint32_t touchPollMs();
+
+// isr runs from the touch pad interrupt when a reading drops below the
+// threshold, so the caller can run touchUpdate() at once instead of at
+// the next idle poll. Must be ISR-safe. Detached while WiFi has the ADC.
+void     touchSetWakeISR(void (*isr)());
 
 // Gesture events (consuming - flag clears on read)
 bool     touchWasTapped();
@@ -22,4 +32,4 @@ uint16_t touchGetBaseline();        // Current adaptive baseline
 
 // WiFi coordination (touch pin shares ADC with WiFi radio)
 void     touchPauseForWiFi();
-void     touchResumeAfterWiFi();
+void     touchResumeAfterWiFi();    // Returns at once; recalibrates over the next polls
@@ -0,0 +1,330 @@
+#include "vlw_font.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================
+// VLW Font Implementation
+// ============================================================
+
+static const uint32_t HEADER_LEN   = 24;
+static const uint32_t RECORD_LEN   = 28;
+static const uint32_t MAX_GLYPH_PX = 255;       // Sanity limit per dimension
+static const int      HASH_BUCKETS = 64;
+static const int16_t  NONE         = -1;
+
+// --- Glyph cache ---
+// Slots sit on a doubly-linked LRU list (head = most recent) and on a
+// hash chain keyed by (font, code point). Bitmaps are malloc'd per glyph
+// and counted against VLW_CACHE_BYTES.
+
+struct CacheSlot {
+    const VlwFont* font;        // nullptr = free
+    uint32_t       code;
+    VlwGlyph       glyph;
+    uint8_t*       data;
+    int16_t        prev, next;  // LRU list
+    int16_t        hashNext;
+};
+
+static CacheSlot     slots[VLW_CACHE_GLYPHS];
+static int16_t       buckets[HASH_BUCKETS];
+static int16_t       lruHead = NONE, lruTail = NONE;
+static bool          cacheReady = false;
+static VlwCacheStats stats;
+
+static uint32_t readBE32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static int bucketFor(const VlwFont* font, uint32_t code) {
+    uint32_t h = code * 2654435761u ^ (uint32_t)(uintptr_t)font;
+    return (int)((h >> 16) % HASH_BUCKETS);
+}
+
+static void cacheInit() {
+    memset(slots, 0, sizeof(slots));
+    for (int i = 0; i < HASH_BUCKETS; i++) buckets[i] = NONE;
+    lruHead = lruTail = NONE;
+    cacheReady = true;
+}
+
+static void lruUnlink(int16_t i) {
+    CacheSlot& s = slots[i];
+    if (s.prev != NONE) slots[s.prev].next = s.next; else lruHead = s.next;
+    if (s.next != NONE) slots[s.next].prev = s.prev; else lruTail = s.prev;
+    s.prev = s.next = NONE;
+}
+
+static void lruPushFront(int16_t i) {
+    CacheSlot& s = slots[i];
+    s.prev = NONE;
+    s.next = lruHead;
+    if (lruHead != NONE) slots[lruHead].prev = i;
+    lruHead = i;
+    if (lruTail == NONE) lruTail = i;
+}
+
+static void evict(int16_t i) {
+    CacheSlot& s = slots[i];
+
+    int b = bucketFor(s.font, s.code);
+    int16_t* link = &buckets[b];
+    while (*link != NONE && *link != i) link = &slots[*link].hashNext;
+    if (*link == i) *link = s.hashNext;
+
+    lruUnlink(i);
+    stats.bytes -= (uint32_t)s.glyph.width * s.glyph.height;
+    stats.glyphs--;
+    free(s.data);
+    memset(&s, 0, sizeof(s));
+}
+
+static int16_t findSlot(const VlwFont* font, uint32_t code) {
+    for (int16_t i = buckets[bucketFor(font, code)]; i != NONE; i = slots[i].hashNext) {
+        if (slots[i].font == font && slots[i].code == code) return i;
+    }
+    return NONE;
+}
+
+// Make room for bytes more alpha data and return a free slot
+static int16_t allocSlot(uint32_t bytes) {
+    while (lruTail != NONE && stats.bytes + bytes > VLW_CACHE_BYTES) {
+        evict(lruTail);
+        stats.evictions++;
+    }
+    for (int16_t i = 0; i < VLW_CACHE_GLYPHS; i++) {
+        if (!slots[i].font) return i;
+    }
+    evict(lruTail);
+    stats.evictions++;
+    for (int16_t i = 0; i < VLW_CACHE_GLYPHS; i++) {
+        if (!slots[i].font) return i;
+    }
+    return NONE;
+}
+
+static const VlwIndexEntry* findIndex(const VlwFont& font, uint32_t code) {
+    int lo = 0, hi = (int)font.glyphCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        uint32_t c = font.index[mid].code;
+        if (c == code) return &font.index[mid];
+        if (c < code) lo = mid + 1; else hi = mid - 1;
+    }
+    return nullptr;
+}
+
+// Read a glyph's metrics and bitmap into a new cache slot
+static int16_t loadGlyph(VlwFont& font, const VlwIndexEntry& entry, uint32_t code) {
+    uint8_t rec[RECORD_LEN];
+    if (!font.read(font.ctx, HEADER_LEN + entry.record * RECORD_LEN, rec, sizeof(rec))) {
+        return NONE;
+    }
+
+    VlwGlyph g;
+    g.height     = (uint16_t)readBE32(rec + 4);
+    g.width      = (uint16_t)readBE32(rec + 8);
+    g.xAdvance   = (int16_t)readBE32(rec + 12);
+    g.topExtent  = (int16_t)readBE32(rec + 16);
+    g.leftExtent = (int16_t)readBE32(rec + 20);
+    g.alpha      = nullptr;
+
+    uint32_t bytes = (uint32_t)g.width * g.height;
+    if (bytes > VLW_CACHE_BYTES) return NONE;
+
+    int16_t i = allocSlot(bytes);
+    if (i == NONE) return NONE;
+
+    uint8_t* data = nullptr;
+    if (bytes) {
+        data = (uint8_t*)malloc(bytes);
+        if (!data || !font.read(font.ctx, entry.bitmapOffset, data, bytes)) {
+            free(data);
+            return NONE;
+        }
+        g.alpha = data;
+    }
+
+    CacheSlot& s = slots[i];
+    s.font  = &font;
+    s.code  = code;
+    s.glyph = g;
+    s.data  = data;
+
+    int b = bucketFor(&font, code);
+    s.hashNext = buckets[b];
+    buckets[b] = i;
+    lruPushFront(i);
+
+    stats.bytes += bytes;
+    stats.glyphs++;
+    return i;
+}
+
+// --- Public API ---
+
+bool vlwOpen(VlwFont& font, VlwReadFn read, void* ctx) {
+    if (!cacheReady) cacheInit();
+    memset(&font, 0, sizeof(font));
+
+    uint8_t hdr[HEADER_LEN];
+    if (!read(ctx, 0, hdr, sizeof(hdr))) return false;
+
+    uint32_t count = readBE32(hdr);
+    if (count == 0 || count > 0xFFFF) return false;
+
+    VlwIndexEntry* index = (VlwIndexEntry*)malloc(count * sizeof(VlwIndexEntry));
+    if (!index) return false;
+
+    // Walk the metrics table in chunks: code points, bitmap offsets and
+    // the true ascent/descent over all glyphs
+    uint8_t  chunk[RECORD_LEN * 16];
+    uint32_t bitmapOffset = HEADER_LEN + count * RECORD_LEN;
+    int16_t  ascent = 0, descent = 0;
+    bool     sorted = true;
+
+    for (uint32_t i = 0; i < count; i += 16) {
+        uint32_t n = (count - i < 16) ? count - i : 16;
+        if (!read(ctx, HEADER_LEN + i * RECORD_LEN, chunk, n * RECORD_LEN)) {
+            free(index);
+            return false;
+        }
+        for (uint32_t j = 0; j < n; j++) {
+            const uint8_t* rec = chunk + j * RECORD_LEN;
+            uint32_t h   = readBE32(rec + 4);
+            uint32_t w   = readBE32(rec + 8);
+            int32_t  top = (int32_t)readBE32(rec + 16);
+            if (w > MAX_GLYPH_PX || h > MAX_GLYPH_PX) {
+                free(index);
+                return false;
+            }
+
+            VlwIndexEntry& e = index[i + j];
+            e.code         = readBE32(rec);
+            e.bitmapOffset = bitmapOffset;
+            e.record       = (uint16_t)(i + j);
+            bitmapOffset  += w * h;
+
+            if (top > ascent) ascent = (int16_t)top;
+            if ((int32_t)h - top > descent) descent = (int16_t)(h - top);
+            if (i + j > 0 && e.code < index[i + j - 1].code) sorted = false;
+        }
+    }
+
+    // Processing writes glyphs in code point order; sort anything else
+    if (!sorted) {
+        for (uint32_t i = 1; i < count; i++) {
+            VlwIndexEntry e = index[i];
+            uint32_t j = i;
+            while (j > 0 && index[j - 1].code > e.code) {
+                index[j] = index[j - 1];
+                j--;
+            }
+            index[j] = e;
+        }
+    }
+
+    font.read       = read;
+    font.ctx        = ctx;
+    font.index      = index;
+    font.glyphCount = (uint16_t)count;
+    font.size       = (uint16_t)readBE32(hdr + 8);
+    font.ascent     = ascent;
+    font.descent    = descent;
+    font.spaceAdvance = (int16_t)(font.size / 4 + 1);
+
+    VlwGlyph space;
+    if (vlwGetGlyph(font, ' ', space)) font.spaceAdvance = space.xAdvance;
+    return true;
+}
+
+void vlwClose(VlwFont& font) {
+    for (int16_t i = 0; i < VLW_CACHE_GLYPHS; i++) {
+        if (slots[i].font == &font) evict(i);
+    }
+    free(font.index);
+    memset(&font, 0, sizeof(font));
+}
+
+bool vlwGetGlyph(VlwFont& font, uint32_t code, VlwGlyph& out) {
+    stats.lookups++;
+
+    int16_t i = findSlot(&font, code);
+    if (i != NONE) {
+        stats.hits++;
+        if (i != lruHead) {
+            lruUnlink(i);
+            lruPushFront(i);
+        }
+        out = slots[i].glyph;
+        return true;
+    }
+
+    const VlwIndexEntry* entry = findIndex(font, code);
+    if (entry) {
+        stats.misses++;
+        i = loadGlyph(font, *entry, code);
+        if (i != NONE) {
+            out = slots[i].glyph;
+            return true;
+        }
+    } else {
+        stats.missing++;
+    }
+
+    memset(&out, 0, sizeof(out));
+    out.xAdvance = font.spaceAdvance;
+    return false;
+}
+
+uint32_t vlwNextCodepoint(const char*& s) {
+    const uint8_t* p = (const uint8_t*)s;
+    uint32_t c = p[0];
+    int extra = 0;
+
+    if (c < 0x80)                { s += 1; return c; }
+    else if ((c & 0xE0) == 0xC0) { c &= 0x1F; extra = 1; }
+    else if ((c & 0xF0) == 0xE0) { c &= 0x0F; extra = 2; }
+    else if ((c & 0xF8) == 0xF0) { c &= 0x07; extra = 3; }
+    else                         { s += 1; return 0xFFFD; }
+
+    for (int i = 1; i <= extra; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            s += i;             // Stop at the offending byte
+            return 0xFFFD;
+        }
+        c = (c << 6) | (p[i] & 0x3F);
+    }
+    s += 1 + extra;
+    return c;
+}
+
+int vlwTextWidth(VlwFont& font, const char* utf8) {
+    int w = 0;
+    VlwGlyph g;
+    while (*utf8) {
+        vlwGetGlyph(font, vlwNextCodepoint(utf8), g);
+        w += g.xAdvance;
+    }
+    return w;
+}
+
+int vlwLineHeight(const VlwFont& font) {
+    return font.ascent + font.descent;
+}
+
+void vlwBlendLut(uint16_t fg, uint16_t bg, uint16_t lut[16]) {
+    int fr = fg >> 11, fgn = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+    int br = bg >> 11, bgn = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+    for (int a = 0; a < 16; a++) {
+        int r = (fr * a + br * (15 - a) + 7) / 15;
+        int g = (fgn * a + bgn * (15 - a) + 7) / 15;
+        int b = (fb * a + bb * (15 - a) + 7) / 15;
+        lut[a] = (uint16_t)((r << 11) | (g << 5) | b);
+    }
+}
+
+const VlwCacheStats& vlwCacheGetStats() {
+    return stats;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================
+// VLW Font - anti-aliased fonts with an LRU glyph cache
+// ============================================================
+//
+// Reads Processing/LovyanGFX .vlw smooth fonts (8-bit alpha glyphs, any
+// Unicode range) through a read callback, so the file can live on
+// LittleFS without being loaded into RAM. Opening a font keeps only a
+// sorted code point index (12 bytes per glyph); metrics and bitmaps are
+// read on first use and kept in a shared, byte-bounded LRU cache, so
+// text that is redrawn every minute never touches flash again.
+//
+// Drawing stays with the caller: vlwBlendLut() turns a fg/bg pair into
+// 16 pre-blended RGB565 shades that glyph alpha indexes directly.
+//
+// File layout (all integers 32-bit big-endian):
+//   header   glyph count, version, size, (unused), ascent, descent
+//   metrics  per glyph: code point, height, width, x advance,
+//            top extent (above baseline), left extent, (unused)
+//   bitmaps  per glyph in the same order: width x height alpha bytes
+//
+// Plain C++ with no Arduino dependencies.
+
+#ifndef VLW_CACHE_BYTES
+#define VLW_CACHE_BYTES     12288   // Alpha bytes kept across all fonts
+#endif
+
+#ifndef VLW_CACHE_GLYPHS
+#define VLW_CACHE_GLYPHS    96      // Cache slots (metrics + bitmap pointer)
+#endif
+
+// Read len bytes at offset from the font file. false = I/O error.
+typedef bool (*VlwReadFn)(void* ctx, uint32_t offset, uint8_t* dst, uint32_t len);
+
+struct VlwIndexEntry {
+    uint32_t code;
+    uint32_t bitmapOffset;
+    uint16_t record;            // Position in the metrics table
+};
+
+struct VlwFont {
+    VlwReadFn      read;
+    void*          ctx;
+    VlwIndexEntry* index;       // Sorted by code point
+    uint16_t       glyphCount;
+    uint16_t       size;        // Nominal pixel size from the header
+    int16_t        ascent;      // Tallest glyph above the baseline
+    int16_t        descent;     // Deepest glyph below the baseline
+    int16_t        spaceAdvance;    // Used for code points the font lacks
+};
+
+struct VlwGlyph {
+    uint16_t       width;
+    uint16_t       height;
+    int16_t        xAdvance;
+    int16_t        topExtent;   // Rows above the baseline
+    int16_t        leftExtent;
+    const uint8_t* alpha;       // width x height, nullptr for blank glyphs
+};
+
+struct VlwCacheStats {
+    uint32_t lookups;
+    uint32_t hits;
+    uint32_t misses;            // Glyph read from the font file
+    uint32_t evictions;
+    uint32_t missing;           // Code points not in the font
+    uint32_t bytes;             // Alpha bytes currently cached
+    uint16_t glyphs;            // Glyphs currently cached
+};
+
+bool vlwOpen(VlwFont& font, VlwReadFn read, void* ctx);
+void vlwClose(VlwFont& font);   // Also drops its cached glyphs
+
+// Glyph for a code point, through the cache. The alpha pointer stays
+// valid until the next vlwGetGlyph() call. false = not in the font
+// (out still holds a blank glyph with the space advance).
+bool vlwGetGlyph(VlwFont& font, uint32_t code, VlwGlyph& out);
+
+// Decode one UTF-8 code point and advance s. Malformed bytes yield U+FFFD.
+uint32_t vlwNextCodepoint(const char*& s);
+
+int  vlwTextWidth(VlwFont& font, const char* utf8);
+int  vlwLineHeight(const VlwFont& font);
+
+// 16 RGB565 shades from bg (index 0) to fg (index 15); alpha >> 4 picks one
+void vlwBlendLut(uint16_t fg, uint16_t bg, uint16_t lut[16]);
+
+const VlwCacheStats& vlwCacheGetStats();
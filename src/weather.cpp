@@ -10,7 +10,6 @@
 // --- Module state ---
 
 static WeatherData currentWeather;
-static unsigned long lastFetchAttempt = 0;
 
 // --- WMO weather code to icon mapping ---
 // Reference: https://open-meteo.com/en/docs (WMO Weather interpretation codes)
@@ -201,28 +200,15 @@ void weatherInit() {
     currentWeather.icon        = ICON_UNKNOWN;
     currentWeather.lastFetchMs = 0;
 
-    // Set initial fetch time so the first fetch happens 10 seconds after boot
-    // instead of immediately (which would block the main loop for up to 10s)
-    lastFetchAttempt = millis() - WEATHER_FETCH_INTERVAL + 10000;
-
-    logPrintf("[WEATHER] Weather client initialized (first fetch in ~10s)");
+    logPrintf("[WEATHER] Weather client initialized");
 }
 
 void weatherUpdate() {
-    unsigned long now = millis();
-
-    // First fetch: try immediately once WiFi is available
-    // Subsequent fetches: respect the interval
-    if (lastFetchAttempt == 0 ||
-        (now - lastFetchAttempt) >= WEATHER_FETCH_INTERVAL) {
-        lastFetchAttempt = now;
-        fetchWeather();
-    }
+    fetchWeather();
 }
 
 void weatherFetchNow() {
     logPrintf("[WEATHER] Forced fetch requested");
-    lastFetchAttempt = millis();
     fetchWeather();
 }
 
@@ -32,7 +32,7 @@ struct WeatherData {
 };
 
 void               weatherInit();
-void               weatherUpdate();                         // Call in main loop (fetches every 15 min)
+void               weatherUpdate();                         // Scheduled fetch, every WEATHER_FETCH_INTERVAL
 void               weatherFetchNow();                       // Force immediate fetch
 const WeatherData& weatherGet();
 const char*        weatherIconName(WeatherIcon icon);       // "Clear", "Cloudy", etc.
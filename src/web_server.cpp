@@ -6,18 +6,30 @@
 #include "weather.h"
 #include "ota.h"
 #include "touch.h"
+#include "remote_display.h"
+#include "screen_stream.h"
+#include "vlw_font.h"
+#include "backlight.h"
+#include "boot_trace.h"
+#include "splash.h"
+#include "photo.h"
+#include "scheduler.h"
 
 #include <WebServer.h>
 #include <ArduinoJson.h>
 #include <Update.h>
+#include <esp_timer.h>
 #include "index_html_gz.h"
 
 // --- Module state ---
 static WebServer server(WEB_SERVER_PORT);
+static unsigned long lastClientMs = 0;     // Last pass that had a client, see webServerPollMs()
 
 // --- Forward declarations ---
 static void handleRoot();
 static void handleStatus();
+static void handlePerf();
+static void handleMetrics();
 static void handleSet();
 static void handleWeather();
 static void handleScan();
@@ -29,6 +41,11 @@ static void handleConfirmGood();
 static void handleRollback();
 static void handleReset();
 static void handleLog();
+static void handleScreenshot();
+static void handleScreenStream();
+static void handlePhotos();
+static void handlePhotoUploadDone();
+static void handlePhotoDelete();
 static void handleCaptiveRedirect();
 static void handleNotFound();
 static void addCorsHeaders();
@@ -143,6 +160,9 @@ static void handleStatus() {
     doc["heap"]       = ESP.getFreeHeap();
     doc["uptime"]     = millis() / 1000;
     doc["brightness"] = s.brightness;
+    doc["night_brightness"] = s.nightBrightness;
+    doc["night_start"]      = s.nightStartMin;
+    doc["night_end"]        = s.nightEndMin;
     doc["temp_f"]     = s.tempFahrenheit;
     doc["gmt_offset"] = s.gmtOffsetSec;
     doc["lat"]        = s.latitude;
@@ -153,11 +173,411 @@ static void handleStatus() {
     doc["touch_touching"] = touchIsTouched();
     doc["touch_threshold_pct"] = s.touchThresholdPct;
 
+    const DisplayFrameStats& fs = displayGetFrameStats();
+    doc["display_back_buffer"]        = fs.backBuffer;
+    doc["display_frames"]             = fs.frames;
+    doc["display_frame_bytes"]        = fs.lastBytes;
+    doc["display_frame_transactions"] = fs.lastTransactions;
+    doc["display_frame_bytes_max"]    = fs.maxBytes;
+    doc["display_bytes_total"]        = fs.totalBytes;
+    doc["display_transactions_total"] = fs.totalTransactions;
+
+    const DisplayClockStats& cs = displayGetClockStats();
+    doc["clock_cell_blits"]       = cs.cellBlits;
+    doc["clock_pixels_written"]   = cs.pixelsWritten;
+    doc["clock_full_path_pixels"] = cs.fullPathPixels;
+
+    const RenderSchedulerStats& rs = displayGetSchedulerStats();
+    doc["render_count"]            = rs.renders;
+    doc["render_wakeups_avoided"]  = rs.wakeupsAvoided;
+    doc["rollover_latency_ms"]     = rs.lastRolloverLatencyMs;
+    doc["rollover_latency_max_ms"] = rs.maxRolloverLatencyMs;
+
+    const DisplayTaskStats& ts = displayGetTaskStats();
+    doc["render_gap_ms"]     = ts.lastGapMs;
+    doc["render_gap_max_ms"] = ts.maxGapMs;
+
+    const DisplayBusStats& bs = displayGetBusStats();
+    doc["bus_pass_bytes"]        = bs.lastBytes;
+    doc["bus_pass_commands"]     = bs.lastCommands;
+    doc["bus_pass_addr_windows"] = bs.lastAddrWindows;
+    doc["bus_pass_bytes_max"]    = bs.maxBytes;
+    doc["bus_bytes_total"]       = bs.totalBytes;
+
+    const BacklightStats& bl = backlightGetStats();
+    doc["backlight_level"]    = bl.level;
+    doc["backlight_duty"]     = bl.duty;
+    doc["backlight_duty_max"] = bl.dutyMax;
+    doc["backlight_night"]    = bl.night;
+    doc["backlight_fades"]    = bl.fades;
+
+    const RemoteDisplayStats& rd = remoteDisplayGetStats();
+    doc["remote_active"]        = rd.active;
+    doc["remote_frames"]        = rd.frames;
+    doc["remote_tiles"]         = rd.tiles;
+    doc["remote_tiles_retried"] = rd.retriedTiles;
+    doc["remote_deferred"]      = rd.deferredPasses;
+    doc["remote_bad_packets"]   = rd.badPackets;
+
     String json;
     serializeJson(doc, json);
     server.send(200, "application/json", json);
 }
 
+static void addHistogram(JsonObject obj, const Histogram& h) {
+    obj["count"] = h.count;
+    obj["min"]   = h.min;
+    obj["max"]   = h.max;
+    obj["avg"]   = histogramMean(h);
+    obj["p50"]   = histogramPercentile(h, 50);
+    obj["p95"]   = histogramPercentile(h, 95);
+    obj["p99"]   = histogramPercentile(h, 99);
+
+    // Trailing empty buckets are trimmed; see "bucket_limits_us"
+    int last = HISTOGRAM_BUCKETS - 1;
+    while (last > 0 && h.buckets[last] == 0) last--;
+    JsonArray buckets = obj["buckets"].to<JsonArray>();
+    for (int i = 0; i <= last; i++) {
+        buckets.add(h.buckets[i]);
+    }
+}
+
+static void handlePerf() {
+    addCorsHeaders();
+
+    JsonDocument doc;
+    doc["uptime"] = millis() / 1000;
+
+    JsonArray limits = doc["bucket_limits_us"].to<JsonArray>();
+    for (int i = 0; i < HISTOGRAM_BUCKETS - 1; i++) {
+        limits.add(histogramBucketLimit(i));
+    }
+
+    const DisplayPerfStats& ps = displayGetPerfStats();
+    JsonObject pages = doc["render"].to<JsonObject>();
+    for (int i = 0; i < PERF_KIND_COUNT; i++) {
+        const DisplayPerfEntry& e = ps.kinds[i];
+        JsonObject obj = pages[displayPerfKindName((DisplayPerfKind)i)].to<JsonObject>();
+        obj["last_us"]      = e.lastUs;
+        obj["pixels"]       = e.pixels;
+        obj["bytes"]        = e.bytes;
+        obj["addr_windows"] = e.addrWindows;
+        obj["ram_writes"]   = e.ramWrites;
+        obj["transactions"] = e.transactions;
+        addHistogram(obj["us"].to<JsonObject>(), e.renderUs);
+    }
+    addHistogram(doc["dma_wait_us"].to<JsonObject>(), ps.dmaWaitUs);
+    addHistogram(doc["capture_wait_us"].to<JsonObject>(), ps.captureWaitUs);
+
+    const DisplayTransitionStats& tr = ps.transition;
+    JsonObject trans = doc["transition"].to<JsonObject>();
+    trans["count"]       = tr.count;
+    trans["frames"]      = tr.lastFrames;
+    trans["overruns"]    = tr.lastOverruns;
+    trans["duration_ms"] = tr.lastDurationMs;
+    trans["fps"]         = tr.lastFps;
+    trans["period_us"]   = tr.lastPeriodUs;
+    addHistogram(trans["frame_us"].to<JsonObject>(), tr.frameUs);
+
+    JsonArray boot = doc["boot"].to<JsonArray>();
+    for (int i = 0; i < bootTraceCount(); i++) {
+        const BootTraceEntry& e = bootTraceGet(i);
+        JsonObject mark = boot.add<JsonObject>();
+        mark["stage"] = e.stage;
+        mark["ms"]    = e.ms;
+    }
+
+    const SplashStats& sp = splashGetStats();
+    JsonObject splash = doc["splash"].to<JsonObject>();
+    splash["loaded"]       = sp.loaded;
+    splash["load_ms"]      = sp.loadMs;
+    splash["saves"]        = sp.saves;
+    splash["failures"]     = sp.failures;
+    splash["last_bytes"]   = sp.lastBytes;
+    splash["last_save_ms"] = sp.lastSaveMs;
+
+    const DisplayConsoleStats& cs = displayGetConsoleStats();
+    JsonObject console = doc["console"].to<JsonObject>();
+    console["lines"]   = cs.lines;
+    console["scrolls"] = cs.scrolls;
+    console["redraws"] = cs.redraws;
+    console["dropped"] = cs.dropped;
+
+    const DisplayLayoutStats& ls = displayGetLayoutStats();
+    JsonObject layout = doc["layout"].to<JsonObject>();
+    layout["runs"]              = ls.runs;
+    layout["ops_skipped"]       = ls.opsSkipped;
+    layout["ops_evaluated"]     = ls.opsEvaluated;
+    layout["ops_drawn"]         = ls.opsDrawn;
+    layout["ops_erased"]        = ls.opsErased;
+    layout["clock_from_file"]   = ls.clockFromFile;
+    layout["sysinfo_from_file"] = ls.sysinfoFromFile;
+    addHistogram(layout["run_us"].to<JsonObject>(), ls.runUs);
+
+    const DisplayAnalogStats& as = displayGetAnalogStats();
+    JsonObject analog = doc["analog"].to<JsonObject>();
+    analog["ticks"]        = as.ticks;
+    analog["faces"]        = as.faces;
+    analog["last_pixels"]  = as.lastPixels;
+    analog["last_rects"]   = as.lastRects;
+    analog["total_pixels"] = as.totalPixels;
+    addHistogram(analog["tick_pixels"].to<JsonObject>(), as.tickPixels);
+    addHistogram(analog["tick_us"].to<JsonObject>(), as.tickUs);
+
+    const DisplayPhotoStats& dp = displayGetPhotoStats();
+    const PhotoStats&        pp = photoGetStats();
+    JsonObject photo = doc["photo"].to<JsonObject>();
+    photo["files"]         = pp.files;
+    photo["shown"]         = pp.shown;
+    photo["prefetched"]    = pp.prefetched;
+    photo["read_failures"] = pp.readFailures;
+    photo["last_read_ms"]  = pp.lastReadMs;
+    photo["uploads"]       = pp.uploads;
+    photo["decodes"]       = dp.decodes;
+    photo["failures"]      = dp.failures;
+    photo["from_ram"]      = dp.fromRam;
+    photo["from_flash"]    = dp.fromFlash;
+    photo["dropped"]       = dp.dropped;
+    photo["last_us"]       = dp.lastUs;
+    photo["last_bytes"]    = dp.lastBytes;
+    addHistogram(photo["decode_us"].to<JsonObject>(), dp.decodeUs);
+    addHistogram(photo["chunk_us"].to<JsonObject>(), pp.chunkUs);
+
+    const DisplayGifStats& gs = displayGetGifStats();
+    JsonObject gifObj = doc["gif"].to<JsonObject>();
+    gifObj["files"]       = gs.files;
+    gifObj["frames"]      = gs.frames;
+    gifObj["shown"]       = gs.shown;
+    gifObj["dropped"]     = gs.dropped;
+    gifObj["loops"]       = gs.loops;
+    gifObj["errors"]      = gs.errors;
+    gifObj["fps"]         = gs.lastFps;
+    gifObj["target_fps"]  = gs.lastTargetFps;
+    gifObj["last_pixels"] = gs.lastPixels;
+    addHistogram(gifObj["decode_us"].to<JsonObject>(), gs.decodeUs);
+
+    // Lateness is in ms, so its buckets are ms as well
+    const SchedStats& sc = schedGetStats();
+    const TimerWheel& wheel = schedGetWheel();
+    JsonObject sched = doc["sched"].to<JsonObject>();
+    sched["passes"]   = sc.passes;
+    sched["triggers"] = sc.triggers;
+    sched["wakeups"]  = sc.wakeups;
+    sched["idle_pct"] = sc.lastIdlePct;
+    sched["fired"]    = wheel.fired;
+    sched["cascaded"] = wheel.cascaded;
+    addHistogram(sched["pass_us"].to<JsonObject>(), sc.passUs);
+    JsonArray jobs = sched["jobs"].to<JsonArray>();
+    for (int i = 0; i < wheel.count; i++) {
+        const TimerJob& j = wheel.jobs[i];
+        JsonObject job = jobs.add<JsonObject>();
+        job["name"]      = j.name;
+        job["period_ms"] = j.periodMs;
+        job["armed"]     = j.armed;
+        job["runs"]      = j.runs;
+        job["skipped"]   = j.skipped;
+        addHistogram(job["late_ms"].to<JsonObject>(), j.lateMs);
+        addHistogram(job["run_us"].to<JsonObject>(), j.runUs);
+    }
+
+    const WifiFsm& wf = wifiGetState();
+    JsonObject wifi = doc["wifi"].to<JsonObject>();
+    wifi["state"]           = wifiFsmStateName(wf.state);
+    wifi["attempts"]        = wf.stats.attempts;
+    wifi["failures"]        = wf.stats.failures;
+    wifi["connects"]        = wf.stats.connects;
+    wifi["drops"]           = wf.stats.drops;
+    wifi["ap_fallbacks"]    = wf.stats.apFallbacks;
+    wifi["last_connect_ms"] = wf.stats.lastConnectMs;
+    wifi["fast_connects"]   = wf.stats.fastConnects;
+    wifi["fast_misses"]     = wf.stats.fastMisses;
+
+    const WifiConnectStats& wc = wifiGetConnectStats();
+    wifi["path"]            = wifiConnectPathName(wc.lastPath);
+    wifi["boot_path"]       = wifiConnectPathName(wc.bootPath);
+    wifi["boot_to_ip_ms"]   = wc.bootToIpMs;
+    wifi["cache_writes"]    = wc.cacheWrites;
+
+    const DisplayFontStats& fs = displayGetFontStats();
+    const VlwCacheStats&    fc = vlwCacheGetStats();
+    JsonObject font = doc["font"].to<JsonObject>();
+    font["loaded"]          = fs.loaded;
+    font["glyphs"]          = fs.glyphs;
+    font["strings"]         = fs.strings;
+    font["cache_lookups"]   = fc.lookups;
+    font["cache_hits"]      = fc.hits;
+    font["cache_hit_pct"]   = fc.lookups ? (fc.hits * 100.0f) / fc.lookups : 0.0f;
+    font["cache_misses"]    = fc.misses;
+    font["cache_evictions"] = fc.evictions;
+    font["cache_missing"]   = fc.missing;
+    font["cache_bytes"]     = fc.bytes;
+    font["cache_glyphs"]    = fc.glyphs;
+    addHistogram(font["string_us"].to<JsonObject>(), fs.stringUs);
+
+    const ScreenStreamStats& ss = screenStreamGetStats();
+    JsonObject stream = doc["stream"].to<JsonObject>();
+    stream["active"]      = ss.active;
+    stream["clients"]     = ss.clients;
+    stream["frames"]      = ss.frames;
+    stream["tiles"]       = ss.tiles;
+    stream["bytes"]       = ss.bytes;
+    stream["frame_bytes"] = ss.lastFrameBytes;
+    stream["busy"]        = ss.busy;
+    stream["write_full"]  = ss.writeFull;
+    stream["stalled"]     = ss.stalled;
+    addHistogram(stream["encode_us"].to<JsonObject>(), ss.encodeUs);
+    addHistogram(stream["write_us"].to<JsonObject>(), ss.writeUs);
+
+    const DisplayBusStats& bs = displayGetBusStats();
+    doc["bus_passes"]      = bs.passes;
+    doc["bus_bytes_total"] = bs.totalBytes;
+
+    String json;
+    serializeJson(doc, json);
+    server.send(200, "application/json", json);
+}
+
+// ============================================================
+// Prometheus Metrics
+// ============================================================
+// Text exposition format for scraping: run time and lateness of every
+// loop job as histograms, plus heap, signal and uptime gauges. Sent in
+// chunks, since the job histograms alone come to tens of KB.
+
+static const size_t METRICS_CHUNK = 1024;
+
+static void metricsFlush(String& out) {
+    if (out.length() >= METRICS_CHUNK) {
+        server.sendContent(out);
+        out = "";
+    }
+}
+
+static void metricsHeader(String& out, const char* name, const char* type, const char* help) {
+    char line[192];
+    snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    out += line;
+}
+
+// labels is the inside of {} ("job=\"touch\""), or null
+static void metricsValue(String& out, const char* name, const char* labels, double value) {
+    char line[160];
+    if (labels) snprintf(line, sizeof(line), "%s{%s} %.10g\n", name, labels, value);
+    else        snprintf(line, sizeof(line), "%s %.10g\n", name, value);
+    out += line;
+}
+
+// Prometheus buckets are cumulative with inclusive upper bounds. Ours
+// count whole units below histogramBucketLimit(), so bucket b tops out at
+// limit - 1. scale turns units into seconds.
+static void metricsHistogram(String& out, const char* name, const char* labels,
+                             const Histogram& h, double scale) {
+    char line[160];
+    const char* sep = labels ? "," : "";
+    uint32_t cumulative = 0;
+    for (int b = 0; b < HISTOGRAM_BUCKETS - 1; b++) {
+        cumulative += h.buckets[b];
+        snprintf(line, sizeof(line), "%s_bucket{%s%sle=\"%g\"} %u\n", name, labels ? labels : "", sep,
+                 (histogramBucketLimit(b) - 1) * scale, cumulative);
+        out += line;
+    }
+    snprintf(line, sizeof(line), "%s_bucket{%s%sle=\"+Inf\"} %u\n", name, labels ? labels : "", sep, h.count);
+    out += line;
+
+    char series[96];
+    snprintf(series, sizeof(series), "%s_sum", name);
+    metricsValue(out, series, labels, h.sum * scale);
+    snprintf(series, sizeof(series), "%s_count", name);
+    metricsValue(out, series, labels, h.count);
+}
+
+static void handleMetrics() {
+    const SchedStats& sc    = schedGetStats();
+    const TimerWheel& wheel = schedGetWheel();
+    char labels[64];
+    String out;
+    out.reserve(METRICS_CHUNK + 512);
+
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain; version=0.0.4", "");
+
+    snprintf(labels, sizeof(labels), "version=\"%s\",device=\"%s\"", FW_VERSION, wifiGetDeviceId().c_str());
+    metricsHeader(out, "smalltv_build_info", "gauge", "Firmware version and device id");
+    metricsValue(out, "smalltv_build_info", labels, 1);
+    metricsHeader(out, "smalltv_uptime_seconds", "gauge", "Time since boot");
+    metricsValue(out, "smalltv_uptime_seconds", nullptr, esp_timer_get_time() / 1e6);
+    metricsHeader(out, "smalltv_heap_free_bytes", "gauge", "Free heap");
+    metricsValue(out, "smalltv_heap_free_bytes", nullptr, ESP.getFreeHeap());
+    metricsHeader(out, "smalltv_heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+    metricsValue(out, "smalltv_heap_min_free_bytes", nullptr, ESP.getMinFreeHeap());
+    metricsHeader(out, "smalltv_heap_max_alloc_bytes", "gauge", "Largest allocatable heap block");
+    metricsValue(out, "smalltv_heap_max_alloc_bytes", nullptr, ESP.getMaxAllocHeap());
+    metricsHeader(out, "smalltv_wifi_connected", "gauge", "1 when joined to an access point");
+    metricsValue(out, "smalltv_wifi_connected", nullptr, wifiIsConnected() ? 1 : 0);
+    if (wifiIsConnected()) {
+        metricsHeader(out, "smalltv_wifi_rssi_dbm", "gauge", "Signal strength of the joined access point");
+        metricsValue(out, "smalltv_wifi_rssi_dbm", nullptr, wifiGetRSSI());
+    }
+
+    // Boot to first IP, labelled with how it connected, to compare the fast
+    // and full paths across units
+    const WifiConnectStats& wc = wifiGetConnectStats();
+    const WifiFsm&          wf = wifiGetState();
+    if (wc.bootPath != WIFI_PATH_NONE) {
+        snprintf(labels, sizeof(labels), "path=\"%s\"", wifiConnectPathName(wc.bootPath));
+        metricsHeader(out, "smalltv_wifi_boot_connect_seconds", "gauge", "Boot to first IP");
+        metricsValue(out, "smalltv_wifi_boot_connect_seconds", labels, wc.bootToIpMs / 1000.0);
+    }
+    metricsHeader(out, "smalltv_wifi_drops_total", "counter", "Working links lost");
+    metricsValue(out, "smalltv_wifi_drops_total", nullptr, wf.stats.drops);
+    metricsHeader(out, "smalltv_wifi_fast_connects_total", "counter", "Connects through the cached AP");
+    metricsValue(out, "smalltv_wifi_fast_connects_total", nullptr, wf.stats.fastConnects);
+    metricsHeader(out, "smalltv_wifi_fast_misses_total", "counter", "Cached AP attempts that fell back to the full path");
+    metricsValue(out, "smalltv_wifi_fast_misses_total", nullptr, wf.stats.fastMisses);
+
+    metricsHeader(out, "smalltv_loop_passes_total", "counter", "Scheduler passes of loop()");
+    metricsValue(out, "smalltv_loop_passes_total", nullptr, sc.passes);
+    metricsHeader(out, "smalltv_loop_idle_ratio", "gauge", "Share of the last second loop() spent asleep");
+    metricsValue(out, "smalltv_loop_idle_ratio", nullptr, sc.lastIdlePct / 100.0);
+    metricsHeader(out, "smalltv_loop_pass_seconds", "histogram", "Run time of one scheduler pass");
+    metricsHistogram(out, "smalltv_loop_pass_seconds", nullptr, sc.passUs, 1e-6);
+    metricsFlush(out);
+
+    // One family at a time: the format wants each family's series together
+    metricsHeader(out, "smalltv_job_runs_total", "counter", "Runs of each loop job");
+    for (int i = 0; i < wheel.count; i++) {
+        snprintf(labels, sizeof(labels), "job=\"%s\"", wheel.jobs[i].name);
+        metricsValue(out, "smalltv_job_runs_total", labels, wheel.jobs[i].runs);
+    }
+    metricsHeader(out, "smalltv_job_skipped_total", "counter", "Periodic runs dropped after falling a period behind");
+    for (int i = 0; i < wheel.count; i++) {
+        snprintf(labels, sizeof(labels), "job=\"%s\"", wheel.jobs[i].name);
+        metricsValue(out, "smalltv_job_skipped_total", labels, wheel.jobs[i].skipped);
+    }
+    metricsHeader(out, "smalltv_job_run_max_seconds", "gauge", "Longest run of each loop job since boot");
+    for (int i = 0; i < wheel.count; i++) {
+        snprintf(labels, sizeof(labels), "job=\"%s\"", wheel.jobs[i].name);
+        metricsValue(out, "smalltv_job_run_max_seconds", labels, wheel.jobs[i].runUs.max * 1e-6);
+    }
+    metricsFlush(out);
+
+    metricsHeader(out, "smalltv_job_run_seconds", "histogram", "Run time of each loop job");
+    for (int i = 0; i < wheel.count; i++) {
+        snprintf(labels, sizeof(labels), "job=\"%s\"", wheel.jobs[i].name);
+        metricsHistogram(out, "smalltv_job_run_seconds", labels, wheel.jobs[i].runUs, 1e-6);
+        metricsFlush(out);
+    }
+    metricsHeader(out, "smalltv_job_lateness_seconds", "histogram", "Start of each loop job after its deadline");
+    for (int i = 0; i < wheel.count; i++) {
+        snprintf(labels, sizeof(labels), "job=\"%s\"", wheel.jobs[i].name);
+        metricsHistogram(out, "smalltv_job_lateness_seconds", labels, wheel.jobs[i].lateMs, 1e-3);
+        metricsFlush(out);
+    }
+
+    if (out.length()) server.sendContent(out);
+    server.sendContent("");     // End of chunked body
+}
+
 static void handleSet() {
     addCorsHeaders();
 
@@ -168,11 +588,29 @@ static void handleSet() {
         int brt = server.arg("brt").toInt();
         brt = constrain(brt, 0, 100);
         s.brightness = (uint8_t)brt;
-        displaySetBrightness(s.brightness);
         logPrintf("Web: brightness set to %d", s.brightness);
         changed = true;
     }
 
+    // Night window: level plus start/end as minutes after local midnight
+    if (server.hasArg("nightBrt")) {
+        s.nightBrightness = (uint8_t)constrain(server.arg("nightBrt").toInt(), 0, 100);
+        changed = true;
+    }
+    if (server.hasArg("nightStart")) {
+        s.nightStartMin = (uint16_t)constrain(server.arg("nightStart").toInt(), 0, 1439);
+        changed = true;
+    }
+    if (server.hasArg("nightEnd")) {
+        s.nightEndMin = (uint16_t)constrain(server.arg("nightEnd").toInt(), 0, 1439);
+        changed = true;
+    }
+    if (server.hasArg("nightBrt") || server.hasArg("nightStart") || server.hasArg("nightEnd")) {
+        logPrintf("Web: night %d%% from %02d:%02d to %02d:%02d", s.nightBrightness,
+                  s.nightStartMin / 60, s.nightStartMin % 60,
+                  s.nightEndMin / 60, s.nightEndMin % 60);
+    }
+
     if (server.hasArg("gmt")) {
         s.gmtOffsetSec = server.arg("gmt").toInt();
         logPrintf("Web: GMT offset set to %ld", s.gmtOffsetSec);
@@ -195,6 +633,7 @@ static void handleSet() {
 
     if (changed) {
         settingsSave();
+        backlightLoadSettings();
     }
 
     JsonDocument doc;
@@ -233,9 +672,12 @@ static void handleScan() {
         return;
     }
 
-    // Return cached scan results and scanning status
+    // Return cached scan results and scanning status. While a scan runs
+    // these are the channels done so far; poll again for the rest.
     JsonDocument doc;
     doc["scanning"] = wifiIsScanInProgress();
+    doc["channel"]  = wifiGetScanChannel();
+    doc["channels"] = WIFI_SCAN_CHANNELS;
     JsonArray networks = doc["networks"].to<JsonArray>();
 
     for (int i = 0; i < wifiGetScanCount(); i++) {
@@ -367,6 +809,128 @@ static void handleLog() {
     server.send(200, "text/plain", logs);
 }
 
+// 16-bit BMP (BI_BITFIELDS, RGB565), stored top-down. Rows are copied
+// from the back buffer one by one, so each row is from a single render
+// pass but a pass may land between rows.
+static void handleScreenshot() {
+    addCorsHeaders();
+    if (!displayCaptureAvailable()) {
+        server.send(503, "text/plain", "No back buffer");
+        return;
+    }
+
+    const uint32_t rowBytes   = DISPLAY_WIDTH * 2;
+    const uint32_t headerSize = 14 + 40 + 12;
+    const uint32_t imageSize  = rowBytes * DISPLAY_HEIGHT;
+    const uint32_t fileSize   = headerSize + imageSize;
+
+    uint8_t hdr[headerSize];
+    memset(hdr, 0, sizeof(hdr));
+    auto put16 = [&](int off, uint16_t v) { hdr[off] = v & 0xFF; hdr[off + 1] = v >> 8; };
+    auto put32 = [&](int off, uint32_t v) { put16(off, v & 0xFFFF); put16(off + 2, v >> 16); };
+    hdr[0] = 'B';
+    hdr[1] = 'M';
+    put32(2, fileSize);
+    put32(10, headerSize);                      // Pixel data offset
+    put32(14, 40);                              // BITMAPINFOHEADER
+    put32(18, DISPLAY_WIDTH);
+    put32(22, (uint32_t)-DISPLAY_HEIGHT);       // Negative: top-down
+    put16(26, 1);                               // Planes
+    put16(28, 16);                              // Bits per pixel
+    put32(30, 3);                               // BI_BITFIELDS
+    put32(34, imageSize);
+    put32(54, 0xF800);                          // Red mask
+    put32(58, 0x07E0);                          // Green mask
+    put32(62, 0x001F);                          // Blue mask
+
+    server.setContentLength(fileSize);
+    server.sendHeader("Content-Disposition", "inline; filename=\"smalltv.bmp\"");
+    server.send(200, "image/bmp", "");
+    server.sendContent((const char*)hdr, sizeof(hdr));
+
+    static uint8_t rows[4 * DISPLAY_WIDTH * 2];
+    for (int y = 0; y < DISPLAY_HEIGHT; y += 4) {
+        for (int i = 0; i < 4; i++) {
+            uint8_t* row = rows + i * rowBytes;
+            if (!displayCaptureRow(y + i, row)) {
+                memset(row, 0, rowBytes);
+                continue;
+            }
+            // Back buffer is big-endian, BMP little-endian
+            for (uint32_t x = 0; x < rowBytes; x += 2) {
+                uint8_t hi = row[x];
+                row[x]     = row[x + 1];
+                row[x + 1] = hi;
+            }
+        }
+        server.sendContent((const char*)rows, sizeof(rows));
+    }
+}
+
+static void handleScreenStream() {
+    if (!displayCaptureAvailable()) {
+        addCorsHeaders();
+        server.send(503, "text/plain", "No back buffer");
+        return;
+    }
+    WiFiClient client = server.client();
+    screenStreamBegin(client);
+}
+
+static void handlePhotos() {
+    addCorsHeaders();
+
+    JsonDocument doc;
+    const PhotoStats& ps = photoGetStats();
+    doc["fs_total"] = ps.fsTotal;
+    doc["fs_used"]  = ps.fsUsed;
+    JsonArray files = doc["files"].to<JsonArray>();
+    for (int i = 0; i < photoCount(); i++) {
+        JsonObject f = files.add<JsonObject>();
+        f["name"] = photoName(i);
+        f["size"] = photoSize(i);
+    }
+
+    String json;
+    serializeJson(doc, json);
+    server.send(200, "application/json", json);
+}
+
+static void handlePhotoUploadDone() {
+    addCorsHeaders();
+
+    PhotoUploadResult result = photoTakeUploadResult();
+    int code;
+    switch (result) {
+        case PHOTO_UPLOAD_OK:       code = 200; break;
+        case PHOTO_UPLOAD_BAD_NAME: code = 400; break;
+        case PHOTO_UPLOAD_TOO_BIG:  code = 413; break;
+        case PHOTO_UPLOAD_NONE:     code = 400; break;  // No file part in the request
+        default:                    code = 500; break;
+    }
+
+    JsonDocument doc;
+    doc["result"] = photoUploadResultName(result);
+    doc["files"]  = photoCount();
+
+    String json;
+    serializeJson(doc, json);
+    server.send(code, "application/json", json);
+}
+
+static void handlePhotoDelete() {
+    addCorsHeaders();
+    if (!server.hasArg("name")) {
+        server.send(400, "application/json", "{\"success\":false,\"message\":\"name required\"}");
+        return;
+    }
+    if (!photoDelete(server.arg("name").c_str())) {
+        server.send(404, "application/json", "{\"success\":false,\"message\":\"No such photo\"}");
+        return;
+    }
+    server.send(200, "application/json", "{\"success\":true}");
+}
+
 static void handleCaptiveRedirect() {
     server.sendHeader("Location", "http://" + wifiGetIP());
     server.send(302, "text/plain", "");
@@ -396,12 +960,21 @@ void webServerInit() {
 
     // API endpoints
     server.on("/api/status", HTTP_GET, handleStatus);
+    server.on("/api/perf", HTTP_GET, handlePerf);
+    server.on("/metrics", HTTP_GET, handleMetrics);
     server.on("/api/set", HTTP_GET, handleSet);
     server.on("/api/weather", HTTP_GET, handleWeather);
     server.on("/api/scan", HTTP_GET, handleScan);
     server.on("/api/connect", HTTP_POST, handleConnect);
     server.on("/api/location", HTTP_GET, handleGetLocation);
     server.on("/api/location", HTTP_POST, handleSetLocation);
+    server.on("/api/screenshot", HTTP_GET, handleScreenshot);
+    server.on("/api/screen/stream", HTTP_GET, handleScreenStream);
+    server.on("/api/photos", HTTP_GET, handlePhotos);
+    server.on("/api/photos", HTTP_POST, handlePhotoUploadDone, []() {
+        photoHandleUpload(server);
+    });
+    server.on("/api/photos/delete", HTTP_POST, handlePhotoDelete);
 
     // OTA - delegate to ota module's upload handler
     server.on("/ota", HTTP_POST, []() {
@@ -442,7 +1015,7 @@ void webServerInit() {
     // Catch-all
     server.onNotFound(handleNotFound);
 
-    // Collect Content-Length header so OTA upload handler can read actual file size
+    // Collect Content-Length header so the OTA and photo upload handlers can read the size
     const char* headersToCollect[] = { "Content-Length" };
     server.collectHeaders(headersToCollect, 1);
 
@@ -452,4 +1025,9 @@ void webServerInit() {
 
 void webServerUpdate() {
     server.handleClient();
+    if (server.client()) lastClientMs = millis();   // Mid-request or kept alive
+}
+
+uint32_t webServerPollMs() {
+    return millis() - lastClientMs < SCHED_BUSY_HOLD_MS ? SCHED_POLL_MS : SCHED_IDLE_POLL_MS;
 }
@@ -19,3 +19,8 @@
 
 void webServerInit();       // Register all routes, start server
 void webServerUpdate();     // Call in main loop (handle clients)
+
+// SCHED_POLL_MS while a client is being served and for SCHED_BUSY_HOLD_MS
+// after, so a page load's burst of requests goes through quickly;
+// SCHED_IDLE_POLL_MS while the listening socket is quiet
+uint32_t webServerPollMs();
@@ -0,0 +1,166 @@
+#include "wifi_fsm.h"
+
+#include <string.h>
+
+// ============================================================
+// WiFi FSM Implementation
+// ============================================================
+
+// --- Internal helpers ---
+
+static bool reached(uint32_t nowMs, uint32_t deadlineMs) {
+    return (int32_t)(nowMs - deadlineMs) >= 0;
+}
+
+static uint8_t beginAttempt(WifiFsm& fsm, uint32_t nowMs) {
+    fsm.state      = WIFI_FSM_CONNECTING;
+    fsm.refused    = false;
+    fsm.fast       = fsm.haveFast && fsm.attempt == 1;
+    if (fsm.fast) {
+        fsm.deadlineMs = nowMs + fsm.cfg.fastTimeoutMs;
+    } else {
+        fsm.deadlineMs = nowMs + (fsm.quick ? fsm.cfg.quickTimeoutMs : fsm.cfg.connectTimeoutMs);
+    }
+    fsm.stats.attempts++;
+    return WIFI_ACT_BEGIN;
+}
+
+// The cached AP let us down: forget it and run the same attempt in full
+static uint8_t fastFailed(WifiFsm& fsm, uint32_t nowMs) {
+    fsm.stats.fastMisses++;
+    fsm.haveFast = false;
+    return WIFI_ACT_DISCONNECT | WIFI_ACT_FORGET_FAST | beginAttempt(fsm, nowMs);
+}
+
+// A new round of attempts: from boot, from AP, or after a drop
+static uint8_t beginRound(WifiFsm& fsm, uint32_t nowMs, bool quick) {
+    fsm.quick        = quick;
+    fsm.attempt      = 1;
+    fsm.backoffMs    = fsm.cfg.backoffMs;
+    fsm.roundStartMs = nowMs;
+    return beginAttempt(fsm, nowMs);
+}
+
+static uint8_t enterAP(WifiFsm& fsm, uint32_t nowMs) {
+    fsm.state      = WIFI_FSM_AP;
+    fsm.deadlineMs = nowMs + fsm.cfg.apRetryMs;
+    fsm.stats.apFallbacks++;
+    return WIFI_ACT_START_AP;
+}
+
+static uint8_t attemptFailed(WifiFsm& fsm, uint32_t nowMs) {
+    if (fsm.fast) return fastFailed(fsm, nowMs);
+
+    fsm.stats.failures++;
+    uint8_t limit = fsm.quick ? fsm.cfg.quickAttempts : fsm.cfg.attempts;
+    if (fsm.attempt >= limit) {
+        return WIFI_ACT_DISCONNECT | enterAP(fsm, nowMs);
+    }
+
+    fsm.state = WIFI_FSM_BACKOFF;
+    if (fsm.quick) {
+        fsm.deadlineMs = nowMs + fsm.cfg.quickGapMs;
+    } else {
+        fsm.deadlineMs = nowMs + fsm.backoffMs;
+        fsm.backoffMs *= 2;     // 2 s, 4 s, 8 s
+    }
+    return WIFI_ACT_DISCONNECT;
+}
+
+static uint8_t connected(WifiFsm& fsm, uint32_t nowMs) {
+    fsm.state               = WIFI_FSM_CONNECTED;
+    fsm.quick               = false;
+    fsm.attempt             = 0;
+    fsm.stats.connects++;
+    if (fsm.fast) fsm.stats.fastConnects++;
+    fsm.stats.lastConnectMs = nowMs - fsm.roundStartMs;
+    return WIFI_ACT_NONE;
+}
+
+// --- Public API ---
+
+void wifiFsmInit(WifiFsm& fsm, const WifiFsmConfig& cfg) {
+    memset(&fsm, 0, sizeof(fsm));
+    fsm.cfg   = cfg;
+    fsm.state = WIFI_FSM_IDLE;
+}
+
+uint8_t wifiFsmStart(WifiFsm& fsm, uint32_t nowMs, bool haveCreds) {
+    if (fsm.state != WIFI_FSM_IDLE) return WIFI_ACT_NONE;
+    fsm.haveCreds = haveCreds;
+    return haveCreds ? beginRound(fsm, nowMs, false) : enterAP(fsm, nowMs);
+}
+
+uint8_t wifiFsmEvent(WifiFsm& fsm, WifiFsmEvent event, uint32_t nowMs) {
+    switch (event) {
+        case WIFI_EV_GOT_IP:
+            if (fsm.state == WIFI_FSM_CONNECTING || fsm.state == WIFI_FSM_BACKOFF) {
+                return connected(fsm, nowMs);
+            }
+            return WIFI_ACT_NONE;
+
+        case WIFI_EV_LOST:
+            if (fsm.state == WIFI_FSM_CONNECTING && fsm.fast) {
+                return fastFailed(fsm, nowMs);      // Wrong channel or the AP is gone
+            }
+            if (fsm.state == WIFI_FSM_CONNECTING) {
+                // The window stays open: try again shortly, as the driver would
+                fsm.refused   = true;
+                fsm.retryAtMs = nowMs + fsm.cfg.refusedRetryMs;
+                return WIFI_ACT_NONE;
+            }
+            if (fsm.state == WIFI_FSM_CONNECTED) {
+                fsm.stats.drops++;
+                return beginRound(fsm, nowMs, true);
+            }
+            return WIFI_ACT_NONE;
+
+        case WIFI_EV_FORCE_AP:
+            if (fsm.state == WIFI_FSM_AP) return WIFI_ACT_NONE;
+            return WIFI_ACT_DISCONNECT | enterAP(fsm, nowMs);
+    }
+    return WIFI_ACT_NONE;
+}
+
+uint8_t wifiFsmPoll(WifiFsm& fsm, uint32_t nowMs) {
+    switch (fsm.state) {
+        case WIFI_FSM_CONNECTING:
+            if (reached(nowMs, fsm.deadlineMs)) return attemptFailed(fsm, nowMs);
+            if (fsm.refused && reached(nowMs, fsm.retryAtMs)) {
+                fsm.refused = false;
+                fsm.stats.attempts++;
+                return WIFI_ACT_BEGIN;
+            }
+            break;
+
+        case WIFI_FSM_BACKOFF:
+            if (reached(nowMs, fsm.deadlineMs)) {
+                fsm.attempt++;
+                return beginAttempt(fsm, nowMs);
+            }
+            break;
+
+        case WIFI_FSM_AP:
+            if (!reached(nowMs, fsm.deadlineMs)) break;
+            if (!fsm.haveCreds) {
+                fsm.deadlineMs = nowMs + fsm.cfg.apRetryMs;
+                break;
+            }
+            return WIFI_ACT_STOP_AP | beginRound(fsm, nowMs, false);
+
+        default:
+            break;
+    }
+    return WIFI_ACT_NONE;
+}
+
+const char* wifiFsmStateName(WifiFsmState state) {
+    switch (state) {
+        case WIFI_FSM_IDLE:       return "idle";
+        case WIFI_FSM_CONNECTING: return "connecting";
+        case WIFI_FSM_BACKOFF:    return "backoff";
+        case WIFI_FSM_CONNECTED:  return "connected";
+        case WIFI_FSM_AP:         return "ap";
+    }
+    return "?";
+}
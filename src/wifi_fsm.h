@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============================================================
+// WiFi FSM - connect, retry, backoff and AP fallback decisions
+// ============================================================
+//
+// The connection policy behind wifi_manager.cpp as an explicit state
+// machine, separate from the radio:
+//
+//   IDLE        -> CONNECTING with saved creds, else AP
+//   CONNECTING  -> CONNECTED on an IP. On a timeout, BACKOFF, or AP once
+//                  the round's attempts are used up. A refused attempt (no
+//                  AP found, bad auth) is re-issued within its window, as
+//                  the driver's auto-reconnect did
+//   BACKOFF     -> CONNECTING when it ends
+//   CONNECTED   -> CONNECTING when the link drops, as a quick round
+//                  (shorter timeout, fixed gap between attempts)
+//   AP          -> CONNECTING every apRetryMs while creds are saved
+//   any         -> AP when forced
+//
+// While the caller has a cached AP (haveFast), the first attempt of each
+// round is a fast one: straight to the cached BSSID and channel, with
+// fastTimeoutMs. If it is refused or times out, the cache is dropped and
+// the same attempt runs again the full way. That costs the round
+// nothing.
+//
+// Inputs are events (got IP, link lost, AP forced) and deadlines, fed in
+// with the time. Every call returns at once with the actions the caller
+// must carry out on the radio, in the order of the WifiFsmAction bits.
+// Nothing here waits, so the loop never stalls on a connect.
+//
+// Plain C++ with no Arduino dependencies: time and events are passed
+// in, so scripted event sequences can be replayed on a desktop.
+
+enum WifiFsmState : uint8_t {
+    WIFI_FSM_IDLE,              // Not started
+    WIFI_FSM_CONNECTING,        // WiFi.begin() issued, waiting for an IP
+    WIFI_FSM_BACKOFF,           // Attempt failed, waiting before the next
+    WIFI_FSM_CONNECTED,
+    WIFI_FSM_AP                 // Captive portal up, retrying saved creds now and then
+};
+
+enum WifiFsmEvent : uint8_t {
+    WIFI_EV_GOT_IP,
+    WIFI_EV_LOST,               // Link dropped, or an attempt was refused
+    WIFI_EV_FORCE_AP
+};
+
+// Actions, carried out in this order when several are set
+enum WifiFsmAction : uint8_t {
+    WIFI_ACT_NONE        = 0,
+    WIFI_ACT_DISCONNECT  = 1 << 0,  // Drop the STA link / abandon the attempt
+    WIFI_ACT_STOP_AP     = 1 << 1,
+    WIFI_ACT_FORGET_FAST = 1 << 2,  // The cached AP did not work, drop it
+    WIFI_ACT_BEGIN       = 1 << 3,  // STA mode, WiFi.begin() with the saved creds (cached AP if fast)
+    WIFI_ACT_START_AP    = 1 << 4   // Scan, then AP and captive portal
+};
+
+struct WifiFsmConfig {
+    uint32_t connectTimeoutMs;  // One attempt from boot or AP
+    uint32_t fastTimeoutMs;     // One attempt at the cached AP
+    uint32_t refusedRetryMs;    // Re-issue a refused attempt after this
+    uint8_t  attempts;          // Attempts per round before AP
+    uint32_t backoffMs;         // After the first failure, doubling
+    uint32_t quickTimeoutMs;    // One attempt after losing a working link
+    uint8_t  quickAttempts;     // Before giving up on the link and going AP
+    uint32_t quickGapMs;        // Between quick attempts
+    uint32_t apRetryMs;         // Saved creds retried this often from AP
+};
+
+struct WifiFsmStats {
+    uint32_t attempts;          // WiFi.begin() calls, re-issues included
+    uint32_t failures;          // Attempt windows that ran out
+    uint32_t connects;
+    uint32_t drops;             // Working links lost
+    uint32_t apFallbacks;
+    uint32_t fastConnects;      // Connected on a fast attempt
+    uint32_t fastMisses;        // Fast attempts that fell back to the full path
+    uint32_t lastConnectMs;     // First attempt of the round to IP
+};
+
+struct WifiFsm {
+    WifiFsmConfig cfg;
+    WifiFsmState  state;
+    bool          haveCreds;
+    bool          haveFast;     // Caller has a cached AP (set by the caller)
+    bool          fast;         // This attempt is a fast one; still set once connected
+    bool          quick;        // This round follows a drop
+    uint8_t       attempt;      // 1-based within the round
+    bool          refused;      // Attempt refused, re-issue at retryAtMs
+    uint32_t      retryAtMs;
+    uint32_t      backoffMs;    // Next backoff
+    uint32_t      deadlineMs;   // Attempt timeout, backoff end or AP retry
+    uint32_t      roundStartMs;
+    WifiFsmStats  stats;
+};
+
+void    wifiFsmInit(WifiFsm& fsm, const WifiFsmConfig& cfg);
+
+// Leave IDLE: connect with saved creds, or go straight to AP without
+uint8_t wifiFsmStart(WifiFsm& fsm, uint32_t nowMs, bool haveCreds);
+uint8_t wifiFsmEvent(WifiFsm& fsm, WifiFsmEvent event, uint32_t nowMs);
+uint8_t wifiFsmPoll(WifiFsm& fsm, uint32_t nowMs);     // Deadlines; cheap, call often
+
+const char* wifiFsmStateName(WifiFsmState state);
@@ -1,38 +1,78 @@
 #include "wifi_manager.h"
+#include "wifi_fsm.h"
+#include "spsc_ring.h"
 #include "touch.h"
 #include "logger.h"
 #include <WiFi.h>
 #include <DNSServer.h>
 #include <Preferences.h>
+#include <stddef.h>
+#include <time.h>
 
 // --- NVS keys ---
 static const char* WIFI_NVS_NAMESPACE = "wifi";
 static const char* KEY_SSID           = "ssid";
 static const char* KEY_PASSWORD       = "password";
+static const char* KEY_FAST           = "fast";
 
 // --- Module state ---
 static bool        apMode         = false;
 static String      apSSID;
 static String      deviceId;
-static unsigned long lastMonitorCheck   = 0;
-static unsigned long lastReconnectTry   = 0;
-static int         quickReconnectCount  = 0;
+static String      savedSsid;
+static String      savedPassword;
+static WifiFsm     fsm;
 static DNSServer   dnsServer;
 static bool        dnsRunning     = false;
 
+// WiFi event task -> loop task; the state machine only runs in wifiUpdate()
+static SpscRing<WifiFsmEvent, 8> eventRing;
+
+// --- Fast reconnect cache ---
+// The AP and lease of the last DHCP connect, kept in RTC memory (survives
+// resets, not power loss) and in NVS (survives both; written only when
+// the AP or addresses change). The cached BSSID and channel are always
+// tried first. The IP is reused only while the lease is known to be less
+// than WIFI_FAST_LEASE_S old. That takes a set clock, which after a reset
+// usually survives and after a power cut does not.
+
+static const uint32_t FAST_CACHE_MAGIC = 0x57464331;    // "WFC1"
+
+struct WifiFastCache {
+    uint32_t magic;
+    uint32_t ssidHash;          // Cache belongs to these saved creds
+    uint8_t  bssid[6];
+    uint8_t  channel;
+    uint8_t  reserved;
+    uint32_t ip, gateway, subnet, dns1, dns2;
+    uint32_t leaseEpoch;        // Unix time DHCP granted the IP, 0 = unknown
+    uint32_t check;             // FNV-1a over everything above
+};
+
+RTC_DATA_ATTR static WifiFastCache rtcCache;
+static WifiFastCache    fastCache;              // In use; magic 0 = none
+static WifiFastCache    nvsCache;               // As last read from or written to NVS
+static bool             staticIp = false;       // Running on a cached lease
+static bool             leaseEpochPending = false;
+static uint32_t         leaseMs = 0;            // millis() of that lease
+static WifiConnectStats connectStats;
+
 // --- Cached scan results ---
 static const int   MAX_SCAN_RESULTS = 20;
-static WifiNetwork scanResults[MAX_SCAN_RESULTS];
+static WifiNetwork scanResults[MAX_SCAN_RESULTS];     // Strongest first, one per SSID
 static int         scanCount = 0;
 static bool        _scanRequested = false;
-static bool        _scanInProgress = false;
+static uint8_t     _scanChannel = 0;        // Channel in flight or next, 0 = no scan
+static bool        _scanBusy = false;       // A channel's scan is in flight
+static uint32_t    _scanStepMs = 0;         // millis() it started, or when the next may
+static bool        _apAfterScan = false;    // START_AP waits for the scan
+static bool        _beginAfterScan = false; // BEGIN waits for the channel in flight
 
 // --- Forward declarations ---
-static bool     tryConnect(const String& ssid, const String& password);
 static void     saveCreds(const String& ssid, const String& password);
 static bool     loadCreds(String& ssid, String& password);
 static void     buildDeviceId();
-static void     scanAndCache();
+static void     scanBegin();
 static void     startAPMode();
 static void     stopAP();
 
@@ -66,46 +106,191 @@ static void saveCreds(const String& ssid, const String& password) {
     logPrintf("WiFi credentials saved for '%s'", ssid.c_str());
 }
 
-static bool tryConnect(const String& ssid, const String& password) {
-    logPrintf("WiFi: connecting to '%s'", ssid.c_str());
+// --- Fast reconnect cache ---
 
-    WiFi.mode(WIFI_STA);
-    WiFi.setAutoReconnect(true);
+static uint32_t fnv1a(const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
 
-    unsigned long backoff = WIFI_RETRY_DELAY_MS;
+static uint32_t cacheCheck(const WifiFastCache& c) {
+    return fnv1a(&c, offsetof(WifiFastCache, check));
+}
 
-    for (int attempt = 1; attempt <= WIFI_RETRY_ATTEMPTS; attempt++) {
-        logPrintf("WiFi: attempt %d/%d", attempt, WIFI_RETRY_ATTEMPTS);
+static bool cacheValid(const WifiFastCache& c) {
+    return c.magic == FAST_CACHE_MAGIC && c.check == cacheCheck(c) &&
+           c.ssidHash == fnv1a(savedSsid.c_str(), savedSsid.length());
+}
 
-        WiFi.begin(ssid.c_str(), password.c_str());
+// Same AP and addresses; the lease time alone is not worth an NVS write
+static bool sameLink(const WifiFastCache& a, const WifiFastCache& b) {
+    return a.magic == b.magic &&
+           memcmp(&a.ssidHash, &b.ssidHash,
+                  offsetof(WifiFastCache, leaseEpoch) - offsetof(WifiFastCache, ssidHash)) == 0;
+}
 
-        unsigned long start = millis();
-        while (WiFi.status() != WL_CONNECTED &&
-               (millis() - start) < (unsigned long)WIFI_CONNECT_TIMEOUT_MS) {
-            delay(250);
-        }
+// Unix time, or 0 while the clock is not set
+static uint32_t epochNow() {
+    time_t now = time(nullptr);
+    return now >= 1451606400 ? (uint32_t)now : 0;      // 2016-01-01
+}
 
-        if (WiFi.status() == WL_CONNECTED) {
-            logPrintf("WiFi: connected to '%s' - IP: %s",
-                      ssid.c_str(), WiFi.localIP().toString().c_str());
-            return true;
-        }
+static bool leaseUsable() {
+    uint32_t now = epochNow();
+    return fastCache.leaseEpoch && now && now - fastCache.leaseEpoch < WIFI_FAST_LEASE_S;
+}
 
-        logPrintf("WiFi: attempt %d failed (status=%d)", attempt, WiFi.status());
-        WiFi.disconnect(true);
+static void loadFastCache() {
+    memset(&nvsCache, 0, sizeof(nvsCache));
+    Preferences p;
+    p.begin(WIFI_NVS_NAMESPACE, true);
+    if (p.isKey(KEY_FAST) && p.getBytes(KEY_FAST, &nvsCache, sizeof(nvsCache)) != sizeof(nvsCache)) {
+        memset(&nvsCache, 0, sizeof(nvsCache));
+    }
+    p.end();
 
-        if (attempt < WIFI_RETRY_ATTEMPTS) {
-            logPrintf("WiFi: backoff %lums before next attempt", backoff);
-            delay(backoff);
-            backoff *= 2;  // Exponential backoff: 2s, 4s, 8s
-        }
+    if (cacheValid(rtcCache)) {
+        fastCache = rtcCache;
+    } else if (cacheValid(nvsCache)) {
+        fastCache = nvsCache;
+    } else {
+        memset(&fastCache, 0, sizeof(fastCache));
+    }
+    fsm.haveFast = fastCache.magic != 0;
+    if (fsm.haveFast) {
+        logPrintf("WiFi: cached AP %02X:%02X:%02X:%02X:%02X:%02X on channel %u, lease %s",
+                  fastCache.bssid[0], fastCache.bssid[1], fastCache.bssid[2],
+                  fastCache.bssid[3], fastCache.bssid[4], fastCache.bssid[5],
+                  fastCache.channel, leaseUsable() ? "reusable" : "not reusable");
+    }
+}
+
+// Remember the AP and lease of the link that just came up
+static void storeFastCache() {
+    const uint8_t* bssid = WiFi.BSSID();
+    if (!bssid) return;
+
+    WifiFastCache c;
+    memset(&c, 0, sizeof(c));
+    c.magic    = FAST_CACHE_MAGIC;
+    c.ssidHash = fnv1a(savedSsid.c_str(), savedSsid.length());
+    memcpy(c.bssid, bssid, sizeof(c.bssid));
+    c.channel  = (uint8_t)WiFi.channel();
+    c.ip       = WiFi.localIP();
+    c.gateway  = WiFi.gatewayIP();
+    c.subnet   = WiFi.subnetMask();
+    c.dns1     = WiFi.dnsIP(0);
+    c.dns2     = WiFi.dnsIP(1);
+    if (staticIp) {
+        c.leaseEpoch = fastCache.leaseEpoch;    // Reusing a lease does not renew it
+    } else {
+        c.leaseEpoch      = epochNow();
+        leaseEpochPending = c.leaseEpoch == 0;
+        leaseMs           = millis();
+    }
+    c.check = cacheCheck(c);
+
+    fastCache    = c;
+    rtcCache     = c;
+    fsm.haveFast = true;
+
+    if (!sameLink(c, nvsCache)) {
+        Preferences p;
+        p.begin(WIFI_NVS_NAMESPACE, false);
+        p.putBytes(KEY_FAST, &c, sizeof(c));
+        p.end();
+        nvsCache = c;
+        connectStats.cacheWrites++;
+    }
+}
+
+static void forgetFastCache() {
+    memset(&fastCache, 0, sizeof(fastCache));
+    memset(&rtcCache, 0, sizeof(rtcCache));
+    fsm.haveFast = false;
+    if (nvsCache.magic) {
+        Preferences p;
+        p.begin(WIFI_NVS_NAMESPACE, false);
+        p.remove(KEY_FAST);
+        p.end();
+        memset(&nvsCache, 0, sizeof(nvsCache));
+    }
+}
+
+// Fast attempts go straight to the cached BSSID and channel (no scan),
+// and on a young lease skip DHCP as well
+static void beginConnect() {
+    WiFi.mode(WIFI_STA);
+
+    bool useLease = fsm.fast && leaseUsable();
+    if (useLease) {
+        WiFi.config(IPAddress(fastCache.ip), IPAddress(fastCache.gateway), IPAddress(fastCache.subnet),
+                    IPAddress(fastCache.dns1), IPAddress(fastCache.dns2));
+    } else if (staticIp) {
+        WiFi.config(IPAddress(), IPAddress(), IPAddress());    // Back to DHCP
     }
+    staticIp = useLease;
 
-    logPrintf("WiFi: all %d attempts failed for '%s'", WIFI_RETRY_ATTEMPTS, ssid.c_str());
-    return false;
+    if (fsm.fast) {
+        WiFi.begin(savedSsid.c_str(), savedPassword.c_str(), fastCache.channel, fastCache.bssid);
+    } else {
+        WiFi.begin(savedSsid.c_str(), savedPassword.c_str());
+    }
+}
+
+static void noteConnected() {
+    WifiConnectPath path = !fsm.fast ? WIFI_PATH_FULL
+                         : staticIp  ? WIFI_PATH_CACHED_LEASE
+                                     : WIFI_PATH_CACHED_AP;
+    connectStats.lastPath = path;
+    if (connectStats.bootPath == WIFI_PATH_NONE) {
+        connectStats.bootPath   = path;
+        connectStats.bootToIpMs = millis();
+    }
+    storeFastCache();
+}
+
+// --- Background scan ---
+// One channel per scanNetworks(async) call, polled from wifiUpdate(). The
+// radio is back on the home channel between calls, so a live link or the
+// AP keeps passing traffic, and results show up channel by channel.
+
+// Keep the strongest AP of each SSID, sorted by RSSI; a full list pushes
+// out its weakest
+static void mergeScanResult(const String& ssid, int rssi, bool encrypted) {
+    if (ssid.length() == 0) return;
+
+    int i = 0;
+    while (i < scanCount && scanResults[i].ssid != ssid) i++;
+    if (i < scanCount) {
+        if (rssi <= scanResults[i].rssi) return;
+    } else if (scanCount < MAX_SCAN_RESULTS) {
+        i = scanCount++;
+    } else if (rssi > scanResults[scanCount - 1].rssi) {
+        i = scanCount - 1;
+    } else {
+        return;
+    }
+
+    // RSSI only went up, so the entry only moves towards the front
+    while (i > 0 && scanResults[i - 1].rssi < rssi) {
+        scanResults[i] = scanResults[i - 1];
+        i--;
+    }
+    scanResults[i] = {ssid, rssi, encrypted};
 }
 
-static void scanAndCache() {
+static void scanStartChannel(uint32_t nowMs) {
+    WiFi.scanNetworks(true, false, false, WIFI_SCAN_DWELL_MS, _scanChannel);
+    _scanBusy   = true;
+    _scanStepMs = nowMs;
+}
+
+static void scanBegin() {
     logPrintf("WiFi: scanning networks...");
 
     // Pause touch during WiFi scan - they share the ADC hardware
@@ -116,27 +301,63 @@ static void scanAndCache() {
         WiFi.mode(WIFI_STA);
     }
 
-    int found = WiFi.scanNetworks(false, false);  // Synchronous, no hidden
-    scanCount = 0;
+    scanCount    = 0;
+    _scanChannel = 1;
+    scanStartChannel(millis());
+}
 
-    if (found <= 0) {
-        logPrintf("WiFi: scan found no networks (result=%d)", found);
-        return;
+static void scanFinish() {
+    logPrintf("WiFi: scan found %d networks", scanCount);
+    _scanChannel = 0;
+
+    // Resume touch now that WiFi scan is done
+    touchResumeAfterWiFi();
+
+    if (_apAfterScan) {
+        _apAfterScan = false;
+        startAPMode();
     }
+}
 
-    scanCount = min(found, MAX_SCAN_RESULTS);
-    logPrintf("WiFi: scan found %d networks (caching %d)", found, scanCount);
+static void scanPoll() {
+    if (_scanChannel == 0) {
+        // Requested scans wait while a connect attempt is on the radio
+        if (_scanRequested && fsm.state != WIFI_FSM_CONNECTING) {
+            _scanRequested = false;
+            scanBegin();
+        }
+        return;
+    }
 
-    for (int i = 0; i < scanCount; i++) {
-        scanResults[i].ssid      = WiFi.SSID(i);
-        scanResults[i].rssi      = WiFi.RSSI(i);
-        scanResults[i].encrypted = (WiFi.encryptionType(i) != WIFI_AUTH_OPEN);
+    uint32_t now = millis();
+    if (!_scanBusy) {
+        if ((int32_t)(now - _scanStepMs) >= 0) scanStartChannel(now);
+        return;
     }
 
-    WiFi.scanDelete();  // Free scan memory
+    int16_t found = WiFi.scanComplete();
+    if (found == WIFI_SCAN_RUNNING && now - _scanStepMs < WIFI_SCAN_CHANNEL_TIMEOUT_MS) return;
 
-    // Resume touch now that WiFi scan is done
-    touchResumeAfterWiFi();
+    for (int i = 0; i < found; i++) {
+        mergeScanResult(WiFi.SSID(i), WiFi.RSSI(i), WiFi.encryptionType(i) != WIFI_AUTH_OPEN);
+    }
+    if (found < 0) {
+        logPrintf("WiFi: scan of channel %u failed (result=%d)", _scanChannel, found);
+    }
+    WiFi.scanDelete();  // Free scan memory
+    _scanBusy = false;
+
+    if (_beginAfterScan) {
+        // The connect attempt has the radio now; the rest of the scan is dropped
+        _beginAfterScan = false;
+        scanFinish();
+        beginConnect();
+    } else if (_scanChannel >= WIFI_SCAN_CHANNELS) {
+        scanFinish();
+    } else {
+        _scanChannel++;
+        _scanStepMs = now + WIFI_SCAN_GAP_MS;
+    }
 }
 
 static void startAPMode() {
@@ -147,20 +368,16 @@ static void startAPMode() {
     WiFi.mode(WIFI_AP);
     WiFi.softAP(apSSID.c_str());
 
-    // Small delay for AP to stabilize
-    delay(100);
-
     // Start DNS server for captive portal (redirect all domains to us)
     dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
     dnsRunning = true;
 
     logPrintf("WiFi: AP mode started - SSID: %s, IP: %s",
               apSSID.c_str(), WiFi.softAPIP().toString().c_str());
-
-    lastReconnectTry = millis();
 }
 
 static void stopAP() {
+    _apAfterScan = false;
     if (dnsRunning) {
         dnsServer.stop();
         dnsRunning = false;
@@ -170,6 +387,92 @@ static void stopAP() {
     logPrintf("WiFi: AP mode stopped");
 }
 
+// --- State machine glue ---
+
+static void onWifiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        eventRing.push(WIFI_EV_GOT_IP);
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED &&
+               info.wifi_sta_disconnected.reason != WIFI_REASON_ASSOC_LEAVE) {
+        // ASSOC_LEAVE is our own WiFi.disconnect(); the FSM already knows
+        eventRing.push(WIFI_EV_LOST);
+    }
+}
+
+static void logTransition(WifiFsmState from, uint32_t nowMs) {
+    switch (fsm.state) {
+        case WIFI_FSM_CONNECTING:
+            if (from == WIFI_FSM_CONNECTED) {
+                logPrintf("WiFi: connection lost, reconnecting");
+            } else if (fsm.fast) {
+                logPrintf("WiFi: connecting to '%s' via cached AP", savedSsid.c_str());
+            } else {
+                logPrintf("WiFi: connecting to '%s' (attempt %d/%d)", savedSsid.c_str(), fsm.attempt,
+                          fsm.quick ? WIFI_QUICK_ATTEMPTS : WIFI_RETRY_ATTEMPTS);
+            }
+            break;
+        case WIFI_FSM_BACKOFF:
+            logPrintf("WiFi: attempt %d failed (status=%d), next in %lu ms",
+                      fsm.attempt, WiFi.status(), (unsigned long)(fsm.deadlineMs - nowMs));
+            break;
+        case WIFI_FSM_CONNECTED:
+            logPrintf("WiFi: connected to '%s' - IP: %s (%lu ms, %s)", savedSsid.c_str(),
+                      WiFi.localIP().toString().c_str(), (unsigned long)fsm.stats.lastConnectMs,
+                      wifiConnectPathName(connectStats.lastPath));
+            break;
+        case WIFI_FSM_AP:
+            if (from == WIFI_FSM_CONNECTING) {
+                logPrintf("WiFi: all attempts failed for '%s', falling back to AP", savedSsid.c_str());
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// Carry out what the state machine asked for, in bit order. Re-issuing a
+// refused attempt keeps the state and is not logged.
+static void apply(WifiFsmState from, uint8_t actions) {
+    if (fsm.state != from) {
+        if (fsm.state == WIFI_FSM_CONNECTED) noteConnected();
+        logTransition(from, millis());
+    }
+
+    if (actions & WIFI_ACT_DISCONNECT) {
+        WiFi.disconnect(true);
+    }
+    if (actions & WIFI_ACT_STOP_AP) {
+        stopAP();
+    }
+    if (actions & WIFI_ACT_FORGET_FAST) {
+        logPrintf("WiFi: cached AP did not answer, connecting the full way");
+        forgetFastCache();
+    }
+    if (actions & WIFI_ACT_BEGIN) {
+        if (_scanBusy) {
+            _beginAfterScan = true;     // Once the channel in flight is done
+        } else {
+            if (_scanChannel) scanFinish();
+            beginConnect();
+        }
+    }
+    if (actions & WIFI_ACT_START_AP) {
+        // Scan before the AP is up (see the header); a scan already
+        // running will do
+        _beginAfterScan = false;
+        _apAfterScan    = true;
+        if (_scanChannel == 0) scanBegin();
+    }
+}
+
+static void feed(WifiFsmEvent event) {
+    WifiFsmState from = fsm.state;
+    apply(from, wifiFsmEvent(fsm, event, millis()));
+
+    // A new lease on a live link: DHCP took over from a cached one
+    if (event == WIFI_EV_GOT_IP && from == WIFI_FSM_CONNECTED) storeFastCache();
+}
+
 // ============================================================
 // Public API
 // ============================================================
@@ -181,105 +484,81 @@ void wifiInit() {
     logPrintf("WiFi: device ID = %s, MAC = %s",
               deviceId.c_str(), WiFi.macAddress().c_str());
 
-    // Tier 1: Try saved credentials
-    String ssid, password;
-    if (loadCreds(ssid, password)) {
-        logPrintf("WiFi: found saved credentials for '%s'", ssid.c_str());
-        if (tryConnect(ssid, password)) {
-            lastMonitorCheck = millis();
-            return;
-        }
+    WifiFsmConfig cfg;
+    cfg.connectTimeoutMs = WIFI_CONNECT_TIMEOUT_MS;
+    cfg.fastTimeoutMs    = WIFI_FAST_TIMEOUT_MS;
+    cfg.refusedRetryMs   = WIFI_REFUSED_RETRY_MS;
+    cfg.attempts         = WIFI_RETRY_ATTEMPTS;
+    cfg.backoffMs        = WIFI_RETRY_DELAY_MS;
+    cfg.quickTimeoutMs   = WIFI_QUICK_TIMEOUT_MS;
+    cfg.quickAttempts    = WIFI_QUICK_ATTEMPTS;
+    cfg.quickGapMs       = WIFI_MONITOR_INTERVAL;
+    cfg.apRetryMs        = WIFI_RECONNECT_INTERVAL;
+    wifiFsmInit(fsm, cfg);
+
+    // Retries are the state machine's, not the driver's
+    WiFi.setAutoReconnect(false);
+    WiFi.onEvent(onWifiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onWifiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+
+    // Tier 1: saved credentials, connected in the background from wifiUpdate()
+    // Tier 2: no credentials, so scan first, then start AP
+    bool haveCreds = loadCreds(savedSsid, savedPassword);
+    if (haveCreds) {
+        logPrintf("WiFi: found saved credentials for '%s'", savedSsid.c_str());
+        loadFastCache();
     } else {
         logPrintf("WiFi: no saved credentials found");
     }
-
-    // Tier 2: Scan networks first, then start AP
-    scanAndCache();
-    startAPMode();
+    apply(WIFI_FSM_IDLE, wifiFsmStart(fsm, millis(), haveCreds));
 }
 
 void wifiUpdate() {
+    // Connection state machine: events from the WiFi task, then deadlines
+    WifiFsmEvent event;
+    while (eventRing.pop(event)) {
+        feed(event);
+    }
+    WifiFsmState from = fsm.state;
+    apply(from, wifiFsmPoll(fsm, millis()));
+
     // Process DNS requests when in AP mode
     if (dnsRunning) {
         dnsServer.processNextRequest();
     }
 
-    // Handle deferred scan request (triggered by web UI, executed here safely)
-    if (_scanRequested && !_scanInProgress) {
-        _scanRequested = false;
-        _scanInProgress = true;
-        scanAndCache();
-        _scanInProgress = false;
-    }
+    // Background scan: deferred requests from the web UI, then one channel at a time
+    scanPoll();
+}
 
-    unsigned long now = millis();
+// Connect deadlines are seconds apart and events trigger the job (see
+// main.cpp), so only the captive portal's DNS socket and a running scan
+// need the fast poll
+uint32_t wifiPollMs() {
+    return (dnsRunning || _scanChannel != 0) ? SCHED_POLL_MS : SCHED_IDLE_POLL_MS;
+}
 
-    if (apMode) {
-        // In AP mode: periodically try to reconnect using saved creds
-        if ((now - lastReconnectTry) >= WIFI_RECONNECT_INTERVAL) {
-            lastReconnectTry = now;
-
-            String ssid, password;
-            if (loadCreds(ssid, password)) {
-                logPrintf("WiFi: periodic reconnect attempt to '%s'", ssid.c_str());
-
-                // Briefly stop AP, try STA, restart AP if it fails
-                stopAP();
-
-                if (tryConnect(ssid, password)) {
-                    logPrintf("WiFi: reconnected to saved network");
-                    lastMonitorCheck = now;
-                    quickReconnectCount = 0;
-                    return;
-                }
-
-                // Failed; scan again and restart AP
-                scanAndCache();
-                startAPMode();
-            }
-        }
-        return;
+void wifiMonitor() {
+    // Drops arrive as events; this catches one whose event never came
+    if (fsm.state == WIFI_FSM_CONNECTED && WiFi.status() != WL_CONNECTED) {
+        logPrintf("WiFi: link down with no disconnect event (status=%d)", WiFi.status());
+        feed(WIFI_EV_LOST);
     }
 
-    // In STA mode: monitor connection health
-    if ((now - lastMonitorCheck) >= WIFI_MONITOR_INTERVAL) {
-        lastMonitorCheck = now;
-
-        if (WiFi.status() != WL_CONNECTED) {
-            logPrintf("WiFi: connection lost, attempting quick reconnect");
-
-            quickReconnectCount++;
-
-            if (quickReconnectCount <= 3) {
-                // Quick reconnect: just try again with saved creds
-                String ssid, password;
-                if (loadCreds(ssid, password)) {
-                    WiFi.disconnect(true);
-                    WiFi.begin(ssid.c_str(), password.c_str());
-
-                    unsigned long start = millis();
-                    while (WiFi.status() != WL_CONNECTED &&
-                           (millis() - start) < 10000) {
-                        delay(250);
-                    }
+    // A lease taken before the clock was set gets its time once it is
+    uint32_t now = epochNow();
+    if (leaseEpochPending && now) {
+        fastCache.leaseEpoch = now - (millis() - leaseMs) / 1000;
+        fastCache.check      = cacheCheck(fastCache);
+        rtcCache             = fastCache;
+        leaseEpochPending    = false;
+    }
 
-                    if (WiFi.status() == WL_CONNECTED) {
-                        logPrintf("WiFi: quick reconnect #%d succeeded", quickReconnectCount);
-                        quickReconnectCount = 0;
-                        return;
-                    }
-                }
-                logPrintf("WiFi: quick reconnect #%d failed", quickReconnectCount);
-            } else {
-                // All quick reconnects failed; fall back to AP mode
-                logPrintf("WiFi: quick reconnects exhausted, falling back to AP");
-                quickReconnectCount = 0;
-                scanAndCache();
-                startAPMode();
-            }
-        } else {
-            quickReconnectCount = 0;  // Reset counter on healthy check
-        }
+    // A reused lease goes back to DHCP before the router could hand it out
+    if (staticIp && !leaseUsable()) {
+        logPrintf("WiFi: cached lease expired, renewing by DHCP");
+        WiFi.config(IPAddress(), IPAddress(), IPAddress());
+        staticIp = false;
     }
 }
 
@@ -322,15 +601,33 @@ int wifiGetRSSI() {
 
 void wifiStartAP() {
     logPrintf("WiFi: forced AP mode requested");
-    if (!apMode) {
-        WiFi.disconnect(true);
-        scanAndCache();
-        startAPMode();
-    }
+    feed(WIFI_EV_FORCE_AP);
 }
 
 void wifiSaveCredentials(const String& ssid, const String& password) {
     saveCreds(ssid, password);
+    savedSsid      = ssid;
+    savedPassword  = password;
+    fsm.haveCreds  = true;
+    forgetFastCache();
+}
+
+const WifiFsm& wifiGetState() {
+    return fsm;
+}
+
+const WifiConnectStats& wifiGetConnectStats() {
+    return connectStats;
+}
+
+const char* wifiConnectPathName(WifiConnectPath path) {
+    switch (path) {
+        case WIFI_PATH_NONE:         return "none";
+        case WIFI_PATH_FULL:         return "full";
+        case WIFI_PATH_CACHED_AP:    return "cached-ap";
+        case WIFI_PATH_CACHED_LEASE: return "cached-lease";
+    }
+    return "?";
 }
 
 void wifiFactoryReset() {
@@ -357,9 +654,13 @@ WifiNetwork wifiGetScanResult(int index) {
 }
 
 void wifiScanNetworks() {
-    _scanRequested = true;
+    if (_scanChannel == 0) _scanRequested = true;     // A running scan is fresh enough
 }
 
 bool wifiIsScanInProgress() {
-    return _scanInProgress || _scanRequested;
+    return _scanChannel != 0 || _scanRequested;
+}
+
+uint8_t wifiGetScanChannel() {
+    return _scanChannel;
 }
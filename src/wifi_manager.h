@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "wifi_fsm.h"
 
 // ============================================================
 // WiFi Manager - Three-tier connection management
@@ -9,14 +10,25 @@
 //
 // Tier 1: Try saved credentials from NVS
 // Tier 2: Fall back to AP mode with captive portal
-// Runtime: Monitor connection health, auto-reconnect
+// Runtime: Reconnect on drops, retry saved creds from AP
+//
+// Connecting never blocks: the retry, backoff and fallback policy is a
+// state machine (wifi_fsm.h) fed by WiFi events and stepped from
+// wifiUpdate(), so wifiInit() returns before the link is up. Watch
+// wifiIsConnected() or the GOT_IP event for when it is.
 //
 // Uses scan-then-serve pattern: WiFi networks are scanned
 // BEFORE starting AP mode to avoid the crash bug where
 // WiFi.scanNetworks() conflicts with active web server handlers.
+//
+// Scans never block either: wifiUpdate() scans one channel at a time in
+// the background and merges each channel's networks into the results,
+// so /api/scan can show them while the scan runs.
 
-void    wifiInit();             // Start WiFi (try saved creds, then AP)
-void    wifiUpdate();           // Call in main loop (monitors connection, retries)
+void    wifiInit();             // Start connecting with saved creds, or AP without
+void    wifiUpdate();           // Connection state machine, captive portal DNS, deferred scans
+uint32_t wifiPollMs();          // Call wifiUpdate() again this much later (10 ms while DNS or a scan runs)
+void    wifiMonitor();          // Every WIFI_MONITOR_INTERVAL: catch a drop that sent no event
 bool    wifiIsConnected();      // STA connected?
 bool    wifiIsAPMode();         // Running as AP?
 String  wifiGetIP();            // Current IP (STA or AP)
@@ -27,6 +39,28 @@ int     wifiGetRSSI();
 void    wifiStartAP();          // Force AP mode
 void    wifiSaveCredentials(const String& ssid, const String& password);
 void    wifiFactoryReset();     // Clear WiFi creds + reboot
+const WifiFsm& wifiGetState();  // Connection state and counters
+
+// --- Connect paths ---
+// The last good AP (BSSID, channel) and DHCP lease are cached in RTC
+// memory and NVS, and each round of attempts starts with them.
+
+enum WifiConnectPath : uint8_t {
+    WIFI_PATH_NONE,
+    WIFI_PATH_FULL,             // Scan for the SSID, then DHCP
+    WIFI_PATH_CACHED_AP,        // Cached BSSID and channel, then DHCP
+    WIFI_PATH_CACHED_LEASE      // Cached BSSID, channel and IP: no scan, no DHCP
+};
+
+struct WifiConnectStats {
+    WifiConnectPath bootPath;   // First connect since boot
+    uint32_t        bootToIpMs; // millis() when it got its IP
+    WifiConnectPath lastPath;
+    uint32_t        cacheWrites;    // NVS writes of the cache
+};
+
+const WifiConnectStats& wifiGetConnectStats();
+const char*             wifiConnectPathName(WifiConnectPath path);
 
 // --- Scan results (used by web server) ---
 
@@ -36,7 +70,8 @@ struct WifiNetwork {
     bool   encrypted;
 };
 
-int              wifiGetScanCount();
-WifiNetwork      wifiGetScanResult(int index);
+int              wifiGetScanCount();        // Grows while a scan runs
+WifiNetwork      wifiGetScanResult(int index);  // Strongest first, one per SSID
 void             wifiScanNetworks();    // Request a deferred scan (safe to call from HTTP handler)
 bool             wifiIsScanInProgress();
+uint8_t          wifiGetScanChannel();      // 1..WIFI_SCAN_CHANNELS while scanning, else 0
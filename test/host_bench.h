@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <unity.h>
+
+// ============================================================
+// Host Bench - timing helpers for the native tests
+// ============================================================
+//
+// Benchmarks run as ordinary Unity tests in the native env and report
+// through TEST_MESSAGE, so `pio test -e native -v` prints them. Host
+// timings only rank approaches against each other; device numbers are
+// in /api/perf.
+
+// Results are added here so the optimizer cannot drop the timed work
+inline volatile uint32_t benchSink = 0;
+
+// Average nanoseconds per call of fn() over iterations calls
+template <typename Fn>
+inline double benchNsPerIter(uint32_t iterations, Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        fn(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+#define BENCH_REPORT(...) do {                          \
+    char benchMsg_[200];                                \
+    snprintf(benchMsg_, sizeof(benchMsg_), __VA_ARGS__); \
+    TEST_MESSAGE(benchMsg_);                            \
+} while (0)
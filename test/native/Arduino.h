@@ -0,0 +1,38 @@
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+// ============================================================
+// Host Arduino - just enough of the Arduino core for display.cpp
+// ============================================================
+// Used by the native_display env only. Time is virtual: it moves when
+// the test calls hostAdvanceMs() and when the code under test calls
+// delay() or vTaskDelay(), never on its own, so every pass renders the
+// same bytes on every machine.
+
+#define PROGMEM
+#define DEG_TO_RAD  0.017453292519943295769236907684886
+
+inline uint64_t hostNowUs = 0;
+
+inline unsigned long micros() { return (unsigned long)(uint32_t)hostNowUs; }
+inline unsigned long millis() { return (unsigned long)(uint32_t)(hostNowUs / 1000); }
+inline void delay(uint32_t ms) { hostNowUs += (uint64_t)ms * 1000; }
+inline void hostAdvanceMs(uint32_t ms) { hostNowUs += (uint64_t)ms * 1000; }
+
+// Only declared in the headers display.cpp includes (logGetAll)
+class String {
+public:
+    String(const char* s = "") : _s(s ? s : "") {}
+    const char* c_str() const { return _s.c_str(); }
+    size_t length() const { return _s.size(); }
+
+private:
+    std::string _s;
+};
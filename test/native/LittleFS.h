@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+
+// ============================================================
+// Host LittleFS - a filesystem that never mounts
+// ============================================================
+// Renders on the host use the built-in fonts and layouts, the same as a
+// device with an empty filesystem: begin() always fails. Tests can still
+// put files in memory with hostFsAdd() for code that opens them without
+// mounting first, such as the GIF page listing PHOTO_DIR. Anything else
+// opens as a closed file.
+
+struct HostFsFile {
+    const char*    path;
+    const uint8_t* data;
+    size_t         len;
+};
+
+inline HostFsFile hostFsFiles[8];
+inline int        hostFsCount = 0;
+
+inline void hostFsAdd(const char* path, const uint8_t* data, size_t len) {
+    if (hostFsCount < (int)(sizeof(hostFsFiles) / sizeof(hostFsFiles[0]))) {
+        hostFsFiles[hostFsCount++] = { path, data, len };
+    }
+}
+
+// True if path is a file directly inside dir
+inline bool hostFsInDir(const char* path, const char* dir) {
+    size_t n = strlen(dir);
+    return strncmp(path, dir, n) == 0 && path[n] == '/' && !strchr(path + n + 1, '/');
+}
+
+class File {
+public:
+    File() {}
+    explicit File(const HostFsFile* f) : file(f) {}
+    explicit File(const char* dirPath) : dir(dirPath) {}
+
+    explicit operator bool() const { return file || dir; }
+    void        close() { file = nullptr; dir = nullptr; }
+    bool        seek(uint32_t p) {
+        if (!file || p > file->len) return false;
+        pos = p;
+        return true;
+    }
+    size_t      position() const { return pos; }
+    size_t      size() const { return file ? file->len : 0; }
+    size_t      read(uint8_t* dst, size_t len) {
+        if (!file) return 0;
+        if (len > file->len - pos) len = file->len - pos;
+        memcpy(dst, file->data + pos, len);
+        pos += len;
+        return len;
+    }
+    int         read() { return file && pos < file->len ? file->data[pos++] : -1; }
+    size_t      readBytes(char* dst, size_t len) { return read((uint8_t*)dst, len); }
+    const char* name() const { return file ? strrchr(file->path, '/') + 1 : ""; }
+    bool        isDirectory() const { return dir != nullptr; }
+    File        openNextFile() {
+        while (dir && next < hostFsCount) {
+            const HostFsFile* f = &hostFsFiles[next++];
+            if (hostFsInDir(f->path, dir)) return File(f);
+        }
+        return File();
+    }
+
+private:
+    const HostFsFile* file = nullptr;
+    const char*       dir  = nullptr;
+    size_t            pos  = 0;
+    int               next = 0;
+};
+
+class HostLittleFS {
+public:
+    bool begin(bool = false) { return false; }
+    bool exists(const char* path) { return find(path) != nullptr; }
+    File open(const char* path, const char* = "r") {
+        if (const HostFsFile* f = find(path)) return File(f);
+        for (int i = 0; i < hostFsCount; i++) {
+            if (hostFsInDir(hostFsFiles[i].path, path)) return File(path);
+        }
+        return File();
+    }
+
+private:
+    const HostFsFile* find(const char* path) {
+        for (int i = 0; i < hostFsCount; i++) {
+            if (strcmp(hostFsFiles[i].path, path) == 0) return &hostFsFiles[i];
+        }
+        return nullptr;
+    }
+};
+
+inline HostLittleFS LittleFS;
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ============================================================
+// Host FreeRTOS - single-threaded stand-ins for the native_display env
+// ============================================================
+// No render task runs on the host: the test calls displayTraceStep()
+// instead, so task creation succeeds without starting anything and
+// notifications go nowhere. Ticks are milliseconds of virtual time.
+
+typedef int      BaseType_t;
+typedef uint32_t TickType_t;
+typedef void*    TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE              1
+#define pdFALSE             0
+#define pdPASS              1
+#define portMAX_DELAY       0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char*, uint32_t, void*,
+                                          uint32_t, TaskHandle_t* handle, BaseType_t) {
+    static int hostTask;
+    if (handle) *handle = &hostTask;
+    return pdPASS;
+}
+
+inline void     xTaskNotifyGive(TaskHandle_t) {}
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+inline void     vTaskDelay(TickType_t ticks) { hostAdvanceMs(ticks); }
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+
+// Host mutex: one thread, so taking it always succeeds
+
+typedef void* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    static int hostMutex;
+    return &hostMutex;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
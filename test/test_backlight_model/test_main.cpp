@@ -0,0 +1,179 @@
+#include <math.h>
+#include <unity.h>
+#include "config.h"
+#include "backlight_model.h"
+
+// ============================================================
+// Backlight model tests: the CIE curve, fades queued behind a running
+// one (latest wins), and the night window with and without a wrap past
+// midnight
+// ============================================================
+
+static const uint16_t DUTY_MAX = (1 << BACKLIGHT_PWM_BITS) - 1;     // As backlight.cpp
+static const uint32_t T0_MS    = 4294960000u;                       // Wraps during the fades
+
+static BacklightCurve curve;
+static BacklightFader fader;
+
+void setUp() {
+    backlightCurveInit(curve, DUTY_MAX);
+    backlightFaderInit(fader, 0);
+}
+
+void tearDown() {}
+
+static uint16_t minute(int h, int m) {
+    return (uint16_t)(h * 60 + m);
+}
+
+// --- Curve ---
+
+static void test_curve_ends() {
+    TEST_ASSERT_EQUAL_UINT16(0, backlightCurveDuty(curve, 0));
+    TEST_ASSERT_EQUAL_UINT16(DUTY_MAX, backlightCurveDuty(curve, 100));
+    TEST_ASSERT_EQUAL_UINT16(DUTY_MAX, backlightCurveDuty(curve, 255));  // Clamped
+}
+
+static void test_curve_never_decreases_and_never_hits_zero() {
+    for (int level = 1; level <= 100; level++) {
+        uint16_t duty = backlightCurveDuty(curve, level);
+        TEST_ASSERT_TRUE(duty >= 1);
+        TEST_ASSERT_TRUE(duty >= backlightCurveDuty(curve, level - 1));
+    }
+
+    // Coarse PWM still keeps every level lit and in order
+    BacklightCurve coarse;
+    backlightCurveInit(coarse, 255);
+    for (int level = 1; level <= 100; level++) {
+        TEST_ASSERT_TRUE(coarse.duty[level] >= 1);
+        TEST_ASSERT_TRUE(coarse.duty[level] >= coarse.duty[level - 1]);
+    }
+    TEST_ASSERT_EQUAL_UINT16(255, coarse.duty[100]);
+}
+
+// Perceptual, not linear: half brightness is under a fifth of the duty
+static void test_curve_follows_cie_lightness() {
+    TEST_ASSERT_UINT16_WITHIN(1, (uint16_t)lroundf(0.1842f * DUTY_MAX), backlightCurveDuty(curve, 50));
+    TEST_ASSERT_UINT16_WITHIN(1, (uint16_t)lroundf(0.0114f * DUTY_MAX), backlightCurveDuty(curve, 10));
+    TEST_ASSERT_TRUE(backlightCurveDuty(curve, 33) < DUTY_MAX / 10);
+}
+
+// --- Fader ---
+
+static void test_idle_request_fades_or_sets() {
+    BacklightCommand cmd = backlightFaderRequest(fader, 800, 300, T0_MS);
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_FADE, cmd.action);
+    TEST_ASSERT_EQUAL_UINT16(800, cmd.duty);
+    TEST_ASSERT_EQUAL_UINT16(300, cmd.ms);
+    TEST_ASSERT_EQUAL_UINT16(400, backlightFaderDuty(fader, T0_MS + 150));
+    TEST_ASSERT_EQUAL_UINT16(800, backlightFaderDuty(fader, T0_MS + 300));
+
+    cmd = backlightFaderRequest(fader, 100, 0, T0_MS + 1000);
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_SET, cmd.action);
+    TEST_ASSERT_EQUAL_UINT16(100, backlightFaderDuty(fader, T0_MS + 1000));
+
+    cmd = backlightFaderRequest(fader, 100, 300, T0_MS + 2000);
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_NONE, cmd.action);  // Already there
+}
+
+// Requests during a fade are held; only the newest is run when it ends
+static void test_latest_request_wins_during_a_fade() {
+    backlightFaderRequest(fader, 800, 300, T0_MS);
+
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_NONE, backlightFaderRequest(fader, 200, 100, T0_MS + 50).action);
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_NONE, backlightFaderRequest(fader, 600, 200, T0_MS + 100).action);
+    TEST_ASSERT_TRUE(fader.pending);
+    TEST_ASSERT_EQUAL_UINT16(800, fader.toDuty);        // Running fade untouched
+
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_NONE, backlightFaderPoll(fader, T0_MS + 300).action);  // Margin
+    BacklightCommand cmd = backlightFaderPoll(fader, T0_MS + 320);
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_FADE, cmd.action);
+    TEST_ASSERT_EQUAL_UINT16(600, cmd.duty);
+    TEST_ASSERT_EQUAL_UINT16(200, cmd.ms);
+    TEST_ASSERT_FALSE(fader.pending);
+    TEST_ASSERT_EQUAL_UINT16(700, backlightFaderDuty(fader, T0_MS + 420));
+
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_NONE, backlightFaderPoll(fader, T0_MS + 1000).action);
+    TEST_ASSERT_EQUAL_UINT16(600, backlightFaderDuty(fader, T0_MS + 1000));
+}
+
+// Asking for the running fade's own target cancels anything queued
+static void test_request_for_running_target_drops_the_queue() {
+    backlightFaderRequest(fader, 800, 300, T0_MS);
+    backlightFaderRequest(fader, 200, 100, T0_MS + 50);
+    backlightFaderRequest(fader, 800, 100, T0_MS + 60);
+    TEST_ASSERT_FALSE(fader.pending);
+    TEST_ASSERT_EQUAL_INT(BACKLIGHT_NONE, backlightFaderPoll(fader, T0_MS + 400).action);
+    TEST_ASSERT_EQUAL_UINT16(800, backlightFaderDuty(fader, T0_MS + 400));
+}
+
+// A fade down reports duty falling linearly, as the LEDC steps it
+static void test_duty_follows_a_fade_down() {
+    backlightFaderInit(fader, 1000);
+    backlightFaderRequest(fader, 0, 500, T0_MS);
+    uint16_t last = 1000;
+    for (uint32_t t = 0; t <= 500; t += 50) {
+        uint16_t duty = backlightFaderDuty(fader, T0_MS + t);
+        TEST_ASSERT_TRUE(duty <= last);
+        TEST_ASSERT_UINT16_WITHIN(1, 1000 - t * 2, duty);
+        last = duty;
+    }
+    TEST_ASSERT_TRUE(backlightFaderBusy(fader, T0_MS + 505));
+    TEST_ASSERT_FALSE(backlightFaderBusy(fader, T0_MS + 510));
+}
+
+// --- Schedule ---
+
+static void test_night_window_without_wrap() {
+    BacklightSchedule s = { 80, 10, minute(1, 0), minute(6, 30), 20 };
+    TEST_ASSERT_FALSE(backlightScheduleIsNight(s, minute(0, 59)));
+    TEST_ASSERT_TRUE(backlightScheduleIsNight(s, minute(1, 0)));
+    TEST_ASSERT_TRUE(backlightScheduleIsNight(s, minute(6, 29)));
+    TEST_ASSERT_FALSE(backlightScheduleIsNight(s, minute(6, 30)));
+    TEST_ASSERT_FALSE(backlightScheduleIsNight(s, minute(23, 0)));
+}
+
+static void test_night_window_wraps_past_midnight() {
+    BacklightSchedule s = { 80, 10, minute(22, 0), minute(7, 0), 20 };
+    TEST_ASSERT_FALSE(backlightScheduleIsNight(s, minute(21, 59)));
+    TEST_ASSERT_TRUE(backlightScheduleIsNight(s, minute(22, 0)));
+    TEST_ASSERT_TRUE(backlightScheduleIsNight(s, minute(23, 59)));
+    TEST_ASSERT_TRUE(backlightScheduleIsNight(s, 0));
+    TEST_ASSERT_TRUE(backlightScheduleIsNight(s, minute(6, 59)));
+    TEST_ASSERT_FALSE(backlightScheduleIsNight(s, minute(7, 0)));
+    TEST_ASSERT_FALSE(backlightScheduleIsNight(s, minute(12, 0)));
+}
+
+static void test_night_window_disabled_or_time_unknown() {
+    BacklightSchedule s = { 80, 10, minute(22, 0), minute(22, 0), 20 };
+    for (int m = 0; m < 24 * 60; m += 7) TEST_ASSERT_FALSE(backlightScheduleIsNight(s, m));
+
+    s.nightEndMin = minute(7, 0);
+    TEST_ASSERT_FALSE(backlightScheduleIsNight(s, -1));
+    TEST_ASSERT_EQUAL_UINT8(80, backlightScheduleLevel(s, BACKLIGHT_MODE_NORMAL, -1));
+}
+
+static void test_modes_layer_over_the_window() {
+    BacklightSchedule s = { 80, 10, minute(22, 0), minute(7, 0), 20 };
+    TEST_ASSERT_EQUAL_UINT8(80, backlightScheduleLevel(s, BACKLIGHT_MODE_NORMAL, minute(12, 0)));
+    TEST_ASSERT_EQUAL_UINT8(10, backlightScheduleLevel(s, BACKLIGHT_MODE_NORMAL, minute(2, 0)));
+    TEST_ASSERT_EQUAL_UINT8(20, backlightScheduleLevel(s, BACKLIGHT_MODE_DIM, minute(12, 0)));
+    TEST_ASSERT_EQUAL_UINT8(10, backlightScheduleLevel(s, BACKLIGHT_MODE_DIM, minute(2, 0)));  // Never brighter
+    TEST_ASSERT_EQUAL_UINT8(0, backlightScheduleLevel(s, BACKLIGHT_MODE_OFF, minute(12, 0)));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_curve_ends);
+    RUN_TEST(test_curve_never_decreases_and_never_hits_zero);
+    RUN_TEST(test_curve_follows_cie_lightness);
+    RUN_TEST(test_idle_request_fades_or_sets);
+    RUN_TEST(test_latest_request_wins_during_a_fade);
+    RUN_TEST(test_request_for_running_target_drops_the_queue);
+    RUN_TEST(test_duty_follows_a_fade_down);
+    RUN_TEST(test_night_window_without_wrap);
+    RUN_TEST(test_night_window_wraps_past_midnight);
+    RUN_TEST(test_night_window_disabled_or_time_unknown);
+    RUN_TEST(test_modes_layer_over_the_window);
+    return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#include <math.h>
+#include <stdlib.h>
+#include <unity.h>
+#include "clock_face.h"
+
+// ============================================================
+// Clock face tests: hand boxes against hand-worked goldens at the right
+// angles and diagonals, the right-angle snap, and where the seconds hand
+// lands within each step
+// ============================================================
+
+static const int CX = 120;
+static const int CY = 120;
+static const int M  = CLOCK_FACE_AA_MARGIN;
+
+static const ClockHand MINUTE_HAND = { 80, 20, 6 };
+
+void setUp() {}
+void tearDown() {}
+
+// --- Helpers ---
+
+static void assertBox(int x, int y, int w, int h, const DirtyRect& r) {
+    TEST_ASSERT_EQUAL_INT(x, r.x);
+    TEST_ASSERT_EQUAL_INT(y, r.y);
+    TEST_ASSERT_EQUAL_INT(w, r.w);
+    TEST_ASSERT_EQUAL_INT(h, r.h);
+}
+
+// --- Hand bounds ---
+
+// Bar x in [-3, 3], y in [-80, 20] around the pivot, rotated by quarter
+// turns: 12 o'clock points up, 3 o'clock right (y grows downward)
+static void test_bounds_at_right_angles() {
+    assertBox(CX - 3 - M,  CY - 80 - M, 7 + 2 * M,   101 + 2 * M, clockHandBounds(MINUTE_HAND, 0.0f, CX, CY));
+    assertBox(CX - 20 - M, CY - 3 - M,  101 + 2 * M, 7 + 2 * M,   clockHandBounds(MINUTE_HAND, 90.0f, CX, CY));
+    assertBox(CX - 3 - M,  CY - 20 - M, 7 + 2 * M,   101 + 2 * M, clockHandBounds(MINUTE_HAND, 180.0f, CX, CY));
+    assertBox(CX - 80 - M, CY - 3 - M,  101 + 2 * M, 7 + 2 * M,   clockHandBounds(MINUTE_HAND, 270.0f, CX, CY));
+    assertBox(CX - 3 - M,  CY - 80 - M, 7 + 2 * M,   101 + 2 * M, clockHandBounds(MINUTE_HAND, 360.0f, CX, CY));
+}
+
+// At 45 degrees the far corner (3, -80) lands at (58.69, -54.45) and the
+// tail corner (-3, 20) at (-16.26, 12.02); floor/ceil round outward
+static void test_bounds_at_diagonals() {
+    assertBox(CX - 17 - M, CY - 59 - M, 77 + 2 * M, 77 + 2 * M, clockHandBounds(MINUTE_HAND, 45.0f, CX, CY));
+    assertBox(CX - 17 - M, CY - 17 - M, 77 + 2 * M, 77 + 2 * M, clockHandBounds(MINUTE_HAND, 135.0f, CX, CY));
+    assertBox(CX - 59 - M, CY - 17 - M, 77 + 2 * M, 77 + 2 * M, clockHandBounds(MINUTE_HAND, 225.0f, CX, CY));
+    assertBox(CX - 59 - M, CY - 59 - M, 77 + 2 * M, 77 + 2 * M, clockHandBounds(MINUTE_HAND, 315.0f, CX, CY));
+}
+
+// sinf/cosf residue at right angles (cos 90 = -4e-8) must not grow an
+// axis-aligned box by a pixel: a quarter turn only swaps width and height
+static void test_right_angles_snap_for_every_hand_shape() {
+    for (int width = 1; width <= 9; width++) {
+        for (int length = 20; length <= 100; length += 7) {
+            ClockHand hand = { (int16_t)length, (int16_t)(length / 4), (int16_t)width };
+            DirtyRect up = clockHandBounds(hand, 0.0f, CX, CY);
+
+            for (int q = 1; q < 4; q++) {
+                DirtyRect r = clockHandBounds(hand, 90.0f * q, CX, CY);
+                bool swapped = (q % 2) == 1;
+                TEST_ASSERT_EQUAL_INT(swapped ? up.h : up.w, r.w);
+                TEST_ASSERT_EQUAL_INT(swapped ? up.w : up.h, r.h);
+            }
+        }
+    }
+}
+
+// Off the right angles the box still holds every corner (worked in
+// double), and is at most a pixel per side larger than it has to be
+static void test_bounds_hold_every_corner() {
+    srand(11);
+    const ClockHand hands[] = { { 50, 12, 8 }, { 80, 20, 6 }, { 96, 24, 2 } };
+    for (int i = 0; i < 5000; i++) {
+        const ClockHand& hand = hands[i % 3];
+        float angle = (float)(rand() % 36000) / 100.0f;
+        if (i < 8) angle = 90.0f * (i / 2) + (i % 2 ? 0.01f : -0.01f);     // Just off the snap
+        DirtyRect r = clockHandBounds(hand, angle, CX, CY);
+
+        double s = sin(angle * M_PI / 180.0), c = cos(angle * M_PI / 180.0);
+        double minX = 1e9, maxX = -1e9, minY = 1e9, maxY = -1e9;
+        for (int k = 0; k < 4; k++) {
+            double x = (k & 1) ? hand.width * 0.5 : -hand.width * 0.5;
+            double y = (k >> 1) ? hand.tail : -hand.length;
+            double rx = x * c - y * s, ry = x * s + y * c;
+            minX = fmin(minX, rx); maxX = fmax(maxX, rx);
+            minY = fmin(minY, ry); maxY = fmax(maxY, ry);
+        }
+        TEST_ASSERT_TRUE(r.x + M <= CX + minX + 0.01);
+        TEST_ASSERT_TRUE(r.y + M <= CY + minY + 0.01);
+        TEST_ASSERT_TRUE(r.x + r.w - 1 - M >= CX + maxX - 0.01);
+        TEST_ASSERT_TRUE(r.y + r.h - 1 - M >= CY + maxY - 0.01);
+        TEST_ASSERT_TRUE(r.w - 2 * M <= (maxX - minX) + 3);
+        TEST_ASSERT_TRUE(r.h - 2 * M <= (maxY - minY) + 3);
+    }
+}
+
+// --- Angles ---
+
+static void test_hour_hand_creeps_with_minutes() {
+    ClockAngles a;
+    clockFaceAngles(10, 30, 0, 0, 1000, a);
+    TEST_ASSERT_EQUAL_FLOAT(315.0f, a.hour);
+    TEST_ASSERT_EQUAL_FLOAT(180.0f, a.minute);
+
+    clockFaceAngles(22, 30, 0, 0, 1000, a);             // 24 h clock folds onto the dial
+    TEST_ASSERT_EQUAL_FLOAT(315.0f, a.hour);
+
+    clockFaceAngles(0, 0, 0, 0, 1000, a);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, a.hour);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, a.minute);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, a.second);
+}
+
+// The seconds hand sits at the start of its step for the whole step and
+// moves exactly on the step boundary, for every millisecond of a minute
+static void test_second_hand_lands_at_step_start() {
+    const uint16_t steps[] = { 1000, 500, 250, 100 };
+    for (uint16_t step : steps) {
+        float prev = -1.0f;
+        for (int ms = 0; ms < 60000; ms++) {
+            ClockAngles a;
+            clockFaceAngles(10, 8, ms / 1000, ms % 1000, step, a);
+
+            float expected = (float)(ms - ms % step) * 0.006f;
+            TEST_ASSERT_FLOAT_WITHIN(0.0005f, expected, a.second);
+            if (ms % step == 0) {
+                TEST_ASSERT_TRUE(a.second > prev);
+            } else {
+                TEST_ASSERT_EQUAL_FLOAT(prev, a.second);
+            }
+            prev = a.second;
+        }
+        TEST_ASSERT_FLOAT_WITHIN(0.0005f, (60000 - step) * 0.006f, prev);
+    }
+}
+
+static void test_zero_step_ticks_once_a_second() {
+    ClockAngles a;
+    clockFaceAngles(10, 8, 30, 999, 0, a);
+    TEST_ASSERT_EQUAL_FLOAT(180.0f, a.second);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bounds_at_right_angles);
+    RUN_TEST(test_bounds_at_diagonals);
+    RUN_TEST(test_right_angles_snap_for_every_hand_shape);
+    RUN_TEST(test_bounds_hold_every_corner);
+    RUN_TEST(test_hour_hand_creeps_with_minutes);
+    RUN_TEST(test_second_hand_lands_at_step_start);
+    RUN_TEST(test_zero_step_ticks_once_a_second);
+    return UNITY_END();
+}
@@ -0,0 +1,213 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include "dirty_rect.h"
+#include "host_bench.h"
+
+// ============================================================
+// Dirty rect tests: clipping, containment, merging, and a benchmark
+// of the merge over the frame shapes the pages actually produce
+// ============================================================
+
+static const int W = 240;
+static const int H = 240;
+
+static DirtyRegion region;
+
+void setUp() {
+    dirtyRegionInit(region, W, H);
+}
+
+void tearDown() {}
+
+// --- Helpers ---
+
+static bool rectCovers(const DirtyRect& r, int x, int y) {
+    return x >= r.x && x < r.x + r.w && y >= r.y && y < r.y + r.h;
+}
+
+static bool regionCovers(const DirtyRegion& reg, int x, int y) {
+    for (int i = 0; i < reg.count; i++) {
+        if (rectCovers(reg.rects[i], x, y)) return true;
+    }
+    return false;
+}
+
+static void addRects(DirtyRegion& reg, const DirtyRect* rects, int count) {
+    for (int i = 0; i < count; i++) {
+        dirtyRegionAdd(reg, rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+    }
+}
+
+// --- Tests ---
+
+static void test_add_clips_to_bounds() {
+    dirtyRegionAdd(region, -10, -5, 30, 20);
+    dirtyRegionAdd(region, 230, 235, 40, 40);
+    dirtyRegionAdd(region, 300, 10, 10, 10);        // Entirely off screen
+
+    TEST_ASSERT_EQUAL_INT(2, region.count);
+    TEST_ASSERT_EQUAL_INT(0, region.rects[0].x);
+    TEST_ASSERT_EQUAL_INT(0, region.rects[0].y);
+    TEST_ASSERT_EQUAL_INT(20, region.rects[0].w);
+    TEST_ASSERT_EQUAL_INT(15, region.rects[0].h);
+    TEST_ASSERT_EQUAL_INT(10, region.rects[1].w);
+    TEST_ASSERT_EQUAL_INT(5, region.rects[1].h);
+}
+
+static void test_contained_rect_is_dropped() {
+    dirtyRegionAdd(region, 10, 10, 100, 50);
+    dirtyRegionAdd(region, 20, 20, 10, 10);
+    TEST_ASSERT_EQUAL_INT(1, region.count);
+    TEST_ASSERT_EQUAL_UINT32(5000, dirtyRegionArea(region));
+}
+
+static void test_covering_rect_replaces_contained() {
+    dirtyRegionAdd(region, 20, 20, 10, 10);
+    dirtyRegionAdd(region, 60, 20, 10, 10);
+    dirtyRegionAdd(region, 10, 10, 100, 50);
+    TEST_ASSERT_EQUAL_INT(1, region.count);
+    TEST_ASSERT_EQUAL_INT(10, region.rects[0].x);
+    TEST_ASSERT_EQUAL_INT(100, region.rects[0].w);
+}
+
+static void test_full_list_folds_into_cheapest() {
+    // A row of small cells, then one more right next to the last
+    for (int i = 0; i < DIRTY_RECT_MAX; i++) {
+        dirtyRegionAdd(region, i * 14, 0, 4, 4);
+    }
+    TEST_ASSERT_EQUAL_INT(DIRTY_RECT_MAX, region.count);
+
+    int lastX = (DIRTY_RECT_MAX - 1) * 14;
+    dirtyRegionAdd(region, lastX + 5, 0, 4, 4);
+    TEST_ASSERT_EQUAL_INT(DIRTY_RECT_MAX, region.count);
+    TEST_ASSERT_TRUE(regionCovers(region, lastX + 8, 3));
+    TEST_ASSERT_TRUE(regionCovers(region, lastX, 0));
+}
+
+static void test_merge_joins_neighbours_within_slack() {
+    // Two clock digit cells side by side: the union costs nothing extra
+    dirtyRegionAdd(region, 40, 30, 32, 48);
+    dirtyRegionAdd(region, 72, 30, 32, 48);
+    dirtyRegionMerge(region);
+    TEST_ASSERT_EQUAL_INT(1, region.count);
+    TEST_ASSERT_EQUAL_INT(64, region.rects[0].w);
+}
+
+static void test_merge_keeps_distant_rects_apart() {
+    dirtyRegionAdd(region, 0, 0, 20, 20);
+    dirtyRegionAdd(region, 200, 200, 20, 20);
+    dirtyRegionMerge(region);
+    TEST_ASSERT_EQUAL_INT(2, region.count);
+    TEST_ASSERT_EQUAL_UINT32(800, dirtyRegionArea(region));
+}
+
+static void test_merge_stays_within_slack_per_step() {
+    // Gap of 4 rows x 20 px = 80 extra pixels: under the slack, merged
+    dirtyRegionAdd(region, 0, 0, 20, 10);
+    dirtyRegionAdd(region, 0, 14, 20, 10);
+    dirtyRegionMerge(region);
+    TEST_ASSERT_EQUAL_INT(1, region.count);
+    TEST_ASSERT_EQUAL_UINT32(20 * 24, dirtyRegionArea(region));
+}
+
+static void test_add_all_and_clear() {
+    dirtyRegionAdd(region, 5, 5, 5, 5);
+    dirtyRegionAddAll(region);
+    TEST_ASSERT_EQUAL_INT(1, region.count);
+    TEST_ASSERT_EQUAL_UINT32(W * H, dirtyRegionArea(region));
+
+    dirtyRegionClear(region);
+    TEST_ASSERT_TRUE(dirtyRegionIsEmpty(region));
+}
+
+// Whatever gets folded or merged, every pixel marked must still be sent
+static void test_merged_region_covers_every_added_pixel() {
+    srand(1);
+    for (int round = 0; round < 300; round++) {
+        dirtyRegionClear(region);
+        DirtyRect added[40];
+        int n = 1 + rand() % 40;
+        for (int i = 0; i < n; i++) {
+            added[i] = { (int16_t)(rand() % W), (int16_t)(rand() % H),
+                         (int16_t)(1 + rand() % 60), (int16_t)(1 + rand() % 40) };
+        }
+        addRects(region, added, n);
+        dirtyRegionMerge(region);
+        TEST_ASSERT_LESS_OR_EQUAL(DIRTY_RECT_MAX, region.count);
+
+        for (int i = 0; i < n; i++) {
+            const DirtyRect& r = added[i];
+            for (int y = r.y; y < r.y + r.h && y < H; y++) {
+                for (int x = r.x; x < r.x + r.w && x < W; x++) {
+                    if (!regionCovers(region, x, y)) {
+                        TEST_FAIL_MESSAGE("merged region lost a marked pixel");
+                    }
+                }
+            }
+        }
+    }
+}
+
+// --- Benchmark ---
+// Frame shapes taken from the pages: the minute tick on the clock page,
+// the seconds hand on the analog page, a system info refresh, and a
+// scatter that overflows the list.
+
+struct BenchFrame {
+    const char* name;
+    DirtyRect   rects[40];
+    int         count;
+};
+
+static void benchFrame(const BenchFrame& f) {
+    uint32_t rawPixels = 0;
+    for (int i = 0; i < f.count; i++) rawPixels += (uint32_t)f.rects[i].w * f.rects[i].h;
+
+    DirtyRegion reg;
+    dirtyRegionInit(reg, W, H);
+    double ns = benchNsPerIter(20000, [&](uint32_t) {
+        dirtyRegionClear(reg);
+        addRects(reg, f.rects, f.count);
+        dirtyRegionMerge(reg);
+        benchSink = benchSink + reg.count;
+    });
+
+    BENCH_REPORT("%-8s %2d rects -> %2d windows, %6u -> %6u px, %7.0f ns per frame",
+                 f.name, f.count, reg.count, rawPixels, dirtyRegionArea(reg), ns);
+    TEST_ASSERT_LESS_OR_EQUAL(f.count, reg.count);
+}
+
+static void test_bench_merge() {
+    static BenchFrame frames[4] = {
+        { "minute", { { 88, 31, 32, 48 }, { 152, 31, 32, 48 }, { 70, 100, 100, 20 } }, 3 },
+        { "analog", { { 112, 20, 16, 100 }, { 118, 24, 64, 80 }, { 114, 112, 12, 12 } }, 3 },
+        { "sysinfo", { { 10, 28, 140, 16 }, { 10, 64, 90, 16 }, { 10, 82, 90, 16 },
+                       { 10, 100, 110, 16 }, { 0, 223, 240, 8 }, { 0, 232, 240, 8 } }, 6 },
+        { "scatter", {}, 40 },
+    };
+    srand(7);
+    for (int i = 0; i < frames[3].count; i++) {
+        frames[3].rects[i] = { (int16_t)(rand() % 220), (int16_t)(rand() % 220),
+                               (int16_t)(4 + rand() % 20), (int16_t)(4 + rand() % 20) };
+    }
+
+    for (const BenchFrame& f : frames) {
+        benchFrame(f);
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_add_clips_to_bounds);
+    RUN_TEST(test_contained_rect_is_dropped);
+    RUN_TEST(test_covering_rect_replaces_contained);
+    RUN_TEST(test_full_list_folds_into_cheapest);
+    RUN_TEST(test_merge_joins_neighbours_within_slack);
+    RUN_TEST(test_merge_keeps_distant_rects_apart);
+    RUN_TEST(test_merge_stays_within_slack_per_step);
+    RUN_TEST(test_add_all_and_clear);
+    RUN_TEST(test_merged_region_covers_every_added_pixel);
+    RUN_TEST(test_bench_merge);
+    return UNITY_END();
+}
@@ -0,0 +1,69 @@
+#include <stdarg.h>
+#include "backlight.h"
+#include "boot_trace.h"
+#include "logger.h"
+#include "splash.h"
+#include "weather.h"
+
+// ============================================================
+// Host fakes - the firmware modules display.cpp calls into
+// ============================================================
+// The logger keeps real lines (the console page shows them) stamped with
+// virtual time; the rest do nothing. No splash is ever found.
+
+// --- Logger ---
+
+static char     lines[LOG_BUFFER_SIZE][LOG_LINE_LENGTH];
+static uint32_t lineSeq = 0;
+static void   (*listener)() = nullptr;
+
+void logPrint(const char* msg) {
+    snprintf(lines[lineSeq % LOG_BUFFER_SIZE], LOG_LINE_LENGTH, "[%7lu] %s", millis(), msg);
+    lineSeq++;
+    if (listener) listener();
+}
+
+void logPrintf(const char* format, ...) {
+    char buf[LOG_LINE_LENGTH];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    logPrint(buf);
+}
+
+uint32_t logSequence() {
+    return lineSeq;
+}
+
+bool logGetLine(uint32_t seq, char* dst, size_t len) {
+    if (seq >= lineSeq || lineSeq - seq > LOG_BUFFER_SIZE) return false;
+    snprintf(dst, len, "%s", lines[seq % LOG_BUFFER_SIZE]);
+    return true;
+}
+
+void logSetListener(void (*fn)()) {
+    listener = fn;
+}
+
+// --- Everything else ---
+
+void bootTraceMark(const char*) {}
+
+void backlightDip(bool, uint16_t) {}
+
+bool splashLoad(SplashImage&) {
+    return false;
+}
+
+void splashRelease(SplashImage& img) {
+    img.data = nullptr;
+}
+
+const char* weatherIconName(WeatherIcon icon) {
+    static const char* const names[] = {
+        "Clear", "Clear Night", "Partly Cloudy", "Cloudy", "Fog",
+        "Drizzle", "Rain", "Snow", "Thunderstorm", "Unknown"
+    };
+    return names[(unsigned)icon <= ICON_UNKNOWN ? icon : ICON_UNKNOWN];  // Same names as weather.cpp
+}
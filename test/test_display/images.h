@@ -0,0 +1,182 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============================================================
+// Images for the photo and GIF screens, small enough to keep in source
+// ============================================================
+// Made with Pillow: a 64x48 baseline JPEG (quality 75) and a 40x40 PNG of
+// the same red/green gradient with a white disc and a dark bar. The GIF,
+// LZW-coded by a small script rather than Pillow so the frames stay as
+// written, is 48x32: a full frame of 8px checks, then a 12x10
+// sub-rectangle with colour 0 transparent.
+
+static const uint8_t PHOTO_JPG[] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43,
+    0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08, 0x07, 0x07, 0x07, 0x09,
+    0x09, 0x08, 0x0A, 0x0C, 0x14, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x19, 0x12,
+    0x13, 0x0F, 0x14, 0x1D, 0x1A, 0x1F, 0x1E, 0x1D, 0x1A, 0x1C, 0x1C, 0x20,
+    0x24, 0x2E, 0x27, 0x20, 0x22, 0x2C, 0x23, 0x1C, 0x1C, 0x28, 0x37, 0x29,
+    0x2C, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1F, 0x27, 0x39, 0x3D, 0x38, 0x32,
+    0x3C, 0x2E, 0x33, 0x34, 0x32, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x09, 0x09,
+    0x09, 0x0C, 0x0B, 0x0C, 0x18, 0x0D, 0x0D, 0x18, 0x32, 0x21, 0x1C, 0x21,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0x30, 0x00, 0x40, 0x03,
+    0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00,
+    0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00,
+    0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+    0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24,
+    0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25,
+    0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86,
+    0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6,
+    0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9,
+    0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1,
+    0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00,
+    0x1F, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+    0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31,
+    0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+    0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15,
+    0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18,
+    0x19, 0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4,
+    0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7,
+    0xD8, 0xD9, 0xDA, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA,
+    0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xDA, 0x00,
+    0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF1,
+    0xD8, 0xED, 0x7D, 0xAA, 0xCC, 0x76, 0xBE, 0xD5, 0xA1, 0x1D, 0xAF, 0xB5,
+    0x5A, 0x8E, 0xD7, 0xDA, 0xBE, 0xA6, 0x75, 0xCE, 0x4C, 0x3E, 0x24, 0xCF,
+    0x8E, 0xD7, 0xDA, 0xA1, 0xD5, 0x21, 0xF2, 0xED, 0x14, 0xFF, 0x00, 0xB6,
+    0x07, 0xE8, 0x6B, 0xA9, 0xD2, 0xF4, 0x3B, 0xDD, 0x56, 0xED, 0x6D, 0x6C,
+    0x2D, 0x65, 0xB8, 0x98, 0xE3, 0xE5, 0x8D, 0x73, 0x81, 0x90, 0x32, 0x4F,
+    0x40, 0x32, 0x47, 0x27, 0x81, 0x57, 0x3C, 0x7D, 0xE0, 0x3D, 0x43, 0xC3,
+    0x3E, 0x13, 0xB6, 0xD4, 0x75, 0x09, 0x60, 0x0D, 0x2D, 0xD4, 0x71, 0x2C,
+    0x31, 0x92, 0xC5, 0x72, 0x8E, 0xC7, 0x71, 0xE9, 0x91, 0xB4, 0x0E, 0x32,
+    0x0E, 0x4F, 0x3C, 0x73, 0xE7, 0x62, 0xB1, 0x09, 0xC1, 0xC6, 0xFB, 0x9E,
+    0xBF, 0xD6, 0x2F, 0x4D, 0xA3, 0x8C, 0xD0, 0x22, 0xF3, 0x0D, 0xC7, 0xB6,
+    0xDF, 0xEB, 0x5D, 0x0C, 0x76, 0xBE, 0xD5, 0x6B, 0xE1, 0x7F, 0x84, 0x6E,
+    0xBC, 0x53, 0x1E, 0xAC, 0x6D, 0x27, 0x86, 0x39, 0x2D, 0x9A, 0x0C, 0xAC,
+    0xD9, 0x01, 0x83, 0x79, 0x9C, 0xE4, 0x03, 0xC8, 0xDA, 0x38, 0xC7, 0x7F,
+    0x6E, 0x77, 0x6F, 0xBC, 0x3D, 0xA8, 0x69, 0x13, 0x88, 0x6F, 0xED, 0x24,
+    0x81, 0x8F, 0xDD, 0x2C, 0x32, 0xAD, 0xC0, 0x3C, 0x30, 0xE0, 0xF5, 0x1D,
+    0x0F, 0x15, 0xCB, 0x4A, 0xBA, 0x8D, 0x35, 0x13, 0xD7, 0xCA, 0xF1, 0x51,
+    0x8D, 0x35, 0x4E, 0xFA, 0xAF, 0xF3, 0x30, 0xA3, 0xB5, 0xF6, 0xAB, 0x31,
+    0xDA, 0xFB, 0x56, 0x84, 0x76, 0xBE, 0xD5, 0x6A, 0x3B, 0x5F, 0x6A, 0x99,
+    0xD7, 0x3E, 0xA3, 0x0F, 0x89, 0x39, 0x58, 0xED, 0x7D, 0xAA, 0xCC, 0x76,
+    0xBE, 0xD5, 0xA1, 0x1D, 0xAF, 0xB5, 0x5A, 0x8E, 0xD7, 0xDA, 0xAE, 0x75,
+    0xCF, 0xC2, 0x70, 0xF8, 0x93, 0xDA, 0x3C, 0x25, 0xE1, 0xDB, 0x7F, 0x0E,
+    0xE8, 0x70, 0xC2, 0x90, 0x79, 0x77, 0x52, 0xA2, 0xBD, 0xD3, 0x12, 0x19,
+    0x8C, 0x98, 0xE4, 0x64, 0x76, 0x04, 0x90, 0x00, 0xE3, 0xF1, 0x24, 0x9E,
+    0x1F, 0xF6, 0x80, 0xFF, 0x00, 0x91, 0x0E, 0xC7, 0xFE, 0xC2, 0x71, 0xFF,
+    0x00, 0xE8, 0xA9, 0x6B, 0xD1, 0xF4, 0x5D, 0x49, 0x35, 0x6D, 0x26, 0xDE,
+    0xED, 0x5D, 0x19, 0xD9, 0x00, 0x94, 0x26, 0x40, 0x57, 0xC7, 0xCC, 0x30,
+    0x79, 0x1C, 0xFE, 0x98, 0xAF, 0x38, 0xFD, 0xA0, 0x3F, 0xE4, 0x43, 0xB1,
+    0xFF, 0x00, 0xB0, 0x9C, 0x7F, 0xFA, 0x2A, 0x5A, 0xE1, 0x6D, 0xB7, 0x76,
+    0x7D, 0x4C, 0x1A, 0x71, 0x4D, 0x6C, 0x61, 0x7E, 0xCE, 0x9F, 0xF3, 0x32,
+    0xFF, 0x00, 0xDB, 0xAF, 0xFE, 0xD5, 0xAF, 0x67, 0xD4, 0xF4, 0xCB, 0x5D,
+    0x5E, 0xC5, 0xED, 0x2F, 0x23, 0xDF, 0x1B, 0x72, 0x08, 0xEA, 0x87, 0xB3,
+    0x03, 0xD8, 0xFF, 0x00, 0x9E, 0x95, 0xE3, 0x1F, 0xB3, 0xA7, 0xFC, 0xCC,
+    0xBF, 0xF6, 0xEB, 0xFF, 0x00, 0xB5, 0x6B, 0xDB, 0xE7, 0x9E, 0x2B, 0x68,
+    0x5E, 0x69, 0x9C, 0x24, 0x68, 0x32, 0xCC, 0x69, 0x17, 0x16, 0xD3, 0xBA,
+    0xDC, 0xF1, 0x77, 0xB0, 0x7B, 0x79, 0xE4, 0x86, 0x54, 0xDB, 0x24, 0x6C,
+    0x51, 0x86, 0x73, 0x82, 0x0E, 0x0D, 0x4D, 0x1D, 0xAF, 0xB5, 0x6A, 0xCA,
+    0x8D, 0x75, 0x75, 0x2D, 0xC3, 0xA8, 0x0F, 0x2B, 0x97, 0x60, 0x3A, 0x64,
+    0x9C, 0xF1, 0x52, 0xC7, 0x6B, 0xED, 0x5C, 0x33, 0xAE, 0x7D, 0x4E, 0x1B,
+    0x13, 0xA2, 0xB9, 0xCA, 0xC7, 0x6B, 0xED, 0x56, 0x63, 0xB5, 0xF6, 0xAD,
+    0x08, 0xED, 0x7D, 0xAA, 0xD4, 0x76, 0xBE, 0xD5, 0x73, 0xAE, 0x7E, 0x13,
+    0x87, 0xC4, 0x8C, 0xD2, 0x6F, 0x2F, 0x34, 0x99, 0xCC, 0x96, 0x92, 0x6D,
+    0xDD, 0x8D, 0xE8, 0x46, 0x55, 0xC0, 0x3D, 0x08, 0xFE, 0xBD, 0x79, 0x35,
+    0x89, 0xF1, 0x97, 0x5E, 0x3A, 0xAF, 0x81, 0xEC, 0xE0, 0x96, 0xDF, 0xCB,
+    0x95, 0x75, 0x08, 0xD8, 0xB2, 0xB6, 0x55, 0xBF, 0x77, 0x20, 0x3F, 0x4E,
+    0xA3, 0xD6, 0xBA, 0x78, 0xED, 0x7D, 0xAB, 0x8A, 0xF8, 0xB7, 0x0F, 0x97,
+    0xE1, 0x2B, 0x53, 0x8F, 0xF9, 0x7E, 0x41, 0xFF, 0x00, 0x8E, 0x49, 0x59,
+    0xD3, 0xC4, 0x37, 0x35, 0x13, 0xE9, 0xF2, 0xDC, 0x64, 0x9C, 0xE3, 0x4E,
+    0xFA, 0x32, 0x2F, 0x81, 0x3A, 0xA8, 0xD3, 0x17, 0xC4, 0x1F, 0xB9, 0x32,
+    0xB4, 0x86, 0xDB, 0x03, 0x76, 0x00, 0x03, 0xCD, 0xEF, 0xF8, 0x8A, 0xF4,
+    0xCB, 0xDB, 0xDB, 0xBD, 0x4C, 0x8F, 0xB4, 0x30, 0xD8, 0x0E, 0x44, 0x6A,
+    0x30, 0xA0, 0xFF, 0x00, 0x5F, 0xC7, 0xD6, 0xBC, 0xAB, 0xE0, 0x9C, 0x5E,
+    0x61, 0xD7, 0x3D, 0xBC, 0x8F, 0xFD, 0xA9, 0x5E, 0xC1, 0x1D, 0xAF, 0xB5,
+    0x63, 0x8B, 0xC4, 0x4A, 0x33, 0x70, 0xBE, 0x87, 0xB6, 0xF1, 0x1C, 0xB5,
+    0x5C, 0x7B, 0x14, 0x23, 0xB5, 0xF6, 0xAB, 0x31, 0xDA, 0xFB, 0x56, 0x84,
+    0x76, 0xBE, 0xD5, 0x6A, 0x3B, 0x5F, 0x6A, 0xF3, 0x27, 0x5C, 0xF5, 0x70,
+    0xF8, 0x93, 0xFF, 0xD9,
+};
+
+static const uint8_t PHOTO_PNG[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x03, 0x9C, 0x2F, 0x3A, 0x00, 0x00, 0x01,
+    0x22, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xED, 0x96, 0xB1, 0x6A, 0xC3,
+    0x30, 0x10, 0x86, 0xFF, 0x84, 0x60, 0xBD, 0x40, 0xA6, 0x3C, 0x48, 0xB6,
+    0x4E, 0x19, 0x0A, 0x05, 0x43, 0x87, 0x6C, 0x81, 0x40, 0xB6, 0x0E, 0x7D,
+    0x82, 0x9B, 0x32, 0x1D, 0x9D, 0x4D, 0x87, 0x6C, 0x06, 0x83, 0x37, 0x0D,
+    0x06, 0x83, 0x21, 0x83, 0x27, 0x6F, 0x7E, 0x96, 0x8E, 0x9D, 0x3C, 0x75,
+    0x70, 0x08, 0x81, 0xB6, 0xD6, 0xC9, 0x95, 0x31, 0x71, 0x25, 0x0E, 0x81,
+    0x96, 0xFF, 0xE7, 0x43, 0xBA, 0xFF, 0x34, 0x03, 0x8E, 0x01, 0xA0, 0x80,
+    0xEE, 0xFD, 0xF6, 0xA8, 0x97, 0xEF, 0xF8, 0xB6, 0xDE, 0x3E, 0x5E, 0x95,
+    0x40, 0xE7, 0xAA, 0xB6, 0x40, 0x00, 0x37, 0xCB, 0x52, 0x67, 0x01, 0xE5,
+    0xC8, 0x58, 0xD9, 0x1A, 0xDF, 0x13, 0x71, 0x33, 0x16, 0x71, 0x33, 0x16,
+    0xF1, 0xE7, 0xBF, 0xBB, 0x63, 0x78, 0xE2, 0xC1, 0x89, 0x4F, 0x39, 0x01,
+    0xD0, 0xAB, 0x1F, 0x22, 0x73, 0x7F, 0x26, 0x00, 0x59, 0xC8, 0x42, 0xA9,
+    0xF9, 0x25, 0x3A, 0x05, 0x15, 0xE7, 0x64, 0x94, 0x7B, 0xCE, 0x49, 0xA8,
+    0x26, 0x35, 0x4E, 0x35, 0x09, 0x51, 0x9E, 0x34, 0xC9, 0x8C, 0x03, 0x18,
+    0x4B, 0xA7, 0x64, 0x75, 0x7F, 0x9B, 0x94, 0x8C, 0x9A, 0x66, 0xE2, 0x3C,
+    0xA6, 0x1E, 0x4F, 0xED, 0x21, 0x36, 0x70, 0xBB, 0x6B, 0x27, 0xCB, 0x06,
+    0x33, 0x10, 0x9F, 0x23, 0xEA, 0xED, 0xBB, 0x8E, 0x68, 0x24, 0xE2, 0x4E,
+    0x68, 0x77, 0x01, 0x62, 0x99, 0x2A, 0x9E, 0x78, 0xFA, 0xC4, 0x86, 0xE4,
+    0x7A, 0x4C, 0xB8, 0xB7, 0x69, 0x9D, 0x70, 0x87, 0xF2, 0x90, 0xC4, 0xEA,
+    0x6F, 0xD3, 0x29, 0xCC, 0xFA, 0x40, 0x57, 0x19, 0x3B, 0x18, 0x12, 0xDB,
+    0xC2, 0xCE, 0xBB, 0x2C, 0xD8, 0xC1, 0x90, 0x68, 0x6B, 0x57, 0x4A, 0xBD,
+    0x8B, 0x92, 0x9D, 0x8D, 0xC5, 0xB6, 0x0E, 0x95, 0xD9, 0x3B, 0xAB, 0x58,
+    0xA8, 0x66, 0xF7, 0xB8, 0x5E, 0x6A, 0xFE, 0xAD, 0x33, 0x93, 0x9A, 0x15,
+    0xA0, 0xC4, 0x6A, 0xFE, 0x97, 0xE9, 0x89, 0x3D, 0xF1, 0x14, 0x88, 0x47,
+    0x32, 0xFE, 0x02, 0x6F, 0x39, 0x3A, 0xBE, 0x27, 0xEC, 0x02, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+};
+
+static const uint8_t ANIM_GIF[] = {
+    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x30, 0x00, 0x20, 0x00, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE6, 0x3C, 0x28, 0x28, 0xC8, 0x5A, 0x28, 0x5A,
+    0xE6, 0xFA, 0xDC, 0x28, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0xF9, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x03, 0xBC, 0x18, 0xBA, 0x2A,
+    0xFE, 0x6E, 0xC8, 0x29, 0x89, 0xBD, 0x96, 0x31, 0x08, 0xF5, 0xE2, 0x0F,
+    0x45, 0x61, 0x98, 0xD7, 0x80, 0x82, 0x19, 0xA0, 0x82, 0x38, 0x91, 0x97,
+    0xCA, 0xCA, 0xA8, 0x5B, 0xC1, 0x04, 0x0D, 0xEA, 0x9C, 0x3D, 0xE0, 0x39,
+    0xD3, 0x4C, 0x58, 0xB3, 0x01, 0x79, 0x1D, 0x22, 0xC8, 0x77, 0x54, 0x72,
+    0x90, 0x21, 0x23, 0x0E, 0xCA, 0x8A, 0x48, 0x61, 0xD4, 0x96, 0x8D, 0xC5,
+    0x9C, 0x3A, 0x21, 0x3E, 0xEE, 0x95, 0x94, 0x0D, 0x17, 0x5D, 0x4D, 0x8F,
+    0xD8, 0xB5, 0x16, 0xA5, 0x35, 0x6D, 0x4A, 0xFC, 0xE5, 0x55, 0x9F, 0x45,
+    0xF3, 0x1B, 0xF6, 0x1B, 0x65, 0xDF, 0x47, 0x75, 0x70, 0x7F, 0x3E, 0x74,
+    0x7B, 0x76, 0x4B, 0x63, 0x18, 0x5D, 0x86, 0x82, 0x88, 0x68, 0x38, 0x8B,
+    0x64, 0x7C, 0x56, 0x8F, 0x30, 0x91, 0x25, 0x93, 0x5A, 0x95, 0x24, 0x97,
+    0x31, 0x99, 0x9D, 0x16, 0xA0, 0x41, 0x87, 0x3D, 0x89, 0x17, 0xA2, 0x65,
+    0xA6, 0xA1, 0xAA, 0xA3, 0x8D, 0xA5, 0x9B, 0x40, 0x98, 0xA4, 0x60, 0xAC,
+    0x2A, 0x6F, 0x1B, 0x83, 0x7A, 0x92, 0x1E, 0xB7, 0x1F, 0xB9, 0x3F, 0x81,
+    0x0C, 0xBD, 0x27, 0x8E, 0x6E, 0xC1, 0x0B, 0xC3, 0x2B, 0xBF, 0xC9, 0xC9,
+    0x79, 0xC0, 0x8C, 0xC2, 0xC7, 0xC4, 0xAF, 0xC6, 0xD0, 0xC8, 0xD2, 0xCA,
+    0xC5, 0x80, 0xD6, 0x0A, 0x09, 0x00, 0x21, 0xF9, 0x04, 0x05, 0x0A, 0x00,
+    0x00, 0x00, 0x2C, 0x12, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0A, 0x00, 0x00,
+    0x03, 0x14, 0x08, 0x55, 0xCA, 0xDB, 0x2F, 0x3A, 0xD7, 0x6A, 0xB4, 0x13,
+    0x66, 0xA9, 0xB0, 0xF5, 0x12, 0x27, 0x82, 0x94, 0x38, 0x25, 0x00, 0x3B,
+};
@@ -0,0 +1,457 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unity.h>
+#include <LittleFS.h>
+#include "display.h"
+#include "logger.h"
+#include "host_bench.h"
+#include "images.h"
+
+// ============================================================
+// Display capture tests: every screen rendered on the host through
+// BusTrace, compared pixel for pixel against the goldens in golden/
+// ============================================================
+//
+//   pio test -e native_display -v
+//
+// A missing golden fails the test, with the render written next to where
+// it should be as <name>.actual.ppm. SMALLTV_RECORD=1 records every golden
+// from the current renders instead (those tests report as ignored); do
+// that after an intended visual change and commit the files.
+//
+// Each pass also reports what it cost on the wire: bytes, address
+// windows and bus transactions, the same figures as /api/perf. The
+// tests run in order and each starts from the screen the last one left,
+// so the page transitions are part of what gets measured.
+
+static const int   W = DISPLAY_WIDTH;
+static const int   H = DISPLAY_HEIGHT;
+static const char* GOLDEN_DIR = "test/test_display/golden";     // pio test runs from the project root
+
+static const int64_t T0_MS = 1773482910000LL;       // Sat 2026-03-14 10:08:30 UTC
+
+static uint16_t     panel[W * H];
+static DisplayState state;
+static int64_t      clockMs = T0_MS;
+
+void setUp() {}
+void tearDown() {}
+
+// --- Helpers ---
+
+// Move the wall clock and virtual millis() together, then run a pass
+static void stepAfter(uint32_t ms) {
+    clockMs += ms;
+    hostAdvanceMs(ms);
+    displayTraceSetClock(clockMs);
+    displayTraceStep();
+}
+
+static void reportPass(const char* name) {
+    const DisplayBusStats& bus = displayGetBusStats();
+    BENCH_REPORT("%-16s %7u bytes %4u windows %4u transactions",
+                 name, bus.lastBytes, bus.lastAddrWindows, bus.lastTransactions);
+}
+
+// The panel as a PPM, through BusTrace::writePPM()
+static long renderPPM(char** out) {
+    FILE* f = tmpfile();
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_TRUE(displayGetLCD()->busTrace().writePPM(f, 0, 0, W, H));
+    long len = ftell(f);
+    *out = (char*)malloc(len);
+    rewind(f);
+    TEST_ASSERT_EQUAL_INT(1, (int)fread(*out, len, 1, f));
+    fclose(f);
+    return len;
+}
+
+static long readFile(const char* path, char** out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    rewind(f);
+    *out = (char*)malloc(len);
+    bool ok = fread(*out, len, 1, f) == 1;
+    fclose(f);
+    if (!ok) { free(*out); return -1; }
+    return len;
+}
+
+static bool writeFile(const char* path, const char* data, long len) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(data, len, 1, f) == 1;
+    fclose(f);
+    return ok;
+}
+
+// Compare the panel against golden/<name>.ppm. Returns false when the
+// golden was recorded instead (SMALLTV_RECORD), so the caller can finish
+// its passes before reporting the test as ignored.
+static bool matchGolden(const char* name) {
+    char path[160];
+    snprintf(path, sizeof(path), "%s/%s.ppm", GOLDEN_DIR, name);
+    char actualPath[176];
+    snprintf(actualPath, sizeof(actualPath), "%s/%s.actual.ppm", GOLDEN_DIR, name);
+
+    char* actual = nullptr;
+    long  actualLen = renderPPM(&actual);
+
+    if (getenv("SMALLTV_RECORD")) {
+        mkdir(GOLDEN_DIR, 0755);
+        bool ok = writeFile(path, actual, actualLen);
+        free(actual);
+        TEST_ASSERT_TRUE_MESSAGE(ok, "cannot write golden");
+        return false;
+    }
+
+    char* golden = nullptr;
+    long  goldenLen = readFile(path, &golden);
+    if (goldenLen < 0) {
+        mkdir(GOLDEN_DIR, 0755);
+        writeFile(actualPath, actual, actualLen);
+        free(actual);
+
+        char msg[240];
+        snprintf(msg, sizeof(msg), "no golden for %s (render in %s); record it with SMALLTV_RECORD=1",
+                 name, actualPath);
+        TEST_FAIL_MESSAGE(msg);
+    }
+
+    bool same = goldenLen == actualLen && memcmp(golden, actual, actualLen) == 0;
+    if (!same) {
+        long diff = 0;
+        long n = goldenLen < actualLen ? goldenLen : actualLen;
+        for (long i = 0; i < n; i += 3) {
+            if (memcmp(golden + i, actual + i, 3) != 0) diff++;
+        }
+        writeFile(actualPath, actual, actualLen);
+
+        char msg[240];
+        snprintf(msg, sizeof(msg), "%s differs from its golden in %ld pixels, see %s",
+                 name, diff, actualPath);
+        free(golden);
+        free(actual);
+        TEST_FAIL_MESSAGE(msg);
+    }
+    free(golden);
+    free(actual);
+    return true;
+}
+
+static void finish(bool matched, const char* name) {
+    if (!matched) {
+        char msg[120];
+        snprintf(msg, sizeof(msg), "recorded golden/%s.ppm, commit it", name);
+        TEST_IGNORE_MESSAGE(msg);
+    }
+}
+
+static void initState() {
+    memset(&state, 0, sizeof(state));
+    state.wifiConnected = true;
+    strcpy(state.ssid, "SmallTV-Lab");
+    strcpy(state.ip, "192.168.1.42");
+    strcpy(state.mac, "24:6F:28:A1:B2:C3");
+    state.rssi           = -58;
+    state.freeHeapKB     = 142;
+    state.largestBlockKB = 96;
+    state.otaConfirmed   = true;
+    state.loopsPerSec    = 980;
+    state.worstLoopUs    = 1800;
+    state.weather.temperature = 21.5f;
+    state.weather.weatherCode = 2;
+    state.weather.icon        = ICON_PARTLY_CLOUDY;
+    state.weather.isDay       = true;
+    state.weather.valid       = true;
+    state.weather.lastFetchMs = 1000;
+}
+
+// --- Screens ---
+
+static void test_clock_page() {
+    displaySetPage(PAGE_CLOCK_WEATHER);
+    stepAfter(0);
+    reportPass("clock enter");
+    bool matched = matchGolden("clock");
+
+    stepAfter(30000);                   // 10:08:30 -> 10:09:00
+    reportPass("clock minute");
+    finish(matched, "clock");
+}
+
+static void test_analog_page() {
+    displaySetPage(PAGE_ANALOG_CLOCK);
+    stepAfter(0);
+    reportPass("analog enter");
+    bool matched = matchGolden("analog");
+
+    stepAfter(DISPLAY_ANALOG_STEP_MS);
+    reportPass("analog step");
+    stepAfter(1000 - DISPLAY_ANALOG_STEP_MS);
+    reportPass("analog second");
+    finish(matched, "analog");
+}
+
+static void test_sysinfo_page() {
+    displaySetPage(PAGE_SYSTEM_INFO);
+    stepAfter(0);
+    reportPass("sysinfo enter");
+    bool matched = matchGolden("sysinfo");
+
+    state.freeHeapKB = 139;
+    state.rssi       = -61;
+    displayPublish(state);
+    stepAfter(0);
+    reportPass("sysinfo update");
+    finish(matched, "sysinfo");
+}
+
+static void test_console_page() {
+    displaySetPage(PAGE_LOG);
+    stepAfter(0);
+    reportPass("console enter");
+    bool matched = matchGolden("console");
+
+    logPrintf("Weather: 21.5C Partly Cloudy");
+    stepAfter(0);
+    reportPass("console line");
+    finish(matched, "console");
+}
+
+static void test_ap_screen() {
+    displaySetPage(PAGE_CLOCK_WEATHER);
+    state.apMode        = true;
+    state.wifiConnected = false;
+    strcpy(state.ssid, "SmallTV-A1B2C3");
+    strcpy(state.ip, "192.168.4.1");
+    displayPublish(state);
+    stepAfter(0);
+    reportPass("ap enter");
+    bool matched = matchGolden("ap");
+
+    initState();
+    displayPublish(state);
+    stepAfter(0);
+    reportPass("ap leave");
+    finish(matched, "ap");
+}
+
+static void test_ota_overlay() {
+    displayRenderOTAProgress(40);
+    stepAfter(0);
+    reportPass("ota enter");
+    bool matched = matchGolden("ota");
+
+    displayRenderOTAProgress(41);
+    stepAfter(0);
+    reportPass("ota percent");
+    displayClearOverlay();
+    stepAfter(0);
+    finish(matched, "ota");
+}
+
+static void test_message_overlay() {
+    displayRenderMessage("Waiting for NTP...");
+    stepAfter(0);
+    reportPass("message enter");
+    bool matched = matchGolden("message");
+
+    displayRenderMessage("Connecting to WiFi...");
+    stepAfter(0);
+    reportPass("message change");
+    displayClearOverlay();
+    stepAfter(0);
+    finish(matched, "message");
+}
+
+// A photo from RAM, as photo.cpp hands over files it prefetched. The
+// display takes the copy and frees it after the decode.
+static void showPhoto(const char* path, const uint8_t* data, uint32_t len,
+                      DisplayPhotoFormat format) {
+    DisplayPhoto p;
+    memset(&p, 0, sizeof(p));
+    snprintf(p.path, sizeof(p.path), "%s", path);
+    p.data = (uint8_t*)malloc(len);
+    memcpy(p.data, data, len);
+    p.len    = len;
+    p.format = format;
+    TEST_ASSERT_TRUE(displayShowPhoto(p));
+}
+
+static void test_photo_jpeg() {
+    displaySetPage(PAGE_PHOTO);
+    showPhoto("/photos/lab.jpg", PHOTO_JPG, sizeof(PHOTO_JPG), DISPLAY_PHOTO_JPEG);
+    stepAfter(0);
+    reportPass("photo jpeg");
+    bool matched = matchGolden("photo_jpeg");
+
+    TEST_ASSERT_EQUAL_UINT32(1, displayGetPhotoStats().fromRam);
+    TEST_ASSERT_EQUAL_UINT32(0, displayGetPhotoStats().failures);
+    finish(matched, "photo_jpeg");
+}
+
+static void test_photo_png() {
+    showPhoto("/photos/lab.png", PHOTO_PNG, sizeof(PHOTO_PNG), DISPLAY_PHOTO_PNG);
+    stepAfter(0);
+    reportPass("photo png");
+    bool matched = matchGolden("photo_png");
+
+    TEST_ASSERT_EQUAL_UINT32(2, displayGetPhotoStats().fromRam);
+    TEST_ASSERT_EQUAL_UINT32(0, displayGetPhotoStats().failures);
+    finish(matched, "photo_png");
+}
+
+// The GIF page lists PHOTO_DIR, so the file goes on the host filesystem
+static void test_gif_page() {
+    hostFsAdd(PHOTO_DIR "/anim.gif", ANIM_GIF, sizeof(ANIM_GIF));
+    displaySetPage(PAGE_GIF);
+    stepAfter(0);
+    reportPass("gif enter");
+    TEST_ASSERT_EQUAL_UINT16(1, displayGetGifStats().files);
+    TEST_ASSERT_EQUAL_UINT32(1, displayGetGifStats().shown);
+    bool matched = matchGolden("gif");
+
+    stepAfter(100);                     // Second frame: the sub-rectangle
+    reportPass("gif frame");
+    TEST_ASSERT_EQUAL_UINT32(2, displayGetGifStats().shown);
+    TEST_ASSERT_EQUAL_UINT32(12 * 10, displayGetGifStats().lastPixels);
+    matched = matchGolden("gif_frame2") && matched;
+    finish(matched, "gif");
+}
+
+// Tiles in the four corners and a diagonal band, then one tile changed
+static void fillTile(DisplayTile& t, int tx, int ty, uint16_t color) {
+    t.tx = tx;
+    t.ty = ty;
+    for (int i = 0; i < DISPLAY_TILE_SIZE * DISPLAY_TILE_SIZE; i++) {
+        t.px[i * 2]     = color >> 8;       // Big-endian, as on the wire
+        t.px[i * 2 + 1] = color & 0xFF;
+    }
+}
+
+static void test_remote_screen() {
+    static const int TILES = DISPLAY_WIDTH / DISPLAY_TILE_SIZE;
+    static DisplayTile t;
+
+    displaySetRemote(true);
+    stepAfter(0);
+    for (int i = 0; i < TILES; i++) {
+        fillTile(t, i, i, 0x07E0);
+        TEST_ASSERT_TRUE(displayPushTile(t));
+        if (i % 8 == 7) stepAfter(0);   // Let the render task stage them, as the ring is 16 deep
+    }
+    const int corners[4][2] = { { 0, 0 }, { TILES - 1, 0 }, { 0, TILES - 1 }, { TILES - 1, TILES - 1 } };
+    for (const auto& c : corners) {
+        fillTile(t, c[0], c[1], 0xF800);
+        TEST_ASSERT_TRUE(displayPushTile(t));
+    }
+    displayPresentTiles();
+    stepAfter(0);
+    reportPass("remote frame");
+    bool matched = matchGolden("remote");
+
+    fillTile(t, 7, 3, 0x001F);
+    TEST_ASSERT_TRUE(displayPushTile(t));
+    displayPresentTiles();
+    stepAfter(0);
+    reportPass("remote tile");
+
+    displaySetRemote(false);
+    stepAfter(0);
+    finish(matched, "remote");
+}
+
+// --- Benchmark ---
+// Minute ticks drawn from the digit atlas and from the full Font7 string.
+// Both must leave the same pixels on the panel; the atlas should send
+// only the cells that changed.
+
+struct MinuteTick {
+    const char* from;
+    int         hour, minute;       // Last minute before the tick
+};
+
+static const int64_t DAY_MS = T0_MS - (10 * 3600 + 8 * 60 + 30) * 1000LL;   // 2026-03-14 00:00
+
+// Bus pixels for one tick, leaving the panel showing the new minute
+static uint64_t tickPixels(const MinuteTick& t, bool atlas, double* ns) {
+    displayTraceUseAtlas(atlas);
+    clockMs = DAY_MS + ((t.hour * 60 + t.minute) * 60 + 59) * 1000LL + 500;
+    stepAfter(0);                       // Clock jump: draws the old minute
+
+    uint64_t before = displayGetLCD()->busTrace().stats().pixels;
+    *ns = benchNsPerIter(1, [](uint32_t) { stepAfter(500); });
+    return displayGetLCD()->busTrace().stats().pixels - before;
+}
+
+static void test_bench_clock_atlas() {
+    static const MinuteTick ticks[] = {
+        { "10:09", 10, 9 }, { "10:59", 10, 59 }, { "19:59", 19, 59 }, { "23:59", 23, 59 },
+    };
+    static uint16_t atlasPanel[W * H];
+
+    displaySetPage(PAGE_CLOCK_WEATHER);
+    stepAfter(0);
+
+    uint64_t atlasTotal = 0, fontTotal = 0;
+    for (const MinuteTick& t : ticks) {
+        double atlasNs, fontNs;
+        uint64_t atlasPx = tickPixels(t, true, &atlasNs);
+        memcpy(atlasPanel, panel, sizeof(panel));
+        uint64_t fontPx = tickPixels(t, false, &fontNs);
+
+        int diff = 0;
+        for (int i = 0; i < W * H; i++) {
+            if (atlasPanel[i] != panel[i]) diff++;
+        }
+        BENCH_REPORT("after %s  atlas %6llu px %8.0f ns   font7 %6llu px %8.0f ns",
+                     t.from, (unsigned long long)atlasPx, atlasNs,
+                     (unsigned long long)fontPx, fontNs);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, diff, "atlas and Font7 digits differ on the panel");
+        TEST_ASSERT_TRUE_MESSAGE(atlasPx <= fontPx, "atlas sent more pixels than Font7");
+
+        atlasTotal += atlasPx;
+        fontTotal  += fontPx;
+    }
+    displayTraceUseAtlas(true);
+
+    // RGB565: two bytes on the bus per pixel
+    const int n = sizeof(ticks) / sizeof(ticks[0]);
+    BENCH_REPORT("minute ticks: atlas %llu px, font7 %llu px (%.0f%%); "
+                 "per tick atlas %llu bytes, font7 %llu bytes",
+                 (unsigned long long)atlasTotal, (unsigned long long)fontTotal,
+                 fontTotal ? 100.0 * atlasTotal / fontTotal : 0.0,
+                 (unsigned long long)(atlasTotal * 2 / n), (unsigned long long)(fontTotal * 2 / n));
+}
+
+int main(int argc, char** argv) {
+    setenv("TZ", "UTC0", 1);
+    tzset();
+
+    displayGetLCD()->busTrace().attachFramebuffer(panel, W, H);
+    displayTraceSetClock(clockMs);
+    displayInit();
+    initState();
+    displayPublish(state);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_clock_page);
+    RUN_TEST(test_analog_page);
+    RUN_TEST(test_sysinfo_page);
+    RUN_TEST(test_console_page);
+    RUN_TEST(test_ap_screen);
+    RUN_TEST(test_ota_overlay);
+    RUN_TEST(test_message_overlay);
+    RUN_TEST(test_photo_jpeg);
+    RUN_TEST(test_photo_png);
+    RUN_TEST(test_gif_page);
+    RUN_TEST(test_remote_screen);
+    RUN_TEST(test_bench_clock_atlas);
+    return UNITY_END();
+}
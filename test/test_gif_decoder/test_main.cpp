@@ -0,0 +1,448 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include "gif_decoder.h"
+#include "host_bench.h"
+
+// ============================================================
+// GIF decoder tests: sub-rectangle frames, transparency, interlacing,
+// code growth to 12 bits, malformed and oversized files, and a benchmark
+// of one full-screen frame
+// ============================================================
+
+static const int MAX_W = GIF_MAX_WIDTH;
+static const int MAX_H = GIF_MAX_HEIGHT;
+
+// Written by a small LZW script and checked against Pillow. Palette:
+// 0 black, 1 red, 2 green, 3 blue.
+
+// 8x6. Frame 1 is (x + y) % 4, 100 ms, kept. Frame 2 is a 3x2 patch at
+// (2,1), 250 ms, disposed to background.
+static const uint8_t SUBRECT_GIF[] = {
+    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x08, 0x00, 0x06, 0x00, 0x81, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x21, 0xF9, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x02, 0x0C, 0x44, 0x34, 0x86,
+    0x97, 0x0C, 0xA8, 0x5A, 0x83, 0x27, 0x46, 0xE7, 0x0A, 0x00, 0x21, 0xF9,
+    0x04, 0x08, 0x19, 0x00, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x03, 0x9C, 0x6C, 0x05, 0x00, 0x3B,
+};
+
+// 6x4. Frame 1 is all red; frame 2 is green on odd (x + y) with index 0
+// transparent everywhere else.
+static const uint8_t TRANSPARENT_GIF[] = {
+    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x06, 0x00, 0x04, 0x00, 0x81, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x21, 0xF9, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x02, 0x04, 0x8C, 0x8F, 0xA9,
+    0x57, 0x00, 0x21, 0xF9, 0x04, 0x05, 0x0A, 0x00, 0x00, 0x00, 0x2C, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x02, 0x06, 0x84, 0x6C,
+    0xA7, 0x80, 0xBA, 0x57, 0x00, 0x3B,
+};
+
+// 5x11, interlaced: (x + 2y) % 4. Eleven rows reach all four passes.
+static const uint8_t INTERLACED_GIF[] = {
+    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x05, 0x00, 0x0B, 0x00, 0x81, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x21, 0xF9, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x0B, 0x00, 0x40, 0x02, 0x0E, 0x44, 0x34, 0x60,
+    0xA8, 0x97, 0xFB, 0x5C, 0x63, 0xEC, 0x54, 0x71, 0x73, 0x3A, 0x05, 0x00,
+    0x3B,
+};
+
+// --- In-memory file ---
+
+struct Source {
+    const uint8_t* data;
+    uint32_t       len;
+    uint32_t       chunk;       // Largest read served, to exercise refills
+};
+
+static int32_t readSource(void* ctx, uint32_t offset, uint8_t* dst, uint32_t len) {
+    const Source& s = *(const Source*)ctx;
+    if (offset >= s.len) return 0;
+    if (len > s.len - offset) len = s.len - offset;
+    if (s.chunk && len > s.chunk) len = s.chunk;
+    memcpy(dst, s.data + offset, len);
+    return (int32_t)len;
+}
+
+// --- Canvas: rows composited the way the GIF page does ---
+
+static GifDecoder dec;
+static Source     src;
+static uint8_t    canvas[MAX_W * MAX_H];
+static int        rowOrder[MAX_H * 2];
+static int        rowCount;
+
+void setUp() {
+    memset(canvas, 0xEE, sizeof(canvas));
+    rowCount = 0;
+}
+
+void tearDown() {}
+
+static void drawRow(void* ctx, const GifFrame& f, int y, const uint8_t* idx) {
+    if (rowCount < (int)(sizeof(rowOrder) / sizeof(rowOrder[0]))) rowOrder[rowCount++] = y;
+    for (int i = 0; i < f.w; i++) {
+        if (idx[i] == f.transparent) continue;
+        canvas[y * dec.width + f.x + i] = idx[i];
+    }
+}
+
+static void openGif(const uint8_t* data, uint32_t len, uint32_t chunk = 0) {
+    src = { data, len, chunk };
+    TEST_ASSERT_TRUE(gifOpen(dec, readSource, &src));
+}
+
+static uint8_t at(int x, int y) {
+    return canvas[y * dec.width + x];
+}
+
+// --- LZW encoder for the large images ---
+// The same scheme as the script that made the fixtures: a clear code
+// first, codes widened when the table reaches the next power of two,
+// and a clear when it fills.
+
+struct GifWriter {
+    uint8_t* out;
+    size_t   len;
+    uint32_t bits;
+    int      nbits;
+    int      codeSize;
+    uint8_t  block[255];
+    int      blockLen;
+
+    void byte(uint8_t b) { out[len++] = b; }
+    void u16(uint16_t v) { byte(v & 0xFF); byte(v >> 8); }
+
+    void dataByte(uint8_t b) {
+        block[blockLen++] = b;
+        if (blockLen == 255) flushBlock();
+    }
+    void flushBlock() {
+        if (blockLen == 0) return;
+        byte((uint8_t)blockLen);
+        memcpy(out + len, block, blockLen);
+        len += blockLen;
+        blockLen = 0;
+    }
+    void code(int c) {
+        bits |= (uint32_t)c << nbits;
+        nbits += codeSize;
+        while (nbits >= 8) {
+            dataByte(bits & 0xFF);
+            bits >>= 8;
+            nbits -= 8;
+        }
+    }
+};
+
+// w x h, eight colours, one frame of indices (row-major). Returns the size.
+static size_t writeGif(uint8_t* out, int w, int h, const uint8_t* px) {
+    static int16_t table[GIF_LZW_CODES][8];     // Code + next index -> code
+    GifWriter g = {};
+    g.out = out;
+    memcpy(out, "GIF89a", 6);
+    g.len = 6;
+    g.u16(w);
+    g.u16(h);
+    g.byte(0x82);                                   // Global palette, 8 entries
+    g.byte(0);
+    g.byte(0);
+    for (int i = 0; i < 8; i++) {
+        g.byte(i & 1 ? 255 : 0);
+        g.byte(i & 2 ? 255 : 0);
+        g.byte(i & 4 ? 255 : 0);
+    }
+    g.byte(0x2C);
+    g.u16(0);
+    g.u16(0);
+    g.u16(w);
+    g.u16(h);
+    g.byte(0);
+    g.byte(3);                                      // Minimum code size
+
+    const int clear = 8, eoi = 9;
+    int next = eoi + 1;
+    g.codeSize = 4;
+    memset(table, 0xFF, sizeof(table));
+    g.code(clear);
+
+    int cur = px[0];
+    for (int i = 1; i < w * h; i++) {
+        int k = px[i];
+        if (table[cur][k] >= 0) {
+            cur = table[cur][k];
+            continue;
+        }
+        g.code(cur);
+        if (next < GIF_LZW_CODES) {
+            table[cur][k] = (int16_t)next++;
+            if (next > (1 << g.codeSize) && g.codeSize < 12) g.codeSize++;
+        } else {
+            g.code(clear);
+            memset(table, 0xFF, sizeof(table));
+            next = eoi + 1;
+            g.codeSize = 4;
+        }
+        cur = k;
+    }
+    g.code(cur);
+    g.code(eoi);
+    if (g.nbits > 0) g.dataByte(g.bits & 0xFF);
+    g.flushBlock();
+    g.byte(0);
+    g.byte(0x3B);
+    return g.len;
+}
+
+// Busy enough that the table fills and clears at least once
+static uint8_t pattern(int x, int y) {
+    return (uint8_t)((((x ^ y) >> 2) + ((x * y) >> 7)) & 7);
+}
+
+static uint8_t  bigPx[MAX_W * MAX_H];
+static uint8_t  bigGif[96 * 1024];
+static size_t   bigLen;
+
+static void makeBigGif() {
+    for (int y = 0; y < MAX_H; y++) {
+        for (int x = 0; x < MAX_W; x++) bigPx[y * MAX_W + x] = pattern(x, y);
+    }
+    bigLen = writeGif(bigGif, MAX_W, MAX_H, bigPx);
+}
+
+// A logical screen of w x h with no palette and nothing after it
+static void screenHeader(uint8_t* out, uint16_t w, uint16_t h) {
+    memcpy(out, "GIF89a", 6);
+    out[6] = w & 0xFF;  out[7] = w >> 8;
+    out[8] = h & 0xFF;  out[9] = h >> 8;
+    out[10] = out[11] = out[12] = 0;
+    out[13] = 0x3B;
+}
+
+// 4x1, four colours, one image whose LZW data is the given bytes
+static size_t oneImage(uint8_t* out, const uint8_t* lzw, uint8_t lzwLen) {
+    static const uint8_t head[] = {
+        'G', 'I', 'F', '8', '9', 'a', 4, 0, 1, 0, 0x81, 0, 0,
+        0, 0, 0,  255, 0, 0,  0, 255, 0,  0, 0, 255,
+        0x2C, 0, 0, 0, 0, 4, 0, 1, 0, 0,
+        2,                                          // Minimum code size
+    };
+    size_t len = sizeof(head);
+    memcpy(out, head, len);
+    out[len++] = lzwLen;
+    memcpy(out + len, lzw, lzwLen);
+    len += lzwLen;
+    out[len++] = 0;
+    out[len++] = 0x3B;
+    return len;
+}
+
+// --- Frames ---
+
+static void test_full_frame_then_sub_rect() {
+    openGif(SUBRECT_GIF, sizeof(SUBRECT_GIF));
+    TEST_ASSERT_EQUAL_UINT16(8, dec.width);
+    TEST_ASSERT_EQUAL_UINT16(6, dec.height);
+
+    GifFrame f;
+    TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+    TEST_ASSERT_EQUAL_UINT16(0, f.x);
+    TEST_ASSERT_EQUAL_UINT16(8, f.w);
+    TEST_ASSERT_EQUAL_UINT16(6, f.h);
+    TEST_ASSERT_EQUAL_UINT16(100, f.delayMs);
+    TEST_ASSERT_EQUAL_INT(GIF_DISPOSE_KEEP, f.disposal);
+    TEST_ASSERT_EQUAL_INT(GIF_NO_TRANSPARENT, f.transparent);
+    TEST_ASSERT_EQUAL_HEX16(0xF800, f.palette[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x07E0, f.palette[2]);
+    TEST_ASSERT_EQUAL_HEX16(0x001F, f.palette[3]);
+    TEST_ASSERT_EQUAL_INT(6, rowCount);
+    for (int y = 0; y < 6; y++) {
+        for (int x = 0; x < 8; x++) TEST_ASSERT_EQUAL_UINT8((x + y) % 4, at(x, y));
+    }
+
+    rowCount = 0;
+    TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+    TEST_ASSERT_EQUAL_UINT16(2, f.x);
+    TEST_ASSERT_EQUAL_UINT16(1, f.y);
+    TEST_ASSERT_EQUAL_UINT16(3, f.w);
+    TEST_ASSERT_EQUAL_UINT16(2, f.h);
+    TEST_ASSERT_EQUAL_UINT16(250, f.delayMs);
+    TEST_ASSERT_EQUAL_INT(GIF_DISPOSE_BACKGROUND, f.disposal);
+
+    // Only the patch's two rows are emitted, and only its columns change
+    TEST_ASSERT_EQUAL_INT(2, rowCount);
+    TEST_ASSERT_EQUAL_INT(1, rowOrder[0]);
+    TEST_ASSERT_EQUAL_INT(2, rowOrder[1]);
+    static const uint8_t patch[2][3] = { { 3, 2, 3 }, { 2, 3, 2 } };
+    for (int y = 0; y < 6; y++) {
+        for (int x = 0; x < 8; x++) {
+            bool in = x >= 2 && x < 5 && y >= 1 && y < 3;
+            TEST_ASSERT_EQUAL_UINT8(in ? patch[y - 1][x - 2] : (x + y) % 4, at(x, y));
+        }
+    }
+
+    TEST_ASSERT_EQUAL_INT(GIF_END, gifNextFrame(dec, f, drawRow, nullptr));
+}
+
+static void test_transparent_pixels_are_left_alone() {
+    openGif(TRANSPARENT_GIF, sizeof(TRANSPARENT_GIF));
+    GifFrame f;
+    TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+    TEST_ASSERT_EQUAL_INT(GIF_NO_TRANSPARENT, f.transparent);
+    TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+    TEST_ASSERT_EQUAL_INT(0, f.transparent);
+
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 6; x++) TEST_ASSERT_EQUAL_UINT8((x + y) % 2 ? 2 : 1, at(x, y));
+    }
+}
+
+// The control extension covers one image: the next has none
+static void test_transparency_does_not_carry_over() {
+    openGif(TRANSPARENT_GIF, sizeof(TRANSPARENT_GIF));
+    GifFrame f;
+    gifNextFrame(dec, f, drawRow, nullptr);
+    gifNextFrame(dec, f, drawRow, nullptr);
+    TEST_ASSERT_EQUAL_INT(GIF_END, gifNextFrame(dec, f, drawRow, nullptr));
+    gifRewind(dec);
+    TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+    TEST_ASSERT_EQUAL_INT(GIF_NO_TRANSPARENT, f.transparent);
+}
+
+static void test_interlaced_rows_come_in_pass_order() {
+    openGif(INTERLACED_GIF, sizeof(INTERLACED_GIF));
+    GifFrame f;
+    TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+    TEST_ASSERT_TRUE(f.interlaced);
+
+    static const int order[] = { 0, 8, 4, 2, 6, 10, 1, 3, 5, 7, 9 };
+    TEST_ASSERT_EQUAL_INT(11, rowCount);
+    TEST_ASSERT_EQUAL_INT_ARRAY(order, rowOrder, 11);
+    for (int y = 0; y < 11; y++) {
+        for (int x = 0; x < 5; x++) TEST_ASSERT_EQUAL_UINT8((x + 2 * y) % 4, at(x, y));
+    }
+}
+
+// --- Code growth ---
+
+// Widths from 4 to 12 bits and a full table, read a few bytes at a time
+static void test_full_screen_round_trip() {
+    makeBigGif();
+    static const uint32_t chunks[] = { 0, 7, 255 };
+    for (uint32_t chunk : chunks) {
+        setUp();
+        openGif(bigGif, (uint32_t)bigLen, chunk);
+        GifFrame f;
+        TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+        TEST_ASSERT_EQUAL_INT(MAX_H, rowCount);
+        TEST_ASSERT_EQUAL_MEMORY(bigPx, canvas, MAX_W * MAX_H);
+        TEST_ASSERT_EQUAL_INT(GIF_END, gifNextFrame(dec, f, drawRow, nullptr));
+    }
+}
+
+// --- Malformed ---
+
+static void test_truncated_data_is_an_error() {
+    makeBigGif();
+    const uint32_t cuts[] = { (uint32_t)bigLen / 2, (uint32_t)bigLen - 40 };
+    for (uint32_t cut : cuts) {
+        openGif(bigGif, cut);
+        GifFrame f;
+        TEST_ASSERT_EQUAL_INT(GIF_ERROR, gifNextFrame(dec, f, drawRow, nullptr));
+    }
+}
+
+static void test_bad_codes_are_an_error() {
+    uint8_t gif[64];
+    GifFrame f;
+
+    // Clear, then code 7: past the table with nothing decoded yet
+    static const uint8_t beforeTable[] = { 0x3C };
+    openGif(gif, (uint32_t)oneImage(gif, beforeTable, sizeof(beforeTable)));
+    TEST_ASSERT_EQUAL_INT(GIF_ERROR, gifNextFrame(dec, f, drawRow, nullptr));
+
+    // Clear, 1, then 7 while the next free code is 6
+    static const uint8_t pastNext[] = { 0xCC, 0x01 };
+    openGif(gif, (uint32_t)oneImage(gif, pastNext, sizeof(pastNext)));
+    TEST_ASSERT_EQUAL_INT(GIF_ERROR, gifNextFrame(dec, f, drawRow, nullptr));
+
+    // Control: clear, 1, 6 (the KwKwK case), end: pixels 1 1 1, short of 4
+    static const uint8_t kwkwk[] = { 0x8C, 0x0B };
+    setUp();
+    openGif(gif, (uint32_t)oneImage(gif, kwkwk, sizeof(kwkwk)));
+    TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+}
+
+static void test_unknown_block_is_an_error() {
+    uint8_t gif[64];
+    static const uint8_t lzw[] = { 0x8C, 0x0B };
+    size_t len = oneImage(gif, lzw, sizeof(lzw));
+    gif[len - 1] = 0x42;                            // Not a trailer, image or extension
+    openGif(gif, (uint32_t)len);
+    GifFrame f;
+    TEST_ASSERT_EQUAL_INT(GIF_FRAME, gifNextFrame(dec, f, drawRow, nullptr));
+    TEST_ASSERT_EQUAL_INT(GIF_ERROR, gifNextFrame(dec, f, drawRow, nullptr));
+}
+
+static void test_open_rejects_bad_screens() {
+    uint8_t hdr[14];
+    struct { uint16_t w, h; bool ok; } cases[] = {
+        { MAX_W, MAX_H, true },
+        { MAX_W + 1, 10, false },
+        { 10, MAX_H + 1, false },
+        { 0, 10, false },
+        { 10, 0, false },
+        { 65535, 65535, false },
+    };
+    for (const auto& c : cases) {
+        screenHeader(hdr, c.w, c.h);
+        src = { hdr, sizeof(hdr), 0 };
+        TEST_ASSERT_EQUAL(c.ok, gifOpen(dec, readSource, &src));
+    }
+
+    screenHeader(hdr, 10, 10);
+    memcpy(hdr, "PNG89a", 6);
+    src = { hdr, sizeof(hdr), 0 };
+    TEST_ASSERT_FALSE(gifOpen(dec, readSource, &src));
+
+    src = { SUBRECT_GIF, 20, 0 };                   // Cut inside the palette
+    TEST_ASSERT_FALSE(gifOpen(dec, readSource, &src));
+}
+
+// --- Benchmark ---
+
+static void noRow(void*, const GifFrame&, int y, const uint8_t* idx) {
+    benchSink += idx[y % 8];
+}
+
+static void test_bench_full_screen_frame() {
+    makeBigGif();
+    src = { bigGif, (uint32_t)bigLen, 0 };
+    TEST_ASSERT_TRUE(gifOpen(dec, readSource, &src));
+
+    double ns = benchNsPerIter(50, [](uint32_t) {
+        GifFrame f;
+        gifRewind(dec);
+        gifNextFrame(dec, f, noRow, nullptr);
+    });
+    BENCH_REPORT("%dx%d frame, %u bytes: %.0f us (%.1f ns/pixel)",
+                 MAX_W, MAX_H, (unsigned)bigLen, ns / 1000, ns / (MAX_W * MAX_H));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_full_frame_then_sub_rect);
+    RUN_TEST(test_transparent_pixels_are_left_alone);
+    RUN_TEST(test_transparency_does_not_carry_over);
+    RUN_TEST(test_interlaced_rows_come_in_pass_order);
+    RUN_TEST(test_full_screen_round_trip);
+    RUN_TEST(test_truncated_data_is_an_error);
+    RUN_TEST(test_bad_codes_are_an_error);
+    RUN_TEST(test_unknown_block_is_an_error);
+    RUN_TEST(test_open_rejects_bad_screens);
+    RUN_TEST(test_bench_full_screen_frame);
+    return UNITY_END();
+}
@@ -0,0 +1,146 @@
+#include <unity.h>
+#include "histogram.h"
+#include "host_bench.h"
+
+// ============================================================
+// Histogram tests: bucket edges, the open top bucket, min/max/mean,
+// percentiles and their clamp to the maximum, and a benchmark of
+// histogramAdd() as the render and loop timers call it
+// ============================================================
+
+static Histogram h;
+
+void setUp() {
+    histogramInit(h);
+}
+
+void tearDown() {}
+
+// Bucket a lone value landed in
+static int bucketOf(uint32_t value) {
+    Histogram one;
+    histogramInit(one);
+    histogramAdd(one, value);
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+        if (one.buckets[b]) return b;
+    }
+    return -1;
+}
+
+// --- Buckets ---
+
+static void test_bucket_edges() {
+    TEST_ASSERT_EQUAL_INT(0, bucketOf(0));
+    TEST_ASSERT_EQUAL_INT(0, bucketOf(1));
+    TEST_ASSERT_EQUAL_INT(1, bucketOf(2));
+    TEST_ASSERT_EQUAL_INT(1, bucketOf(3));
+    TEST_ASSERT_EQUAL_INT(2, bucketOf(4));
+    for (int b = 1; b < HISTOGRAM_BUCKETS - 1; b++) {
+        TEST_ASSERT_EQUAL_INT(b, bucketOf(1u << b));
+        TEST_ASSERT_EQUAL_INT(b, bucketOf((2u << b) - 1));
+    }
+}
+
+static void test_top_bucket_is_open() {
+    const int top = HISTOGRAM_BUCKETS - 1;
+    TEST_ASSERT_EQUAL_INT(top, bucketOf(1u << top));
+    TEST_ASSERT_EQUAL_INT(top, bucketOf(UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, histogramBucketLimit(top));
+}
+
+// Each bucket's limit is where the next one starts
+static void test_limits_are_exclusive_upper_bounds() {
+    TEST_ASSERT_EQUAL_UINT32(2, histogramBucketLimit(0));
+    for (int b = 0; b < HISTOGRAM_BUCKETS - 1; b++) {
+        uint32_t limit = histogramBucketLimit(b);
+        TEST_ASSERT_EQUAL_INT(b, bucketOf(limit - 1));
+        TEST_ASSERT_EQUAL_INT(b + 1, bucketOf(limit));
+    }
+}
+
+// --- Summary ---
+
+static void test_empty_histogram_reports_zero() {
+    TEST_ASSERT_EQUAL_UINT32(0, h.count);
+    TEST_ASSERT_EQUAL_UINT32(0, histogramMean(h));
+    TEST_ASSERT_EQUAL_UINT32(0, histogramPercentile(h, 50));
+    TEST_ASSERT_EQUAL_UINT32(0, histogramPercentile(h, 99));
+}
+
+static void test_min_max_mean() {
+    histogramAdd(h, 700);
+    histogramAdd(h, 40);
+    histogramAdd(h, 0);
+    histogramAdd(h, 1260);
+    TEST_ASSERT_EQUAL_UINT32(4, h.count);
+    TEST_ASSERT_EQUAL_UINT32(0, h.min);
+    TEST_ASSERT_EQUAL_UINT32(1260, h.max);
+    TEST_ASSERT_EQUAL_UINT32(500, histogramMean(h));
+}
+
+// A sum of large values does not wrap at 32 bits
+static void test_sum_holds_large_values() {
+    for (int i = 0; i < 10; i++) histogramAdd(h, 4000000000u);
+    TEST_ASSERT_EQUAL_UINT64(40000000000ull, h.sum);
+    TEST_ASSERT_EQUAL_UINT32(4000000000u, histogramMean(h));
+}
+
+// --- Percentiles ---
+
+// 90 fast passes (100-127 us) and 10 slow ones (5000 us)
+static void test_percentiles_pick_the_bucket_holding_the_rank() {
+    for (int i = 0; i < 90; i++) histogramAdd(h, 100 + (i % 28));
+    for (int i = 0; i < 10; i++) histogramAdd(h, 5000);
+
+    TEST_ASSERT_EQUAL_UINT32(128, histogramPercentile(h, 50));
+    TEST_ASSERT_EQUAL_UINT32(128, histogramPercentile(h, 90));
+    TEST_ASSERT_EQUAL_UINT32(5000, histogramPercentile(h, 91));     // Clamped to max
+    TEST_ASSERT_EQUAL_UINT32(5000, histogramPercentile(h, 99));
+    TEST_ASSERT_EQUAL_UINT32(5000, histogramPercentile(h, 100));
+}
+
+// Never more than a factor of two above the true value, never above max
+static void test_percentile_bounds() {
+    for (uint32_t v = 1; v <= 1000; v++) histogramAdd(h, v);
+    for (int pct = 1; pct <= 100; pct++) {
+        uint32_t exact = (uint32_t)(1000 * pct / 100);
+        uint32_t got   = histogramPercentile(h, pct);
+        TEST_ASSERT_TRUE(got >= exact);
+        TEST_ASSERT_TRUE(got <= 2 * exact);
+        TEST_ASSERT_TRUE(got <= h.max);
+    }
+}
+
+// The rank rounds up: with two values the median is the larger one's bucket
+static void test_small_counts_round_the_rank_up() {
+    histogramAdd(h, 3);
+    TEST_ASSERT_EQUAL_UINT32(3, histogramPercentile(h, 1));
+    histogramAdd(h, 300);
+    TEST_ASSERT_EQUAL_UINT32(4, histogramPercentile(h, 50));
+    TEST_ASSERT_EQUAL_UINT32(300, histogramPercentile(h, 51));
+}
+
+// --- Benchmark ---
+
+static void test_bench_add() {
+    double ns = benchNsPerIter(1000000, [](uint32_t i) {
+        histogramAdd(h, (i * 2654435761u) >> 12);       // Spread over all buckets
+    });
+    benchSink += h.count;
+    BENCH_REPORT("histogramAdd: %.1f ns", ns);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bucket_edges);
+    RUN_TEST(test_top_bucket_is_open);
+    RUN_TEST(test_limits_are_exclusive_upper_bounds);
+    RUN_TEST(test_empty_histogram_reports_zero);
+    RUN_TEST(test_min_max_mean);
+    RUN_TEST(test_sum_holds_large_values);
+    RUN_TEST(test_percentiles_pick_the_bucket_holding_the_rank);
+    RUN_TEST(test_percentile_bounds);
+    RUN_TEST(test_small_counts_round_the_rank_up);
+    RUN_TEST(test_bench_add);
+    return UNITY_END();
+}
@@ -0,0 +1,365 @@
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+#include "layout.h"
+#include "render_scheduler.h"
+#include "host_bench.h"
+
+// ============================================================
+// Layout engine tests: compile errors, the differential pass (skip,
+// redraw, erase) against a recording backend, icon hide and show, and a
+// benchmark of layoutRun over the clock page
+// ============================================================
+
+static const uint16_t WHITE = 0xFFFF;
+
+// The built-in clock page (display.cpp)
+static const LayoutWidget CLOCK_WIDGETS[] = {
+    { LAYOUT_TEXT,  BIND_STA_IP,       LAYOUT_FONT_0,  LAYOUT_ALIGN_LEFT,     4,   4,   0, 0x4208, "%s" },
+    { LAYOUT_DOT,   BIND_WIFI,         LAYOUT_FONT_0,  LAYOUT_ALIGN_CENTER, 228,   8,   5, 0xF800, nullptr },
+    { LAYOUT_CLOCK, BIND_TIME,         LAYOUT_FONT_7,  LAYOUT_ALIGN_CENTER, 120,  55,   0, WHITE,  nullptr },
+    { LAYOUT_TEXT,  BIND_DATE,         LAYOUT_FONT_UI, LAYOUT_ALIGN_CENTER, 120, 110,   0, 0x8410, "%s" },
+    { LAYOUT_HLINE, BIND_NONE,         LAYOUT_FONT_0,  LAYOUT_ALIGN_LEFT,    40, 140, 160, 0x4208, nullptr },
+    { LAYOUT_TEXT,  BIND_WEATHER,      LAYOUT_FONT_UI, LAYOUT_ALIGN_CENTER, 120, 160,   0, WHITE,  "%s" },
+    { LAYOUT_ICON,  BIND_WEATHER_ICON, LAYOUT_FONT_0,  LAYOUT_ALIGN_LEFT,    40, 171,   0, WHITE,  nullptr },
+    { LAYOUT_TEXT,  BIND_TEMPERATURE,  LAYOUT_FONT_4,  LAYOUT_ALIGN_CENTER, 144, 195,   0, 0x07FF, "%s" },
+};
+static const int CLOCK_COUNT = sizeof(CLOCK_WIDGETS) / sizeof(CLOCK_WIDGETS[0]);
+
+static const int OP_TIME    = 2;
+static const int OP_WEATHER = 5;
+static const int OP_ICON    = 6;
+static const int OP_TEMP    = 7;
+
+static LayoutProgram prog;
+static LayoutState   state;
+
+// --- Recording backend ---
+// Values come from a table per binding; draw() and erase() only count.
+// Text is measured as 6 px per character, 8 px high, like Font0.
+
+struct FakeDisplay {
+    char     text[BIND_COUNT][LAYOUT_VALUE_LEN];
+    bool     hidden[BIND_COUNT];
+    uint16_t draws[LAYOUT_MAX_OPS];
+    uint16_t erases;
+    DirtyRect lastErase;
+};
+
+static FakeDisplay fake;
+
+static void fakeValue(void* ctx, LayoutBinding bind, LayoutValue& out) {
+    FakeDisplay* d = (FakeDisplay*)ctx;
+    strcpy(out.text, d->text[bind]);
+    out.visible = !d->hidden[bind];
+}
+
+static DirtyRect fakeDraw(void* ctx, const LayoutOp& op, const LayoutValue& value,
+                          const LayoutOpState&) {
+    FakeDisplay* d = (FakeDisplay*)ctx;
+    d->draws[&op - prog.ops]++;
+    if (op.box.w > 0) return op.box;
+    return { op.x, op.y, (int16_t)(strlen(value.text) * 6), 8 };
+}
+
+static void fakeErase(void* ctx, const DirtyRect& box) {
+    FakeDisplay* d = (FakeDisplay*)ctx;
+    d->erases++;
+    d->lastErase = box;
+}
+
+static const LayoutBackend BACKEND = { &fake, fakeValue, fakeDraw, fakeErase };
+
+static void setValue(LayoutBinding bind, const char* text) {
+    strcpy(fake.text[bind], text);
+}
+
+void setUp() {
+    memset(&fake, 0, sizeof(fake));
+    setValue(BIND_STA_IP, "192.168.1.42");
+    setValue(BIND_WIFI, "");
+    setValue(BIND_TIME, "10:08");
+    setValue(BIND_DATE, "Sat, Mar 14");
+    setValue(BIND_WEATHER, "Partly Cloudy");
+    setValue(BIND_WEATHER_ICON, "2");
+    setValue(BIND_TEMPERATURE, "71F");
+
+    TEST_ASSERT_NULL(layoutCompile(CLOCK_WIDGETS, CLOCK_COUNT, prog));
+    layoutReset(state);
+}
+
+void tearDown() {}
+
+// --- Helpers ---
+
+static const char* compileOne(const LayoutWidget& w) {
+    LayoutProgram p;
+    const char* err = layoutCompile(&w, 1, p);
+    if (err) TEST_ASSERT_EQUAL_INT(0, p.count);     // Nothing half-compiled
+    return err;
+}
+
+static LayoutWidget icon(int16_t x, int16_t y, LayoutAlign align = LAYOUT_ALIGN_LEFT) {
+    return { LAYOUT_ICON, BIND_WEATHER_ICON, LAYOUT_FONT_0, align, x, y, 0, WHITE, nullptr };
+}
+
+static LayoutWidget text(LayoutBinding bind, const char* format,
+                         LayoutFont font = LAYOUT_FONT_2, LayoutAlign align = LAYOUT_ALIGN_LEFT) {
+    return { LAYOUT_TEXT, bind, font, align, 10, 10, 0, WHITE, format };
+}
+
+static LayoutRunStats run(uint32_t dirty) {
+    LayoutRunStats stats;
+    layoutRun(prog, state, dirty, BACKEND, &stats);
+    return stats;
+}
+
+// --- Compile ---
+
+static void test_builtin_clock_page_compiles() {
+    TEST_ASSERT_EQUAL_INT(CLOCK_COUNT, prog.count);
+    TEST_ASSERT_EQUAL_HEX32(RENDER_DIRTY_MINUTE | RENDER_DIRTY_TIME | RENDER_DIRTY_WEATHER |
+                            RENDER_DIRTY_WIFI, prog.deps);
+
+    const DirtyRect& dot = prog.ops[1].box;         // Centered: radius 5 around (228, 8)
+    TEST_ASSERT_EQUAL_INT(223, dot.x);
+    TEST_ASSERT_EQUAL_INT(3, dot.y);
+    TEST_ASSERT_EQUAL_INT(11, dot.w);
+    TEST_ASSERT_EQUAL_INT(40, prog.ops[OP_ICON].box.x);
+    TEST_ASSERT_EQUAL_INT(48, prog.ops[OP_ICON].box.h);
+    TEST_ASSERT_EQUAL_INT(0, prog.ops[OP_TIME].box.w);     // Measured when drawn
+}
+
+static void test_bad_formats_are_rejected() {
+    TEST_ASSERT_EQUAL_STRING("format may only contain %s and %%", compileOne(text(BIND_HEAP, "%d KB")));
+    TEST_ASSERT_EQUAL_STRING("format has more than one %s", compileOne(text(BIND_HEAP, "%s/%s")));
+    TEST_ASSERT_EQUAL_STRING("static text has a %s", compileOne(text(BIND_NONE, "Up: %s")));
+    TEST_ASSERT_EQUAL_STRING("static text needs a format", compileOne(text(BIND_NONE, nullptr)));
+    TEST_ASSERT_EQUAL_STRING("format too long", compileOne(text(BIND_HEAP, "Free heap right now: %s KB")));
+    TEST_ASSERT_EQUAL_STRING("ui font text must be centered", compileOne(text(BIND_DATE, "%s", LAYOUT_FONT_UI)));
+    TEST_ASSERT_NULL(compileOne(text(BIND_HEAP, "100%% %s")));
+    TEST_ASSERT_NULL(compileOne(text(BIND_HEAP, nullptr)));             // Bound: "%s"
+}
+
+static void test_bad_widgets_are_rejected() {
+    LayoutWidget clock = { LAYOUT_CLOCK, BIND_DATE, LAYOUT_FONT_7, LAYOUT_ALIGN_CENTER, 120, 55, 0, WHITE, nullptr };
+    TEST_ASSERT_EQUAL_STRING("clock must bind time", compileOne(clock));
+
+    LayoutWidget wrongIcon = icon(0, 0);
+    wrongIcon.bind = BIND_WEATHER;
+    TEST_ASSERT_EQUAL_STRING("icon must bind weather_icon", compileOne(wrongIcon));
+
+    LayoutWidget dot = { LAYOUT_DOT, BIND_WIFI, LAYOUT_FONT_0, LAYOUT_ALIGN_CENTER, 100, 100, 0, WHITE, nullptr };
+    TEST_ASSERT_EQUAL_STRING("size must be positive", compileOne(dot));
+
+    LayoutWidget hline = { LAYOUT_HLINE, BIND_WIFI, LAYOUT_FONT_0, LAYOUT_ALIGN_LEFT, 0, 100, 20, WHITE, nullptr };
+    TEST_ASSERT_EQUAL_STRING("hline cannot bind", compileOne(hline));
+
+    LayoutWidget unknown = icon(0, 0);
+    unknown.kind = LAYOUT_KIND_COUNT;
+    TEST_ASSERT_EQUAL_STRING("unknown widget kind", compileOne(unknown));
+
+    LayoutProgram p;
+    TEST_ASSERT_EQUAL_STRING("no widgets", layoutCompile(CLOCK_WIDGETS, 0, p));
+    LayoutWidget many[LAYOUT_MAX_OPS + 1];
+    for (LayoutWidget& w : many) w = icon(0, 0);
+    TEST_ASSERT_EQUAL_STRING("too many widgets", layoutCompile(many, LAYOUT_MAX_OPS + 1, p));
+}
+
+// The icon is decoded into the frame unclipped: its box must be on the panel
+static void test_off_screen_boxes_are_rejected() {
+    TEST_ASSERT_NULL(compileOne(icon(DISPLAY_WIDTH - 48, DISPLAY_HEIGHT - 48)));
+    TEST_ASSERT_EQUAL_STRING("widget off screen", compileOne(icon(220, 10)));
+    TEST_ASSERT_EQUAL_STRING("widget off screen", compileOne(icon(10, 230)));
+    TEST_ASSERT_EQUAL_STRING("widget off screen", compileOne(icon(-1, 10)));
+    TEST_ASSERT_EQUAL_STRING("widget off screen", compileOne(icon(10, 10, LAYOUT_ALIGN_CENTER)));
+
+    LayoutWidget dot = { LAYOUT_DOT, BIND_WIFI, LAYOUT_FONT_0, LAYOUT_ALIGN_CENTER, 120, 120, 20000, WHITE, nullptr };
+    TEST_ASSERT_EQUAL_STRING("widget off screen", compileOne(dot));     // Would wrap int16_t
+    LayoutWidget hline = { LAYOUT_HLINE, BIND_NONE, LAYOUT_FONT_0, LAYOUT_ALIGN_LEFT, 100, 100, 141, WHITE, nullptr };
+    TEST_ASSERT_EQUAL_STRING("widget off screen", compileOne(hline));
+
+    // One bad widget fails the whole page
+    LayoutWidget page[CLOCK_COUNT];
+    memcpy(page, CLOCK_WIDGETS, sizeof(page));
+    page[OP_ICON].y = 200;
+    LayoutProgram p;
+    TEST_ASSERT_EQUAL_STRING("widget off screen", layoutCompile(page, CLOCK_COUNT, p));
+    TEST_ASSERT_EQUAL_INT(0, p.count);
+}
+
+static void test_names_round_trip() {
+    LayoutKind kind;
+    LayoutBinding bind;
+    LayoutFont font;
+    LayoutAlign align;
+    TEST_ASSERT_TRUE(layoutKindFromName("icon", kind));
+    TEST_ASSERT_EQUAL_INT(LAYOUT_ICON, kind);
+    TEST_ASSERT_TRUE(layoutBindingFromName("weather_icon", bind));
+    TEST_ASSERT_EQUAL_INT(BIND_WEATHER_ICON, bind);
+    TEST_ASSERT_TRUE(layoutFontFromName("ui", font));
+    TEST_ASSERT_EQUAL_INT(LAYOUT_FONT_UI, font);
+    TEST_ASSERT_TRUE(layoutAlignFromName("left", align));
+    TEST_ASSERT_EQUAL_INT(LAYOUT_ALIGN_LEFT, align);
+    TEST_ASSERT_FALSE(layoutKindFromName("image", kind));
+    TEST_ASSERT_FALSE(layoutBindingFromName(nullptr, bind));
+}
+
+// --- Differential pass ---
+
+static void test_first_run_draws_every_op() {
+    LayoutRunStats s = run(0);
+    TEST_ASSERT_EQUAL_UINT16(0, s.skipped);
+    TEST_ASSERT_EQUAL_UINT16(CLOCK_COUNT, s.evaluated);
+    TEST_ASSERT_EQUAL_UINT16(CLOCK_COUNT, s.drawn);
+    TEST_ASSERT_EQUAL_UINT16(0, s.erased);
+}
+
+static void test_clean_pass_skips_everything() {
+    run(0);
+    LayoutRunStats s = run(0);
+    TEST_ASSERT_EQUAL_UINT16(CLOCK_COUNT, s.skipped);
+    TEST_ASSERT_EQUAL_UINT16(0, s.evaluated);
+
+    // A flag no op depends on is the same as none
+    s = run(RENDER_DIRTY_SYSTEM | RENDER_DIRTY_SECOND);
+    TEST_ASSERT_EQUAL_UINT16(CLOCK_COUNT, s.skipped);
+}
+
+// A minute tick fetches time and date; only the value that changed is
+// drawn, and the clock draws over itself without an erase
+static void test_minute_tick_redraws_only_what_changed() {
+    run(0);
+    setValue(BIND_TIME, "10:09");
+    LayoutRunStats s = run(RENDER_DIRTY_MINUTE);
+    TEST_ASSERT_EQUAL_UINT16(CLOCK_COUNT - 2, s.skipped);
+    TEST_ASSERT_EQUAL_UINT16(2, s.evaluated);
+    TEST_ASSERT_EQUAL_UINT16(1, s.drawn);
+    TEST_ASSERT_EQUAL_UINT16(0, s.erased);
+    TEST_ASSERT_EQUAL_UINT16(2, fake.draws[OP_TIME]);
+}
+
+// Changed text is erased over its old box first, then drawn
+static void test_changed_text_is_erased_then_drawn() {
+    run(0);
+    setValue(BIND_WEATHER, "Rain");
+    LayoutRunStats s = run(RENDER_DIRTY_WEATHER);
+    TEST_ASSERT_EQUAL_UINT16(3, s.evaluated);       // Condition, icon, temperature
+    TEST_ASSERT_EQUAL_UINT16(1, s.drawn);
+    TEST_ASSERT_EQUAL_UINT16(1, s.erased);
+    TEST_ASSERT_EQUAL_INT(13 * 6, fake.lastErase.w);    // "Partly Cloudy" as drawn
+    TEST_ASSERT_EQUAL_STRING("Rain", state.ops[OP_WEATHER].value.text);
+    TEST_ASSERT_EQUAL_INT(4 * 6, state.ops[OP_WEATHER].drawn.w);
+}
+
+static void test_format_is_applied_before_compare() {
+    LayoutWidget w = text(BIND_HEAP, "Heap: %s KB");
+    TEST_ASSERT_NULL(layoutCompile(&w, 1, prog));
+    layoutReset(state);
+    setValue(BIND_HEAP, "142");
+    run(0);
+    TEST_ASSERT_EQUAL_STRING("Heap: 142 KB", state.ops[0].value.text);
+}
+
+// Weather going away hides the icon and temperature (erased, not drawn);
+// coming back draws them again with nothing left to erase
+static void test_icon_hides_and_shows() {
+    run(0);
+    fake.hidden[BIND_WEATHER_ICON] = true;
+    fake.hidden[BIND_TEMPERATURE]  = true;
+    setValue(BIND_WEATHER, "No weather data");
+
+    LayoutRunStats s = run(RENDER_DIRTY_WEATHER);
+    TEST_ASSERT_EQUAL_UINT16(1, s.drawn);           // The condition text
+    TEST_ASSERT_EQUAL_UINT16(3, s.erased);
+    TEST_ASSERT_EQUAL_UINT16(1, fake.draws[OP_ICON]);
+    TEST_ASSERT_EQUAL_INT(0, state.ops[OP_ICON].drawn.w);
+    TEST_ASSERT_EQUAL_INT(0, state.ops[OP_TEMP].drawn.w);
+
+    // Still hidden: nothing to do
+    s = run(RENDER_DIRTY_WEATHER);
+    TEST_ASSERT_EQUAL_UINT16(0, s.drawn);
+    TEST_ASSERT_EQUAL_UINT16(0, s.erased);
+
+    fake.hidden[BIND_WEATHER_ICON] = false;
+    fake.hidden[BIND_TEMPERATURE]  = false;
+    setValue(BIND_WEATHER, "Partly Cloudy");
+    s = run(RENDER_DIRTY_WEATHER);
+    TEST_ASSERT_EQUAL_UINT16(3, s.drawn);
+    TEST_ASSERT_EQUAL_UINT16(1, s.erased);          // Only the old condition text
+    TEST_ASSERT_EQUAL_UINT16(2, fake.draws[OP_ICON]);
+    TEST_ASSERT_EQUAL_INT(48, state.ops[OP_ICON].drawn.w);
+}
+
+// A different icon draws over the old one in place
+static void test_icon_change_draws_without_erase() {
+    run(0);
+    setValue(BIND_WEATHER_ICON, "5");
+    LayoutRunStats s = run(RENDER_DIRTY_WEATHER);
+    TEST_ASSERT_EQUAL_UINT16(1, s.drawn);
+    TEST_ASSERT_EQUAL_UINT16(0, s.erased);
+}
+
+static void test_reset_draws_everything_again() {
+    run(0);
+    layoutReset(state);
+    LayoutRunStats s = run(0);
+    TEST_ASSERT_EQUAL_UINT16(CLOCK_COUNT, s.drawn);
+}
+
+// --- Benchmark ---
+// layoutRun() over the clock page for a full draw, a pass with nothing
+// dirty, a minute tick, and a weather update. The backend does no drawing,
+// so this is the engine's own cost per pass.
+
+static void test_bench_clock_page() {
+    static const char* const TIMES[] = { "10:08", "10:09" };
+
+    double fullNs = benchNsPerIter(20000, [](uint32_t) {
+        layoutReset(state);
+        layoutRun(prog, state, 0, BACKEND, nullptr);
+    });
+
+    double idleNs = benchNsPerIter(200000, [](uint32_t) {
+        layoutRun(prog, state, RENDER_DIRTY_SECOND, BACKEND, nullptr);
+    });
+
+    LayoutRunStats tick;
+    double minuteNs = benchNsPerIter(100000, [&](uint32_t i) {
+        setValue(BIND_TIME, TIMES[i & 1]);
+        layoutRun(prog, state, RENDER_DIRTY_MINUTE, BACKEND, &tick);
+    });
+
+    static const char* const CONDITIONS[] = { "Rain", "Partly Cloudy" };
+    LayoutRunStats weather;
+    double weatherNs = benchNsPerIter(100000, [&](uint32_t i) {
+        setValue(BIND_WEATHER, CONDITIONS[i & 1]);
+        layoutRun(prog, state, RENDER_DIRTY_WEATHER, BACKEND, &weather);
+    });
+
+    BENCH_REPORT("clock page, %d ops: full %.0f ns, nothing dirty %.0f ns", prog.count, fullNs, idleNs);
+    BENCH_REPORT("minute tick %.0f ns (%u evaluated, %u drawn), weather %.0f ns (%u evaluated, %u drawn, %u erased)",
+                 minuteNs, tick.evaluated, tick.drawn,
+                 weatherNs, weather.evaluated, weather.drawn, weather.erased);
+    TEST_ASSERT_EQUAL_UINT16(1, tick.drawn);
+    TEST_ASSERT_EQUAL_UINT16(1, weather.drawn);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_builtin_clock_page_compiles);
+    RUN_TEST(test_bad_formats_are_rejected);
+    RUN_TEST(test_bad_widgets_are_rejected);
+    RUN_TEST(test_off_screen_boxes_are_rejected);
+    RUN_TEST(test_names_round_trip);
+    RUN_TEST(test_first_run_draws_every_op);
+    RUN_TEST(test_clean_pass_skips_everything);
+    RUN_TEST(test_minute_tick_redraws_only_what_changed);
+    RUN_TEST(test_changed_text_is_erased_then_drawn);
+    RUN_TEST(test_format_is_applied_before_compare);
+    RUN_TEST(test_icon_hides_and_shows);
+    RUN_TEST(test_icon_change_draws_without_erase);
+    RUN_TEST(test_reset_draws_everything_again);
+    RUN_TEST(test_bench_clock_page);
+    return UNITY_END();
+}
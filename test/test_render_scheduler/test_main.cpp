@@ -0,0 +1,158 @@
+#include <stdlib.h>
+#include <unity.h>
+#include "render_scheduler.h"
+#include "host_bench.h"
+
+// ============================================================
+// Render scheduler tests: boundary alignment, interest masks, clock
+// jumps, and rollover latency of a sleeping render loop on a virtual
+// clock
+// ============================================================
+
+static const int64_t T0_MS = 1773482910000LL;       // 2026-03-14 10:08:30 UTC
+
+static RenderScheduler sched;
+
+void setUp() {
+    renderSchedInit(sched);
+}
+
+void tearDown() {}
+
+// --- Helpers ---
+
+// The render task's loop: poll, then sleep until the next tick. wakeLateMs
+// is how long after the deadline the task actually runs again.
+struct LoopResult {
+    uint32_t polls;
+    uint32_t renders;
+    uint32_t minutesSeen;
+};
+
+static LoopResult runLoop(int64_t& wallMs, int64_t untilMs, uint32_t interest,
+                          uint32_t (*wakeLateMs)(uint32_t poll)) {
+    LoopResult r = { 0, 0, 0 };
+    while (wallMs < untilMs) {
+        uint32_t work = renderSchedPoll(sched, wallMs, interest);
+        r.polls++;
+        if (work) r.renders++;
+        if (work & RENDER_DIRTY_MINUTE) r.minutesSeen++;
+
+        uint32_t waitMs = renderSchedMsUntilTick(sched, wallMs);
+        if (waitMs == 0 || waitMs > 1000) waitMs = 1000;
+        wallMs += waitMs + wakeLateMs(r.polls);
+    }
+    return r;
+}
+
+static uint32_t onTime(uint32_t) { return 0; }
+
+// Scheduling noise: 0-40 ms late, now and then a 300 ms stall
+static uint32_t jittery(uint32_t poll) {
+    return (poll % 97 == 0) ? 300 : (uint32_t)(rand() % 41);
+}
+
+// --- Tests ---
+
+static void test_first_poll_draws_everything() {
+    uint32_t work = renderSchedPoll(sched, T0_MS, RENDER_DIRTY_PAGE | RENDER_DIRTY_WEATHER);
+    TEST_ASSERT_EQUAL_UINT32(RENDER_DIRTY_PAGE | RENDER_DIRTY_WEATHER, work);
+    TEST_ASSERT_EQUAL_UINT32(0, renderSchedPoll(sched, T0_MS + 10, RENDER_DIRTY_PAGE));
+}
+
+static void test_boundaries_align_to_wall_clock() {
+    renderSchedPoll(sched, T0_MS + 250, RENDER_DIRTY_ALL);
+    TEST_ASSERT_EQUAL_UINT32(750, renderSchedMsUntilTick(sched, T0_MS + 250));
+
+    // Second boundary only
+    TEST_ASSERT_EQUAL_UINT32(0, renderSchedPoll(sched, T0_MS + 999, RENDER_DIRTY_SECOND));
+    TEST_ASSERT_EQUAL_UINT32(RENDER_DIRTY_SECOND,
+                             renderSchedPoll(sched, T0_MS + 1000, RENDER_DIRTY_SECOND | RENDER_DIRTY_MINUTE));
+
+    // 10:08:30 + 30 s is the minute
+    TEST_ASSERT_EQUAL_UINT32(RENDER_DIRTY_SECOND | RENDER_DIRTY_MINUTE,
+                             renderSchedPoll(sched, T0_MS + 30000, RENDER_DIRTY_SECOND | RENDER_DIRTY_MINUTE));
+    TEST_ASSERT_EQUAL_UINT32(0, sched.stats.lastRolloverLatencyMs);
+}
+
+static void test_uninterested_flags_stay_pending() {
+    renderSchedPoll(sched, T0_MS, RENDER_DIRTY_ALL);
+
+    // The clock page draws its minute; the photo that arrived with it waits
+    renderSchedInvalidate(sched, RENDER_DIRTY_MINUTE | RENDER_DIRTY_PHOTO);
+    TEST_ASSERT_EQUAL_UINT32(RENDER_DIRTY_MINUTE, renderSchedPoll(sched, T0_MS + 10, RENDER_DIRTY_MINUTE));
+    TEST_ASSERT_EQUAL_UINT32(0, renderSchedPoll(sched, T0_MS + 20, RENDER_DIRTY_MINUTE));
+    TEST_ASSERT_EQUAL_UINT32(RENDER_DIRTY_PHOTO, renderSchedPoll(sched, T0_MS + 30, RENDER_DIRTY_PHOTO));
+    TEST_ASSERT_EQUAL_UINT32(0, renderSchedPoll(sched, T0_MS + 40, RENDER_DIRTY_PHOTO));
+}
+
+static void test_seconds_without_interest_are_avoided_wakeups() {
+    renderSchedPoll(sched, T0_MS, RENDER_DIRTY_ALL);
+    for (int i = 1; i <= 5; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, renderSchedPoll(sched, T0_MS + i * 1000, RENDER_DIRTY_WEATHER));
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, sched.stats.secondTicks);
+    TEST_ASSERT_EQUAL_UINT32(5, sched.stats.wakeupsAvoided);
+}
+
+static void test_clock_jump_rebases_and_redraws_time() {
+    renderSchedPoll(sched, T0_MS, RENDER_DIRTY_ALL);
+
+    // NTP moves the clock back an hour
+    uint32_t interest = RENDER_DIRTY_TIME | RENDER_DIRTY_MINUTE;
+    uint32_t work = renderSchedPoll(sched, T0_MS - 3600000 + 400, interest);
+    TEST_ASSERT_EQUAL_UINT32(interest, work);
+    TEST_ASSERT_EQUAL_UINT32(1, sched.stats.clockJumps);
+    TEST_ASSERT_EQUAL_UINT32(600, renderSchedMsUntilTick(sched, T0_MS - 3600000 + 400));
+}
+
+static void test_frame_ticks_between_seconds() {
+    renderSchedPoll(sched, T0_MS, RENDER_DIRTY_ALL);
+    renderSchedSetFrameMs(sched, 250);
+    renderSchedPoll(sched, T0_MS + 10, RENDER_DIRTY_FRAME);     // Realigns
+
+    TEST_ASSERT_EQUAL_UINT32(240, renderSchedMsUntilTick(sched, T0_MS + 10));
+    TEST_ASSERT_EQUAL_UINT32(RENDER_DIRTY_FRAME, renderSchedPoll(sched, T0_MS + 250, RENDER_DIRTY_FRAME));
+    TEST_ASSERT_EQUAL_UINT32(0, renderSchedPoll(sched, T0_MS + 260, RENDER_DIRTY_FRAME));
+}
+
+// A loop that wakes exactly when asked sees every rollover at 0 ms
+static void test_rollover_latency_on_time() {
+    int64_t wallMs = T0_MS;
+    renderSchedPoll(sched, wallMs, RENDER_DIRTY_ALL);       // Initial full draw
+    LoopResult r = runLoop(wallMs, T0_MS + 10 * 60000LL, RENDER_DIRTY_MINUTE, onTime);
+
+    TEST_ASSERT_EQUAL_UINT32(10, r.minutesSeen);
+    TEST_ASSERT_EQUAL_UINT32(0, sched.stats.maxRolloverLatencyMs);
+    TEST_ASSERT_EQUAL_UINT32(0, sched.stats.clockJumps);
+    TEST_ASSERT_EQUAL_UINT32(r.polls - 1, sched.stats.secondTicks);
+}
+
+// Rollover latency is bounded by how late the task wakes, never by the
+// poll period: no minute is missed or seen a second late
+static void test_rollover_latency_with_jitter() {
+    srand(3);
+    int64_t wallMs = T0_MS + 137;
+    renderSchedPoll(sched, wallMs, RENDER_DIRTY_ALL);
+    LoopResult r = runLoop(wallMs, T0_MS + 60 * 60000LL, RENDER_DIRTY_MINUTE, jittery);
+
+    TEST_ASSERT_EQUAL_UINT32(60, r.minutesSeen);
+    TEST_ASSERT_LESS_OR_EQUAL(300, sched.stats.maxRolloverLatencyMs);
+    TEST_ASSERT_EQUAL_UINT32(0, sched.stats.clockJumps);
+
+    BENCH_REPORT("60 min jittery loop: %u polls, %u renders, max rollover latency %u ms",
+                 r.polls, r.renders, sched.stats.maxRolloverLatencyMs);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_first_poll_draws_everything);
+    RUN_TEST(test_boundaries_align_to_wall_clock);
+    RUN_TEST(test_uninterested_flags_stay_pending);
+    RUN_TEST(test_seconds_without_interest_are_avoided_wakeups);
+    RUN_TEST(test_clock_jump_rebases_and_redraws_time);
+    RUN_TEST(test_frame_ticks_between_seconds);
+    RUN_TEST(test_rollover_latency_on_time);
+    RUN_TEST(test_rollover_latency_with_jitter);
+    return UNITY_END();
+}
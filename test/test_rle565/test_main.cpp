@@ -0,0 +1,166 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include "rle565.h"
+#include "host_bench.h"
+
+#ifndef PROGMEM
+#define PROGMEM                 // Flash placement attribute, meaningless on the host
+#endif
+#include "weather_icons.h"
+
+// ============================================================
+// RLE565 tests: encoder/decoder round trips, malformed input, parity
+// with tools/pack_icons.py, and a benchmark of rle565NextRow over the
+// packed weather icons
+// ============================================================
+
+static const int ICON_BYTES = WEATHER_ICON_W * WEATHER_ICON_H * 2;
+
+void setUp() {}
+void tearDown() {}
+
+// --- Helpers ---
+
+// Decode a whole icon; false if any row fails or data is left over
+static bool decodeIcon(int icon, uint8_t* out) {
+    Rle565Decoder dec;
+    rle565Begin(dec, WEATHER_ICON_RLE[icon], WEATHER_ICON_RLE_LEN[icon],
+                WEATHER_ICON_W, WEATHER_ICON_H);
+    for (int y = 0; y < WEATHER_ICON_H; y++) {
+        if (!rle565NextRow(dec, out + y * WEATHER_ICON_W * 2)) return false;
+    }
+    return dec.pos == dec.size && !rle565NextRow(dec, out);
+}
+
+static void roundTrip(const uint8_t* row, uint16_t width) {
+    uint8_t packed[1024];
+    uint8_t decoded[512];
+    size_t len = rle565EncodeRow(row, width, packed, sizeof(packed));
+    TEST_ASSERT_TRUE(len > 0);
+
+    Rle565Decoder dec;
+    rle565Begin(dec, packed, len, width, 1);
+    TEST_ASSERT_TRUE(rle565NextRow(dec, decoded));
+    TEST_ASSERT_EQUAL_MEMORY(row, decoded, width * 2);
+    TEST_ASSERT_EQUAL_UINT32(len, dec.pos);
+}
+
+// --- Tests ---
+
+static void test_run_packs_to_three_bytes() {
+    uint8_t row[32 * 2];
+    for (int i = 0; i < 32; i++) { row[i * 2] = 0xF8; row[i * 2 + 1] = 0x00; }
+    uint8_t packed[80];
+    TEST_ASSERT_EQUAL_UINT32(3, rle565EncodeRow(row, 32, packed, sizeof(packed)));
+    TEST_ASSERT_EQUAL_HEX8(0x80 | 31, packed[0]);
+    roundTrip(row, 32);
+}
+
+static void test_round_trips_mixed_rows() {
+    srand(5);
+    uint8_t row[240 * 2];
+    for (int round = 0; round < 200; round++) {
+        uint16_t width = 1 + rand() % 240;
+        uint16_t color = (uint16_t)rand();
+        for (int i = 0; i < width; i++) {
+            if (rand() % 4 == 0) color = (uint16_t)rand();     // Runs of varying length
+            row[i * 2] = color >> 8;
+            row[i * 2 + 1] = color & 0xFF;
+        }
+        roundTrip(row, width);
+    }
+}
+
+static void test_encoder_refuses_short_buffer() {
+    uint8_t row[16 * 2];
+    for (int i = 0; i < 32; i++) row[i] = (uint8_t)(i * 37);
+    uint8_t packed[16];
+    TEST_ASSERT_EQUAL_UINT32(0, rle565EncodeRow(row, 16, packed, sizeof(packed)));
+}
+
+static void test_truncated_data_is_rejected() {
+    const uint8_t packed[] = { 0x03, 0x12, 0x34, 0x56 };    // 4 literals, 1.5 present
+    uint8_t row[8];
+    Rle565Decoder dec;
+    rle565Begin(dec, packed, sizeof(packed), 4, 1);
+    TEST_ASSERT_FALSE(rle565NextRow(dec, row));
+}
+
+static void test_packet_crossing_row_end_is_rejected() {
+    const uint8_t packed[] = { 0x80 | 7, 0xFF, 0xFF };     // Run of 8 in a 4-wide row
+    uint8_t row[16];
+    Rle565Decoder dec;
+    rle565Begin(dec, packed, sizeof(packed), 4, 2);
+    TEST_ASSERT_FALSE(rle565NextRow(dec, row));
+}
+
+// Every packed icon decodes to exactly its size, and re-encoding gives
+// back the same bytes tools/pack_icons.py wrote
+static void test_icons_match_pack_icons() {
+    static uint8_t pixels[ICON_BYTES];
+    static uint8_t packed[ICON_BYTES + WEATHER_ICON_H * 2];
+
+    for (int icon = 0; icon < WEATHER_ICON_COUNT; icon++) {
+        TEST_ASSERT_TRUE(decodeIcon(icon, pixels));
+
+        size_t len = 0;
+        for (int y = 0; y < WEATHER_ICON_H; y++) {
+            size_t n = rle565EncodeRow(pixels + y * WEATHER_ICON_W * 2, WEATHER_ICON_W,
+                                       packed + len, sizeof(packed) - len);
+            TEST_ASSERT_TRUE(n > 0);
+            len += n;
+        }
+        TEST_ASSERT_EQUAL_UINT32(WEATHER_ICON_RLE_LEN[icon], len);
+        TEST_ASSERT_EQUAL_MEMORY(WEATHER_ICON_RLE[icon], packed, len);
+    }
+}
+
+// --- Benchmark ---
+// Row-at-a-time decode of every icon, against copying the same pixels
+// from an uncompressed image (what a raw RGB565 icon table would cost)
+
+static void test_bench_icon_decode() {
+    static uint8_t raw[WEATHER_ICON_COUNT][ICON_BYTES];
+    uint8_t row[WEATHER_ICON_W * 2];
+    uint32_t packedTotal = 0;
+    for (int icon = 0; icon < WEATHER_ICON_COUNT; icon++) {
+        TEST_ASSERT_TRUE(decodeIcon(icon, raw[icon]));
+        packedTotal += WEATHER_ICON_RLE_LEN[icon];
+    }
+
+    double rleNs = benchNsPerIter(2000, [&](uint32_t i) {
+        int icon = i % WEATHER_ICON_COUNT;
+        Rle565Decoder dec;
+        rle565Begin(dec, WEATHER_ICON_RLE[icon], WEATHER_ICON_RLE_LEN[icon],
+                    WEATHER_ICON_W, WEATHER_ICON_H);
+        while (rle565NextRow(dec, row)) {}
+        benchSink = benchSink + row[0];
+    });
+
+    double rawNs = benchNsPerIter(2000, [&](uint32_t i) {
+        const uint8_t* src = raw[i % WEATHER_ICON_COUNT];
+        for (int y = 0; y < WEATHER_ICON_H; y++) {
+            memcpy(row, src + y * WEATHER_ICON_W * 2, sizeof(row));
+        }
+        benchSink = benchSink + row[0];
+    });
+
+    BENCH_REPORT("%d icons: %u bytes packed, %u raw (%.0f%%)",
+                 WEATHER_ICON_COUNT, packedTotal, WEATHER_ICON_COUNT * ICON_BYTES,
+                 100.0 * packedTotal / (WEATHER_ICON_COUNT * ICON_BYTES));
+    BENCH_REPORT("per icon: rle565NextRow %.0f ns (%.1f ns/row), raw copy %.0f ns",
+                 rleNs, rleNs / WEATHER_ICON_H, rawNs);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_run_packs_to_three_bytes);
+    RUN_TEST(test_round_trips_mixed_rows);
+    RUN_TEST(test_encoder_refuses_short_buffer);
+    RUN_TEST(test_truncated_data_is_rejected);
+    RUN_TEST(test_packet_crossing_row_end_is_rejected);
+    RUN_TEST(test_icons_match_pack_icons);
+    RUN_TEST(test_bench_icon_decode);
+    return UNITY_END();
+}
@@ -0,0 +1,270 @@
+#include <stdlib.h>
+#include <unity.h>
+#include "timer_wheel.h"
+
+// ============================================================
+// Timer wheel tests on a virtual clock: firing order, cascades down the
+// levels and out of the overflow list, lateness and skipped periods,
+// and a randomised run against a list of expected deadlines
+// ============================================================
+
+static const uint64_t T0_MS = 1000003;     // Off every block boundary
+
+static TimerWheel wheel;
+static uint64_t   nowMs;
+
+// What fired, in order
+struct Fired {
+    int      job;
+    uint64_t atMs;
+};
+
+static Fired fired[512];
+static int   firedCount;
+
+// Randomised run: each job re-arms itself, and must fire on its deadline
+static bool     rearm;
+static uint64_t expectDue[TIMER_WHEEL_MAX_JOBS];
+
+void setUp() {
+    nowMs = T0_MS;
+    timerWheelInit(wheel, nowMs, nullptr, 1);
+    firedCount = 0;
+    rearm = false;
+}
+
+void tearDown() {}
+
+// --- Helpers ---
+
+static uint32_t randomDelay() {
+    switch (rand() % 4) {
+        case 0:  return rand() % 64;                // Level 0
+        case 1:  return rand() % 4096;              // Level 1
+        case 2:  return rand() % 300000;            // Level 2 and 3
+        default: return (uint32_t)rand() % 20000000u;   // Up to level 4
+    }
+}
+
+template <int N>
+static void job() {
+    if (firedCount < (int)(sizeof(fired) / sizeof(fired[0]))) {
+        fired[firedCount++] = { N, nowMs };
+    }
+    if (rearm) {
+        TEST_ASSERT_EQUAL_UINT64(expectDue[N], nowMs);
+        uint32_t delay = 1 + randomDelay();         // 0 would mean this slot, already firing
+        expectDue[N] = nowMs + delay;
+        timerWheelSchedule(wheel, N, nowMs, delay);
+    }
+}
+
+static const TimerFn JOBS[] = {
+    job<0>,  job<1>,  job<2>,  job<3>,  job<4>,  job<5>,  job<6>,  job<7>,
+    job<8>,  job<9>,  job<10>, job<11>, job<12>, job<13>, job<14>, job<15>,
+};
+static const int JOB_COUNT = sizeof(JOBS) / sizeof(JOBS[0]);
+
+static int add(int n, uint32_t delayMs, uint32_t periodMs = 0) {
+    int id = timerWheelAdd(wheel, nowMs, "job", delayMs, periodMs, JOBS[n]);
+    TEST_ASSERT_EQUAL_INT(n, id);
+    return id;
+}
+
+// Advance the clock one millisecond at a time, running the wheel each step
+static void stepTo(uint64_t untilMs) {
+    while (nowMs < untilMs) {
+        nowMs++;
+        timerWheelRun(wheel, nowMs);
+    }
+}
+
+// Advance the clock in one jump, as a loop that slept past deadlines would
+static uint32_t jumpTo(uint64_t untilMs) {
+    nowMs = untilMs;
+    return timerWheelRun(wheel, nowMs);
+}
+
+// --- Firing order ---
+
+static void test_fires_in_deadline_order() {
+    add(0, 40);
+    add(1, 5);
+    add(2, 3000);
+    add(3, 17);
+
+    TEST_ASSERT_EQUAL_UINT32(4, jumpTo(T0_MS + 5000));
+    const int order[] = { 1, 3, 0, 2 };
+    for (int i = 0; i < 4; i++) TEST_ASSERT_EQUAL_INT(order[i], fired[i].job);
+}
+
+static void test_same_deadline_fires_in_arm_order() {
+    add(0, 10);
+    add(1, 10);
+    add(2, 10);
+    timerWheelSchedule(wheel, 0, nowMs, 10);     // Re-armed: now the last of the three
+
+    stepTo(T0_MS + 10);
+    TEST_ASSERT_EQUAL_INT(3, firedCount);
+    TEST_ASSERT_EQUAL_INT(1, fired[0].job);
+    TEST_ASSERT_EQUAL_INT(2, fired[1].job);
+    TEST_ASSERT_EQUAL_INT(0, fired[2].job);
+}
+
+static void test_nothing_fires_early() {
+    add(0, 100);
+    stepTo(T0_MS + 99);
+    TEST_ASSERT_EQUAL_INT(0, firedCount);
+    TEST_ASSERT_EQUAL_UINT32(1, timerWheelMsUntilNext(wheel, nowMs, 1000));
+    stepTo(T0_MS + 100);
+    TEST_ASSERT_EQUAL_INT(1, firedCount);
+    TEST_ASSERT_EQUAL_UINT64(T0_MS + 100, fired[0].atMs);
+}
+
+static void test_cancelled_job_does_not_fire() {
+    add(0, 10);
+    add(1, 20);
+    timerWheelCancel(wheel, 0);
+    jumpTo(T0_MS + 100);
+    TEST_ASSERT_EQUAL_INT(1, firedCount);
+    TEST_ASSERT_EQUAL_INT(1, fired[0].job);
+    TEST_ASSERT_FALSE(wheel.jobs[0].armed);
+    TEST_ASSERT_EQUAL_UINT32(1000, timerWheelMsUntilNext(wheel, nowMs, 1000));
+}
+
+// --- Cascades ---
+
+// Deadlines in each level fire on their millisecond whether the clock
+// steps through every boundary or jumps straight there
+static void test_cascades_land_on_the_deadline() {
+    const uint32_t delays[] = { 63, 64, 4095, 4096, 262143, 262144, 16777300 };
+    const int n = sizeof(delays) / sizeof(delays[0]);
+
+    for (int i = 0; i < n; i++) add(i, delays[i]);
+    for (int i = 0; i < n; i++) {
+        uint64_t due = T0_MS + delays[i];
+        TEST_ASSERT_EQUAL_UINT32(delays[i] - (nowMs - T0_MS),
+                                 timerWheelMsUntilNext(wheel, nowMs, UINT32_MAX));
+        if (delays[i] < 300000) {
+            stepTo(due);
+        } else {
+            jumpTo(due - 1);
+            TEST_ASSERT_EQUAL_INT(i, firedCount);
+            jumpTo(due);
+        }
+        TEST_ASSERT_EQUAL_INT(i + 1, firedCount);
+        TEST_ASSERT_EQUAL_UINT64(due, fired[i].atMs);
+    }
+    TEST_ASSERT_TRUE(wheel.cascaded > 0);
+}
+
+// Past the top level (12.4 days) a job waits in the overflow list and
+// still comes out on time
+static void test_overflow_list_comes_back_down() {
+    const uint32_t delay = 20u * 24 * 3600 * 1000;     // 20 days
+    add(0, delay);
+    TEST_ASSERT_EQUAL_INT(TIMER_WHEEL_LEVELS, wheel.jobs[0].level);
+    TEST_ASSERT_EQUAL_UINT32(delay, timerWheelMsUntilNext(wheel, nowMs, UINT32_MAX));
+
+    // A loop that never sleeps longer than a second is what the firmware does
+    uint64_t due = T0_MS + delay;
+    while (nowMs + 1000 < due) {
+        jumpTo(nowMs + 1000);
+        TEST_ASSERT_EQUAL_INT(0, firedCount);
+    }
+    TEST_ASSERT_EQUAL_UINT32(due - nowMs, timerWheelMsUntilNext(wheel, nowMs, UINT32_MAX));
+    jumpTo(due);
+    TEST_ASSERT_EQUAL_INT(1, firedCount);
+    TEST_ASSERT_EQUAL_UINT64(due, fired[0].atMs);
+}
+
+// --- Lateness ---
+
+static void test_lateness_is_measured_from_the_deadline() {
+    add(0, 10);
+    jumpTo(T0_MS + 17);
+    const TimerJob& j = wheel.jobs[0];
+    TEST_ASSERT_EQUAL_UINT32(1, j.lateMs.count);
+    TEST_ASSERT_EQUAL_UINT32(7, j.lateMs.max);
+}
+
+// A late run does not push the schedule back
+static void test_periodic_job_keeps_its_phase() {
+    add(0, 10, 10);
+    jumpTo(T0_MS + 13);
+    TEST_ASSERT_EQUAL_UINT64(T0_MS + 20, wheel.jobs[0].dueMs);
+    TEST_ASSERT_EQUAL_UINT32(7, timerWheelMsUntilNext(wheel, nowMs, 1000));
+
+    stepTo(T0_MS + 50);
+    TEST_ASSERT_EQUAL_INT(5, firedCount);
+    for (int i = 1; i < 5; i++) TEST_ASSERT_EQUAL_UINT64(T0_MS + 10 * (i + 1), fired[i].atMs);
+    TEST_ASSERT_EQUAL_UINT32(0, wheel.jobs[0].skipped);
+}
+
+// A whole period behind, the missed runs are skipped, not run back to back
+static void test_periodic_job_skips_missed_runs() {
+    add(0, 10, 10);
+    jumpTo(T0_MS + 45);                             // Due at 10; 20, 30 and 40 missed
+    TEST_ASSERT_EQUAL_INT(1, firedCount);
+    TEST_ASSERT_EQUAL_UINT32(3, wheel.jobs[0].skipped);
+    TEST_ASSERT_EQUAL_UINT64(T0_MS + 50, wheel.jobs[0].dueMs);
+    TEST_ASSERT_EQUAL_UINT32(35, wheel.jobs[0].lateMs.max);
+}
+
+// A job re-arming itself lands in a later slot, never the one firing
+static void test_job_rearming_itself_fires_next_pass() {
+    rearm = true;
+    expectDue[0] = T0_MS;
+    add(0, 0);
+    for (int i = 0; i < 20; i++) {
+        uint64_t next = nowMs + timerWheelMsUntilNext(wheel, nowMs, UINT32_MAX);
+        jumpTo(next);
+    }
+    TEST_ASSERT_EQUAL_INT(20, firedCount);
+    TEST_ASSERT_EQUAL_UINT32(0, wheel.jobs[0].lateMs.max);
+}
+
+// --- Randomised ---
+
+// Sixteen jobs re-arming at delays across every level. Sleeping exactly
+// until timerWheelMsUntilNext() must land on every deadline with zero
+// lateness, through however many cascades that takes.
+static void test_random_deadlines_fire_on_time() {
+    srand(21);
+    rearm = true;
+    for (int i = 0; i < JOB_COUNT; i++) {
+        uint32_t delay = randomDelay();
+        expectDue[i] = nowMs + delay;
+        add(i, delay);
+    }
+
+    uint32_t runs = 0;
+    for (uint32_t pass = 0; runs < 5000; pass++) {
+        if (pass == 5000000) TEST_FAIL_MESSAGE("jobs stopped firing");
+        uint32_t wait = timerWheelMsUntilNext(wheel, nowMs, 1000);  // As schedWait() does
+        uint32_t n = jumpTo(nowMs + wait);
+        TEST_ASSERT_TRUE(wait == 1000 || n > 0);
+        runs += n;
+        firedCount = 0;
+    }
+    for (int i = 0; i < JOB_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, wheel.jobs[i].lateMs.max);
+    }
+    TEST_ASSERT_TRUE(wheel.cascaded > 0);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_fires_in_deadline_order);
+    RUN_TEST(test_same_deadline_fires_in_arm_order);
+    RUN_TEST(test_nothing_fires_early);
+    RUN_TEST(test_cancelled_job_does_not_fire);
+    RUN_TEST(test_cascades_land_on_the_deadline);
+    RUN_TEST(test_overflow_list_comes_back_down);
+    RUN_TEST(test_lateness_is_measured_from_the_deadline);
+    RUN_TEST(test_periodic_job_keeps_its_phase);
+    RUN_TEST(test_periodic_job_skips_missed_runs);
+    RUN_TEST(test_job_rearming_itself_fires_next_pass);
+    RUN_TEST(test_random_deadlines_fire_on_time);
+    return UNITY_END();
+}
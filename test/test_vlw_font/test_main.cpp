@@ -0,0 +1,359 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include "vlw_font.h"
+#include "host_bench.h"
+
+// ============================================================
+// VLW font tests: parsing fonts built in memory (sorted and not),
+// glyph lookups through the LRU cache and its byte and slot limits,
+// UTF-8 decoding, text width and the blend table, and a benchmark of
+// cached lookups for a clock string
+// ============================================================
+
+// --- Font files built in memory ---
+
+struct GlyphSpec {
+    uint32_t code;
+    int      w, h;
+    int      advance;
+    int      top, left;
+};
+
+struct FontFile {
+    uint8_t  data[160 * 1024];
+    uint32_t len;
+    uint32_t reads;             // read() calls served
+    bool     failReads;
+};
+
+static void putBE32(FontFile& f, uint32_t v) {
+    f.data[f.len++] = v >> 24;
+    f.data[f.len++] = v >> 16;
+    f.data[f.len++] = v >> 8;
+    f.data[f.len++] = v;
+}
+
+// Each glyph's alpha bytes are its code point's low byte plus the pixel
+// index, so a bitmap read from the wrong offset shows up
+static uint8_t alphaAt(uint32_t code, int i) {
+    return (uint8_t)(code + i);
+}
+
+static void buildFont(FontFile& f, uint16_t size, const GlyphSpec* glyphs, int count) {
+    f.len = 0;
+    f.reads = 0;
+    f.failReads = false;
+    putBE32(f, count);
+    putBE32(f, 11);             // Version
+    putBE32(f, size);
+    putBE32(f, 0);
+    putBE32(f, size);           // Header ascent/descent; the reader measures its own
+    putBE32(f, size / 4);
+    for (int i = 0; i < count; i++) {
+        const GlyphSpec& g = glyphs[i];
+        putBE32(f, g.code);
+        putBE32(f, g.h);
+        putBE32(f, g.w);
+        putBE32(f, g.advance);
+        putBE32(f, g.top);
+        putBE32(f, g.left);
+        putBE32(f, 0);
+    }
+    for (int i = 0; i < count; i++) {
+        for (int p = 0; p < glyphs[i].w * glyphs[i].h; p++) {
+            f.data[f.len++] = alphaAt(glyphs[i].code, p);
+        }
+    }
+}
+
+static bool readFont(void* ctx, uint32_t offset, uint8_t* dst, uint32_t len) {
+    FontFile& f = *(FontFile*)ctx;
+    f.reads++;
+    if (f.failReads || offset + len > f.len) return false;
+    memcpy(dst, f.data + offset, len);
+    return true;
+}
+
+// Digits, colon and space in code point order, as Processing writes them
+static const GlyphSpec CLOCK_GLYPHS[] = {
+    { ' ', 0, 0, 7, 0, 0 },
+    { '0', 14, 22, 17, 22, 1 }, { '1', 8, 22, 17, 22, 4 }, { '2', 14, 22, 17, 22, 1 },
+    { '3', 14, 22, 17, 22, 1 }, { '4', 15, 22, 17, 22, 1 }, { '5', 14, 22, 17, 22, 1 },
+    { '6', 14, 22, 17, 22, 1 }, { '7', 14, 22, 17, 22, 1 }, { '8', 14, 22, 17, 22, 1 },
+    { '9', 14, 22, 17, 22, 1 }, { ':', 4, 16, 8, 16, 2 },
+    { 'g', 12, 20, 14, 14, 1 },                     // Descends 6 below the baseline
+    { 0x00B0, 7, 7, 9, 22, 1 },                     // Degree sign
+    { 0x6708, 20, 21, 22, 19, 1 },                  // 月
+};
+static const int CLOCK_COUNT = sizeof(CLOCK_GLYPHS) / sizeof(CLOCK_GLYPHS[0]);
+
+static FontFile fileA, fileB;
+static VlwFont  fontA, fontB;
+
+void setUp() {
+    buildFont(fileA, 24, CLOCK_GLYPHS, CLOCK_COUNT);
+}
+
+void tearDown() {
+    if (fontA.index) vlwClose(fontA);
+    if (fontB.index) vlwClose(fontB);
+}
+
+static void checkGlyph(VlwFont& font, const GlyphSpec& spec) {
+    VlwGlyph g;
+    TEST_ASSERT_TRUE(vlwGetGlyph(font, spec.code, g));
+    TEST_ASSERT_EQUAL_UINT16(spec.w, g.width);
+    TEST_ASSERT_EQUAL_UINT16(spec.h, g.height);
+    TEST_ASSERT_EQUAL_INT16(spec.advance, g.xAdvance);
+    TEST_ASSERT_EQUAL_INT16(spec.top, g.topExtent);
+    TEST_ASSERT_EQUAL_INT16(spec.left, g.leftExtent);
+    if (spec.w * spec.h == 0) {
+        TEST_ASSERT_NULL(g.alpha);
+        return;
+    }
+    TEST_ASSERT_NOT_NULL(g.alpha);
+    for (int p = 0; p < spec.w * spec.h; p++) {
+        TEST_ASSERT_EQUAL_UINT8(alphaAt(spec.code, p), g.alpha[p]);
+    }
+}
+
+// --- Parsing ---
+
+static void test_open_reads_header_and_extents() {
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    TEST_ASSERT_EQUAL_UINT16(CLOCK_COUNT, fontA.glyphCount);
+    TEST_ASSERT_EQUAL_UINT16(24, fontA.size);
+    TEST_ASSERT_EQUAL_INT16(22, fontA.ascent);
+    TEST_ASSERT_EQUAL_INT16(6, fontA.descent);
+    TEST_ASSERT_EQUAL_INT(28, vlwLineHeight(fontA));
+    TEST_ASSERT_EQUAL_INT16(7, fontA.spaceAdvance);     // From the ' ' glyph
+}
+
+static void test_glyphs_match_their_records() {
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    for (int i = 0; i < CLOCK_COUNT; i++) checkGlyph(fontA, CLOCK_GLYPHS[i]);
+}
+
+// Bitmaps stay in file order even when the index has to be sorted
+static void test_unsorted_file_is_indexed() {
+    GlyphSpec shuffled[CLOCK_COUNT];
+    for (int i = 0; i < CLOCK_COUNT; i++) shuffled[i] = CLOCK_GLYPHS[(i * 7) % CLOCK_COUNT];
+    buildFont(fileA, 24, shuffled, CLOCK_COUNT);
+
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    for (int i = 1; i < CLOCK_COUNT; i++) {
+        TEST_ASSERT_TRUE(fontA.index[i - 1].code < fontA.index[i].code);
+    }
+    for (int i = 0; i < CLOCK_COUNT; i++) checkGlyph(fontA, CLOCK_GLYPHS[i]);
+}
+
+static void test_missing_glyph_gets_the_space_advance() {
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    uint32_t missingBefore = vlwCacheGetStats().missing;
+
+    VlwGlyph g;
+    TEST_ASSERT_FALSE(vlwGetGlyph(fontA, 'Q', g));
+    TEST_ASSERT_EQUAL_INT16(7, g.xAdvance);
+    TEST_ASSERT_EQUAL_UINT16(0, g.width);
+    TEST_ASSERT_NULL(g.alpha);
+    TEST_ASSERT_EQUAL_UINT32(missingBefore + 1, vlwCacheGetStats().missing);
+
+    // Without a space glyph the advance comes from the size
+    buildFont(fileB, 24, CLOCK_GLYPHS + 1, CLOCK_COUNT - 1);
+    TEST_ASSERT_TRUE(vlwOpen(fontB, readFont, &fileB));
+    TEST_ASSERT_EQUAL_INT16(24 / 4 + 1, fontB.spaceAdvance);
+}
+
+static void test_open_rejects_bad_files() {
+    static const GlyphSpec huge[] = { { 'A', 256, 10, 10, 10, 0 } };
+    buildFont(fileB, 24, huge, 1);
+    TEST_ASSERT_FALSE(vlwOpen(fontB, readFont, &fileB));
+
+    buildFont(fileB, 24, CLOCK_GLYPHS, 0);
+    TEST_ASSERT_FALSE(vlwOpen(fontB, readFont, &fileB));
+
+    buildFont(fileB, 24, CLOCK_GLYPHS, CLOCK_COUNT);
+    fileB.len = 24 + 28 * 3;                            // Cut inside the metrics
+    TEST_ASSERT_FALSE(vlwOpen(fontB, readFont, &fileB));
+
+    buildFont(fileB, 24, CLOCK_GLYPHS, CLOCK_COUNT);
+    fileB.failReads = true;
+    TEST_ASSERT_FALSE(vlwOpen(fontB, readFont, &fileB));
+    memset(&fontB, 0, sizeof(fontB));
+}
+
+// --- Cache ---
+
+static void test_cached_glyphs_do_not_touch_the_file() {
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    VlwGlyph g;
+    vlwGetGlyph(fontA, '7', g);
+    uint32_t reads = fileA.reads;
+    uint32_t hits  = vlwCacheGetStats().hits;
+
+    for (int i = 0; i < 10; i++) TEST_ASSERT_TRUE(vlwGetGlyph(fontA, '7', g));
+    TEST_ASSERT_EQUAL_UINT32(reads, fileA.reads);
+    TEST_ASSERT_EQUAL_UINT32(hits + 10, vlwCacheGetStats().hits);
+}
+
+// Same code point in two fonts: two entries, each with its own bitmap
+static void test_fonts_do_not_share_entries() {
+    static const GlyphSpec wide[] = { { '0', 3, 2, 5, 2, 0 } };
+    buildFont(fileB, 12, wide, 1);
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    TEST_ASSERT_TRUE(vlwOpen(fontB, readFont, &fileB));
+
+    checkGlyph(fontA, CLOCK_GLYPHS[1]);
+    checkGlyph(fontB, wide[0]);
+    checkGlyph(fontA, CLOCK_GLYPHS[1]);
+}
+
+// Over the byte budget the least recently used glyph goes first
+static void test_byte_budget_evicts_least_recent() {
+    // Four glyphs of just over a quarter of the budget: three fit
+    const int side = 56;
+    static_assert(3 * 56 * 56 <= VLW_CACHE_BYTES && 4 * 56 * 56 > VLW_CACHE_BYTES, "sizes");
+    GlyphSpec big[4];
+    for (int i = 0; i < 4; i++) big[i] = { (uint32_t)('A' + i), side, side, side, side, 0 };
+    buildFont(fileB, 60, big, 4);
+    TEST_ASSERT_TRUE(vlwOpen(fontB, readFont, &fileB));
+
+    VlwGlyph g;
+    vlwGetGlyph(fontB, 'A', g);
+    vlwGetGlyph(fontB, 'B', g);
+    vlwGetGlyph(fontB, 'C', g);
+    vlwGetGlyph(fontB, 'A', g);                         // B is now the oldest
+    uint32_t evictions = vlwCacheGetStats().evictions;
+    uint32_t misses    = vlwCacheGetStats().misses;
+
+    checkGlyph(fontB, big[3]);                          // D pushes B out
+    TEST_ASSERT_EQUAL_UINT32(evictions + 1, vlwCacheGetStats().evictions);
+    TEST_ASSERT_TRUE(vlwCacheGetStats().bytes <= VLW_CACHE_BYTES);
+
+    checkGlyph(fontB, big[0]);                          // A and C stayed
+    checkGlyph(fontB, big[2]);
+    TEST_ASSERT_EQUAL_UINT32(misses + 1, vlwCacheGetStats().misses);
+    checkGlyph(fontB, big[1]);                          // B comes back from the file
+    TEST_ASSERT_EQUAL_UINT32(misses + 2, vlwCacheGetStats().misses);
+}
+
+// More glyphs than slots: the oldest slot is reused
+static void test_slot_limit_evicts_least_recent() {
+    const int n = VLW_CACHE_GLYPHS + 4;
+    static GlyphSpec tiny[VLW_CACHE_GLYPHS + 4];
+    for (int i = 0; i < n; i++) tiny[i] = { (uint32_t)(0x4E00 + i), 1, 1, 10, 10, 0 };
+    buildFont(fileB, 12, tiny, n);
+    TEST_ASSERT_TRUE(vlwOpen(fontB, readFont, &fileB));
+
+    VlwGlyph g;
+    for (int i = 0; i < n; i++) TEST_ASSERT_TRUE(vlwGetGlyph(fontB, tiny[i].code, g));
+    TEST_ASSERT_EQUAL_UINT16(VLW_CACHE_GLYPHS, vlwCacheGetStats().glyphs);
+
+    uint32_t misses = vlwCacheGetStats().misses;
+    vlwGetGlyph(fontB, tiny[n - 1].code, g);            // Recent: still cached
+    TEST_ASSERT_EQUAL_UINT32(misses, vlwCacheGetStats().misses);
+    vlwGetGlyph(fontB, tiny[0].code, g);                // Oldest: was evicted
+    TEST_ASSERT_EQUAL_UINT32(misses + 1, vlwCacheGetStats().misses);
+}
+
+static void test_close_drops_the_fonts_glyphs() {
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    static const GlyphSpec one[] = { { 'x', 5, 5, 6, 5, 0 } };
+    buildFont(fileB, 12, one, 1);
+    TEST_ASSERT_TRUE(vlwOpen(fontB, readFont, &fileB));
+
+    VlwGlyph g;
+    vlwGetGlyph(fontA, '0', g);
+    vlwGetGlyph(fontA, '1', g);
+    vlwGetGlyph(fontB, 'x', g);
+    uint32_t bytes = vlwCacheGetStats().bytes;
+
+    vlwClose(fontA);
+    TEST_ASSERT_EQUAL_UINT32(25, vlwCacheGetStats().bytes);
+    TEST_ASSERT_EQUAL_UINT16(1, vlwCacheGetStats().glyphs);
+    TEST_ASSERT_TRUE(bytes > 25);
+    TEST_ASSERT_NULL(fontA.index);
+    checkGlyph(fontB, one[0]);
+}
+
+// --- Text ---
+
+static void test_utf8_decoding() {
+    const char* s = "A\xC2\xB0\xE6\x9C\x88\xF0\x9F\x98\x80";     // A ° 月 😀
+    TEST_ASSERT_EQUAL_HEX32(0x41, vlwNextCodepoint(s));
+    TEST_ASSERT_EQUAL_HEX32(0xB0, vlwNextCodepoint(s));
+    TEST_ASSERT_EQUAL_HEX32(0x6708, vlwNextCodepoint(s));
+    TEST_ASSERT_EQUAL_HEX32(0x1F600, vlwNextCodepoint(s));
+    TEST_ASSERT_EQUAL_INT(0, *s);
+
+    // A stray continuation byte, and a lead byte cut short by ASCII
+    const char* bad = "\x80Z\xE6\x9CZ";
+    TEST_ASSERT_EQUAL_HEX32(0xFFFD, vlwNextCodepoint(bad));
+    TEST_ASSERT_EQUAL_HEX32('Z', vlwNextCodepoint(bad));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFD, vlwNextCodepoint(bad));
+    TEST_ASSERT_EQUAL_HEX32('Z', vlwNextCodepoint(bad));    // Not swallowed
+    TEST_ASSERT_EQUAL_INT(0, *bad);
+
+    const char* end = "\xE6";                               // Cut by the terminator
+    TEST_ASSERT_EQUAL_HEX32(0xFFFD, vlwNextCodepoint(end));
+    TEST_ASSERT_EQUAL_INT(0, *end);
+}
+
+static void test_text_width_sums_advances() {
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    TEST_ASSERT_EQUAL_INT(4 * 17 + 8, vlwTextWidth(fontA, "10:59"));
+    TEST_ASSERT_EQUAL_INT(17 + 17 + 9, vlwTextWidth(fontA, "21\xC2\xB0"));
+    TEST_ASSERT_EQUAL_INT(17 + 7 + 22, vlwTextWidth(fontA, "3Q\xE6\x9C\x88"));  // Q missing
+    TEST_ASSERT_EQUAL_INT(0, vlwTextWidth(fontA, ""));
+}
+
+static void test_blend_lut_runs_from_bg_to_fg() {
+    uint16_t lut[16];
+    vlwBlendLut(0xFFFF, 0x0000, lut);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, lut[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, lut[15]);
+    for (int i = 1; i < 16; i++) {
+        TEST_ASSERT_TRUE((lut[i] >> 11) >= (lut[i - 1] >> 11));
+        TEST_ASSERT_TRUE(((lut[i] >> 5) & 0x3F) >= ((lut[i - 1] >> 5) & 0x3F));
+    }
+
+    vlwBlendLut(0xF800, 0x001F, lut);                       // Red over blue
+    TEST_ASSERT_EQUAL_HEX16(0x001F, lut[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xF800, lut[15]);
+    TEST_ASSERT_EQUAL_HEX16((17 << 11) | 14, lut[8]);        // 8/15 of 31 rounds to 17, 7/15 to 14
+}
+
+// --- Benchmark ---
+
+static void test_bench_clock_string_width() {
+    TEST_ASSERT_TRUE(vlwOpen(fontA, readFont, &fileA));
+    vlwTextWidth(fontA, "0123456789:");                     // Warm the cache
+    uint32_t reads = fileA.reads;
+
+    static const char* const times[] = { "10:08", "10:09", "23:59", "00:00" };
+    double ns = benchNsPerIter(200000, [](uint32_t i) {
+        benchSink += vlwTextWidth(fontA, times[i & 3]);
+    });
+    TEST_ASSERT_EQUAL_UINT32(reads, fileA.reads);
+    BENCH_REPORT("vlwTextWidth(\"HH:MM\"), all cached: %.0f ns (%.0f ns per glyph)", ns, ns / 5);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_open_reads_header_and_extents);
+    RUN_TEST(test_glyphs_match_their_records);
+    RUN_TEST(test_unsorted_file_is_indexed);
+    RUN_TEST(test_missing_glyph_gets_the_space_advance);
+    RUN_TEST(test_open_rejects_bad_files);
+    RUN_TEST(test_cached_glyphs_do_not_touch_the_file);
+    RUN_TEST(test_fonts_do_not_share_entries);
+    RUN_TEST(test_byte_budget_evicts_least_recent);
+    RUN_TEST(test_slot_limit_evicts_least_recent);
+    RUN_TEST(test_close_drops_the_fonts_glyphs);
+    RUN_TEST(test_utf8_decoding);
+    RUN_TEST(test_text_width_sums_advances);
+    RUN_TEST(test_blend_lut_runs_from_bg_to_fg);
+    RUN_TEST(test_bench_clock_string_width);
+    return UNITY_END();
+}
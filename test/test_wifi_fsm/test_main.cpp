@@ -0,0 +1,388 @@
+#include <stdio.h>
+#include <unity.h>
+#include "config.h"
+#include "wifi_fsm.h"
+
+// ============================================================
+// WiFi FSM tests: scripted event sequences replayed against the
+// firmware's own timeouts, polled on the wifi job's idle grid
+// ============================================================
+
+static const uint32_t POLL_MS = SCHED_IDLE_POLL_MS;    // wifiPollMs() away from a scan or the portal
+
+static WifiFsm fsm;
+
+void setUp() {
+    // As wifiInit() sets it up
+    WifiFsmConfig cfg;
+    cfg.connectTimeoutMs = WIFI_CONNECT_TIMEOUT_MS;
+    cfg.fastTimeoutMs    = WIFI_FAST_TIMEOUT_MS;
+    cfg.refusedRetryMs   = WIFI_REFUSED_RETRY_MS;
+    cfg.attempts         = WIFI_RETRY_ATTEMPTS;
+    cfg.backoffMs        = WIFI_RETRY_DELAY_MS;
+    cfg.quickTimeoutMs   = WIFI_QUICK_TIMEOUT_MS;
+    cfg.quickAttempts    = WIFI_QUICK_ATTEMPTS;
+    cfg.quickGapMs       = WIFI_MONITOR_INTERVAL;
+    cfg.apRetryMs        = WIFI_RECONNECT_INTERVAL;
+    wifiFsmInit(fsm, cfg);
+}
+
+void tearDown() {}
+
+// --- Replay ---
+
+enum StepKind {
+    START,                      // wifiFsmStart() with saved creds
+    START_NO_CREDS,
+    EVENT,
+    POLL                        // A deadline that must act at exactly atMs
+};
+
+struct Step {
+    uint32_t     atMs;
+    StepKind     kind;
+    WifiFsmEvent event;         // EVENT only
+    uint8_t      actions;       // Expected
+    WifiFsmState state;         // Expected after the step
+};
+
+static const uint8_t DISCONNECT  = WIFI_ACT_DISCONNECT;
+static const uint8_t STOP_AP     = WIFI_ACT_STOP_AP;
+static const uint8_t FORGET_FAST = WIFI_ACT_FORGET_FAST;
+static const uint8_t BEGIN       = WIFI_ACT_BEGIN;
+static const uint8_t START_AP    = WIFI_ACT_START_AP;
+
+// Run the steps in order. Between steps the FSM is polled on the POLL_MS
+// grid and must do nothing, so every action happens at its step and no
+// deadline fires early.
+static void replay(const Step* steps, int count) {
+    uint32_t now = 0;
+    for (int i = 0; i < count; i++) {
+        const Step& s = steps[i];
+        for (uint32_t t = (now / POLL_MS + 1) * POLL_MS; t < s.atMs; t += POLL_MS) {
+            char msg[64];
+            snprintf(msg, sizeof(msg), "step %d: early action at %u ms", i, (unsigned)t);
+            TEST_ASSERT_EQUAL_HEX8_MESSAGE(WIFI_ACT_NONE, wifiFsmPoll(fsm, t), msg);
+        }
+        now = s.atMs;
+
+        uint8_t actions = WIFI_ACT_NONE;
+        switch (s.kind) {
+            case START:          actions = wifiFsmStart(fsm, now, true);  break;
+            case START_NO_CREDS: actions = wifiFsmStart(fsm, now, false); break;
+            case EVENT:          actions = wifiFsmEvent(fsm, s.event, now); break;
+            case POLL:           actions = wifiFsmPoll(fsm, now); break;
+        }
+
+        char msg[64];
+        snprintf(msg, sizeof(msg), "step %d at %u ms", i, (unsigned)now);
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE(s.actions, actions, msg);
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(wifiFsmStateName(s.state), wifiFsmStateName(fsm.state), msg);
+    }
+}
+
+#define REPLAY(steps) replay(steps, sizeof(steps) / sizeof(steps[0]))
+
+// --- Boot ---
+
+static void test_boot_with_creds_connects() {
+    static const Step steps[] = {
+        { 0,    START, {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { 4200, EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE, WIFI_FSM_CONNECTED  },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.connects);
+    TEST_ASSERT_EQUAL_UINT32(4200, fsm.stats.lastConnectMs);
+    TEST_ASSERT_FALSE(fsm.fast);
+}
+
+// With nothing saved the portal comes up at once, and stays up: the AP
+// retry deadline passes without an attempt
+static void test_boot_without_creds_goes_ap() {
+    static const Step steps[] = {
+        { 0,                               START_NO_CREDS, {}, START_AP,      WIFI_FSM_AP },
+        { WIFI_RECONNECT_INTERVAL,         POLL,           {}, WIFI_ACT_NONE, WIFI_FSM_AP },
+        { WIFI_RECONNECT_INTERVAL * 2 + 5, POLL,           {}, WIFI_ACT_NONE, WIFI_FSM_AP },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_EQUAL_UINT32(0, fsm.stats.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.apFallbacks);
+}
+
+// --- Attempts ---
+
+// A refusal (no AP found, bad auth) re-issues the attempt within the same
+// window instead of failing it
+static void test_refused_attempt_is_reissued() {
+    static const Step steps[] = {
+        { 0,    START, {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { 800,  EVENT, WIFI_EV_LOST,   WIFI_ACT_NONE, WIFI_FSM_CONNECTING },
+        { 1800, POLL,  {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { 2100, EVENT, WIFI_EV_LOST,   WIFI_ACT_NONE, WIFI_FSM_CONNECTING },
+        { 3100, POLL,  {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { 5000, EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE, WIFI_FSM_CONNECTED  },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_EQUAL_UINT32(3, fsm.stats.attempts);
+    TEST_ASSERT_EQUAL_UINT32(0, fsm.stats.failures);
+    TEST_ASSERT_EQUAL_UINT32(5000, fsm.stats.lastConnectMs);
+}
+
+// Re-issues do not stretch the window: it still closes on time
+static void test_refusals_do_not_extend_the_window() {
+    static const Step steps[] = {
+        { 0,                       START, {},           BEGIN,         WIFI_FSM_CONNECTING },
+        { 29500,                   EVENT, WIFI_EV_LOST, WIFI_ACT_NONE, WIFI_FSM_CONNECTING },
+        { WIFI_CONNECT_TIMEOUT_MS, POLL,  {},           DISCONNECT,    WIFI_FSM_BACKOFF    },
+    };
+    REPLAY(steps);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.failures);
+}
+
+static void test_timeout_backs_off_then_connects() {
+    const uint32_t t1 = WIFI_CONNECT_TIMEOUT_MS;
+    const uint32_t t2 = t1 + WIFI_RETRY_DELAY_MS;
+    const Step steps[] = {
+        { 0,         START, {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { t1,        POLL,  {},             DISCONNECT,    WIFI_FSM_BACKOFF    },
+        { t2,        POLL,  {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { t2 + 3000, EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE, WIFI_FSM_CONNECTED  },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.failures);
+    TEST_ASSERT_EQUAL_UINT32(t2 + 3000, fsm.stats.lastConnectMs);   // From the round's first attempt
+}
+
+// An IP that lands during the backoff still counts
+static void test_late_ip_during_backoff_connects() {
+    static const Step steps[] = {
+        { 0,                              START, {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { WIFI_CONNECT_TIMEOUT_MS,        POLL,  {},             DISCONNECT,    WIFI_FSM_BACKOFF    },
+        { WIFI_CONNECT_TIMEOUT_MS + 500,  EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE, WIFI_FSM_CONNECTED  },
+        { WIFI_CONNECT_TIMEOUT_MS + 5000, POLL,  {},             WIFI_ACT_NONE, WIFI_FSM_CONNECTED  },
+    };
+    REPLAY(steps);
+}
+
+// --- AP fallback ---
+
+// Every attempt of the round fails, backing off 2 s then 4 s; the third
+// failure brings up the portal, and the AP retry tears it down for a
+// fresh round
+static void test_failed_round_falls_back_to_ap_and_retries() {
+    const uint32_t fail1  = WIFI_CONNECT_TIMEOUT_MS;
+    const uint32_t begin2 = fail1 + WIFI_RETRY_DELAY_MS;
+    const uint32_t fail2  = begin2 + WIFI_CONNECT_TIMEOUT_MS;
+    const uint32_t begin3 = fail2 + WIFI_RETRY_DELAY_MS * 2;
+    const uint32_t fail3  = begin3 + WIFI_CONNECT_TIMEOUT_MS;
+    const uint32_t retry  = fail3 + WIFI_RECONNECT_INTERVAL;
+    const Step steps[] = {
+        { 0,            START, {},             BEGIN,                 WIFI_FSM_CONNECTING },
+        { fail1,        POLL,  {},             DISCONNECT,            WIFI_FSM_BACKOFF    },
+        { begin2,       POLL,  {},             BEGIN,                 WIFI_FSM_CONNECTING },
+        { fail2,        POLL,  {},             DISCONNECT,            WIFI_FSM_BACKOFF    },
+        { begin3,       POLL,  {},             BEGIN,                 WIFI_FSM_CONNECTING },
+        { fail3,        POLL,  {},             DISCONNECT | START_AP, WIFI_FSM_AP         },
+        { retry,        POLL,  {},             STOP_AP | BEGIN,       WIFI_FSM_CONNECTING },
+        { retry + 6000, EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE,         WIFI_FSM_CONNECTED  },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_EQUAL_UINT32(WIFI_RETRY_ATTEMPTS, fsm.stats.failures);
+    TEST_ASSERT_EQUAL_UINT32(WIFI_RETRY_ATTEMPTS + 1, fsm.stats.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.apFallbacks);
+    TEST_ASSERT_EQUAL_UINT32(6000, fsm.stats.lastConnectMs);
+}
+
+// The retry from AP is a full round: its backoff starts over at 2 s
+static void test_ap_retry_round_restarts_backoff() {
+    const uint32_t apAt  = WIFI_CONNECT_TIMEOUT_MS * 3 + WIFI_RETRY_DELAY_MS * 3;
+    const uint32_t retry = apAt + WIFI_RECONNECT_INTERVAL;
+    const uint32_t fail  = retry + WIFI_CONNECT_TIMEOUT_MS;
+    const Step steps[] = {
+        { 0,                          START, {}, BEGIN,                 WIFI_FSM_CONNECTING },
+        { WIFI_CONNECT_TIMEOUT_MS,    POLL,  {}, DISCONNECT,            WIFI_FSM_BACKOFF    },
+        { WIFI_CONNECT_TIMEOUT_MS + WIFI_RETRY_DELAY_MS,
+                                      POLL,  {}, BEGIN,                 WIFI_FSM_CONNECTING },
+        { WIFI_CONNECT_TIMEOUT_MS * 2 + WIFI_RETRY_DELAY_MS,
+                                      POLL,  {}, DISCONNECT,            WIFI_FSM_BACKOFF    },
+        { WIFI_CONNECT_TIMEOUT_MS * 2 + WIFI_RETRY_DELAY_MS * 3,
+                                      POLL,  {}, BEGIN,                 WIFI_FSM_CONNECTING },
+        { apAt,                       POLL,  {}, DISCONNECT | START_AP, WIFI_FSM_AP         },
+        { retry,                      POLL,  {}, STOP_AP | BEGIN,       WIFI_FSM_CONNECTING },
+        { fail,                       POLL,  {}, DISCONNECT,            WIFI_FSM_BACKOFF    },
+        { fail + WIFI_RETRY_DELAY_MS, POLL,  {}, BEGIN,                 WIFI_FSM_CONNECTING },
+    };
+    REPLAY(steps);
+}
+
+static void test_forced_ap_from_connected() {
+    static const Step steps[] = {
+        { 0,    START, {},               BEGIN,                 WIFI_FSM_CONNECTING },
+        { 3000, EVENT, WIFI_EV_GOT_IP,   WIFI_ACT_NONE,         WIFI_FSM_CONNECTED  },
+        { 9000, EVENT, WIFI_EV_FORCE_AP, DISCONNECT | START_AP, WIFI_FSM_AP         },
+        { 9500, EVENT, WIFI_EV_FORCE_AP, WIFI_ACT_NONE,         WIFI_FSM_AP         },
+    };
+    REPLAY(steps);
+}
+
+// --- Drops ---
+
+// A working link that drops gets a quick round: the shorter timeout, then
+// reconnects on the first attempt
+static void test_drop_while_connected_reconnects_quickly() {
+    static const Step steps[] = {
+        { 0,      START, {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { 3000,   EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE, WIFI_FSM_CONNECTED  },
+        { 100000, EVENT, WIFI_EV_LOST,   BEGIN,         WIFI_FSM_CONNECTING },
+        { 102500, EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE, WIFI_FSM_CONNECTED  },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.drops);
+    TEST_ASSERT_EQUAL_UINT32(2, fsm.stats.connects);
+    TEST_ASSERT_EQUAL_UINT32(2500, fsm.stats.lastConnectMs);
+    TEST_ASSERT_FALSE(fsm.quick);
+}
+
+// A link that stays down: quick attempts a fixed gap apart, then AP
+static void test_drop_that_stays_down_falls_back_to_ap() {
+    const uint32_t drop  = 100000;
+    const uint32_t fail1 = drop + WIFI_QUICK_TIMEOUT_MS;
+    const uint32_t try2  = fail1 + WIFI_MONITOR_INTERVAL;
+    const uint32_t fail2 = try2 + WIFI_QUICK_TIMEOUT_MS;
+    const uint32_t try3  = fail2 + WIFI_MONITOR_INTERVAL;
+    const uint32_t fail3 = try3 + WIFI_QUICK_TIMEOUT_MS;
+    const Step steps[] = {
+        { 0,     START, {},             BEGIN,                 WIFI_FSM_CONNECTING },
+        { 3000,  EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE,         WIFI_FSM_CONNECTED  },
+        { drop,  EVENT, WIFI_EV_LOST,   BEGIN,                 WIFI_FSM_CONNECTING },
+        { fail1, POLL,  {},             DISCONNECT,            WIFI_FSM_BACKOFF    },
+        { try2,  POLL,  {},             BEGIN,                 WIFI_FSM_CONNECTING },
+        { fail2, POLL,  {},             DISCONNECT,            WIFI_FSM_BACKOFF    },
+        { try3,  POLL,  {},             BEGIN,                 WIFI_FSM_CONNECTING },
+        { fail3, POLL,  {},             DISCONNECT | START_AP, WIFI_FSM_AP         },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_EQUAL_UINT32(WIFI_QUICK_ATTEMPTS, fsm.stats.failures);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.drops);
+}
+
+// A LOST outside an attempt or a link (our own disconnect echoing back)
+// changes nothing
+static void test_stray_lost_is_ignored() {
+    static const Step steps[] = {
+        { 0,                             START, {},           BEGIN,         WIFI_FSM_CONNECTING },
+        { WIFI_CONNECT_TIMEOUT_MS,       POLL,  {},           DISCONNECT,    WIFI_FSM_BACKOFF    },
+        { WIFI_CONNECT_TIMEOUT_MS + 100, EVENT, WIFI_EV_LOST, WIFI_ACT_NONE, WIFI_FSM_BACKOFF    },
+    };
+    REPLAY(steps);
+    TEST_ASSERT_EQUAL_UINT32(0, fsm.stats.drops);
+}
+
+// --- Fast path ---
+
+static void test_fast_path_hit() {
+    fsm.haveFast = true;
+    static const Step steps[] = {
+        { 0,   START, {},             BEGIN,         WIFI_FSM_CONNECTING },
+        { 700, EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE, WIFI_FSM_CONNECTED  },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_TRUE(fsm.fast);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.fastConnects);
+    TEST_ASSERT_EQUAL_UINT32(0, fsm.stats.fastMisses);
+}
+
+// The cached AP times out: FORGET_FAST, and the same attempt runs again
+// the full way with the full timeout, costing the round nothing
+static void test_fast_path_timeout_forgets_cache() {
+    fsm.haveFast = true;
+    const uint32_t full = WIFI_FAST_TIMEOUT_MS;
+    const Step steps[] = {
+        { 0,                              START, {}, BEGIN,                            WIFI_FSM_CONNECTING },
+        { full,                           POLL,  {}, DISCONNECT | FORGET_FAST | BEGIN, WIFI_FSM_CONNECTING },
+        { full + WIFI_CONNECT_TIMEOUT_MS, POLL,  {}, DISCONNECT,                       WIFI_FSM_BACKOFF    },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_FALSE(fsm.haveFast);
+    TEST_ASSERT_FALSE(fsm.fast);
+    TEST_ASSERT_EQUAL_UINT8(1, fsm.attempt);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.fastMisses);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.failures);   // Only the full attempt counts
+}
+
+// Refused at the cached AP (wrong channel, AP gone): forgotten at once,
+// no refusal retry at the stale BSSID
+static void test_fast_path_refusal_forgets_cache() {
+    fsm.haveFast = true;
+    static const Step steps[] = {
+        { 0,    START, {},             BEGIN,                            WIFI_FSM_CONNECTING },
+        { 400,  EVENT, WIFI_EV_LOST,   DISCONNECT | FORGET_FAST | BEGIN, WIFI_FSM_CONNECTING },
+        { 6000, EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE,                    WIFI_FSM_CONNECTED  },
+    };
+    REPLAY(steps);
+
+    TEST_ASSERT_FALSE(fsm.fast);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.fastMisses);
+    TEST_ASSERT_EQUAL_UINT32(0, fsm.stats.fastConnects);
+    TEST_ASSERT_EQUAL_UINT32(6000, fsm.stats.lastConnectMs);
+}
+
+// After a drop the quick round tries the cached AP first too
+static void test_drop_retries_fast_path_first() {
+    fsm.haveFast = true;
+    const uint32_t drop = 50000;
+    const Step steps[] = {
+        { 0,                           START, {},             BEGIN,                            WIFI_FSM_CONNECTING },
+        { 800,                         EVENT, WIFI_EV_GOT_IP, WIFI_ACT_NONE,                    WIFI_FSM_CONNECTED  },
+        { drop,                        EVENT, WIFI_EV_LOST,   BEGIN,                            WIFI_FSM_CONNECTING },
+        { drop + WIFI_FAST_TIMEOUT_MS, POLL,  {},             DISCONNECT | FORGET_FAST | BEGIN, WIFI_FSM_CONNECTING },
+        { drop + WIFI_FAST_TIMEOUT_MS + WIFI_QUICK_TIMEOUT_MS,
+                                       POLL,  {},             DISCONNECT,                       WIFI_FSM_BACKOFF    },
+    };
+    REPLAY(steps);
+    TEST_ASSERT_EQUAL_UINT32(1, fsm.stats.fastMisses);
+}
+
+// --- Clock ---
+
+// millis() wraps after 49.7 days; deadlines straddling it still fire on time
+static void test_deadlines_across_millis_wrap() {
+    const uint32_t t0 = 0xFFFFFFFFu - 10000;
+    TEST_ASSERT_EQUAL_HEX8(BEGIN, wifiFsmStart(fsm, t0, true));
+    TEST_ASSERT_EQUAL_HEX8(WIFI_ACT_NONE, wifiFsmPoll(fsm, t0 + 20000));
+    TEST_ASSERT_EQUAL_HEX8(DISCONNECT, wifiFsmPoll(fsm, t0 + WIFI_CONNECT_TIMEOUT_MS));
+    TEST_ASSERT_EQUAL_HEX8(WIFI_ACT_NONE, wifiFsmPoll(fsm, t0 + WIFI_CONNECT_TIMEOUT_MS + 1999));
+    TEST_ASSERT_EQUAL_HEX8(BEGIN, wifiFsmPoll(fsm, t0 + WIFI_CONNECT_TIMEOUT_MS + WIFI_RETRY_DELAY_MS));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_boot_with_creds_connects);
+    RUN_TEST(test_boot_without_creds_goes_ap);
+    RUN_TEST(test_refused_attempt_is_reissued);
+    RUN_TEST(test_refusals_do_not_extend_the_window);
+    RUN_TEST(test_timeout_backs_off_then_connects);
+    RUN_TEST(test_late_ip_during_backoff_connects);
+    RUN_TEST(test_failed_round_falls_back_to_ap_and_retries);
+    RUN_TEST(test_ap_retry_round_restarts_backoff);
+    RUN_TEST(test_forced_ap_from_connected);
+    RUN_TEST(test_drop_while_connected_reconnects_quickly);
+    RUN_TEST(test_drop_that_stays_down_falls_back_to_ap);
+    RUN_TEST(test_stray_lost_is_ignored);
+    RUN_TEST(test_fast_path_hit);
+    RUN_TEST(test_fast_path_timeout_forgets_cache);
+    RUN_TEST(test_fast_path_refusal_forgets_cache);
+    RUN_TEST(test_drop_retries_fast_path_first);
+    RUN_TEST(test_deadlines_across_millis_wrap);
+    return UNITY_END();
+}
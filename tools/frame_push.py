@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""Push frames to a SmallTV over the UDP tile-delta protocol.
+
+Frames are cut into 16x16 tiles; only tiles that differ from the previous
+frame are sent, each as raw RGB565 or RLE565, whichever is smaller. The
+protocol is documented in src/remote_display.h. Standard library only.
+
+  python3 tools/frame_push.py 192.168.1.50 --image status.ppm
+  python3 tools/frame_push.py 192.168.1.50 --fps 30 --frames 300   # demo pattern
+  python3 tools/frame_push.py --loopback --frames 500
+
+--loopback runs a receiver on 127.0.0.1 that parses and applies every tile
+the way the firmware does, and reports frames/s and bytes/frame.
+"""
+
+import argparse
+import math
+import os
+import socket
+import struct
+import sys
+import threading
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from pack_icons import encode_row  # noqa: E402  (same RLE565 packets)
+
+WIDTH = HEIGHT = 240
+TILE = 16
+TILES_X, TILES_Y = WIDTH // TILE, HEIGHT // TILE
+PORT = 7070                     # REMOTE_DISPLAY_PORT
+MAX_PAYLOAD = 1472              # One Ethernet-MTU UDP datagram
+HEADER = struct.Struct("<2sBBHBB")
+TILE_HEADER = struct.Struct("<BBBBH")
+FLAG_END_OF_FRAME = 0x01
+ENC_RAW, ENC_RLE565 = 0, 1
+
+
+# --- Frames (lists of RGB565 ints, row-major) ---
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def load_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    parts, pos = [], 0
+    while len(parts) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        parts.append(data[pos:end])
+        pos = end
+    pos += 1
+    if parts[0] != b"P6" or int(parts[3]) != 255:
+        sys.exit(f"{path}: need binary 8-bit PPM (P6)")
+    w, h = int(parts[1]), int(parts[2])
+    if (w, h) != (WIDTH, HEIGHT):
+        sys.exit(f"{path}: must be {WIDTH}x{HEIGHT}")
+    px = data[pos:pos + w * h * 3]
+    return [rgb565(px[i], px[i + 1], px[i + 2]) for i in range(0, len(px), 3)]
+
+
+def demo_frame(n):
+    """Static background with a moving ball and a counter bar: mostly
+    unchanged tiles, like a real status display."""
+    frame = [rgb565(0, 0, 40)] * (WIDTH * HEIGHT)
+    cx = int(WIDTH / 2 + 80 * math.cos(n / 20))
+    cy = int(HEIGHT / 2 + 80 * math.sin(n / 20))
+    for y in range(max(0, cy - 12), min(HEIGHT, cy + 12)):
+        for x in range(max(0, cx - 12), min(WIDTH, cx + 12)):
+            if (x - cx) ** 2 + (y - cy) ** 2 <= 144:
+                frame[y * WIDTH + x] = rgb565(255, 200, 40)
+    bar = (n * 3) % WIDTH
+    for y in range(HEIGHT - 8, HEIGHT):
+        for x in range(bar):
+            frame[y * WIDTH + x] = rgb565(0, 200, 255)
+    return frame
+
+
+# --- Encoding ---
+
+def tile_pixels(frame, tx, ty):
+    rows = []
+    for y in range(ty * TILE, ty * TILE + TILE):
+        rows.append(frame[y * WIDTH + tx * TILE:y * WIDTH + tx * TILE + TILE])
+    return rows
+
+
+def encode_tile(rows):
+    raw = b"".join(struct.pack(">%dH" % TILE, *row) for row in rows)
+    rle = b"".join(bytes(encode_row(row)) for row in rows)
+    return (ENC_RLE565, rle) if len(rle) < len(raw) else (ENC_RAW, raw)
+
+
+def build_packets(frame, prev, seq):
+    """Datagrams for every tile that changed since prev (None = all)."""
+    records = []
+    for ty in range(TILES_Y):
+        for tx in range(TILES_X):
+            rows = tile_pixels(frame, tx, ty)
+            if prev is not None and rows == tile_pixels(prev, tx, ty):
+                continue
+            enc, payload = encode_tile(rows)
+            records.append(TILE_HEADER.pack(tx, ty, enc, 0, len(payload)) + payload)
+
+    packets, body, count = [], b"", 0
+    for rec in records:
+        if HEADER.size + len(body) + len(rec) > MAX_PAYLOAD or count == 255:
+            packets.append((body, count))
+            body, count = b"", 0
+        body += rec
+        count += 1
+    packets.append((body, count))   # Last (possibly empty) one presents
+
+    out = []
+    for i, (body, count) in enumerate(packets):
+        flags = FLAG_END_OF_FRAME if i == len(packets) - 1 else 0
+        out.append(HEADER.pack(b"ST", 1, flags, seq & 0xFFFF, count, 0) + body)
+    return out
+
+
+# --- Loopback receiver (mirrors src/remote_display.cpp) ---
+
+def decode_rle(payload):
+    out, pos = bytearray(), 0
+    while pos < len(payload):
+        h = payload[pos]
+        n = (h & 0x7F) + 1
+        if h & 0x80:
+            out += payload[pos + 1:pos + 3] * n
+            pos += 3
+        else:
+            out += payload[pos + 1:pos + 1 + n * 2]
+            pos += 1 + n * 2
+    return bytes(out)
+
+
+class Receiver(threading.Thread):
+    def __init__(self, sock):
+        super().__init__(daemon=True)
+        self.sock = sock
+        self.fb = bytearray(WIDTH * HEIGHT * 2)
+        self.frames = self.tiles = self.bytes = 0
+        self.done = threading.Event()
+
+    def run(self):
+        while not self.done.is_set():
+            try:
+                data = self.sock.recv(65535)
+            except socket.timeout:
+                continue
+            self.bytes += len(data)
+            magic, ver, flags, _, count, _ = HEADER.unpack_from(data)
+            if magic != b"ST" or ver != 1:
+                continue
+            pos = HEADER.size
+            for _ in range(count):
+                tx, ty, enc, _, plen = TILE_HEADER.unpack_from(data, pos)
+                payload = data[pos + TILE_HEADER.size:pos + TILE_HEADER.size + plen]
+                pos += TILE_HEADER.size + plen
+                px = payload if enc == ENC_RAW else decode_rle(payload)
+                for row in range(TILE):
+                    dst = ((ty * TILE + row) * WIDTH + tx * TILE) * 2
+                    self.fb[dst:dst + TILE * 2] = px[row * TILE * 2:(row + 1) * TILE * 2]
+                self.tiles += 1
+            if flags & FLAG_END_OF_FRAME:
+                self.frames += 1
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("host", nargs="?", help="device IP (omit with --loopback)")
+    ap.add_argument("--port", type=int, default=PORT)
+    ap.add_argument("--image", help="240x240 binary PPM to show once (default: animated demo)")
+    ap.add_argument("--fps", type=float, default=0, help="pace frames (0 = as fast as possible)")
+    ap.add_argument("--frames", type=int, default=100)
+    ap.add_argument("--loopback", action="store_true", help="benchmark against a local receiver")
+    args = ap.parse_args()
+
+    if not args.loopback and not args.host:
+        ap.error("host is required unless --loopback is given")
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    receiver = None
+    target = (args.host, args.port)
+    if args.loopback:
+        rsock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        rsock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 4 << 20)
+        rsock.bind(("127.0.0.1", 0))
+        rsock.settimeout(0.2)
+        receiver = Receiver(rsock)
+        receiver.start()
+        target = rsock.getsockname()
+
+    if args.image:
+        frames = [load_ppm(args.image)]
+    else:
+        frames = None
+
+    prev, sent_bytes, sent_packets = None, 0, 0
+    count = 1 if frames else args.frames
+    start = time.perf_counter()
+
+    for n in range(count):
+        frame = frames[0] if frames else demo_frame(n)
+        for pkt in build_packets(frame, prev, n):
+            sock.sendto(pkt, target)
+            sent_bytes += len(pkt)
+            sent_packets += 1
+        prev = frame
+        if args.fps:
+            delay = start + (n + 1) / args.fps - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+
+    elapsed = time.perf_counter() - start
+    print(f"sent {count} frames, {sent_packets} packets, {sent_bytes} bytes in {elapsed:.2f} s")
+    print(f"  {count / elapsed:.1f} frames/s, {sent_bytes / count:.0f} bytes/frame "
+          f"(full raw frame {WIDTH * HEIGHT * 2})")
+
+    if receiver:
+        deadline = time.time() + 2
+        while receiver.frames < count and time.time() < deadline:
+            time.sleep(0.01)
+        receiver.done.set()
+        receiver.join()
+        print(f"  received {receiver.frames}/{count} frames, {receiver.tiles} tiles, "
+              f"{receiver.bytes / max(receiver.frames, 1):.0f} bytes/frame")
+        expect = b"".join(struct.pack(">H", p) for p in frame)
+        print("  final framebuffer matches" if expect == bytes(receiver.fb)
+              else "  final framebuffer MISMATCH")
+
+
+if __name__ == "__main__":
+    main()
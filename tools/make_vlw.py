@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Rasterize a TrueType/OpenType font into a .vlw smooth font for LittleFS.
+
+Writes the same format Processing's "Create Font" produces (read by
+src/vlw_font.cpp): 8-bit alpha glyphs plus metrics, all integers 32-bit
+big-endian. Only the characters you ask for are included, so a font with
+Cyrillic or CJK dates stays small. Needs Pillow (pip install pillow).
+
+  python3 tools/make_vlw.py DejaVuSans.ttf 20 data/fonts/ui.vlw
+  python3 tools/make_vlw.py NotoSansJP.otf 20 data/fonts/ui.vlw --text "月火水木金土日年"
+
+The default set is printable ASCII, Latin-1 and the degree sign; --text
+and --text-file add every character they contain. Upload the data/
+directory with `pio run -t uploadfs`.
+"""
+
+import argparse
+import struct
+import sys
+
+try:
+    from PIL import Image, ImageDraw, ImageFont
+except ImportError:
+    sys.exit("make_vlw.py needs Pillow: pip install pillow")
+
+VLW_VERSION = 11
+DEFAULT_CHARS = [chr(c) for c in range(0x20, 0x7F)] + [chr(c) for c in range(0xA0, 0x100)]
+
+
+def render_glyph(font, ch):
+    """(height, width, x advance, top extent, left extent, alpha bytes)"""
+    advance = int(round(font.getlength(ch)))
+    x0, y0, x1, y1 = font.getbbox(ch, anchor="ls")     # Relative to the baseline origin
+    w, h = max(0, x1 - x0), max(0, y1 - y0)
+    if w == 0 or h == 0:
+        return 0, 0, advance, 0, 0, b""
+
+    img = Image.new("L", (w, h), 0)
+    ImageDraw.Draw(img).text((-x0, -y0), ch, font=font, fill=255, anchor="ls")
+    return h, w, advance, -y0, x0, img.tobytes()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("font", help=".ttf/.otf source")
+    ap.add_argument("size", type=int, help="pixel size")
+    ap.add_argument("out", help="output .vlw")
+    ap.add_argument("--text", default="", help="extra characters to include")
+    ap.add_argument("--text-file", help="UTF-8 file whose characters are included")
+    args = ap.parse_args()
+
+    chars = set(DEFAULT_CHARS)
+    chars.update(args.text)
+    if args.text_file:
+        with open(args.text_file, encoding="utf-8") as f:
+            chars.update(f.read())
+    chars = sorted(c for c in chars if c.isprintable() or c == " ")
+
+    font = ImageFont.truetype(args.font, args.size)
+    ascent, descent = font.getmetrics()
+
+    metrics, bitmaps, missing = [], [], 0
+    for ch in chars:
+        h, w, adv, top, left, alpha = render_glyph(font, ch)
+        if w == 0 and ch != " " and adv == 0:
+            missing += 1
+            continue
+        metrics.append(struct.pack(">7i", ord(ch), h, w, adv, top, left, 0))
+        bitmaps.append(alpha)
+
+    with open(args.out, "wb") as f:
+        f.write(struct.pack(">6i", len(metrics), VLW_VERSION, args.size, 0, ascent, descent))
+        f.write(b"".join(metrics))
+        f.write(b"".join(bitmaps))
+
+    total = 24 + 28 * len(metrics) + sum(len(b) for b in bitmaps)
+    print(f"{args.out}: {len(metrics)} glyphs, {total} bytes"
+          + (f" ({missing} characters not in the source font)" if missing else ""))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Pack weather icon PNGs into run-length encoded RGB565 for flash.
+
+Reads assets/icons/<name>.png (8-bit RGB or RGBA, non-interlaced) for each
+WeatherIcon in enum order, composites onto the black page background and
+writes include/weather_icons.h. Standard library only.
+
+Encoding (decoded by src/rle565.cpp), packets never cross a row:
+  0x80 | (n - 1), hi, lo          run of n pixels (n = 1..128)
+  (n - 1), n x (hi, lo)           n literal pixels
+Pixels are RGB565 big-endian, the byte order the panel expects.
+
+Usage: python3 tools/pack_icons.py
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ICON_DIR = os.path.join(ROOT, "assets", "icons")
+OUT_PATH = os.path.join(ROOT, "include", "weather_icons.h")
+
+# Must match enum WeatherIcon in src/weather.h (ICON_UNKNOWN has no image)
+ICONS = [
+    "clear_day",
+    "clear_night",
+    "partly_cloudy",
+    "cloudy",
+    "fog",
+    "drizzle",
+    "rain",
+    "snow",
+    "thunderstorm",
+]
+
+MAX_PACKET = 128
+
+
+def read_png(path):
+    """Return (width, height, rows of (r, g, b, a) tuples)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path}: not a PNG")
+
+    pos, idat, header = 8, b"", None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if ctype == b"IHDR":
+            header = struct.unpack(">IIBBBBB", body)
+        elif ctype == b"IDAT":
+            idat += body
+        pos += 12 + length
+
+    width, height, depth, color, _, _, interlace = header
+    if depth != 8 or color not in (2, 6) or interlace:
+        sys.exit(f"{path}: need 8-bit RGB/RGBA, non-interlaced")
+
+    bpp = 4 if color == 6 else 3
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    rows, prev = [], bytearray(stride)
+
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        prev = line
+        rows.append([tuple(line[x * bpp:x * bpp + bpp]) + ((255,) if bpp == 3 else ())
+                     for x in range(width)])
+    return width, height, rows
+
+
+def to_rgb565(px):
+    # Composite over black (COL_BG), then quantize
+    r, g, b, a = px
+    r, g, b = r * a // 255, g * a // 255, b * a // 255
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def encode_row(pixels):
+    out = bytearray()
+    i, n = 0, len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_PACKET and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out += bytes([0x80 | (run - 1), pixels[i] >> 8, pixels[i] & 0xFF])
+            i += run
+            continue
+
+        # Literal until the next run of 2+ or the packet limit
+        start = i
+        while i < n and i - start < MAX_PACKET:
+            if i + 1 < n and pixels[i + 1] == pixels[i]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        for p in pixels[start:i]:
+            out += bytes([p >> 8, p & 0xFF])
+    return out
+
+
+def main():
+    images, size = [], None
+    for name in ICONS:
+        w, h, rows = read_png(os.path.join(ICON_DIR, name + ".png"))
+        if size is None:
+            size = (w, h)
+        elif size != (w, h):
+            sys.exit(f"{name}.png: all icons must be {size[0]}x{size[1]}")
+        blob = b"".join(encode_row([to_rgb565(p) for p in row]) for row in rows)
+        images.append((name, blob))
+        print(f"{name:14s} {len(blob):5d} bytes ({100 * len(blob) // (w * h * 2)}% of raw)")
+
+    w, h = size
+    lines = [
+        "// Generated by tools/pack_icons.py from assets/icons/*.png - do not edit",
+        "// Run-length encoded RGB565, see src/rle565.h",
+        "#pragma once",
+        "",
+        f"#define WEATHER_ICON_W {w}",
+        f"#define WEATHER_ICON_H {h}",
+        "",
+    ]
+    for name, blob in images:
+        lines.append(f"const unsigned char ICON_{name.upper()}_RLE[] PROGMEM = {{")
+        for i in range(0, len(blob), 12):
+            lines.append("  " + ", ".join(f"0x{b:02x}" for b in blob[i:i + 12]) + ",")
+        lines.append("};")
+        lines.append("")
+
+    lines.append("// Indexed by WeatherIcon; ICON_UNKNOWN has no image")
+    lines.append("const unsigned char* const WEATHER_ICON_RLE[] = {")
+    lines += [f"  ICON_{name.upper()}_RLE," for name, _ in images]
+    lines.append("};")
+    lines.append("const unsigned int WEATHER_ICON_RLE_LEN[] = {")
+    lines += [f"  {len(blob)}," for _, blob in images]
+    lines.append("};")
+    lines.append(f"const int WEATHER_ICON_COUNT = {len(images)};")
+
+    with open(OUT_PATH, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+    total = sum(len(b) for _, b in images)
+    print(f"total {total} bytes for {len(images)} icons ({w}x{h}), raw would be {len(images) * w * h * 2}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Prepare photos for the SmallTV photo page, upload them, benchmark decoding.
+
+The firmware decodes baseline JPEG and PNG (LovyanGFX: tjpgd and pngle).
+Progressive JPEGs are rejected by tjpgd, and anything bigger than the
+screen is decoded only to be scaled down, so images are fitted into
+240x240 and re-encoded as baseline JPEG (or PNG with --png). Needs Pillow
+(pip install pillow).
+
+  python3 tools/photo_prep.py photos/*.jpg --out data/photos
+  python3 tools/photo_prep.py beach.heic --out /tmp/p --upload 192.168.1.50
+  python3 tools/photo_prep.py photos/*.jpg --bench
+
+--bench decodes each prepared image on this machine the way the firmware
+reads it: fed to an incremental decoder 4 KB at a time (PHOTO_READ_CHUNK),
+and reports size, decode time and throughput next to a one-shot decode.
+Host numbers only rank formats and settings; time on the device itself is
+under `photo` in /api/perf.
+"""
+
+import argparse
+import io
+import os
+import sys
+import time
+import urllib.request
+import uuid
+
+try:
+    from PIL import Image, ImageFile, ImageOps
+except ImportError:
+    sys.exit("photo_prep.py needs Pillow: pip install pillow")
+
+SIZE = 240                      # DISPLAY_WIDTH / DISPLAY_HEIGHT
+NAME_MAX = 31                   # PHOTO_NAME_MAX
+PREFETCH_MAX = 32768            # PHOTO_PREFETCH_MAX
+READ_CHUNK = 4096               # PHOTO_READ_CHUNK
+
+
+def prepare(path, png, quality):
+    """(file name, encoded bytes) for one source image"""
+    img = ImageOps.exif_transpose(Image.open(path)).convert("RGB")
+    img.thumbnail((SIZE, SIZE), Image.LANCZOS)
+
+    buf = io.BytesIO()
+    if png:
+        img.save(buf, "PNG", optimize=True)
+        ext = ".png"
+    else:
+        # Baseline, 4:2:0: the layout tjpgd decodes fastest
+        img.save(buf, "JPEG", quality=quality, progressive=False, optimize=True, subsampling=2)
+        ext = ".jpg"
+
+    stem = os.path.splitext(os.path.basename(path))[0]
+    name = stem[:NAME_MAX - len(ext)] + ext
+    return name, buf.getvalue()
+
+
+def decode_streamed(data):
+    parser = ImageFile.Parser()
+    for pos in range(0, len(data), READ_CHUNK):
+        parser.feed(data[pos:pos + READ_CHUNK])
+    parser.close().load()
+
+
+def decode_once(data):
+    Image.open(io.BytesIO(data)).load()
+
+
+def time_decode(fn, data, repeat):
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        fn(data)
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def bench(items, repeat):
+    print(f"{'name':<32} {'bytes':>7} {'from':>5} {'stream ms':>9} {'MB/s':>7} {'once ms':>8}")
+    total_bytes = total_s = 0.0
+    for name, data in items:
+        streamed = time_decode(decode_streamed, data, repeat)
+        once = time_decode(decode_once, data, repeat)
+        source = "ram" if len(data) <= PREFETCH_MAX else "flash"
+        print(f"{name:<32} {len(data):>7} {source:>5} {streamed * 1e3:>9.2f} "
+              f"{len(data) / streamed / 1e6:>7.1f} {once * 1e3:>8.2f}")
+        total_bytes += len(data)
+        total_s += streamed
+    if items:
+        print(f"{len(items)} images, {total_bytes / len(items):.0f} bytes average, "
+              f"{total_s / len(items) * 1e3:.2f} ms average streamed decode, "
+              f"{total_bytes / total_s / 1e6:.1f} MB/s")
+
+
+def upload(host, name, data):
+    boundary = uuid.uuid4().hex
+    body = (f"--{boundary}\r\nContent-Disposition: form-data; name=\"photo\"; "
+            f"filename=\"{name}\"\r\nContent-Type: application/octet-stream\r\n\r\n").encode()
+    body += data + f"\r\n--{boundary}--\r\n".encode()
+    req = urllib.request.Request(f"http://{host}/api/photos", data=body, method="POST",
+                                 headers={"Content-Type": f"multipart/form-data; boundary={boundary}"})
+    try:
+        with urllib.request.urlopen(req, timeout=30) as resp:
+            return resp.read().decode()
+    except urllib.error.HTTPError as e:
+        return f"HTTP {e.code}: {e.read().decode()}"
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("images", nargs="+", help="source images (anything Pillow opens)")
+    ap.add_argument("--out", help="directory for the prepared files")
+    ap.add_argument("--png", action="store_true", help="PNG instead of baseline JPEG")
+    ap.add_argument("--quality", type=int, default=85, help="JPEG quality (default 85)")
+    ap.add_argument("--upload", metavar="HOST", help="POST each file to http://HOST/api/photos")
+    ap.add_argument("--bench", action="store_true", help="host decode throughput")
+    ap.add_argument("--repeat", type=int, default=5, help="bench runs per image, best kept")
+    args = ap.parse_args()
+
+    items = [prepare(path, args.png, args.quality) for path in args.images]
+
+    if args.out:
+        os.makedirs(args.out, exist_ok=True)
+        for name, data in items:
+            with open(os.path.join(args.out, name), "wb") as f:
+                f.write(data)
+        print(f"wrote {len(items)} files to {args.out}")
+
+    if args.upload:
+        for name, data in items:
+            print(f"{name}: {upload(args.upload, name, data)}")
+
+    if args.bench:
+        bench(items, args.repeat)
+
+
+if __name__ == "__main__":
+    main()
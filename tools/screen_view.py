@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Mirror a SmallTV screen from /api/screen/stream into a PPM file.
+
+The stream is a sequence of remote display packets (src/remote_display.h):
+the first frame carries every tile, later frames only the tiles that
+changed. Each completed frame is written to --out, so an image viewer
+that reloads on change shows the screen live. Standard library only.
+
+  python3 tools/screen_view.py 192.168.1.50 --out screen.ppm
+  python3 tools/screen_view.py 192.168.1.50 --frames 50     # stats only
+"""
+
+import argparse
+import http.client
+import os
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from frame_push import (  # noqa: E402  (same packets, same decoder)
+    ENC_RAW, FLAG_END_OF_FRAME, HEADER, HEIGHT, TILE, TILE_HEADER, WIDTH, decode_rle,
+)
+
+
+def read_exact(resp, n):
+    data = resp.read(n)
+    if len(data) != n:
+        raise EOFError("stream closed")
+    return data
+
+
+def write_ppm(path, fb):
+    out = bytearray()
+    for i in range(0, len(fb), 2):
+        c = (fb[i] << 8) | fb[i + 1]
+        r5, g6, b5 = c >> 11, (c >> 5) & 0x3F, c & 0x1F
+        out += bytes(((r5 << 3) | (r5 >> 2), (g6 << 2) | (g6 >> 4), (b5 << 3) | (b5 >> 2)))
+    tmp = path + ".tmp"
+    with open(tmp, "wb") as f:
+        f.write(b"P6\n%d %d\n255\n" % (WIDTH, HEIGHT))
+        f.write(out)
+    os.replace(tmp, path)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("host")
+    ap.add_argument("--port", type=int, default=80)
+    ap.add_argument("--out", help="PPM file rewritten after every frame")
+    ap.add_argument("--frames", type=int, default=0, help="stop after N frames (0 = run forever)")
+    args = ap.parse_args()
+
+    conn = http.client.HTTPConnection(args.host, args.port, timeout=10)
+    conn.request("GET", "/api/screen/stream")
+    resp = conn.getresponse()
+    if resp.status != 200:
+        sys.exit(f"stream refused: {resp.status} {resp.read().decode(errors='replace')}")
+
+    fb = bytearray(WIDTH * HEIGHT * 2)
+    frames = tiles = total = frame_bytes = 0
+    start = time.perf_counter()
+
+    try:
+        while not args.frames or frames < args.frames:
+            head = read_exact(resp, HEADER.size)
+            magic, ver, flags, seq, count, _ = HEADER.unpack(head)
+            if magic != b"ST" or ver != 1:
+                sys.exit("bad packet header, stream out of sync")
+            frame_bytes += HEADER.size
+
+            for _ in range(count):
+                tx, ty, enc, _, plen = TILE_HEADER.unpack(read_exact(resp, TILE_HEADER.size))
+                payload = read_exact(resp, plen)
+                frame_bytes += TILE_HEADER.size + plen
+                px = payload if enc == ENC_RAW else decode_rle(payload)
+                for row in range(TILE):
+                    dst = ((ty * TILE + row) * WIDTH + tx * TILE) * 2
+                    fb[dst:dst + TILE * 2] = px[row * TILE * 2:(row + 1) * TILE * 2]
+                tiles += 1
+
+            if flags & FLAG_END_OF_FRAME:
+                frames += 1
+                total += frame_bytes
+                print(f"frame {seq}: {frame_bytes} bytes")
+                frame_bytes = 0
+                if args.out:
+                    write_ppm(args.out, fb)
+    except (EOFError, KeyboardInterrupt):
+        pass
+
+    elapsed = time.perf_counter() - start
+    print(f"{frames} frames, {tiles} tiles, {total} bytes in {elapsed:.1f} s "
+          f"({frames / max(elapsed, 1e-9):.1f} frames/s, {total / max(frames, 1):.0f} bytes/frame)")
+
+
+if __name__ == "__main__":
+    main()